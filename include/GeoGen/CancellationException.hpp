@@ -0,0 +1,49 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+#include "ErrorCode.hpp"
+#include "GeoGenException.hpp"
+
+namespace geogen
+{
+	/// Exception thrown when rendering is interrupted because its genlib::CancellationToken was cancelled or its deadline passed.
+	class CancellationException : public GeoGenException
+	{
+	private:
+		bool isDeadlineExceeded;
+	public:
+		/// Constructor.
+		/// @param isDeadlineExceeded Whether the token was cancelled by its deadline rather than explicitly.
+		explicit CancellationException(bool isDeadlineExceeded) :
+			GeoGenException(GGE3002_RendererCancelled), isDeadlineExceeded(isDeadlineExceeded) {};
+
+		virtual ~CancellationException() throw () {}
+
+		/// Determines whether the token was cancelled by its deadline rather than explicitly.
+		/// @return true if the deadline passed, false otherwise.
+		bool IsDeadlineExceeded() const
+		{
+			return this->isDeadlineExceeded;
+		}
+
+		virtual String GetDetailMessage()
+		{
+			return this->isDeadlineExceeded ? GG_STR("Rendering didn't finish before its deadline.") : GG_STR("Rendering was cancelled.");
+		};
+	};
+}
\ No newline at end of file
@@ -0,0 +1,59 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+#include "Serializable.hpp"
+#include "random/RandomSeed.hpp"
+
+namespace geogen
+{
+	/// Levels of optimization the Compiler may apply to the generated code. Optimizations never change observable behavior of the script (including any runtime errors it triggers).
+	enum OptimizationLevel
+	{
+		/// The code is executed exactly as it was generated from the script.
+		OPTIMIZATION_LEVEL_NONE,
+		/// Operators applied to constants are evaluated during compilation and unreachable code is removed.
+		OPTIMIZATION_LEVEL_BASIC,
+		/// Same as OPTIMIZATION_LEVEL_BASIC, additionally removes local variables which are never read.
+		OPTIMIZATION_LEVEL_FULL
+	};
+
+	/// Settings allowing to slightly customize behavior of the generator.
+	class Configuration : public Serializable
+	{
+	public:
+		/// If this setting is set to true, the Compiler and VirtualMachine trigger errors if the script doesn't yield the main map. Default: true.
+		bool MainMapIsMandatory;
+
+		/// Maximum sum of memory footprints of all the maps allocated simultaneously by the Renderer, in bytes. Default: 100 MiB.
+		unsigned long RendererMemoryLimit;
+
+		/// Optimizations the Compiler applies to the generated code. Default: OPTIMIZATION_LEVEL_FULL.
+		OptimizationLevel CompilerOptimizationLevel;
+
+		/// Scheme used to derive layers of noises and steps of random sequences from the random seed. Changing the scheme changes the generated maps. Default: random::RANDOM_SEED_SCHEME_SEQUENTIAL.
+		random::RandomSeedScheme SeedScheme;
+
+		Configuration() :
+			MainMapIsMandatory(true),
+			RendererMemoryLimit(100 * 1024 * 1024),
+			CompilerOptimizationLevel(OPTIMIZATION_LEVEL_FULL),
+			SeedScheme(random::RANDOM_SEED_SCHEME_SEQUENTIAL) {};
+
+		virtual void Serialize(IOStream& stream) const;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,383 @@
+#pragma once
+
+/// @file GeoGen.hpp Header file used for including GeoGen into other projects.
+// Machine generated file, do not edit.
+
+#include "ApiUsageException.hpp"
+#include "CancellationException.hpp"
+#include "CodeLocation.hpp"
+#include "Configuration.hpp"
+#include "Direction.hpp"
+#include "Documentation.hpp"
+#include "ErrorCode.hpp"
+#include "GeoGenException.hpp"
+#include "InternalErrorException.hpp"
+#include "Interval.hpp"
+#include "Number.hpp"
+#include "Point.hpp"
+#include "Rectangle.hpp"
+#include "RescaleFilter.hpp"
+#include "Serializable.hpp"
+#include "Size.hpp"
+#include "String.hpp"
+#include "compiler/CodeOptimizer.hpp"
+#include "compiler/Compiler.hpp"
+#include "compiler/CompilerException.hpp"
+#include "compiler/IncorrectEnumScriptParameterTypeException.hpp"
+#include "compiler/IncorrectMapSizeNumericValueException.hpp"
+#include "compiler/IncorrectMetadataValueTypeException.hpp"
+#include "compiler/IncorrectScriptParameterAttributeTypeException.hpp"
+#include "compiler/IncorrectScriptParameterValueRestrictionException.hpp"
+#include "compiler/InvalidBreakException.hpp"
+#include "compiler/InvalidContinueException.hpp"
+#include "compiler/InvalidEscapeSequenceException.hpp"
+#include "compiler/InvalidReturnException.hpp"
+#include "compiler/InvalidSymbolDefinitionException.hpp"
+#include "compiler/MainMapNotSupportedByScriptException.hpp"
+#include "compiler/MetadataKeyRedefinitionException.hpp"
+#include "compiler/MinGreaterThanMaxSizeException.hpp"
+#include "compiler/ReadOnlyExpressionWriteException.hpp"
+#include "compiler/ReservedScriptParameterNameException.hpp"
+#include "compiler/ScriptParameterTypeNotSpecifiedException.hpp"
+#include "compiler/SymbolRedefinitionException.hpp"
+#include "compiler/UndefinedMetadataIdentifierException.hpp"
+#include "compiler/UnexpectedCharacterException.hpp"
+#include "compiler/UnexpectedTokenException.hpp"
+#include "corelib/ArithmeticAssignmentOperatorFunctionDefinition.hpp"
+#include "corelib/ArrayContainsFunctionDefinition.hpp"
+#include "corelib/ArrayCountFunctionDefinition.hpp"
+#include "corelib/ArrayEmptyFunctionDefinition.hpp"
+#include "corelib/ArrayFromListFunctionDefinition.hpp"
+#include "corelib/ArrayFrontBackFunctionDefinition.hpp"
+#include "corelib/ArrayGetFunctionDefinition.hpp"
+#include "corelib/ArrayGetKeyByIndexFunctionDefinition.hpp"
+#include "corelib/ArrayGetRefFunctionDefinition.hpp"
+#include "corelib/ArrayGetValueByIndexFunctionDefinition.hpp"
+#include "corelib/ArrayIndexNotFoundException.hpp"
+#include "corelib/ArrayItemReferenceObject.hpp"
+#include "corelib/ArrayKeyNotFoundException.hpp"
+#include "corelib/ArrayObject.hpp"
+#include "corelib/ArrayPushBackFunctionDefinition.hpp"
+#include "corelib/ArrayRemoveFunctionDefinition.hpp"
+#include "corelib/ArrayRepeatFunctionDefinition.hpp"
+#include "corelib/ArraySetFunctionDefinition.hpp"
+#include "corelib/ArrayShuffleFunctionDefinition.hpp"
+#include "corelib/ArraySortByKeysFunctionDefinition.hpp"
+#include "corelib/ArraySortByValuesFunctionDefinition.hpp"
+#include "corelib/ArrayTypeDefinition.hpp"
+#include "corelib/AssignmentOperatorFunctionDefinition.hpp"
+#include "corelib/BinaryArithmeticOperatorFunctionDefinition.hpp"
+#include "corelib/BitLogicAssignmentOperatorFunctionDefinition.hpp"
+#include "corelib/BitLogicOperatorFunctionDefinition.hpp"
+#include "corelib/BooleanTypeDefinition.hpp"
+#include "corelib/CoordinateFromNumberFunctionDefinition.hpp"
+#include "corelib/CoordinateObject.hpp"
+#include "corelib/CoordinateOverflowException.hpp"
+#include "corelib/CoordinateTypeDefinition.hpp"
+#include "corelib/CoreLibrary.hpp"
+#include "corelib/CreateNoiseLayersFunctionDefinition.hpp"
+#include "corelib/DirectionTypeDefinition.hpp"
+#include "corelib/DivisionByZeroException.hpp"
+#include "corelib/EnumFromNumberFunctionDefinition.hpp"
+#include "corelib/EnumTypeDefinition.hpp"
+#include "corelib/EqualityOperatorFunctionDefinition.hpp"
+#include "corelib/HeightMapAbsFunctionDefinition.hpp"
+#include "corelib/HeightMapAbsRenderingStep.hpp"
+#include "corelib/HeightMapAddFunctionDefinition.hpp"
+#include "corelib/HeightMapAddMapRenderingStep.hpp"
+#include "corelib/HeightMapAddRenderingStep.hpp"
+#include "corelib/HeightMapBlurFunctionDefinition.hpp"
+#include "corelib/HeightMapBlurRenderingStep.hpp"
+#include "corelib/HeightMapCellNoiseFunctionDefinition.hpp"
+#include "corelib/HeightMapCellNoiseRenderingStep.hpp"
+#include "corelib/HeightMapClampHeightsFunctionDefinition.hpp"
+#include "corelib/HeightMapClampHeightsRenderingStep.hpp"
+#include "corelib/HeightMapCloneFunctionDefinition.hpp"
+#include "corelib/HeightMapCloneRenderingStep.hpp"
+#include "corelib/HeightMapCombineFunctionDefinition.hpp"
+#include "corelib/HeightMapCombineRenderingStep.hpp"
+#include "corelib/HeightMapConvexityMapFunctionDefinition.hpp"
+#include "corelib/HeightMapConvexityMapRenderingStep.hpp"
+#include "corelib/HeightMapCropFunctionDefinition.hpp"
+#include "corelib/HeightMapCropHeightsFunctionDefinition.hpp"
+#include "corelib/HeightMapCropHeightsRenderingStep.hpp"
+#include "corelib/HeightMapCropRenderingStep.hpp"
+#include "corelib/HeightMapDistanceMapFunctionDefinition.hpp"
+#include "corelib/HeightMapDistanceMapRenderingStep.hpp"
+#include "corelib/HeightMapDistortFunctionDefinition.hpp"
+#include "corelib/HeightMapDistortRenderingStep.hpp"
+#include "corelib/HeightMapDrawLineFunctionDefinition.hpp"
+#include "corelib/HeightMapDrawPrimitivesRenderingStep.hpp"
+#include "corelib/HeightMapFillFunctionDefinition.hpp"
+#include "corelib/HeightMapFillRectangleFunctionDefinition.hpp"
+#include "corelib/HeightMapFillRectangleRenderingStep.hpp"
+#include "corelib/HeightMapFlatFunctionDefinition.hpp"
+#include "corelib/HeightMapFlatRenderingStep.hpp"
+#include "corelib/HeightMapFlipFunctionDefinition.hpp"
+#include "corelib/HeightMapGlaciateFunctionDefinition.hpp"
+#include "corelib/HeightMapGlaciateRenderingStep.hpp"
+#include "corelib/HeightMapGradientFunctionDefinition.hpp"
+#include "corelib/HeightMapGradientRenderingStep.hpp"
+#include "corelib/HeightMapIntersectFunctionDefinition.hpp"
+#include "corelib/HeightMapIntersectRenderingStep.hpp"
+#include "corelib/HeightMapInvertFunctionDefinition.hpp"
+#include "corelib/HeightMapInvertRenderingStep.hpp"
+#include "corelib/HeightMapMoveFunctionDefinition.hpp"
+#include "corelib/HeightMapMoveRenderingStep.hpp"
+#include "corelib/HeightMapMultiplyFunctionDefinition.hpp"
+#include "corelib/HeightMapMultiplyMapRenderingStep.hpp"
+#include "corelib/HeightMapMultiplyRenderingStep.hpp"
+#include "corelib/HeightMapNoiseFunctionDefinition.hpp"
+#include "corelib/HeightMapNoiseLayersRenderingStep.hpp"
+#include "corelib/HeightMapNoiseRenderingStep.hpp"
+#include "corelib/HeightMapPatternFunctionDefinition.hpp"
+#include "corelib/HeightMapPatternRenderingStep.hpp"
+#include "corelib/HeightMapProjectionFunctionDefinition.hpp"
+#include "corelib/HeightMapProjectionRenderingStep.hpp"
+#include "corelib/HeightMapRadialGradientFunctionDefinition.hpp"
+#include "corelib/HeightMapRadialGradientRenderingStep.hpp"
+#include "corelib/HeightMapRescaleFunctionDefinition.hpp"
+#include "corelib/HeightMapRescaleRenderingStep.hpp"
+#include "corelib/HeightMapRidgedNoiseFunctionDefinition.hpp"
+#include "corelib/HeightMapRotateFunctionDefinition.hpp"
+#include "corelib/HeightMapShearFunctionDefinition.hpp"
+#include "corelib/HeightMapShiftFunctionDefinition.hpp"
+#include "corelib/HeightMapShiftRenderingStep.hpp"
+#include "corelib/HeightMapSimplexNoiseFunctionDefinition.hpp"
+#include "corelib/HeightMapSimplexNoiseRenderingStep.hpp"
+#include "corelib/HeightMapStratifyFunctionDefinition.hpp"
+#include "corelib/HeightMapStratifyRenderingStep.hpp"
+#include "corelib/HeightMapTransformFunctionDefinition.hpp"
+#include "corelib/HeightMapTransformHeightsFunctionDefinition.hpp"
+#include "corelib/HeightMapTransformHeightsRenderingStep.hpp"
+#include "corelib/HeightMapTransformRenderingStep.hpp"
+#include "corelib/HeightMapTypeDefinition.hpp"
+#include "corelib/HeightMapUnifyFunctionDefinition.hpp"
+#include "corelib/HeightMapUnifyRenderingStep.hpp"
+#include "corelib/HeightOverflowException.hpp"
+#include "corelib/HeightProfileAbsFunctionDefinition.hpp"
+#include "corelib/HeightProfileAbsRenderingStep.hpp"
+#include "corelib/HeightProfileAddFunctionDefinition.hpp"
+#include "corelib/HeightProfileAddProfileRenderingStep.hpp"
+#include "corelib/HeightProfileAddRenderingStep.hpp"
+#include "corelib/HeightProfileBlurFunctionDefinition.hpp"
+#include "corelib/HeightProfileBlurRenderingStep.hpp"
+#include "corelib/HeightProfileClampHeightsFunctionDefinition.hpp"
+#include "corelib/HeightProfileClampHeightsRenderingStep.hpp"
+#include "corelib/HeightProfileCombineFunctionDefinition.hpp"
+#include "corelib/HeightProfileCombineRenderingStep.hpp"
+#include "corelib/HeightProfileCropFunctionDefinition.hpp"
+#include "corelib/HeightProfileCropHeightsFunctionDefinition.hpp"
+#include "corelib/HeightProfileCropHeightsRenderingStep.hpp"
+#include "corelib/HeightProfileCropRenderingStep.hpp"
+#include "corelib/HeightProfileFillFunctionDefinition.hpp"
+#include "corelib/HeightProfileFillIntervalFunctionDefinition.hpp"
+#include "corelib/HeightProfileFillIntervalRenderingStep.hpp"
+#include "corelib/HeightProfileFlatFunctionDefinition.hpp"
+#include "corelib/HeightProfileFlatRenderingStep.hpp"
+#include "corelib/HeightProfileFlipFunctionDefinition.hpp"
+#include "corelib/HeightProfileFlipRenderingStep.hpp"
+#include "corelib/HeightProfileFromArrayFunctionDefinition.hpp"
+#include "corelib/HeightProfileFromArrayRenderingStep.hpp"
+#include "corelib/HeightProfileGradientFunctionDefinition.hpp"
+#include "corelib/HeightProfileGradientRenderingStep.hpp"
+#include "corelib/HeightProfileIntersectFunctionDefinition.hpp"
+#include "corelib/HeightProfileIntersectRenderingStep.hpp"
+#include "corelib/HeightProfileInvertFunctionDefinition.hpp"
+#include "corelib/HeightProfileInvertRenderingStep.hpp"
+#include "corelib/HeightProfileMoveFunctionDefinition.hpp"
+#include "corelib/HeightProfileMoveRenderingStep.hpp"
+#include "corelib/HeightProfileMultiplyFunctionDefinition.hpp"
+#include "corelib/HeightProfileMultiplyProfileRenderingStep.hpp"
+#include "corelib/HeightProfileMultiplyRenderingStep.hpp"
+#include "corelib/HeightProfileNoiseFunctionDefinition.hpp"
+#include "corelib/HeightProfileNoiseLayersRenderingStep.hpp"
+#include "corelib/HeightProfilePatternFunctionDefinition.hpp"
+#include "corelib/HeightProfilePatternRenderingStep.hpp"
+#include "corelib/HeightProfileRescaleFunctionDefinition.hpp"
+#include "corelib/HeightProfileRescaleRenderingStep.hpp"
+#include "corelib/HeightProfileSliceFunctionDefinition.hpp"
+#include "corelib/HeightProfileSliceRenderingStep.hpp"
+#include "corelib/HeightProfileTypeDefinition.hpp"
+#include "corelib/HeightProfileUnifyFunctionDefinition.hpp"
+#include "corelib/HeightProfileUnifyRenderingStep.hpp"
+#include "corelib/IncrementDecrementOperatorFunctionDefinition.hpp"
+#include "corelib/IndexerWriteFunctionDefinition.hpp"
+#include "corelib/InvalidEnumValueException.hpp"
+#include "corelib/InvalidNumberOfStrataException.hpp"
+#include "corelib/InvalidOperationOnEmptyArrayException.hpp"
+#include "corelib/InvalidPersistenceException.hpp"
+#include "corelib/InvalidScaleException.hpp"
+#include "corelib/InvalidStrengthException.hpp"
+#include "corelib/InvalidTransformationMatrixException.hpp"
+#include "corelib/LogicalOperatorFunctionDefinition.hpp"
+#include "corelib/MathAtan2FunctionDefinition.hpp"
+#include "corelib/MathDefinitionRangeException.hpp"
+#include "corelib/MathLogPowFunctionDefinition.hpp"
+#include "corelib/MathMinMaxFunctionDefinition.hpp"
+#include "corelib/MathRoundFunctionDefinition.hpp"
+#include "corelib/MathSqrtFunctionDefinition.hpp"
+#include "corelib/MathTrigonometricFunctionDefinition.hpp"
+#include "corelib/MaxLessThanMinException.hpp"
+#include "corelib/MessageFunctionDefinition.hpp"
+#include "corelib/NegationOperatorFunctionDefinition.hpp"
+#include "corelib/NonpositiveNoiseLayerAmplitudeException.hpp"
+#include "corelib/NonpositiveNoiseLayerWaveLengthException.hpp"
+#include "corelib/NullKeyException.hpp"
+#include "corelib/NullTypeDefinition.hpp"
+#include "corelib/NumberFromCoordinateFunctionDefinition.hpp"
+#include "corelib/NumberFromEnumFunctionDefinition.hpp"
+#include "corelib/NumberTypeDefinition.hpp"
+#include "corelib/ParametersTypeDefinition.hpp"
+#include "corelib/ParseNoiseInput.hpp"
+#include "corelib/PointCreateFunctionDefinition.hpp"
+#include "corelib/PointObject.hpp"
+#include "corelib/PointTypeDefinition.hpp"
+#include "corelib/RandomFunctionDefinition.hpp"
+#include "corelib/RandomSequence2DAdvanceFunctionDefinition.hpp"
+#include "corelib/RandomSequence2DCreateFunctionDefinition.hpp"
+#include "corelib/RandomSequence2DGetNumberFunctionDefinition.hpp"
+#include "corelib/RandomSequence2DObject.hpp"
+#include "corelib/RandomSequence2DTypeDefinition.hpp"
+#include "corelib/ReferenceObject.hpp"
+#include "corelib/ReferenceTypeDefinition.hpp"
+#include "corelib/RelationalOperatorFunctionDefinition.hpp"
+#include "corelib/RelativeCoordinateInInfiniteDimensionException.hpp"
+#include "corelib/RelativeCoordinateOperatorFunctionDefinition.hpp"
+#include "corelib/RendererTypeDefinition.hpp"
+#include "corelib/RescaleFilterTypeDefinition.hpp"
+#include "corelib/ScopeVariableReferenceObject.hpp"
+#include "corelib/SizeOverflowException.hpp"
+#include "corelib/StringFormatException.hpp"
+#include "corelib/StringTypeDefinition.hpp"
+#include "corelib/UnaryArithmeticOperatorFunctionDefinition.hpp"
+#include "corelib/UnknownRelativeCoordinateDirectionException.hpp"
+#include "corelib/YieldRenderingStep.hpp"
+#include "genlib/BilinearSampler.hpp"
+#include "genlib/CancellationToken.hpp"
+#include "genlib/CommonProfileFactory.hpp"
+#include "genlib/DataObject.hpp"
+#include "genlib/HeightMap.hpp"
+#include "genlib/HeightMapPrimitive.hpp"
+#include "genlib/HeightProfile.hpp"
+#include "genlib/HeightSpanKernels.hpp"
+#include "genlib/MemoryTracker.hpp"
+#include "genlib/NoiseLayersFactory.hpp"
+#include "genlib/ResamplingKernel.hpp"
+#include "genlib/SimplexNoise.hpp"
+#include "genlib/TransformationMatrix.hpp"
+#include "random/Hash.hpp"
+#include "random/RandomSeed.hpp"
+#include "random/RandomSequence.hpp"
+#include "random/RandomSequence2D.hpp"
+#include "random/mtrand/MTRand.hpp"
+#include "renderer/MemoryLimitException.hpp"
+#include "renderer/ProgressiveRenderer.hpp"
+#include "renderer/RenderedMap.hpp"
+#include "renderer/RenderedMapTable.hpp"
+#include "renderer/Renderer.hpp"
+#include "renderer/RendererException.hpp"
+#include "renderer/RendererMetrics.hpp"
+#include "renderer/RendererObject.hpp"
+#include "renderer/RendererObjectSlotTable.hpp"
+#include "renderer/RendererObjectTable.hpp"
+#include "renderer/RendererObserver.hpp"
+#include "renderer/RenderingBounds.hpp"
+#include "renderer/RenderingBounds1D.hpp"
+#include "renderer/RenderingBounds2D.hpp"
+#include "renderer/RenderingGraph.hpp"
+#include "renderer/RenderingGraphNode.hpp"
+#include "renderer/RenderingSequence.hpp"
+#include "renderer/RenderingSequenceMetadata.hpp"
+#include "renderer/RenderingStep.hpp"
+#include "renderer/RenderingStep1D.hpp"
+#include "renderer/RenderingStep2D.hpp"
+#include "renderer/TileGenerator.hpp"
+#include "runtime/BooleanScriptParameter.hpp"
+#include "runtime/CallStack.hpp"
+#include "runtime/CallStackEntry.hpp"
+#include "runtime/CodeBlock.hpp"
+#include "runtime/CodeBlockStack.hpp"
+#include "runtime/CodeBlockStackEntry.hpp"
+#include "runtime/CompiledScript.hpp"
+#include "runtime/EnumScriptParameter.hpp"
+#include "runtime/FunctionDefinition.hpp"
+#include "runtime/GlobalNativeFunctionDefinition.hpp"
+#include "runtime/IncorrectTypeException.hpp"
+#include "runtime/InlineCacheEntry.hpp"
+#include "runtime/InlineCacheStatistics.hpp"
+#include "runtime/IntermediateCodeException.hpp"
+#include "runtime/Library.hpp"
+#include "runtime/MainMapNotGeneratedException.hpp"
+#include "runtime/ManagedObject.hpp"
+#include "runtime/ManagedObjectHolder.hpp"
+#include "runtime/MemberNativeFunctionDefinition.hpp"
+#include "runtime/MemoryManager.hpp"
+#include "runtime/MetadataBoolean.hpp"
+#include "runtime/MetadataIdentifier.hpp"
+#include "runtime/MetadataKeyValueCollection.hpp"
+#include "runtime/MetadataList.hpp"
+#include "runtime/MetadataNumber.hpp"
+#include "runtime/MetadataString.hpp"
+#include "runtime/MetadataValue.hpp"
+#include "runtime/NativeArgumentList.hpp"
+#include "runtime/NullReferenceException.hpp"
+#include "runtime/NumberOfArgumentsException.hpp"
+#include "runtime/NumberOverflowException.hpp"
+#include "runtime/NumberScriptParameter.hpp"
+#include "runtime/NumberUnderflowException.hpp"
+#include "runtime/ObjectId.hpp"
+#include "runtime/ObjectStack.hpp"
+#include "runtime/PrimitiveObject.hpp"
+#include "runtime/ReadOnlyWriteException.hpp"
+#include "runtime/RendererObjectStub.hpp"
+#include "runtime/RenderingSequenceTooLongException.hpp"
+#include "runtime/RuntimeException.hpp"
+#include "runtime/ScriptFunctionDefinition.hpp"
+#include "runtime/ScriptParameter.hpp"
+#include "runtime/ScriptParameters.hpp"
+#include "runtime/ScriptProfiler.hpp"
+#include "runtime/StackOverflowException.hpp"
+#include "runtime/StaticObject.hpp"
+#include "runtime/SymbolDefinitionException.hpp"
+#include "runtime/SymbolDefinitionTable.hpp"
+#include "runtime/TypeDefinition.hpp"
+#include "runtime/UndefinedSymbolAccessException.hpp"
+#include "runtime/UserErrorException.hpp"
+#include "runtime/VariableDefinition.hpp"
+#include "runtime/VariableRedefinitionException.hpp"
+#include "runtime/VariableTable.hpp"
+#include "runtime/VariableTableItem.hpp"
+#include "runtime/VirtualMachine.hpp"
+#include "runtime/VirtualMachineStatusGuard.hpp"
+#include "runtime/instructions/BreakInstruction.hpp"
+#include "runtime/instructions/CallBlockInstruction.hpp"
+#include "runtime/instructions/CallGlobalInstruction.hpp"
+#include "runtime/instructions/CallMemberInstruction.hpp"
+#include "runtime/instructions/ContinueInstruction.hpp"
+#include "runtime/instructions/DeclareGlobalValueInstruction.hpp"
+#include "runtime/instructions/DeclareLocalValueInstruction.hpp"
+#include "runtime/instructions/IfInstruction.hpp"
+#include "runtime/instructions/Instruction.hpp"
+#include "runtime/instructions/LoadConstBooleanInstruction.hpp"
+#include "runtime/instructions/LoadConstNumberInstruction.hpp"
+#include "runtime/instructions/LoadConstStringInstruction.hpp"
+#include "runtime/instructions/LoadMemberValueInstruction.hpp"
+#include "runtime/instructions/LoadNullInstruction.hpp"
+#include "runtime/instructions/LoadScopeReferenceInstruction.hpp"
+#include "runtime/instructions/LoadScopeValueInstruction.hpp"
+#include "runtime/instructions/PopInstruction.hpp"
+#include "runtime/instructions/StoreGlobalValueInstruction.hpp"
+#include "runtime/instructions/StoreMemberValueInstruction.hpp"
+#include "runtime/instructions/StoreReferenceInstruction.hpp"
+#include "runtime/instructions/StoreScopeValueInstruction.hpp"
+#include "runtime/instructions/WhileInstruction.hpp"
+#include "runtime/instructions/YieldAsNamedInstruction.hpp"
+#include "testlib/AssertEqualsFunctionDefinition.hpp"
+#include "testlib/AssertionFailedException.hpp"
+#include "testlib/TestLibrary.hpp"
+#include "utils/CpuClock.hpp"
+#include "utils/OwningMap.hpp"
+#include "utils/SimdSupport.hpp"
+#include "utils/StringUtils.hpp"
+#include "utils/WallClock.hpp"
@@ -0,0 +1,61 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+#include <vector>
+
+#include "../corelib/NumberTypeDefinition.hpp"
+#include "../runtime/GlobalNativeFunctionDefinition.hpp"
+#include "../CodeLocation.hpp"
+
+namespace geogen
+{
+	namespace runtime
+	{
+		class ManagedObject;
+	}
+
+	namespace corelib
+	{        
+		class EqualityOperatorFunctionDefinition : public runtime::GlobalNativeFunctionDefinition
+		{
+		public:
+			enum Operator
+			{
+				EQUAL_TO,
+				NOT_EQUAL_TO
+			};
+		private:
+			typedef bool(*Function)(CodeLocation location, runtime::ManagedObject*, runtime::ManagedObject*);
+
+			static bool CallOperatorEqualTo(CodeLocation location, runtime::ManagedObject*, runtime::ManagedObject*);
+			static bool CallOperatorNotEqualTo(CodeLocation location, runtime::ManagedObject*, runtime::ManagedObject*);
+
+			Function function;
+
+			EqualityOperatorFunctionDefinition(String const& name, Function function) : GlobalNativeFunctionDefinition(name), function(function)
+			{
+			};
+		public:
+			static EqualityOperatorFunctionDefinition* Create(Operator op);
+
+			virtual FunctionType GetFunctionType() const { return FUNCTION_TYPE_OPERATOR; }
+
+			virtual runtime::ManagedObject* CallNative(CodeLocation location, runtime::VirtualMachine* vm, runtime::NativeArgumentList& arguments) const;
+		};
+	}
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+#include <vector>
+
+#include "../Number.hpp"
+#include "../renderer/RenderingStep2D.hpp"
+#include "../renderer/RenderingSequence.hpp"
+#include "../genlib/HeightMapPrimitive.hpp"
+
+namespace geogen
+{
+	namespace corelib
+	{
+		class HeightMapDrawPrimitivesRenderingStep : public renderer::RenderingStep2D
+		{
+		private:
+			std::vector<genlib::HeightMapPrimitive> primitives;
+		public:
+			HeightMapDrawPrimitivesRenderingStep(CodeLocation location, std::vector<unsigned> const& argumentSlots, unsigned returnSlot, genlib::HeightMapPrimitive const& primitive)
+				: RenderingStep2D(location, argumentSlots, returnSlot), primitives(1, primitive) {};
+
+			/// Appends a primitive to the last step of a sequence, if it is a HeightMapDrawPrimitivesRenderingStep drawing into the same slot. Consecutive draw calls on the same map are batched this way, so they occupy a single step.
+			/// @param sequence The rendering sequence.
+			/// @param slot The object slot of the map.
+			/// @param primitive The primitive.
+			/// @return True if the primitive was appended, false if a new step has to be added.
+			static bool TryAppendPrimitive(renderer::RenderingSequence& sequence, unsigned slot, genlib::HeightMapPrimitive const& primitive);
+
+			inline std::vector<genlib::HeightMapPrimitive> const& GetPrimitives() const { return this->primitives; }
+
+			virtual String GetName() const { return GG_STR("HeightMap.DrawPrimitives"); };
+
+			virtual void Step(renderer::Renderer* renderer) const;
+
+			virtual void SerializeArguments(IOStream& stream) const;
+		};
+	}
+}
\ No newline at end of file
@@ -23,17 +23,15 @@ namespace geogen
 {
 	namespace corelib
 	{
-		class HeightMapDrawLineRenderingStep : public renderer::RenderingStep2D
+		class HeightMapMultiplyRenderingStep : public renderer::RenderingStep2D
 		{
 		private:
-			Point start;
-			Point end;
-			Height height;
+			double factor;
 		public:
-			HeightMapDrawLineRenderingStep(CodeLocation location, std::vector<unsigned> const& argumentSlots, unsigned returnSlot, Point start, Point end, Height height)
-				: RenderingStep2D(location, argumentSlots, returnSlot), start(start), end(end), height(height) {};
+			HeightMapMultiplyRenderingStep(CodeLocation location, std::vector<unsigned> const& argumentSlots, unsigned returnSlot, double factor)
+				: RenderingStep2D(location, argumentSlots, returnSlot), factor(factor) {};
 
-			virtual String GetName() const { return GG_STR("HeightMap.DrawLine"); };
+			virtual String GetName() const { return GG_STR("HeightMap.Multiply"); };
 
 			virtual void Step(renderer::Renderer* renderer) const;
 
@@ -16,27 +16,31 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 
 #pragma once
 
+#include <map>
+
 #include "../Number.hpp"
-#include "../genlib/NoiseLayersFactory.hpp"
+#include "../renderer/RenderingStep2D.hpp"
 #include "../random/RandomSeed.hpp"
-#include "../renderer/RenderingStep1D.hpp"
+#include "../genlib/NoiseLayersFactory.hpp"
 
 namespace geogen
 {
 	namespace corelib
 	{
-		class HeightProfileNoiseRenderingStep : public renderer::RenderingStep1D
+		class HeightMapNoiseRenderingStep : public renderer::RenderingStep2D
 		{
 		private:
 			Size1D waveLength;
 			Height amplitude;
 			random::RandomSeed seed;
 			unsigned seedStep;
+			bool isRidged;
+			random::RandomSeedScheme seedScheme;
 		public:
-			HeightProfileNoiseRenderingStep(CodeLocation location, std::vector<unsigned> const& argumentSlots, unsigned returnSlot, Size1D waveLength, Height amplitude, random::RandomSeed seed, unsigned seedStep)
-				: RenderingStep1D(location, argumentSlots, returnSlot), waveLength(waveLength), amplitude(amplitude), seed(seed), seedStep(seedStep) {};
+			HeightMapNoiseRenderingStep(CodeLocation location, std::vector<unsigned> const& argumentSlots, unsigned returnSlot, Size1D waveLength, Height amplitude, random::RandomSeed seed, unsigned seedStep, bool isRidged, random::RandomSeedScheme seedScheme)
+				: RenderingStep2D(location, argumentSlots, returnSlot), waveLength(waveLength), amplitude(amplitude), seed(seed), seedStep(seedStep), isRidged(isRidged), seedScheme(seedScheme) {};
 
-			virtual String GetName() const { return GG_STR("HeightProfile.NoiseLayer"); };
+			virtual String GetName() const { return GG_STR("HeightMap.NoiseLayer"); };
 
 			virtual void Step(renderer::Renderer* renderer) const;
 
@@ -0,0 +1,47 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+#include "../Number.hpp"
+#include "../renderer/RenderingStep1D.hpp"
+#include "../random/RandomSeed.hpp"
+#include "../genlib/NoiseLayersFactory.hpp"
+
+namespace geogen
+{
+	namespace corelib
+	{
+		class HeightProfileNoiseLayersRenderingStep : public renderer::RenderingStep1D
+		{
+		private:
+			genlib::NoiseLayers layers;
+			random::RandomSeed seed;
+			random::RandomSeedScheme seedScheme;
+		public:
+			HeightProfileNoiseLayersRenderingStep(CodeLocation location, std::vector<unsigned> const& argumentSlots, unsigned returnSlot, genlib::NoiseLayers const& layers, random::RandomSeed seed, random::RandomSeedScheme seedScheme)
+				: RenderingStep1D(location, argumentSlots, returnSlot), layers(layers), seed(seed), seedScheme(seedScheme) {};
+
+			virtual String GetName() const { return GG_STR("HeightProfile.NoiseLayers"); };
+
+			virtual void Step(renderer::Renderer* renderer) const;
+
+			virtual unsigned GetPeakExtraMemory(renderer::Renderer* renderer, std::vector<renderer::RenderingBounds const*> argumentBounds) const;
+
+			virtual void SerializeArguments(IOStream& stream) const;
+		};
+	}
+}
\ No newline at end of file
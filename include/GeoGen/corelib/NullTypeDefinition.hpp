@@ -0,0 +1,45 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+#include "../runtime/TypeDefinition.hpp"
+#include "../runtime/PrimitiveObject.hpp"
+#include "../InternalErrorException.hpp"
+
+namespace geogen
+{
+	namespace runtime
+	{
+		class VirtualMachine;
+	}
+
+	namespace corelib
+	{
+		typedef runtime::PrimitiveObject<Number> NumberObject;
+
+		class NullTypeDefinition : public runtime::TypeDefinition
+		{
+		public:
+			NullTypeDefinition() : TypeDefinition(GG_STR("null")) {}
+
+			virtual runtime::ManagedObject* Copy(runtime::VirtualMachine* vm, runtime::ManagedObject* a) const
+			{
+				return a;
+			};
+		};
+	}
+}
\ No newline at end of file
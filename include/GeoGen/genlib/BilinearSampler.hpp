@@ -0,0 +1,90 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+#include "../Number.hpp"
+#include "../Size.hpp"
+
+namespace geogen
+{
+	namespace genlib
+	{
+		/// Bilinear sampler of height data at fractional physical coordinates. Shared by all height map operations which resample the map (HeightMap::Transform, HeightMap::Distort and HeightMap::Shift).
+		///
+		/// Coordinates outside of the height data are clamped to its edges. The interpolation is branch-free and gives exactly the same results as the original per-sample implementation, which used HeightMap::operator()(double, double).
+		class BilinearSampler
+		{
+		private:
+			Height const* data;
+			Size1D width;
+			Size1D height;
+			double maxX;
+			double maxY;
+		public:
+			/// Coordinates this close above a whole number are rounded down to it to compensate for floating point errors.
+			static const double SNAP_DISTANCE;
+
+			/// Initializes a new instance of the BilinearSampler class.
+			/// @param data The height data. Must remain valid for the lifetime of the sampler.
+			/// @param size Size of the height data.
+			BilinearSampler(Height const* data, Size2D size)
+				: data(data), width(size.GetWidth()), height(size.GetHeight()), maxX(double(size.GetWidth()) - 1), maxY(double(size.GetHeight()) - 1) {};
+
+			/// Samples the height data at a single point.
+			/// @param x The physical X coordinate.
+			/// @param y The physical Y coordinate.
+			/// @return The interpolated height.
+			inline Height Sample(double x, double y) const
+			{
+				// Written so that NaN coordinates end up on the edge as well.
+				x = x > 0 ? (x < this->maxX ? x : this->maxX) : 0;
+				y = y > 0 ? (y < this->maxY ? y : this->maxY) : 0;
+
+				Size1D left = Size1D(x);
+				Size1D top = Size1D(y);
+				double fractionX = x - left;
+				double fractionY = y - top;
+				fractionX = fractionX < SNAP_DISTANCE ? 0 : fractionX;
+				fractionY = fractionY < SNAP_DISTANCE ? 0 : fractionY;
+
+				// The right column (bottom row) is only read when actually interpolated, which keeps the edges in bounds.
+				Height const* topRow = this->data + top * this->width;
+				Height const* bottomRow = topRow + (fractionY != 0 ? this->width : 0);
+				Size1D right = left + (fractionX != 0 ? 1 : 0);
+
+				Height topHeight = Height(topRow[left] + (topRow[right] - topRow[left]) * fractionX);
+				Height bottomHeight = Height(bottomRow[left] + (bottomRow[right] - bottomRow[left]) * fractionX);
+				return Height(topHeight + (bottomHeight - topHeight) * fractionY);
+			}
+
+			/// Samples the height data at a sequence of points lying on a line (such as a row of a transformed map). Leading and trailing points, which lie outside of the height data, are set to @a outsideHeight without being sampled.
+			/// @param output The output array, receives @a count heights.
+			/// @param count Number of sampled points.
+			/// @param xs The physical X coordinates of the points.
+			/// @param ys The physical Y coordinates of the points.
+			/// @param outsideHeight Height of points outside of the height data.
+			void SampleLine(Height* output, unsigned count, double const* xs, double const* ys, Height outsideHeight) const;
+
+			/// Samples the height data at a sequence of points with arbitrary coordinates. Points outside of the height data are clamped to its edges.
+			/// @param output The output array, receives @a count heights.
+			/// @param count Number of sampled points.
+			/// @param xs The physical X coordinates of the points.
+			/// @param ys The physical Y coordinates of the points.
+			void SamplePoints(Height* output, unsigned count, double const* xs, double const* ys) const;
+		};
+	}
+}
@@ -0,0 +1,91 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+namespace geogen
+{
+	namespace genlib
+	{
+		/// Allows to interrupt long running HeightMap operations, either explicitly from another thread or once a deadline passes.
+		///
+		/// The operations check the token assigned to the calling thread (see Scope) once per band of rows and throw CancellationException if it is cancelled. The map being modified is left in an unspecified state. The renderer assigns its token (see renderer::Renderer::SetCancellationToken) to each step it executes.
+		class CancellationToken
+		{
+		private:
+			volatile bool isCancelled;
+			unsigned long long deadline;
+
+			// Non-copyable
+			CancellationToken(CancellationToken const&) {};
+			CancellationToken& operator=(CancellationToken const&) {};
+		public:
+			/// Assigns a token to the calling thread for the lifetime of this object.
+			class Scope
+			{
+			private:
+				CancellationToken const* previousToken;
+
+				// Non-copyable
+				Scope(Scope const&) {};
+				Scope& operator=(Scope const&) {};
+			public:
+				/// Assigns the token.
+				/// @param token The token. May be NULL.
+				explicit Scope(CancellationToken const* token);
+
+				/// Restores the token assigned to the thread before.
+				~Scope();
+			};
+
+			/// Initializes a token which is not cancelled and has no deadline.
+			CancellationToken() : isCancelled(false), deadline(0) {};
+
+			/// Requests cancellation. Can be called from any thread.
+			inline void Cancel() { this->isCancelled = true; }
+
+			/// Gets the deadline.
+			/// @return The wall clock time (see utils::GetWallClockMicroseconds), in microseconds. 0 if there is no deadline.
+			inline unsigned long long GetDeadline() const { return this->deadline; }
+
+			/// Sets the deadline after which the token is considered cancelled.
+			/// @param deadline The wall clock time (see utils::GetWallClockMicroseconds), in microseconds. 0 for no deadline.
+			inline void SetDeadline(unsigned long long deadline) { this->deadline = deadline; }
+
+			/// Sets the deadline relative to the current time.
+			/// @param timeout The time remaining until the deadline, in microseconds.
+			void SetTimeout(unsigned long long timeout);
+
+			/// Clears the cancellation request and the deadline, so the token can be used again.
+			void Reset();
+
+			/// Determines whether the deadline has passed.
+			/// @return true if the deadline has passed, false otherwise.
+			bool IsDeadlineExceeded() const;
+
+			/// Determines whether cancellation was requested or the deadline has passed.
+			/// @return true if cancelled, false otherwise.
+			inline bool IsCancelled() const { return this->isCancelled || this->IsDeadlineExceeded(); }
+
+			/// Throws CancellationException if the token is cancelled.
+			void ThrowIfCancelled() const;
+
+			/// Gets the token assigned to the calling thread.
+			/// @return The token or NULL if no token is assigned.
+			static CancellationToken const* GetCurrent();
+		};
+	}
+}
\ No newline at end of file
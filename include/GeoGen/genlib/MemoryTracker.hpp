@@ -0,0 +1,150 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+
+#pragma once
+
+#include "../Number.hpp"
+
+namespace geogen
+{
+	namespace genlib
+	{
+		/// Process-wide counters of memory actually allocated by height maps, height profiles and large temporary buffers of their operations. The renderer predicts memory requirements of rendering steps (see renderer::RenderingSequenceMetadata::GetMemoryRequirement); these counters measure what really happens, so the two can be compared (see renderer::RendererMetrics).
+		///
+		/// The process-wide counters are shared by all renderers running in the process and are thread-safe. Memory of a single renderer is additionally counted by its Account, which is assigned to the thread executing its steps (see AccountScope).
+		class MemoryTracker
+		{
+		private:
+			static unsigned long long currentMemory;
+			static unsigned long long peakMemory;
+			static unsigned long long allocatedMemory;
+
+			// Static class
+			MemoryTracker() {};
+		public:
+			/// Counters of memory allocated and released by threads while the account is assigned to them (see AccountScope), so concurrently running renderers can measure their own memory. Thread-safe.
+			class Account
+			{
+			private:
+				unsigned long long currentMemory;
+				unsigned long long peakMemory;
+
+				// Non-copyable
+				Account(Account const&) {};
+				Account& operator=(Account const&) {};
+
+				friend class MemoryTracker;
+			public:
+				/// Initializes an account with no memory.
+				Account() : currentMemory(0), peakMemory(0) {};
+
+				/// Gets size of the memory currently allocated under the account.
+				/// @return The memory size, in bytes.
+				unsigned long long GetCurrentMemory() const;
+
+				/// Gets the maximum size of memory allocated under the account since the last ResetPeakMemory.
+				/// @return The memory size, in bytes.
+				unsigned long long GetPeakMemory() const;
+
+				/// Starts a new measurement of peak memory, setting it to the memory currently allocated under the account.
+				void ResetPeakMemory();
+			};
+
+			/// Assigns an account to the calling thread for the lifetime of this object. Parallel regions have to assign the account of the thread which started them to their threads again.
+			class AccountScope
+			{
+			private:
+				Account* previousAccount;
+
+				// Non-copyable
+				AccountScope(AccountScope const&) {};
+				AccountScope& operator=(AccountScope const&) {};
+			public:
+				/// Assigns the account.
+				/// @param account The account. May be NULL.
+				explicit AccountScope(Account* account);
+
+				/// Restores the account assigned to the thread before.
+				~AccountScope();
+			};
+
+			/// Temporary buffer registered with the tracker for the lifetime of this object (typically a std::vector local to an operation).
+			class ScopedAllocation
+			{
+			private:
+				unsigned long long size;
+
+				// Non-copyable
+				ScopedAllocation(ScopedAllocation const&) {};
+				ScopedAllocation& operator=(ScopedAllocation const&) {};
+			public:
+				/// Registers the buffer.
+				/// @param size Size of the buffer, in bytes.
+				ScopedAllocation(unsigned long long size) : size(size) { MemoryTracker::RegisterAllocation(size); }
+
+				/// Unregisters the buffer.
+				~ScopedAllocation() { MemoryTracker::RegisterRelease(this->size); }
+			};
+
+			/// Allocates a tracked array of heights. It has to be released using ReleaseHeights.
+			/// @param count Number of heights.
+			/// @return The array.
+			static Height* AllocateHeights(unsigned long long count);
+
+			/// Adds a reference to an array allocated with AllocateHeights, so it is shared by multiple owners. Each of them has to release it using ReleaseHeights; the memory is freed by the last one.
+			/// @param heights The array.
+			/// @return The array.
+			static Height* ShareHeights(Height* heights);
+
+			/// Determines whether an array allocated with AllocateHeights has more than one owner (see ShareHeights).
+			/// @param heights The array.
+			/// @return True if the array is shared.
+			static bool IsShared(Height const* heights);
+
+			/// Releases a reference to an array allocated with AllocateHeights, freeing it if this was the last one.
+			/// @param heights The array. May be NULL.
+			static void ReleaseHeights(Height* heights);
+
+			/// Records an allocation of memory not allocated using AllocateHeights.
+			/// @param size Size of the allocated memory, in bytes.
+			static void RegisterAllocation(unsigned long long size);
+
+			/// Records release of memory previously recorded with RegisterAllocation.
+			/// @param size Size of the released memory, in bytes.
+			static void RegisterRelease(unsigned long long size);
+
+			/// Gets size of the currently allocated tracked memory.
+			/// @return The memory size, in bytes.
+			static unsigned long long GetCurrentMemory();
+
+			/// Gets the maximum size of allocated tracked memory since the last ResetPeakMemory.
+			/// @return The memory size, in bytes.
+			static unsigned long long GetPeakMemory();
+
+			/// Gets total size of all allocations since the process started. Its growth between two points in time is the allocation volume in between.
+			/// @return The memory size, in bytes.
+			static unsigned long long GetAllocatedMemory();
+
+			/// Starts a new measurement of peak memory, setting it to the currently allocated memory.
+			static void ResetPeakMemory();
+
+			/// Gets the account assigned to the calling thread.
+			/// @return The account or NULL if no account is assigned.
+			static Account* GetCurrentAccount();
+		};
+	}
+}
\ No newline at end of file
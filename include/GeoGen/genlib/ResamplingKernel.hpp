@@ -0,0 +1,122 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+#include <vector>
+#include <cmath>
+
+#include "../Number.hpp"
+#include "../RescaleFilter.hpp"
+
+namespace geogen
+{
+	namespace genlib
+	{
+		/// Precomputed table of source samples and their weights for resampling a line of heights to a different length using a RescaleFilter. Used by HeightProfile::Rescale directly and by HeightMap::Rescale once per dimension (the rescaling is separable).
+		///
+		/// Target sample @a t corresponds to source coordinate t * (sourceLength - 1) / (targetLength - 1), so the first and the last samples of both lines are aligned.
+		class ResamplingKernel
+		{
+		private:
+			RescaleFilter filter;
+			Size1D sourceLength;
+			Size1D targetLength;
+			std::vector<unsigned> offsets;
+			std::vector<Size1D> indices;
+			std::vector<double> weights;
+			std::vector<bool> usedSources;
+
+			void AddSample(Size1D index, double weight);
+
+			static inline Height RoundWeightedSum(double sum)
+			{
+				return sum <= HEIGHT_MIN ? HEIGHT_MIN : (sum >= HEIGHT_MAX ? HEIGHT_MAX : Height(floor(sum + 0.5)));
+			}
+		public:
+			/// Source coordinates this close above a whole number are rounded down to it to compensate for floating point errors.
+			static const double SNAP_DISTANCE;
+
+			/// Initializes a new instance of the ResamplingKernel class.
+			/// @param sourceLength Length of the source line.
+			/// @param targetLength Length of the target line.
+			/// @param filter The filter.
+			ResamplingKernel(Size1D sourceLength, Size1D targetLength, RescaleFilter filter);
+
+			/// Gets the filter.
+			/// @return The filter.
+			inline RescaleFilter GetFilter() const { return this->filter; }
+
+			/// Gets length of the source line.
+			/// @return The length.
+			inline Size1D GetSourceLength() const { return this->sourceLength; }
+
+			/// Gets length of the target line.
+			/// @return The length.
+			inline Size1D GetTargetLength() const { return this->targetLength; }
+
+			/// Determines whether a source sample contributes to any of the target samples.
+			/// @param index Index of the source sample.
+			/// @return true if the sample is used, false otherwise.
+			inline bool IsSourceUsed(Size1D index) const { return this->usedSources[index]; }
+
+			/// Calculates a single target sample.
+			/// @param source The source line.
+			/// @param target Index of the target sample.
+			/// @param stride Distance between two consecutive samples of the source line.
+			/// @return The target sample.
+			inline Height Resample(Height const* source, Size1D target, Size1D stride) const
+			{
+				unsigned offset = this->offsets[target];
+				switch (this->filter)
+				{
+				case RESCALE_FILTER_NEAREST:
+					return source[this->indices[offset] * stride];
+				case RESCALE_FILTER_BILINEAR:
+				{
+					// Same evaluation order as BilinearSampler, so the results are identical.
+					Height left = source[this->indices[offset] * stride];
+					Height right = source[this->indices[offset + 1] * stride];
+					return Height(left + (right - left) * this->weights[offset + 1]);
+				}
+				default:
+				{
+					double sum = 0;
+					for (unsigned i = offset; i < this->offsets[target + 1]; i++)
+					{
+						sum += source[this->indices[i] * stride] * this->weights[i];
+					}
+
+					return RoundWeightedSum(sum);
+				}
+				}
+			}
+
+			/// Resamples an entire contiguous line.
+			/// @param output The output array, receives GetTargetLength() heights.
+			/// @param source The source line of GetSourceLength() heights.
+			void ResampleLine(Height* output, Height const* source) const;
+
+			/// Calculates the same target sample of several parallel lines, which are interleaved in memory (such as a block of columns of a height map).
+			/// @param output The output array, receives @a count heights (one for each line).
+			/// @param count Number of lines.
+			/// @param source The first sample of the first line. The lines follow each other immediately.
+			/// @param stride Distance between two consecutive samples of a single line.
+			/// @param target Index of the target sample.
+			void ResampleAcrossLines(Height* output, unsigned count, Height const* source, Size1D stride, Size1D target) const;
+		};
+	}
+}
\ No newline at end of file
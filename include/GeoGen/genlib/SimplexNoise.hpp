@@ -0,0 +1,49 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+#include "../Number.hpp"
+#include "../random/RandomSequence2D.hpp"
+
+namespace geogen
+{
+	namespace genlib
+	{
+		/// Two-dimensional simplex noise (gradient noise evaluated on a grid of triangles) with gradients determined by a random::RandomSequence2D. Unlike the interpolated value noise used by HeightMap::NoiseLayer, it has no visible grid artifacts and very little energy at wave lengths shorter than the grid, so fewer layers are needed for a similar look.
+		class SimplexNoise
+		{
+		private:
+			// This is a static class, instance creation is forbidden.
+			SimplexNoise() {};
+		public:
+			/// Evaluates the noise in a single point. The grid cells have size 1 and the noise is 0 in the grid points.
+			/// @param randomSequence The random sequence determining the gradients.
+			/// @param x The X coordinate.
+			/// @param y The Y coordinate.
+			/// @return The noise value, in range <-1, 1>.
+			static double Evaluate(random::RandomSequence2D const& randomSequence, double x, double y);
+
+			/// Evaluates the noise in a row of points with a common Y coordinate (see Evaluate).
+			/// @param randomSequence The random sequence determining the gradients.
+			/// @param xs X coordinates of the points.
+			/// @param y The Y coordinate.
+			/// @param count Number of the points.
+			/// @param output The output array, receives @a count noise values.
+			static void EvaluateRow(random::RandomSequence2D const& randomSequence, double const* xs, double y, unsigned count, double* output);
+		};
+	}
+}
\ No newline at end of file
@@ -0,0 +1,95 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+#include <vector>
+
+#include "../Number.hpp"
+#include "../Configuration.hpp"
+#include "Renderer.hpp"
+
+namespace geogen
+{
+	namespace renderer
+	{
+		/// Renders a single RenderingSequence repeatedly at increasing render scales, so a coarse preview of the maps is available long before the full resolution render is finished. Each level is rendered at twice the scale of the previous one, the last level is rendered at scale of the rendering sequence itself.
+		///
+		/// The script is executed only once. This requires the rendering sequence not to depend on the render scale (see RenderingSequence::IsRenderScaleDependent), otherwise only the last level is rendered.
+		class ProgressiveRenderer
+		{
+		private:
+			RenderingSequence const& renderingSequence;
+			Configuration configuration;
+			std::vector<Scale> levelScales;
+			unsigned currentLevel;
+			Renderer* currentRenderer;
+			Renderer* finishedRenderer;
+
+			// Non-copyable
+			ProgressiveRenderer(ProgressiveRenderer const&) : renderingSequence(*(RenderingSequence*)NULL) {};
+			ProgressiveRenderer& operator=(ProgressiveRenderer const&) {};
+
+			void StartLevel();
+		public:
+			/// Initializes a new instance of the ProgressiveRenderer class.
+			/// @param renderingSequence The rendering sequence to be rendered. It must exist for whole life of the renderer.
+			/// @param levelCount Maximum number of levels, including the full resolution one. Levels with scale below RENDER_SCALE_MIN are skipped.
+			/// @param configuration The configuration used by the renderer of each level.
+			ProgressiveRenderer(RenderingSequence const& renderingSequence, unsigned levelCount, Configuration configuration = Configuration());
+			~ProgressiveRenderer();
+
+			/// Gets number of levels.
+			/// @return The level count.
+			inline unsigned GetLevelCount() const { return this->levelScales.size(); }
+
+			/// Gets the render scale of a level.
+			/// @param level The level, 0 is the coarsest one.
+			/// @return The render scale.
+			inline Scale GetLevelScale(unsigned level) const { return this->levelScales[level]; }
+
+			/// Gets number of levels rendered so far.
+			/// @return The finished level count.
+			inline unsigned GetFinishedLevelCount() const { return this->currentLevel; }
+
+			/// Determines whether all levels were rendered.
+			/// @return true if finished, false otherwise.
+			inline bool IsFinished() const { return this->currentLevel == this->levelScales.size(); }
+
+			/// Gets the renderer of the level currently being rendered.
+			/// @return The renderer or NULL if all levels are finished.
+			inline Renderer* GetCurrentRenderer() { return this->currentRenderer; }
+
+			/// Gets the maps rendered by the most recently finished level. Ownership of the maps can be taken using RenderedMapTable::RemoveItem. The table is released when the next level finishes.
+			/// @return The rendered map table.
+			RenderedMapTable& GetRenderedMapTable();
+
+			/// Executes next step of the level currently being rendered.
+			/// @return RENDERER_STEP_RESULT_FINISHED if all levels are finished.
+			RendererStepResult Step();
+
+			/// Renders the current level until it is finished.
+			void RunLevel();
+
+			/// Renders all remaining levels.
+			void Run();
+
+			/// Gets current progress of the render, weighted by the number of pixels rendered in each level.
+			/// @return The progress in range from 0 to 100.
+			double GetProgress() const;
+		};
+	}
+}
\ No newline at end of file
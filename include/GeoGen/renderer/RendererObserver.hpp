@@ -0,0 +1,43 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+namespace geogen
+{
+	namespace renderer
+	{
+		class Renderer;
+		class RenderingStep;
+
+		/// Receives notifications about steps executed by a Renderer (see Renderer::AddObserver). Used to instrument rendering without modifying the rendering loop, such as by RendererMetrics.
+		class RendererObserver
+		{
+		public:
+			virtual ~RendererObserver() {}
+
+			/// Called by the Renderer before a step is executed.
+			/// @param renderer The renderer.
+			/// @param step The step about to be executed.
+			virtual void BeforeStep(Renderer& renderer, RenderingStep const* step) {}
+
+			/// Called by the Renderer after a step was successfully executed, before the objects no longer needed by any later step are released.
+			/// @param renderer The renderer.
+			/// @param step The executed step.
+			virtual void AfterStep(Renderer& renderer, RenderingStep const* step) {}
+		};
+	}
+}
\ No newline at end of file
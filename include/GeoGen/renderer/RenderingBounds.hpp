@@ -0,0 +1,58 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+#include "../Number.hpp"
+#include "RenderingStep.hpp"
+
+namespace geogen
+{
+	namespace renderer
+	{
+		/// Contains rendering bounds for a RenderingStep.
+		class RenderingBounds: public Serializable
+		{
+		private:
+			RenderingStepType renderingStepType;
+		protected:
+			RenderingBounds(RenderingStepType renderingStepType) : renderingStepType(renderingStepType) {}
+		public:
+			virtual ~RenderingBounds() {}
+
+			/// Gets the type of the rendering step to which this object is associated. Indicates the specific derived type of this instance (which is why it isn't virtual, so the derived types can be cast to without RTTI, see RenderingBounds1D::Cast and RenderingBounds2D::Cast).
+			/// @return The rendering step type.
+			inline RenderingStepType GetRenderingStepType() const { return this->renderingStepType; }
+
+			/// Gets the number of bytes that will be required to allocate object of size specified by these
+			/// bounds.
+			/// @param scale The scale.
+			/// @return The memory size, in bytes.
+			virtual unsigned GetMemorySize(Scale scale) const = 0;
+
+			/// Gets the number of pixels of an object of size specified by these bounds.
+			/// @param scale The scale.
+			/// @return The number of pixels.
+			virtual unsigned long long GetPixelCount(Scale scale) const = 0;
+
+			/// Creates a copy of these bounds.
+			/// @return The copy, owned by the caller.
+			virtual RenderingBounds* Clone() const = 0;
+
+			virtual void Serialize(IOStream& stream) const = 0;
+		};
+	}
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+#include <vector>
+
+#include "RenderingSequence.hpp"
+#include "../CodeLocation.hpp"
+#include "../Point.hpp"
+#include "RenderingBounds1D.hpp"
+#include "RenderingBounds2D.hpp"
+
+namespace geogen
+{
+	namespace renderer
+	{
+		class RenderingStep;
+
+		/// Data the renderer calculates about individual steps of a RenderingSequence. All of it is stored in flat arrays indexed by RenderingStep::GetIndex.
+		class RenderingSequenceMetadata : public Serializable
+		{
+		private:
+			std::vector<RenderingStep const*> steps;
+			std::vector<RenderingBounds1D> renderingBounds1D;
+			std::vector<RenderingBounds2D> renderingBounds2D;
+			std::vector<RenderingBounds*> renderingBounds;
+			std::vector<std::vector<unsigned> > objectsIndexesToRelease;
+			std::vector<unsigned> memoryRequirements;
+			
+			// Non-copyable
+			RenderingSequenceMetadata(RenderingSequenceMetadata const&) {};
+			RenderingSequenceMetadata& operator=(RenderingSequenceMetadata const&) {};
+		protected:
+		public:
+			RenderingSequenceMetadata(RenderingSequence const& renderingSequence);
+
+			RenderingBounds* GetRenderingBounds(RenderingStep const* step);
+
+			/// Gets rendering bounds of a 1D step.
+			/// @param step The step.
+			/// @return The rendering bounds.
+			inline RenderingBounds1D* GetRenderingBounds1D(RenderingStep const* step) { return RenderingBounds1D::Cast(this->GetRenderingBounds(step)); }
+
+			/// Gets rendering bounds of a 2D step.
+			/// @param step The step.
+			/// @return The rendering bounds.
+			inline RenderingBounds2D* GetRenderingBounds2D(RenderingStep const* step) { return RenderingBounds2D::Cast(this->GetRenderingBounds(step)); }
+
+			std::vector<unsigned>& GetObjectIndexesToRelease(RenderingStep const* step);
+			std::vector<unsigned> const& GetObjectIndexesToRelease(RenderingStep const* step) const;
+			unsigned GetMemoryRequirement(RenderingStep const* step) const;
+			void SetMemoryRequirement(RenderingStep const* step, unsigned memoryRequirement);
+
+			unsigned GetStepNumberByAddress(RenderingStep const* step) const;
+
+			virtual void Serialize(IOStream& stream) const;
+		};
+	}
+}
\ No newline at end of file
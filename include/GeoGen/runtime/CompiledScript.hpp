@@ -0,0 +1,152 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+#include <vector>
+
+#include "../String.hpp"
+#include "CodeBlock.hpp"
+#include "MetadataKeyValueCollection.hpp"
+#include "../corelib/CoreLibrary.hpp"
+#include "ScriptParameters.hpp"
+#include "../Configuration.hpp"
+
+namespace geogen 
+{
+	namespace runtime
+	{
+		class TypeDefinition;
+		class VariableDefinition;
+		class FunctionDefinition;
+		class Library;
+
+		/// A compiled script.
+		class CompiledScript : public Serializable
+		{
+			private:	
+				Configuration configuration;
+
+				SymbolDefinitionTable<VariableDefinition> globalVariableDefinitions;
+				SymbolDefinitionTable<FunctionDefinition> globalFunctionDefinitions;
+				SymbolDefinitionTable<TypeDefinition> typeDefinitions;
+
+				std::vector<FunctionDefinition*> ownedFunctionDefinitions;
+				std::vector<TypeDefinition*> ownedTypeDefinitions;
+
+				MetadataKeyValueCollection metadata;
+
+				std::vector<String> supportedMaps;
+
+				corelib::CoreLibrary coreLibrary;
+
+				String code;
+
+				unsigned inlineCacheSlotCount;
+			public:
+				/// Name of the main function.
+				static const String MAIN_FUNCTION_NAME;
+
+				/// Constructor.
+				/// @param code The script code.
+				CompiledScript(String code);
+
+				/// Destructor.
+				~CompiledScript();
+
+				/// Sets configuration.
+				/// @param configuration The configuration.
+				void SetConfiguration(Configuration configuration) { this->configuration = configuration; }
+
+				/// Gets the configuration.
+				/// @return The configuration.
+				Configuration const& GetConfiguration() const { return this->configuration; }
+
+				/// Gets the code.
+				/// @return The code.
+				inline String GetCode() const { return this->code; }
+
+				/// Creates a script parameters object based on the script metadata.
+				/// @return The script parameters.
+				ScriptParameters CreateScriptParameters() const;
+
+				/// Gets the script metadata tree.
+				/// @return The metadata tree.
+				inline MetadataKeyValueCollection const& GetMetadata() const { return this->metadata; }
+
+				/// Gets the script metadata tree.
+				/// @return The metadata tree.
+				inline MetadataKeyValueCollection& GetMetadata() { return this->metadata; }
+
+				/// Gets global variable definitions.
+				/// @return The global variable definitions.
+				inline SymbolDefinitionTable<VariableDefinition> const& GetGlobalVariableDefinitions() const { return this->globalVariableDefinitions; }
+				//inline SymbolDefinitionTable<VariableDefinition>& GetGlobalVariableDefinitions() { return this->globalVariableDefinitions; }
+
+				/// Gets global function definitions.
+				/// @return The global function definitions.
+				inline SymbolDefinitionTable<FunctionDefinition> const& GetGlobalFunctionDefinitions() const { return this->globalFunctionDefinitions; }
+				//inline SymbolDefinitionTable<FunctionDefinition>& GetGlobalFunctionDefinitions() { return this->globalFunctionDefinitions; }
+
+				/// Gets type definitions.
+				/// @return The type definitions.
+				inline SymbolDefinitionTable<TypeDefinition> const& GetTypeDefinitions() const { return this->typeDefinitions; }
+				//inline SymbolDefinitionTable<TypeDefinition>& GetTypeDefinitions() { return this->typeDefinitions; }
+
+				/// Gets function definitions owned by this script (the functions declared in the script code and the main function).
+				/// @return The owned function definitions.
+				inline std::vector<FunctionDefinition*> const& GetOwnedFunctionDefinitions() const { return this->ownedFunctionDefinitions; }
+
+				/*inline CodeBlock& GetRootCodeBlock() { return this->rootCodeBlock; }
+				inline CodeBlock const& GetRootCodeBlock() const { return this->rootCodeBlock; }*/
+
+				/*inline CodeBlock& GetInitializationCodeBlock() { return this->initializationCodeBlock; }
+				inline CodeBlock const& GetInitializationCodeBlock() const { return this->initializationCodeBlock; }*/
+
+				/// Adds a global function definition.
+				/// @param functionDefintion The function definition. The compiler script will not take ownership of this pointer.
+				/// @return True if the function is successfully added.
+				bool AddGlobalFunctionDefinition(FunctionDefinition* functionDefintion);
+
+				/// Adds a type definition.
+				/// @param typeDefintion The type definition. The compiler script will not take ownership of this pointer.
+				/// @return True if the type is successfully added.
+				bool AddTypeDefinition(TypeDefinition* typeDefinition);
+
+				/// Gets number of inline cache slots assigned to member access instructions of the script. Each VirtualMachine allocates this many inline cache entries.
+				/// @return The slot count.
+				inline unsigned GetInlineCacheSlotCount() const { return this->inlineCacheSlotCount; }
+
+				/// Sets number of inline cache slots assigned to member access instructions of the script.
+				/// @param inlineCacheSlotCount The slot count.
+				inline void SetInlineCacheSlotCount(unsigned inlineCacheSlotCount) { this->inlineCacheSlotCount = inlineCacheSlotCount; }
+
+				/// Gets a list of map names that can be generated by this script.
+				/// @return The supported maps.
+				std::vector<String>& GetSupportedMaps() { return this->supportedMaps; }
+				
+				/// Gets a list of map names that can be generated by this script.
+				/// @return The supported maps.
+				std::vector<String> const& GetSupportedMaps() const { return this->supportedMaps; }
+
+				/// Adds an entire library to the script.
+				/// @param library The library.
+				void AddLibrary(Library const* library);
+
+				virtual void Serialize(IOStream& stream) const;
+		};
+	}
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+#include <stddef.h>
+
+namespace geogen
+{
+	namespace runtime
+	{
+		class ManagedObject;
+		class VirtualMachine;
+
+		/// Arguments passed to a native function. The list doesn't copy the arguments, it refers directly to the topmost objects of the ObjectStack, which keep the arguments alive until the native function returns.
+		class NativeArgumentList
+		{
+		private:
+			ManagedObject** arguments;
+			unsigned size;
+		public:
+			/// Constructor.
+			/// @param arguments Pointer to the first argument.
+			/// @param size Number of arguments.
+			NativeArgumentList(ManagedObject** arguments, unsigned size) : arguments(arguments), size(size) {};
+
+			/// Gets number of arguments.
+			/// @return The number of arguments.
+			inline unsigned Size() const { return this->size; };
+
+			/// Gets an argument.
+			/// @param index Index of the argument.
+			/// @return The argument.
+			inline ManagedObject* operator[](unsigned index) const { return this->arguments[index]; };
+
+			/// Replaces an argument (typically with a result of a type conversion). The reference held by the list is transferred from the original argument to the new object.
+			/// @param vm The virtual machine.
+			/// @param index Index of the argument.
+			/// @param object The new object.
+			void Replace(VirtualMachine* vm, unsigned index, ManagedObject* object);
+		};
+	}
+}
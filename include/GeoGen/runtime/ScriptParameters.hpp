@@ -0,0 +1,296 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+#include <map>
+#include <algorithm>
+
+#include "ScriptParameter.hpp" // Necessary to properly compile the owning map.
+#include "../utils/OwningMap.hpp"
+#include "../random/RandomSeed.hpp"
+#include "../Serializable.hpp"
+#include "../Rectangle.hpp"
+#include "../Point.hpp"
+
+namespace geogen
+{	
+	namespace runtime
+	{
+		/// Infinite size in given dimension.
+		const unsigned MAP_SIZE_INFINITE = -1;
+
+		/// <summary> The size in given dimension will be set automatically by the generator. </summary>
+		const unsigned MAP_SIZE_AUTOMATIC = -2;
+
+		/// Maximum numeric value of a map size in either dimension.
+		const unsigned MAP_SIZE_MAX = -3;
+
+		/// Minimum numeric value of a map size in either dimension.
+		const unsigned MAP_SIZE_MIN = 1;
+
+		/// The minimum render scale.
+		const double RENDER_SCALE_MIN = 0.001;
+
+		/// The maximum render scale.
+		const double RENDER_SCALE_MAX = 10;
+
+		/// The default render size (if no other size can be used).
+		const Size1D RENDER_SIZE_DEFAULT = 1000;
+
+		/// The default default map size.
+		const Size1D MAP_SIZE_DEFAULT = 1000;
+
+		/// Contains configuration of map size, rendering bounds and any additional parameters the script
+		/// may have.
+		class ScriptParameters : public utils::OwningMap<ScriptParameter>, public Serializable
+		{
+		private:
+			unsigned mapWidth;
+			unsigned defaultMapWidth;
+			unsigned minMapWidth;
+			unsigned maxMapWidth;
+
+			unsigned mapHeight;
+			unsigned defaultMapHeight;
+			unsigned minMapHeight;
+			unsigned maxMapHeight;
+
+			int renderOriginX;
+			int renderOriginY;
+
+			unsigned renderWidth;
+			unsigned renderHeight;
+
+			double renderScale;
+
+			random::RandomSeed randomSeed;
+
+			std::vector<String> enabledMaps;
+		public:
+			/// A constant iterator.
+			typedef std::map<String, ScriptParameter const*>::const_iterator const_iterator;
+
+			/// An iterator.
+			typedef std::map<String, ScriptParameter*>::iterator iterator;
+
+			/// Initializes a new instance of the ScriptParameters class.
+			/// @param defaultMapWidth  The default map width.
+			/// @param defaultMapHeight The default map height.
+			/// @param minMapWidth	    The minimum map width.
+			/// @param minMapHeight	    The minimum map height.
+			/// @param maxMapWidth	    The maximum map width.
+			/// @param maxMapHeight	    The maximum map height.
+			ScriptParameters(unsigned defaultMapWidth, unsigned defaultMapHeight, unsigned minMapWidth, unsigned minMapHeight, unsigned maxMapWidth, unsigned maxMapHeight) :
+				mapWidth(MAP_SIZE_AUTOMATIC), mapHeight(MAP_SIZE_AUTOMATIC), defaultMapWidth(defaultMapWidth), defaultMapHeight(defaultMapHeight), minMapWidth(minMapWidth), maxMapHeight(maxMapHeight), maxMapWidth(maxMapWidth), minMapHeight(minMapHeight), renderOriginX(0), renderOriginY(0), renderScale(1), renderWidth(MAP_SIZE_AUTOMATIC), renderHeight(MAP_SIZE_AUTOMATIC) {}
+
+			/// Initializes a new instance of the ScriptParameters class.
+			ScriptParameters() :
+				mapWidth(MAP_SIZE_AUTOMATIC), mapHeight(MAP_SIZE_AUTOMATIC), defaultMapWidth(MAP_SIZE_INFINITE), defaultMapHeight(MAP_SIZE_INFINITE), minMapWidth(MAP_SIZE_MIN), minMapHeight(MAP_SIZE_MIN), maxMapHeight(MAP_SIZE_INFINITE), maxMapWidth(MAP_SIZE_INFINITE), renderOriginX(0), renderOriginY(0), renderScale(1), renderWidth(MAP_SIZE_AUTOMATIC), renderHeight(MAP_SIZE_AUTOMATIC) {}
+
+			/// Copy constructor.
+			/// @param parameter1 The other instance.
+			ScriptParameters(ScriptParameters const&);
+
+			/// Assignment operator.
+			/// @param parameter1 The other instance.
+			/// @return A deep copy of this ScriptParameters.
+			ScriptParameters& operator=(ScriptParameters const&);
+
+			/// Gets current width of the map. If map width wasn't set yet, default width will be returned.
+			/// @return Current map width.
+			inline unsigned GetMapWidth() const
+			{
+				if (this->mapWidth == MAP_SIZE_AUTOMATIC)
+				{
+					if (this->maxMapWidth == MAP_SIZE_INFINITE)
+					{
+						return MAP_SIZE_INFINITE;
+					}
+					else
+					{
+						return Size1D(this->GetRenderWidth() / this->GetRenderScale());
+					}
+				}
+				else
+				{
+					return this->mapWidth;
+				}
+			};
+
+			/// Gets the default width of the map.
+			/// @return Default width of the map.
+			inline unsigned GetDefaultMapWidth() const 
+			{ 
+				if (this->maxMapWidth == MAP_SIZE_INFINITE)
+				{
+					return MAP_SIZE_INFINITE;
+				}
+				else
+				{
+					return this->defaultMapWidth != MAP_SIZE_AUTOMATIC ? this->defaultMapWidth : MAP_SIZE_DEFAULT;
+				}
+			};
+
+			/// Gets the minimum width of the map.
+			/// @return Minimum width of the map. Always greater than 0.
+			inline unsigned GetMinMapWidth() const  { return this->minMapWidth; };
+
+			/// Gets the maximum width of the map.
+			/// @return Maximum width of the map. <see>MAP_SIZE_INFINITE</see> if infinite.
+			inline unsigned GetMaxMapWidth() const { return this->maxMapWidth; };
+
+			/// Sets the width of the map.
+			/// @param width The new width. If MAP_SIZE_AUTOMATIC, default width will be used.
+			void SetMapWidth(unsigned width);
+
+			/// Gets current height of the map. If map height wasn't set yet, default height will be returned.
+			/// @return Current map height.
+			inline unsigned GetMapHeight() const 
+			{ 
+				if (this->mapHeight == MAP_SIZE_AUTOMATIC)
+				{
+					if (this->maxMapHeight == MAP_SIZE_INFINITE)
+					{
+						return MAP_SIZE_INFINITE;
+					}
+					else 
+					{
+						return Size1D(this->GetRenderHeight() / this->GetRenderScale());
+					}
+				}
+				else
+				{
+					return this->mapHeight;
+				}
+			};
+
+			/// Gets the default height of the map.
+			/// @return Default height of the map.
+			inline unsigned GetDefaultMapHeight() const 
+			{ 
+				if (this->maxMapHeight == MAP_SIZE_INFINITE)
+				{
+					return MAP_SIZE_INFINITE;
+				}
+				else 
+				{
+					return this->defaultMapHeight != MAP_SIZE_AUTOMATIC ? this->defaultMapHeight : MAP_SIZE_DEFAULT;
+				}
+			};
+
+			/// Gets the minimum height of the map.
+			/// @return Minimum height of the map. Always greater than 0.
+			inline unsigned GetMinMapHeight() const  { return this->minMapHeight; };
+
+			/// Gets the maximum height of the map.
+			/// @return Maximum height of the map. <see>MAP_SIZE_INFINITE</see> if infinite.
+			inline unsigned GetMaxMapHeight() const { return this->maxMapHeight; };
+
+			/// Sets the height of the map.
+			/// @param height The new height. If MAP_SIZE_AUTOMATIC, default height will be used.
+			void SetMapHeight(unsigned height);
+
+			/// Gets X coordinate of the render origin.
+			/// @return X coordinate of the render origin.
+			inline int GetRenderOriginX() const { return this->renderOriginX; };
+
+			/// Sets X coordinate of the render origin.
+			/// @param renderOriginX X coordinate of the render origin.
+			inline void SetRenderOriginX(int renderOriginX) { this->renderOriginX = renderOriginX; };
+
+			/// Gets Y coordinate of the render origin.
+			/// @return Y coordinate of the render origin.
+			inline int GetRenderOriginY() const { return this->renderOriginY; };
+
+			/// Sets Y coordinate of the render origin.
+			/// @param renderOriginY Y coordinate of the render origin.
+			inline void SetRenderOriginY(int renderOriginY) { this->renderOriginY = renderOriginY; };
+
+			/// Gets width of the render.
+			/// @return Width of the render.
+			inline unsigned GetRenderWidth() const 
+			{ 
+				return this->renderWidth == MAP_SIZE_AUTOMATIC ? RENDER_SIZE_DEFAULT : this->renderWidth; 
+			};
+
+			/// Sets width of the render.
+			/// @param renderWidth Width of the render.
+			inline void SetRenderWidth(unsigned renderWidth) { this->renderWidth = renderWidth; };
+
+			/// Gets height of the render.
+			/// @return Height of the render.
+			inline unsigned GetRenderHeight() const 
+			{ 
+				return this->renderWidth == MAP_SIZE_AUTOMATIC ? RENDER_SIZE_DEFAULT : this->renderHeight;
+			};
+
+			/// Sets height of the render.
+			/// @param renderHeight Height of the render.
+			inline void SetRenderHeight(unsigned renderHeight) { this->renderHeight = renderHeight; };
+
+			/// Sets the render rectangle.
+			/// @param renderRect The render rectangle.
+			inline void SetRenderRectangle(Rectangle renderRectangle) 
+			{ 
+				this->SetRenderOriginX(renderRectangle.GetPosition().GetX());
+				this->SetRenderOriginY(renderRectangle.GetPosition().GetY());
+				this->SetRenderWidth(renderRectangle.GetSize().GetWidth());
+				this->SetRenderHeight(renderRectangle.GetSize().GetHeight());
+			};
+
+			/// Gets the rectangle which will actually be rendered into the yielded maps (automatic render size resolved and the render size limited by the map size if the map is finite).
+			/// @return The actual render rectangle.
+			Rectangle GetActualRenderRectangle() const;
+
+			/// Gets scale of the render.
+			/// @return Scale of the render.
+			inline double GetRenderScale() const { return this->renderScale; };
+
+			/// Sets scale of the render.
+			/// @param renderScale Scale of the render.
+			void SetRenderScale(double renderScale);
+
+			/// Gets the random seed.
+			/// @return The random seed.
+			inline random::RandomSeed GetRandomSeed() const { return this->randomSeed; }
+
+			/// Sets the random seed.
+			/// @param randomSeed The random seed.
+			inline void SetRandomSeed(random::RandomSeed randomSeed) { this->randomSeed = randomSeed; }
+
+			/// Gets a reference to a list of maps that are requested by the .
+			/// @return The enabled maps.
+			inline std::vector<String>& GetEnabledMaps() { return this->enabledMaps; }
+			inline std::vector<String> const& GetEnabledMaps() const { return this->enabledMaps; }
+
+			/// Determines whether the map is infinite in given direction.
+			/// @param direction The direction.
+			/// @return true if the map is infinite in given direction, false otherwise.
+			bool IsMapInfinite(Direction direction) const;
+
+			/// Determines whether the map size in given direction is derived from the render size and the render scale (which is the case for finite maps whose size wasn't set explicitly).
+			/// @param direction The direction.
+			/// @return true if the map size depends on the render scale, false otherwise.
+			bool IsMapSizeRenderScaleDependent(Direction direction) const;
+
+			/// Resets all parameters to their default values.
+			void ResetToDefaults();
+
+			virtual void Serialize(IOStream& stream) const;
+		};
+	}
+}
\ No newline at end of file
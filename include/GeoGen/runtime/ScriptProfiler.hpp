@@ -0,0 +1,130 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include "../String.hpp"
+
+namespace geogen
+{
+	namespace runtime
+	{
+		class VirtualMachine;
+		class FunctionDefinition;
+
+		/// Execution statistics collected by ScriptProfiler for a single source line, native function or call stack.
+		struct ScriptProfilerEntry
+		{
+			/// Number of executed instructions (number of calls for native functions).
+			unsigned long long Count;
+
+			/// Wall time spent, in microseconds.
+			unsigned long long Time;
+
+			/// Number of managed objects created.
+			unsigned long long AllocationCount;
+
+			/// Constructs an empty entry.
+			ScriptProfilerEntry() : Count(0), Time(0), AllocationCount(0) {};
+		};
+
+		/// Opt-in instruction-level profiler of script execution. Once assigned to a VirtualMachine (see VirtualMachine::SetScriptProfiler), it attributes wall time, number of executed instructions and managed object allocations to each source line, each native function and each call stack. A single profiler can accumulate data from multiple runs of the same script.
+		class ScriptProfiler
+		{
+		public:
+			/// Map of entries keyed by source line number.
+			typedef std::map<int, ScriptProfilerEntry> LineEntryMap;
+
+			/// Map of entries keyed by name (of a native function or a call stack).
+			typedef std::map<String, ScriptProfilerEntry> NamedEntryMap;
+		private:
+			LineEntryMap lineEntries;
+			NamedEntryMap nativeFunctionEntries;
+			NamedEntryMap stackEntries;
+			ScriptProfilerEntry total;
+
+			std::vector<FunctionDefinition const*> currentStack;
+			String currentStackName;
+
+			int stepLine;
+			unsigned long long stepStartTime;
+			unsigned stepStartAllocationCount;
+			unsigned long long stepNativeTime;
+
+			unsigned long long nativeCallStartTime;
+			unsigned nativeCallStartAllocationCount;
+
+			// Non-copyable
+			ScriptProfiler(ScriptProfiler const&) {};
+			ScriptProfiler& operator=(ScriptProfiler const&) {};
+
+			void UpdateCurrentStack(VirtualMachine const& vm);
+		public:
+			/// Constructs a profiler with no collected data.
+			ScriptProfiler();
+
+			/// Called by the VirtualMachine before each step.
+			/// @param vm The virtual machine.
+			void BeforeStep(VirtualMachine& vm);
+
+			/// Called by the VirtualMachine after each successfully completed step.
+			/// @param vm The virtual machine.
+			void AfterStep(VirtualMachine& vm);
+
+			/// Called by the VirtualMachine before a native function is invoked.
+			/// @param vm The virtual machine.
+			/// @param functionDefinition The native function.
+			void BeforeNativeCall(VirtualMachine& vm, FunctionDefinition const* functionDefinition);
+
+			/// Called by the VirtualMachine after a native function returned.
+			/// @param vm The virtual machine.
+			/// @param functionDefinition The native function.
+			void AfterNativeCall(VirtualMachine& vm, FunctionDefinition const* functionDefinition);
+
+			/// Gets statistics of individual source lines. Time of a line includes native functions called from it.
+			/// @return The line entries.
+			inline LineEntryMap const& GetLineEntries() const { return this->lineEntries; };
+
+			/// Gets statistics of individual native functions, keyed by function name.
+			/// @return The native function entries.
+			inline NamedEntryMap const& GetNativeFunctionEntries() const { return this->nativeFunctionEntries; };
+
+			/// Gets self time of individual call stacks, keyed by semicolon separated names of the functions on the stack (from the outermost one).
+			/// @return The call stack entries.
+			inline NamedEntryMap const& GetStackEntries() const { return this->stackEntries; };
+
+			/// Gets statistics of the entire execution.
+			/// @return The total.
+			inline ScriptProfilerEntry const& GetTotal() const { return this->total; };
+
+			/// Discards all collected data.
+			void Reset();
+
+			/// Writes a human readable report with source lines and native functions sorted by time spent in them.
+			/// @param stream The output stream.
+			/// @param code Code of the profiled script, used to print the source lines. May be empty.
+			/// @param maxLineCount Maximum number of lines and of native functions listed.
+			void WriteReport(OStream& stream, String const& code, unsigned maxLineCount = 20) const;
+
+			/// Writes self time (in microseconds) of each call stack in the collapsed stack format ("<main>;f;Max 123" per line), which is accepted by flame graph tools.
+			/// @param stream The output stream.
+			void WriteCollapsedStacks(OStream& stream) const;
+		};
+	}
+}
@@ -0,0 +1,27 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+namespace geogen
+{
+	namespace utils
+	{
+		/// Gets CPU time consumed so far by all threads of the process. Only differences between two values are meaningful.
+		/// @return The time in microseconds.
+		unsigned long long GetProcessCpuMicroseconds();
+	}
+}
\ No newline at end of file
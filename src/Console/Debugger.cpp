@@ -33,6 +33,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 #include "runtime_commands/ReadVariableRuntimeCommand.hpp"
 #include "runtime_commands/RenderingSequenceRuntimeCommand.hpp"
 #include "runtime_commands/RunRuntimeCommand.hpp"
+#include "runtime_commands/ScriptProfilerRuntimeCommand.hpp"
 #include "runtime_commands/StepRuntimeCommand.hpp"
 #include "runtime_commands/StopRuntimeCommand.hpp"
 #include "runtime_commands/SupportedMapsRuntimeCommand.hpp"
@@ -67,6 +68,7 @@ Debugger::Debugger(geogen::IStream& in, geogen::OStream& out, runtime::CompiledS
 	commandTable.AddCommand(new ReadVariableRuntimeCommand());
 	commandTable.AddCommand(new RenderingSequenceRuntimeCommand());
 	commandTable.AddCommand(new RunRuntimeCommand());
+	commandTable.AddCommand(new ScriptProfilerRuntimeCommand());
 	commandTable.AddCommand(new StepRuntimeCommand());
 	commandTable.AddCommand(new StopRuntimeCommand());
 	commandTable.AddCommand(new SupportedMapsRuntimeCommand());
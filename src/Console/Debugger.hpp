@@ -31,6 +31,7 @@ namespace geogen
 			static const unsigned NUMBER_OF_SHOWN_LINES_DEFAULT;
 
 			runtime::VirtualMachine vm;
+			runtime::ScriptProfiler scriptProfiler;
 			CommandTable commandTable;
 
 			IStream& in;
@@ -57,6 +58,8 @@ namespace geogen
 			inline runtime::VirtualMachine* GetVirtualMachine() { return &this->vm; };
 			inline runtime::VirtualMachine const* GetVirtualMachine() const { return &this->vm; };
 
+			inline runtime::ScriptProfiler& GetScriptProfiler() { return this->scriptProfiler; };
+
 			runtime::instructions::Instruction const* GetCurrentInstruction() const;
 			inline CommandTable& GetCommandTable() { return this->commandTable; };
 
@@ -32,7 +32,7 @@ void geogen::console::WriteImage(genlib::DataObject* object, renderer::RendererO
 {
 	if (type == renderer::RENDERER_OBJECT_TYPE_HEIGHT_MAP)
 	{
-		HeightMap* heightMap = dynamic_cast<HeightMap*>(object);
+		HeightMap const* heightMap = dynamic_cast<HeightMap const*>(object);
 
 		{
 			png::image<png::ga_pixel_16>image(heightMap->GetRectangle().GetSize().GetWidth(), heightMap->GetRectangle().GetSize().GetHeight());
@@ -51,7 +51,7 @@ using namespace loader_commands;
 using namespace instructions;
 
 Loader::Loader(geogen::IStream& in, geogen::OStream& out, ProgramArguments programArguments)
-: currentFile(programArguments.inputFile), outputDirectory(programArguments.outputDirectory), debug(debug), in(in), out(out), randomSeed(programArguments.seed), renderOrigin(0, 0), renderSize(MAP_SIZE_AUTOMATIC, MAP_SIZE_AUTOMATIC), mapSize(MAP_SIZE_AUTOMATIC, MAP_SIZE_AUTOMATIC), renderScale(1), isInteractive(!programArguments.isNonInteractive), parameterValues(programArguments.scriptArgumentsStrings), compiledScript(NULL)
+: currentFile(programArguments.inputFile), outputDirectory(programArguments.outputDirectory), debug(debug), in(in), out(out), randomSeed(programArguments.seed), scriptProfileFile(programArguments.scriptProfileFile), profileJsonFile(programArguments.profileJsonFile), profileIterations(programArguments.profileIterations < 1 ? 10 : programArguments.profileIterations), renderOrigin(0, 0), renderSize(MAP_SIZE_AUTOMATIC, MAP_SIZE_AUTOMATIC), mapSize(MAP_SIZE_AUTOMATIC, MAP_SIZE_AUTOMATIC), renderScale(1), isInteractive(!programArguments.isNonInteractive), parameterValues(programArguments.scriptArgumentsStrings), compiledScript(NULL)
 {
 	this->commandTable.AddCommand(new CodeLoaderCommand());
 	this->commandTable.AddCommand(new DebugLoaderCommand());
@@ -79,7 +79,11 @@ void Loader::Run()
 	{
 		commandQueue.push(GG_STR("load ") + this->currentFile);
 
-		if (!this->isInteractive)
+		if (!this->isInteractive && this->profileJsonFile != GG_STR(""))
+		{
+			commandQueue.push(GG_STR("prof ") + IntToString(this->profileIterations));
+		}
+		else if (!this->isInteractive)
 		{
 			commandQueue.push(GG_STR("run"));
 		}
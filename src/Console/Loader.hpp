@@ -52,6 +52,10 @@ namespace geogen
 
 			String randomSeed;
 
+			String scriptProfileFile;
+			String profileJsonFile;
+			unsigned profileIterations;
+
 			std::map<String, String> parameterValues;
 
 			std::queue<String> commandQueue;
@@ -99,6 +103,12 @@ namespace geogen
 			inline String GetRandomSeed() const { return this->randomSeed; }
 			inline void SetRandomSeed(String randomSeed) { this->randomSeed = randomSeed; }
 
+			inline String GetScriptProfileFile() const { return this->scriptProfileFile; }
+			inline void SetScriptProfileFile(String scriptProfileFile) { this->scriptProfileFile = scriptProfileFile; }
+
+			inline String GetProfileJsonFile() const { return this->profileJsonFile; }
+			inline void SetProfileJsonFile(String profileJsonFile) { this->profileJsonFile = profileJsonFile; }
+
 			inline std::map<String, String>& GetParameterValues() { return this->parameterValues; }
 
 			inline bool IsInteractive()const { return this->isInteractive; }
@@ -0,0 +1,114 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+
+#include <GeoGen/GeoGen.hpp>
+
+namespace geogen
+{
+	namespace console
+	{
+		/// Wall and CPU times of a single profiled phase, one sample per profile iteration.
+		class ProfileTimings
+		{
+		private:
+			std::vector<unsigned long long> wallTimes;
+			std::vector<unsigned long long> cpuTimes;
+			unsigned long long wallStartTime;
+			unsigned long long cpuStartTime;
+
+			static double GetPercentile(std::vector<unsigned long long> samples, double percentile)
+			{
+				if (samples.size() == 0)
+				{
+					return 0;
+				}
+
+				std::sort(samples.begin(), samples.end());
+
+				double position = percentile * (samples.size() - 1);
+				unsigned lower = (unsigned)position;
+				unsigned upper = std::min(lower + 1, (unsigned)samples.size() - 1);
+
+				return samples[lower] + (position - lower) * ((double)samples[upper] - (double)samples[lower]);
+			}
+
+			static void WriteJsonStatistics(OStream& stream, std::vector<unsigned long long> const& samples)
+			{
+				// Rounded to whole microseconds, so large values aren't written in the lossy scientific notation.
+				stream << GG_STR("{ \"min\": ") << (unsigned long long)(GetPercentile(samples, 0) + 0.5) << GG_STR(", \"median\": ") << (unsigned long long)(GetPercentile(samples, 0.5) + 0.5) << GG_STR(", \"p95\": ") << (unsigned long long)(GetPercentile(samples, 0.95) + 0.5) << GG_STR(" }");
+			}
+		public:
+			ProfileTimings() : wallStartTime(0), cpuStartTime(0) {}
+
+			/// Starts measuring a sample.
+			inline void Start()
+			{
+				this->cpuStartTime = utils::GetProcessCpuMicroseconds();
+				this->wallStartTime = utils::GetWallClockMicroseconds();
+			}
+
+			/// Finishes the sample started by Start.
+			inline void Stop()
+			{
+				this->AddSample(utils::GetWallClockMicroseconds() - this->wallStartTime, utils::GetProcessCpuMicroseconds() - this->cpuStartTime);
+			}
+
+			/// Adds a sample measured by other means.
+			/// @param wallTime Wall time, in microseconds.
+			/// @param cpuTime CPU time of all threads, in microseconds.
+			inline void AddSample(unsigned long long wallTime, unsigned long long cpuTime)
+			{
+				this->wallTimes.push_back(wallTime);
+				this->cpuTimes.push_back(cpuTime);
+			}
+
+			/// Gets a percentile of the wall times, interpolated linearly between the closest samples.
+			/// @param percentile The percentile, from 0 (minimum) to 1 (maximum).
+			/// @return The wall time, in microseconds.
+			inline double GetWallPercentile(double percentile) const { return GetPercentile(this->wallTimes, percentile); }
+
+			/// Gets a percentile of the CPU times, interpolated linearly between the closest samples.
+			/// @param percentile The percentile, from 0 (minimum) to 1 (maximum).
+			/// @return The CPU time, in microseconds.
+			inline double GetCpuPercentile(double percentile) const { return GetPercentile(this->cpuTimes, percentile); }
+
+			/// Writes minimum, median and 95th percentile of the wall and CPU times (in microseconds) as a JSON object.
+			/// @param stream The output stream.
+			void WriteJson(OStream& stream) const
+			{
+				stream << GG_STR("{ \"wall\": ");
+				WriteJsonStatistics(stream, this->wallTimes);
+				stream << GG_STR(", \"cpu\": ");
+				WriteJsonStatistics(stream, this->cpuTimes);
+				stream << GG_STR(" }");
+			}
+
+			/// Writes minimum, median and 95th percentile of the wall and CPU times in a human readable form.
+			/// @param stream The output stream.
+			void WriteSummary(OStream& stream) const
+			{
+				stream << GG_STR("wall ") << this->GetWallPercentile(0) / 1000 << GG_STR(" / ") << this->GetWallPercentile(0.5) / 1000 << GG_STR(" / ") << this->GetWallPercentile(0.95) / 1000 << GG_STR(" ms, ");
+				stream << GG_STR("CPU ") << this->GetCpuPercentile(0) / 1000 << GG_STR(" / ") << this->GetCpuPercentile(0.5) / 1000 << GG_STR(" / ") << this->GetCpuPercentile(0.95) / 1000 << GG_STR(" ms");
+			}
+		};
+	}
+}
\ No newline at end of file
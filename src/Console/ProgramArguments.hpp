@@ -34,6 +34,9 @@ namespace geogen
 			String inputFile;
 			String outputDirectory;
 			String seed;
+			String scriptProfileFile;
+			String profileJsonFile;
+			int profileIterations;
 			std::map<String, String> scriptArgumentsStrings;
 
 			ProgramArguments()
@@ -44,6 +47,9 @@ namespace geogen
 				this->inputFile = GG_STR("");
 				this->outputDirectory = GG_STR(".");
 				this->seed = GG_STR("");
+				this->scriptProfileFile = GG_STR("");
+				this->profileJsonFile = GG_STR("");
+				this->profileIterations = 10;
 			}
 		};
 	}
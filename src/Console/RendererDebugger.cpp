@@ -24,6 +24,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 #include "renderer_commands/AutosaveRendererCommand.hpp"
 #include "renderer_commands/DumpRendererCommand.hpp"
 #include "renderer_commands/HelpRendererCommand.hpp"
+#include "renderer_commands/MemoryTimelineRendererCommand.hpp"
 #include "renderer_commands/ObjectTableRendererCommand.hpp"
 #include "renderer_commands/QuitRendererCommand.hpp"
 #include "renderer_commands/RenderingSequenceRendererCommand.hpp"
@@ -52,9 +53,13 @@ RendererDebugger::RendererDebugger(geogen::IStream& in, geogen::OStream& out, re
 	this->aborted = false;
 	this->autosave = false;
 
+	this->renderer.AddObserver(&this->metrics);
+	this->renderer.SetCancellationToken(&GetAbortCancellationToken());
+
 	this->commandTable.AddCommand(new AutosaveRendererCommand());
 	this->commandTable.AddCommand(new DumpRendererCommand());
 	this->commandTable.AddCommand(new HelpRendererCommand());
+	this->commandTable.AddCommand(new MemoryTimelineRendererCommand());
 	this->commandTable.AddCommand(new QuitRendererCommand());
 	this->commandTable.AddCommand(new ObjectTableRendererCommand());
 	this->commandTable.AddCommand(new RenderingSequenceRendererCommand());
@@ -139,7 +144,17 @@ void RendererDebugger::Step()
 
 	clock_t startTime = clock();
 
-	this->renderer.Step();
+	try
+	{
+		this->renderer.Step();
+	}
+	catch (CancellationException&)
+	{
+		GetAndClearAbortFlag();
+		this->Abort();
+		this->GetOut() << std::endl << GG_STR("Aborted.") << std::endl;
+		return;
+	}
 
 	this->lastStepTime = (double)(clock() - startTime) / (double)CLOCKS_PER_SEC;
 
@@ -29,6 +29,7 @@ namespace geogen
 		class RendererDebugger
 		{
 			renderer::Renderer renderer;
+			renderer::RendererMetrics metrics;
 			CommandTable commandTable;
 
 			IStream& in;
@@ -56,6 +57,7 @@ namespace geogen
 			inline String GetOutputDirectory() { return this->outputDirectory; }
 
 			inline renderer::Renderer* GetRenderer() { return &this->renderer; };
+			inline renderer::RendererMetrics const& GetMetrics() const { return this->metrics; };
 			inline CommandTable& GetCommandTable() { return this->commandTable; };
 
 			inline void Abort() { this->aborted = true; }
@@ -17,6 +17,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 #include <iostream>
 
 #include "SignalHandler.hpp"
+#include <GeoGen/GeoGen.hpp>
 
 using namespace std;
 using namespace geogen;
@@ -24,6 +25,7 @@ using namespace console;
 
 static bool abortFlag = false;
 static bool ignoreNext = false;
+static genlib::CancellationToken abortCancellationToken;
 
 #ifdef _WIN32
 bool geogen::console::HandleCtrlEvent(DWORD event)
@@ -37,6 +39,7 @@ bool geogen::console::HandleCtrlEvent(DWORD event)
 		}
 
 		abortFlag = true;
+		abortCancellationToken.Cancel();
 		return true;
 	}
 
@@ -52,6 +55,7 @@ void geogen::console::HandleIntSignal(int sig)
 	}
 
 	abortFlag = true;
+	abortCancellationToken.Cancel();
 	return;
 }
 #endif
@@ -69,5 +73,11 @@ bool geogen::console::GetAndClearAbortFlag()
 {
 	bool value = abortFlag;
 	abortFlag = false;
+	abortCancellationToken.Reset();
 	return value;
+}
+
+genlib::CancellationToken& geogen::console::GetAbortCancellationToken()
+{
+	return abortCancellationToken;
 }
\ No newline at end of file
@@ -24,6 +24,11 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 
 namespace geogen
 {
+	namespace genlib
+	{
+		class CancellationToken;
+	}
+
 	namespace console
 	{
 #ifdef _WIN32
@@ -45,5 +50,9 @@ namespace geogen
 		void IgnoreNextSignal();
 
 		bool GetAndClearAbortFlag();
+
+		/// Gets the token cancelled by the interrupt signal together with the abort flag. GetAndClearAbortFlag resets it again. Renderers run by the console use it, so the signal interrupts the running step instead of waiting for it to finish.
+		/// @return The token.
+		genlib::CancellationToken& GetAbortCancellationToken();
 	}
 }
\ No newline at end of file
@@ -18,6 +18,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 
 #include <vector>
 #include <fstream>
+#include <memory>
 
 #include "../LoaderCommand.hpp"
 #include "../Loader.hpp"
@@ -167,33 +168,49 @@ namespace geogen
 
 					return false;
 				}
-				bool RenderTile(Loader* loader, Point origin, Size2D size, Rectangle bounds) const
+				bool RenderTile(Loader* loader, Point origin, Size2D size, Rectangle bounds, std::auto_ptr<runtime::VirtualMachine>& templateVm) const
 				{
 					clock_t startTime = clock();
 
-					loader->GetOut() << GG_STR("Tile ") << origin.ToString() << GG_STR(": Runnning script.") << std::endl;
-
 					Rectangle renderRectangle(origin, size);
 					Rectangle actualRenderRectangle = Rectangle::Intersect(renderRectangle, bounds);
 
 					runtime::ScriptParameters scriptParameters = loader->CreateScriptParameters();
 					scriptParameters.SetRenderRectangle(actualRenderRectangle);
-					runtime::VirtualMachine vm(*loader->GetCompiledScript(), scriptParameters);
 
-					while (vm.GetStatus() == geogen::runtime::VIRTUAL_MACHINE_STATUS_READY)
+					std::auto_ptr<runtime::VirtualMachine> tileVm;
+					std::auto_ptr<renderer::Renderer> rendererPtr;
+					if (templateVm.get() != NULL)
+					{
+						// The script doesn't depend on the render rectangle, so its rendering sequence can be rendered again into this tile.
+						loader->GetOut() << GG_STR("Tile ") << origin.ToString() << GG_STR(": Reusing rendering sequence.") << std::endl;
+
+						rendererPtr.reset(new renderer::Renderer(templateVm->GetRenderingSequence(), scriptParameters.GetActualRenderRectangle()));
+					}
+					else
 					{
-						if (GetAndClearAbortFlag())
+						loader->GetOut() << GG_STR("Tile ") << origin.ToString() << GG_STR(": Runnning script.") << std::endl;
+
+						tileVm.reset(new runtime::VirtualMachine(*loader->GetCompiledScript(), scriptParameters));
+
+						while (tileVm->GetStatus() == geogen::runtime::VIRTUAL_MACHINE_STATUS_READY)
 						{
-							loader->GetOut() << GG_STR("Aborted.") << std::endl;
-							return false;
+							if (GetAndClearAbortFlag())
+							{
+								loader->GetOut() << GG_STR("Aborted.") << std::endl;
+								return false;
+							}
+
+							tileVm->Step();
 						}
 
-						vm.Step();
+						rendererPtr.reset(new renderer::Renderer(tileVm->GetRenderingSequence()));
 					}
 
 					loader->GetOut() << GG_STR("Tile ") << origin.ToString() << GG_STR(": Rendering.") << std::endl;
 
-					renderer::Renderer renderer(vm.GetRenderingSequence());
+					renderer::Renderer& renderer = *rendererPtr;
+					renderer.SetCancellationToken(&GetAbortCancellationToken());
 					renderer.CalculateMetadata();
 
 					loader->GetOut() << GG_STR("0% ");
@@ -207,7 +224,16 @@ namespace geogen
 							return false;
 						}
 
-						renderer.Step();
+						try
+						{
+							renderer.Step();
+						}
+						catch (CancellationException&)
+						{
+							GetAndClearAbortFlag();
+							loader->GetOut() << std::endl << GG_STR("Aborted.") << std::endl;
+							return false;
+						}
 
 						loader->GetOut() << round(renderer.GetProgress() * 10) / 10 << GG_STR("% ");
 
@@ -224,6 +250,12 @@ namespace geogen
 
 					double seconds = (double)(clock() - startTime) / (double)CLOCKS_PER_SEC;
 
+					if (tileVm.get() != NULL && !tileVm->GetRenderingSequence().IsRenderRectangleDependent())
+					{
+						// Keep the VM (and its rendering sequence) alive for the following tiles.
+						templateVm = tileVm;
+					}
+
 					loader->GetOut() << GG_STR("Tile ") << origin.ToString() << GG_STR(": Finished in ") << seconds << GG_STR(" seconds.") << std::endl << std::endl;
 
 					return true;
@@ -268,6 +300,8 @@ namespace geogen
 
 					clock_t totalStartTime = clock();
 
+					std::auto_ptr<runtime::VirtualMachine> templateVm;
+
 					Size2D actualTileSize(
 						loader->GetRenderSize().GetWidth() == runtime::MAP_SIZE_AUTOMATIC ? runtime::RENDER_SIZE_DEFAULT : loader->GetRenderSize().GetWidth(),
 						loader->GetRenderSize().GetHeight() == runtime::MAP_SIZE_AUTOMATIC ? runtime::RENDER_SIZE_DEFAULT : loader->GetRenderSize().GetHeight());
@@ -315,7 +349,7 @@ namespace geogen
 								spiralBottom--;
 							}
 
-							if(!this->RenderTile(loader, Point(currentX * actualTileSize.GetWidth(), currentY * actualTileSize.GetHeight()), actualTileSize, bounds)) return;
+							if(!this->RenderTile(loader, Point(currentX * actualTileSize.GetWidth(), currentY * actualTileSize.GetHeight()), actualTileSize, bounds, templateVm)) return;
 
 							currentX += currentChangeX;
 							currentY += currentChangeY;
@@ -326,7 +360,7 @@ namespace geogen
 						for (Coordinate x = 0;; x = x <= 0 ? -x + actualTileSize.GetWidth() : -x)
 						for (Coordinate y = bounds.GetPosition().GetY(); y < bounds.GetEndingPoint().GetY(); y += actualTileSize.GetHeight())
 						{
-							if (!this->RenderTile(loader, Point(x, y), actualTileSize, bounds)) return;
+							if (!this->RenderTile(loader, Point(x, y), actualTileSize, bounds, templateVm)) return;
 						}
 					}
 					else if (boundsInfiniteVertical)
@@ -334,7 +368,7 @@ namespace geogen
 						for (Coordinate y = 0;; y = y <= 0 ? -y + actualTileSize.GetHeight() : -y)
 						for (Coordinate x = bounds.GetPosition().GetX(); x < bounds.GetEndingPoint().GetX(); x += actualTileSize.GetWidth())
 						{
-							if (!this->RenderTile(loader, Point(x, y), actualTileSize, bounds)) return;
+							if (!this->RenderTile(loader, Point(x, y), actualTileSize, bounds, templateVm)) return;
 						}
 					}
 					else
@@ -342,7 +376,7 @@ namespace geogen
 						for (Coordinate y = bounds.GetPosition().GetY(); y < bounds.GetEndingPoint().GetY(); y += actualTileSize.GetHeight())
 						for (Coordinate x = bounds.GetPosition().GetX(); x < bounds.GetEndingPoint().GetX(); x += actualTileSize.GetWidth())
 						{
-							if(!this->RenderTile(loader, Point(x, y), actualTileSize, bounds)) return;
+							if(!this->RenderTile(loader, Point(x, y), actualTileSize, bounds, templateVm)) return;
 						}
 					}
 
@@ -25,6 +25,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 #include "../SignalHandler.hpp"
 #include "../VirtualMachineCallback.hpp"
 #include "../ConsoleUtils.hpp"
+#include "../ProfileTimings.hpp"
 #include <GeoGen/GeoGen.hpp>
 
 namespace geogen
@@ -44,11 +45,12 @@ namespace geogen
 
 				virtual String GetName() const { return GG_STR("Profile"); };
 
-				virtual String GetHelpString() const { return GG_STR("prof [n] - Profiles a script for [n] of iterations (10 if not set)."); };
+				virtual String GetHelpString() const { return GG_STR("prof [n] [file] - Profiles a script for [n] of iterations (10 if not set), measuring wall and CPU time of each phase and rendering step. If [file] is set, the results are also written to it as JSON."); };
 
 				virtual void Run(Loader* loader, String arguments) const
 				{
 					unsigned numberOfInterations = 10;
+					String jsonFile = loader->GetProfileJsonFile();
 					if (arguments != GG_STR(""))
 					{
 						StringStream argumentsStream(arguments);
@@ -63,6 +65,12 @@ namespace geogen
 						{
 							numberOfInterations = 10;
 						}
+
+						String jsonFileArgument;
+						if (argumentsStream >> jsonFileArgument)
+						{
+							jsonFile = jsonFileArgument;
+						}
 					}
 
 					if (loader->GetCompiledScript() == NULL)
@@ -73,18 +81,30 @@ namespace geogen
 
 					loader->GetOut() << "Profiling script." << std::endl;
 
-					double executionTotalSeconds = 0;
-					double prerenderingTotalSeconds = 0;
-					double renderingTotalSeconds = 0;
-					std::vector<double> renderingStepTotalSeconds;					
-					std::vector<std::string> renderingStepLabels;
+					ProfileTimings compilationTimings;
+					ProfileTimings executionTimings;
+					ProfileTimings prerenderingTimings;
+					ProfileTimings renderingTimings;
+					ProfileTimings savingTimings;
+					ProfileTimings totalTimings;
+					std::vector<ProfileTimings> renderingStepTimings;
+					std::vector<String> renderingStepLabels;
+					runtime::InlineCacheStatistics inlineCacheStatistics;
 					for (unsigned i = 0; i < numberOfInterations; i++)
 					{
 						loader->GetOut() << std::endl << "Iteration " << i << "." << std::endl;
 
+						totalTimings.Start();
+
+						loader->GetOut() << "Compiling script." << std::endl;
+
+						compilationTimings.Start();
+						delete loader->GetCompiler()->CompileScript(loader->GetCompiledScript()->GetCode());
+						compilationTimings.Stop();
+
 						loader->GetOut() << "Running script." << std::endl;
 
-						clock_t executionStartTime = clock();
+						executionTimings.Start();
 
 						runtime::VirtualMachine vm(*loader->GetCompiledScript(), loader->CreateScriptParameters());
 						vm.SetCallbackData(&loader->GetOut());
@@ -100,29 +120,38 @@ namespace geogen
 							vm.Run();
 						}
 
-						executionTotalSeconds += (double)(clock() - executionStartTime) / (double)CLOCKS_PER_SEC;
+						executionTimings.Stop();
+						inlineCacheStatistics.Add(vm.GetInlineCacheStatistics());
 
 						loader->GetOut() << "Rendering." << std::endl;
 
-						clock_t prerenderingStartTime = clock();
+						prerenderingTimings.Start();
 
 						renderer::Renderer renderer(vm.GetRenderingSequence());
+						renderer.SetCancellationToken(&GetAbortCancellationToken());
 						renderer.CalculateMetadata();
 
-						prerenderingTotalSeconds += (double)(clock() - prerenderingStartTime) / (double)CLOCKS_PER_SEC;
-						clock_t renderingStartTime = clock();
+						prerenderingTimings.Stop();
 
 						if(i == 0)
 						{
 							for (renderer::RenderingSequence::iterator it = vm.GetRenderingSequence().Begin(); it != vm.GetRenderingSequence().End(); it++)
 							{
-								renderingStepTotalSeconds.push_back(0);
+								renderingStepTimings.push_back(ProfileTimings());
 								renderingStepLabels.push_back((*it)->ToString());
 							}
 						}
-						
+						else if (vm.GetRenderingSequence().Size() != renderingStepTimings.size())
+						{
+							// Timings of individual steps can only be aggregated if all iterations render the same steps.
+							loader->GetOut() << GG_STR("The script generated ") << vm.GetRenderingSequence().Size() << GG_STR(" rendering steps in iteration ") << i << GG_STR(", but ") << renderingStepTimings.size() << GG_STR(" steps in iteration 0. Profile failed.") << std::endl << std::endl;
+							return;
+						}
+
 						loader->GetOut() << GG_STR("0% ");
 
+						renderingTimings.Start();
+
 						int j = 0;
 						while (renderer.GetStatus() == geogen::renderer::RENDERER_STATUS_READY)
 						{
@@ -132,33 +161,98 @@ namespace geogen
 								return;
 							}
 
-							clock_t renderingStepStartTime = clock();
-
-							renderer.Step();
-
-							renderingStepTotalSeconds[j] += (double)(clock() - renderingStepStartTime) / (double)CLOCKS_PER_SEC;
+							renderingStepTimings[j].Start();
+							try
+							{
+								renderer.Step();
+							}
+							catch (CancellationException&)
+							{
+								GetAndClearAbortFlag();
+								loader->GetOut() << std::endl << GG_STR("Aborted.") << std::endl << std::endl;
+								return;
+							}
+							renderingStepTimings[j].Stop();
 
 							loader->GetOut() << round(renderer.GetProgress() * 10) / 10 << "% " << std::flush;
 
 							j++;
 						}
 
-						renderingTotalSeconds += (double)(clock() - renderingStartTime) / (double)CLOCKS_PER_SEC;
+						renderingTimings.Stop();
 
 						loader->GetOut() << std::endl;
+
+						savingTimings.Start();
+						if (!loader->SaveRenderedMaps(renderer.GetRenderedMapTable())) return;
+						savingTimings.Stop();
+
+						totalTimings.Stop();
 					}
 
 					loader->GetOut() << std::endl;
-					loader->GetOut() << "Profile finished." << std::endl;
-					loader->GetOut() << "Execution mean time: " << (executionTotalSeconds / numberOfInterations) << " s" << std::endl;
-					loader->GetOut() << "Prerendering mean time: " << (prerenderingTotalSeconds / numberOfInterations) << " s" << std::endl;
-					loader->GetOut() << "Rendering mean time: " << (renderingTotalSeconds / numberOfInterations) << " s" << std::endl;
-					loader->GetOut() << std::endl;
+					loader->GetOut() << "Profile finished (min / median / 95th percentile)." << std::endl;
+					loader->GetOut() << "Compilation: ";
+					compilationTimings.WriteSummary(loader->GetOut());
+					loader->GetOut() << std::endl << "Execution: ";
+					executionTimings.WriteSummary(loader->GetOut());
+					loader->GetOut() << std::endl << "Inline cache hit rate: " << (round(inlineCacheStatistics.GetHitRate() * 1000) / 10) << "% (" << inlineCacheStatistics.GetHitCount() << " hits, " << inlineCacheStatistics.GetMissCount() << " misses)" << std::endl;
+					loader->GetOut() << "Prerendering: ";
+					prerenderingTimings.WriteSummary(loader->GetOut());
+					loader->GetOut() << std::endl << "Rendering: ";
+					renderingTimings.WriteSummary(loader->GetOut());
+					loader->GetOut() << std::endl << "Saving: ";
+					savingTimings.WriteSummary(loader->GetOut());
+					loader->GetOut() << std::endl << "Total: ";
+					totalTimings.WriteSummary(loader->GetOut());
+					loader->GetOut() << std::endl << std::endl;
 					loader->GetOut() << "Rendering step times:" << std::endl;
 
-					for (unsigned j = 0; j < renderingStepTotalSeconds.size(); j++)
+					double renderingMedian = renderingTimings.GetWallPercentile(0.5);
+					for (unsigned j = 0; j < renderingStepTimings.size(); j++)
+					{
+						double stepMedian = renderingStepTimings[j].GetWallPercentile(0.5);
+						loader->GetOut() << "" << (renderingMedian > 0 ? round(stepMedian / renderingMedian * 10 * 100) / 10 : 0) << "%\t" << renderingStepLabels[j] << " ";
+						renderingStepTimings[j].WriteSummary(loader->GetOut());
+						loader->GetOut() << std::endl;
+					}
+
+					if (jsonFile != GG_STR(""))
 					{
-						loader->GetOut() << "" << (round(renderingStepTotalSeconds[j] / renderingTotalSeconds * 10 * 100) / 10) << "%\t" << renderingStepLabels[j] << " " << (renderingStepTotalSeconds[j] / numberOfInterations) << " s" << std::endl;
+						OFStream jsonStream(jsonFile.c_str());
+						jsonStream << GG_STR("{") << std::endl;
+						jsonStream << GG_STR("\t\"script\": \"") << utils::EscapeJsonString(loader->GetCurrentFileName()) << GG_STR("\",") << std::endl;
+						jsonStream << GG_STR("\t\"iterations\": ") << numberOfInterations << GG_STR(",") << std::endl;
+						jsonStream << GG_STR("\t\"unit\": \"us\",") << std::endl;
+						jsonStream << GG_STR("\t\"phases\": {") << std::endl;
+						jsonStream << GG_STR("\t\t\"compilation\": "); compilationTimings.WriteJson(jsonStream); jsonStream << GG_STR(",") << std::endl;
+						jsonStream << GG_STR("\t\t\"execution\": "); executionTimings.WriteJson(jsonStream); jsonStream << GG_STR(",") << std::endl;
+						jsonStream << GG_STR("\t\t\"prerendering\": "); prerenderingTimings.WriteJson(jsonStream); jsonStream << GG_STR(",") << std::endl;
+						jsonStream << GG_STR("\t\t\"rendering\": "); renderingTimings.WriteJson(jsonStream); jsonStream << GG_STR(",") << std::endl;
+						jsonStream << GG_STR("\t\t\"saving\": "); savingTimings.WriteJson(jsonStream); jsonStream << GG_STR(",") << std::endl;
+						jsonStream << GG_STR("\t\t\"total\": "); totalTimings.WriteJson(jsonStream); jsonStream << std::endl;
+						jsonStream << GG_STR("\t},") << std::endl;
+						jsonStream << GG_STR("\t\"steps\": [") << std::endl;
+						for (unsigned j = 0; j < renderingStepTimings.size(); j++)
+						{
+							jsonStream << (j == 0 ? GG_STR("") : GG_STR(",\n"));
+							jsonStream << GG_STR("\t\t{ \"step\": ") << j << GG_STR(", \"label\": \"") << utils::EscapeJsonString(renderingStepLabels[j]) << GG_STR("\", \"time\": ");
+							renderingStepTimings[j].WriteJson(jsonStream);
+							jsonStream << GG_STR(" }");
+						}
+
+						jsonStream << std::endl << GG_STR("\t]") << std::endl;
+						jsonStream << GG_STR("}") << std::endl;
+						jsonStream.flush();
+
+						if (jsonStream.fail())
+						{
+							loader->GetOut() << GG_STR("Could not save profile \"") << jsonFile << GG_STR("\".") << std::endl;
+						}
+						else
+						{
+							loader->GetOut() << GG_STR("Saved profile \"") << jsonFile << GG_STR("\".") << std::endl;
+						}
 					}
 				}
 			};
@@ -62,6 +62,13 @@ namespace geogen
 					runtime::VirtualMachine vm(*loader->GetCompiledScript(), loader->CreateScriptParameters());
 					vm.SetCallbackData(&loader->GetOut());
 					vm.SetScriptMessageHandler(VirtualMachineCallback);
+
+					runtime::ScriptProfiler scriptProfiler;
+					if (loader->GetScriptProfileFile() != GG_STR(""))
+					{
+						vm.SetScriptProfiler(&scriptProfiler);
+					}
+
 					while (vm.GetStatus() == runtime::VIRTUAL_MACHINE_STATUS_READY)
 					{
 						if (GetAndClearAbortFlag())
@@ -72,10 +79,16 @@ namespace geogen
 
 						vm.Run();
 					}
+
+					if (vm.GetScriptProfiler() != NULL)
+					{
+						this->SaveScriptProfile(loader, scriptProfiler);
+					}
 					
 					loader->GetOut() << "Rendering." << std::endl;
 
 					renderer::Renderer renderer(vm.GetRenderingSequence());
+					renderer.SetCancellationToken(&GetAbortCancellationToken());
 					renderer.CalculateMetadata();
 
 					loader->GetOut() << GG_STR("0% ");
@@ -89,7 +102,16 @@ namespace geogen
 							return;
 						}
 
-						renderer.Step();
+						try
+						{
+							renderer.Step();
+						}
+						catch (CancellationException&)
+						{
+							GetAndClearAbortFlag();
+							loader->GetOut() << std::endl << GG_STR("Aborted.") << std::endl << std::endl;
+							return;
+						}
 
 						loader->GetOut() << round(renderer.GetProgress()*10)/10 << "% " << std::flush;
 
@@ -106,6 +128,29 @@ namespace geogen
 
 					loader->GetOut() << "Finished in " << seconds << " seconds." << std::endl << std::endl;
 				}
+
+				void SaveScriptProfile(Loader* loader, runtime::ScriptProfiler const& scriptProfiler) const
+				{
+					String reportFileName = loader->GetScriptProfileFile();
+					String stacksFileName = reportFileName + GG_STR(".stacks");
+
+					OFStream reportStream(reportFileName.c_str());
+					scriptProfiler.WriteReport(reportStream, loader->GetCompiledScript()->GetCode());
+					reportStream.flush();
+
+					OFStream stacksStream(stacksFileName.c_str());
+					scriptProfiler.WriteCollapsedStacks(stacksStream);
+					stacksStream.flush();
+
+					if (reportStream.fail() || stacksStream.fail())
+					{
+						loader->GetOut() << GG_STR("Could not save script profile \"") << reportFileName << GG_STR("\".") << std::endl;
+					}
+					else
+					{
+						loader->GetOut() << GG_STR("Saved script profile \"") << reportFileName << GG_STR("\" and \"") << stacksFileName << GG_STR("\".") << std::endl;
+					}
+				}
 			};
 		}
 	}
@@ -47,6 +47,9 @@ int main(int argc, char** argv){
 	args.AddStringArg(GG_STR('i'), GG_STR("input"), GG_STR("Input script to be executed."), GG_STR("FILE"), &programArguments.inputFile);
 	args.AddStringArg(GG_STR('o'), GG_STR("output"), GG_STR("Output file, the extension determines file type of the output (*.bmp for Windows Bitmap, *.shd for GeoGen Short Height Data and *.pgm for Portable Gray Map are allowed). Set to \"../temp/out.bmp\" by default."), GG_STR("FILE"), &programArguments.outputDirectory);
 	args.AddStringArg(GG_STR('s'), GG_STR("seed"), GG_STR("Pseudo-random generator seed. Maps generated with same seed, map script, arguments and generator version are always the same."), GG_STR("SEED"), &programArguments.seed);
+	args.AddStringArg(GG_STR('p'), GG_STR("script-profile"), GG_STR("Profiles execution of the script and writes per-line hot spot report to FILE and collapsed call stacks (usable by flame graph tools) to FILE.stacks."), GG_STR("FILE"), &programArguments.scriptProfileFile);
+	args.AddStringArg(GG_STR('j'), GG_STR("profile-json"), GG_STR("Profiles the script instead of running it and writes wall and CPU times (min, median and 95th percentile over the iterations) of compilation, execution, metadata calculation, each rendering step and map saving to FILE as JSON. Implies non-interactive mode."), GG_STR("FILE"), &programArguments.profileJsonFile);
+	args.AddIntArg(GG_STR('t'), GG_STR("profile-iterations"), GG_STR("Number of iterations of the profile (10 by default)."), GG_STR("N"), &programArguments.profileIterations);
 	args.AddBoolArg(GG_STR('n'), GG_STR("noninteractive"), GG_STR("Non-interactive mode."), &programArguments.isNonInteractive);
 	args.AddBoolArg(GG_STR('?'), GG_STR("help"), GG_STR("Displays this help."), &programArguments.displayHelp);
 
@@ -73,6 +76,11 @@ int main(int argc, char** argv){
 		programArguments.scriptArgumentsStrings[name] = value;
 	}
 
+	if (programArguments.profileJsonFile != GG_STR(""))
+	{
+		programArguments.isNonInteractive = true;
+	}
+
 	InitializeSignalHandler();
 
 	Loader loader(Cin, Cout, programArguments);
@@ -0,0 +1,77 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+
+#pragma once
+
+#include <vector>
+
+#include "../RendererCommand.hpp"
+#include "../RendererDebugger.hpp"
+
+namespace geogen
+{
+	namespace console
+	{
+		namespace renderer_commands
+		{
+			class MemoryTimelineRendererCommand : public RendererCommand
+			{
+			public:
+				MemoryTimelineRendererCommand()
+				{
+					this->cues.push_back(GG_STR("mem"));
+					this->cues.push_back(GG_STR("memory"));
+					this->cues.push_back(GG_STR("memorytimeline"));
+				}
+
+				virtual String GetName() const { return GG_STR("Memory timeline"); };
+
+				virtual String GetHelpString() const { return GG_STR("mem - Displays predicted and actual peak memory of each rendering step. Steps which allocated more memory than predicted are marked with \"!\"."); };
+
+				virtual void Run(RendererDebugger* debugger, String arguments) const
+				{
+					std::vector<renderer::RendererStepMetrics> const& steps = debugger->GetMetrics().GetSteps();
+
+					debugger->GetOut() << GG_STR("Memory timeline (predicted / actual peak / live after step):") << std::endl;
+
+					unsigned stepNumber = 0;
+					for (renderer::RenderingSequence::const_iterator it = debugger->GetRenderer()->GetRenderingSequence().Begin(); it != debugger->GetRenderer()->GetRenderingSequence().End(); it++)
+					{
+						unsigned predictedMemory = debugger->GetRenderer()->GetRenderingSequenceMetadata().GetMemoryRequirement(*it);
+
+						if (stepNumber < steps.size())
+						{
+							renderer::RendererStepMetrics const& metrics = steps[stepNumber];
+							debugger->GetOut() << (metrics.Mispredicted ? GG_STR("! ") : GG_STR("  ")) << stepNumber << GG_STR("\t")
+								<< geogen::utils::FormatFileSize(predictedMemory) << GG_STR(" / ")
+								<< geogen::utils::FormatFileSize((unsigned)metrics.PeakMemory) << GG_STR(" / ")
+								<< geogen::utils::FormatFileSize((unsigned)metrics.LiveMemory) << GG_STR("\t") << (*it)->ToString() << std::endl;
+						}
+						else
+						{
+							debugger->GetOut() << GG_STR("  ") << stepNumber << GG_STR("\t") << geogen::utils::FormatFileSize(predictedMemory) << GG_STR(" / - / -\t") << (*it)->ToString() << std::endl;
+						}
+
+						stepNumber++;
+					}
+
+					debugger->GetOut() << std::endl << GG_STR("Actual peak: ") << geogen::utils::FormatFileSize((unsigned)debugger->GetMetrics().GetPeakMemory()) << GG_STR(", mispredicted steps: ") << debugger->GetMetrics().GetMispredictionCount() << std::endl << std::endl;
+				}
+			};
+		}
+	}
+}
\ No newline at end of file
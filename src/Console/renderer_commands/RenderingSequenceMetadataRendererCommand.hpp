@@ -48,7 +48,7 @@ namespace geogen
 
 				virtual void Run(RendererDebugger* debugger, String arguments) const
 				{
-					debugger->GetOut() << GG_STR("Rendering sequence metadata (scale ") << debugger->GetRenderer()->GetRenderingSequence().GetRenderScale() << GG_STR("):") << std::endl;
+					debugger->GetOut() << GG_STR("Rendering sequence metadata (scale ") << debugger->GetRenderer()->GetRenderScale() << GG_STR("):") << std::endl;
 
 					for (renderer::RenderingSequence::const_iterator it = debugger->GetRenderer()->GetRenderingSequence().Begin(); it != debugger->GetRenderer()->GetRenderingSequence().End(); it++)
 					{
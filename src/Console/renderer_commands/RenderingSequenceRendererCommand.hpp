@@ -45,7 +45,7 @@ namespace geogen
 
 				virtual void Run(RendererDebugger* debugger, String arguments) const
 				{
-					debugger->GetOut() << GG_STR("Rendering sequence (scale ") << debugger->GetRenderer()->GetRenderingSequence().GetRenderScale() << GG_STR("):") << std::endl;
+					debugger->GetOut() << GG_STR("Rendering sequence (scale ") << debugger->GetRenderer()->GetRenderScale() << GG_STR("):") << std::endl;
 					debugger->GetOut() << debugger->GetRenderer()->GetRenderingSequence().ToString() << std::endl;
 				}
 			};
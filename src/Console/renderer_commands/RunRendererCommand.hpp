@@ -60,6 +60,12 @@ namespace geogen
 
 						debugger->Step();
 
+						// The step was interrupted by the abort signal.
+						if (debugger->IsAborted())
+						{
+							return;
+						}
+
 						debugger->GetOut() << GG_STR(".. ") << debugger->GetLastStepTime() << GG_STR(" seconds.") << std::endl;
 
 						i++;
@@ -0,0 +1,109 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+#include <vector>
+#include <fstream>
+
+#include "../RuntimeCommand.hpp"
+#include "../Debugger.hpp"
+
+namespace geogen
+{
+	namespace console
+	{
+		namespace runtime_commands
+		{
+			class ScriptProfilerRuntimeCommand : public RuntimeCommand
+			{
+			public:
+				ScriptProfilerRuntimeCommand()
+				{
+					this->cues.push_back(GG_STR("sp"));
+					this->cues.push_back(GG_STR("scriptprofile"));
+				}
+
+				virtual String GetName() const  { return GG_STR("Script profiler"); };
+
+				virtual String GetHelpString() const { return GG_STR("sp [on|off|report [FILE]|stacks FILE|reset] - Controls the instruction-level profiler. Displays the per-line report if no argument is specified."); };
+
+				virtual void Run(Debugger* debugger, String arguments) const
+				{
+					runtime::VirtualMachine* vm = debugger->GetVirtualMachine();
+					runtime::ScriptProfiler& profiler = debugger->GetScriptProfiler();
+
+					size_t separatorPosition = arguments.find(GG_STR(" "));
+					String subcommand = arguments.substr(0, separatorPosition);
+					String fileName = separatorPosition != String::npos ? arguments.substr(separatorPosition + 1) : GG_STR("");
+
+					if (subcommand == GG_STR("on"))
+					{
+						vm->SetScriptProfiler(&profiler);
+						debugger->GetOut() << GG_STR("Script profiler enabled.") << std::endl << std::endl;
+					}
+					else if (subcommand == GG_STR("off"))
+					{
+						vm->SetScriptProfiler(NULL);
+						debugger->GetOut() << GG_STR("Script profiler disabled.") << std::endl << std::endl;
+					}
+					else if (subcommand == GG_STR("reset"))
+					{
+						profiler.Reset();
+						debugger->GetOut() << GG_STR("Collected profiling data discarded.") << std::endl << std::endl;
+					}
+					else if (subcommand == GG_STR("") || subcommand == GG_STR("report"))
+					{
+						if (fileName == GG_STR(""))
+						{
+							profiler.WriteReport(debugger->GetOut(), vm->GetCompiledScript().GetCode());
+							debugger->GetOut() << std::endl;
+						}
+						else
+						{
+							OFStream stream(fileName.c_str());
+							profiler.WriteReport(stream, vm->GetCompiledScript().GetCode());
+							this->PrintWriteResult(debugger, stream, fileName);
+						}
+					}
+					else if (subcommand == GG_STR("stacks") && fileName != GG_STR(""))
+					{
+						OFStream stream(fileName.c_str());
+						profiler.WriteCollapsedStacks(stream);
+						this->PrintWriteResult(debugger, stream, fileName);
+					}
+					else
+					{
+						debugger->GetOut() << GG_STR("Invalid arguments. ") << this->GetHelpString() << std::endl << std::endl;
+					}
+				}
+
+				void PrintWriteResult(Debugger* debugger, OFStream& stream, String const& fileName) const
+				{
+					stream.flush();
+					if (stream.fail())
+					{
+						debugger->GetOut() << GG_STR("Could not write \"") << fileName << GG_STR("\".") << std::endl << std::endl;
+					}
+					else
+					{
+						debugger->GetOut() << GG_STR("Saved \"") << fileName << GG_STR("\".") << std::endl << std::endl;
+					}
+				}
+			};
+		}
+	}
+}
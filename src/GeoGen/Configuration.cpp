@@ -23,4 +23,6 @@ void Configuration::Serialize(IOStream& stream) const
 {
 	stream << "MainMapIsMandatory: " << this->MainMapIsMandatory << endl;
 	stream << "RendererMemoryLimit: " << this->RendererMemoryLimit << endl;
+	stream << "CompilerOptimizationLevel: " << this->CompilerOptimizationLevel << endl;
+	stream << "SeedScheme: " << this->SeedScheme << endl;
 }
\ No newline at end of file
@@ -17,9 +17,21 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 #pragma once
 
 #include "Serializable.hpp"
+#include "random/RandomSeed.hpp"
 
 namespace geogen
 {
+	/// Levels of optimization the Compiler may apply to the generated code. Optimizations never change observable behavior of the script (including any runtime errors it triggers).
+	enum OptimizationLevel
+	{
+		/// The code is executed exactly as it was generated from the script.
+		OPTIMIZATION_LEVEL_NONE,
+		/// Operators applied to constants are evaluated during compilation and unreachable code is removed.
+		OPTIMIZATION_LEVEL_BASIC,
+		/// Same as OPTIMIZATION_LEVEL_BASIC, additionally removes local variables which are never read.
+		OPTIMIZATION_LEVEL_FULL
+	};
+
 	/// Settings allowing to slightly customize behavior of the generator.
 	class Configuration : public Serializable
 	{
@@ -30,9 +42,17 @@ namespace geogen
 		/// Maximum sum of memory footprints of all the maps allocated simultaneously by the Renderer, in bytes. Default: 100 MiB.
 		unsigned long RendererMemoryLimit;
 
+		/// Optimizations the Compiler applies to the generated code. Default: OPTIMIZATION_LEVEL_FULL.
+		OptimizationLevel CompilerOptimizationLevel;
+
+		/// Scheme used to derive layers of noises and steps of random sequences from the random seed. Changing the scheme changes the generated maps. Default: random::RANDOM_SEED_SCHEME_SEQUENTIAL.
+		random::RandomSeedScheme SeedScheme;
+
 		Configuration() :
 			MainMapIsMandatory(true),
-			RendererMemoryLimit(100 * 1024 * 1024) {};
+			RendererMemoryLimit(100 * 1024 * 1024),
+			CompilerOptimizationLevel(OPTIMIZATION_LEVEL_FULL),
+			SeedScheme(random::RANDOM_SEED_SCHEME_SEQUENTIAL) {};
 
 		virtual void Serialize(IOStream& stream) const;
 	};
@@ -129,6 +129,10 @@ namespace geogen
 	/// 
 	/// @snippet RenderProgress.cpp Body
 	/// @link RenderProgress.cpp Full code @endlink
+	///
+	/// To show a preview of the maps before the render is finished, the rendering sequence can be rendered using renderer::ProgressiveRenderer instead, which renders it repeatedly with the resolution doubled in each level. Maps of the most recently finished level are available from renderer::ProgressiveRenderer::GetRenderedMapTable. The script is executed only once, which is possible only if it doesn't read `Parameters.RenderScale` (see renderer::RenderingSequence::IsRenderScaleDependent).
+	///
+	/// Code which needs to be notified about each executed rendering step (for example to log or to measure it) can implement renderer::RendererObserver and register it using renderer::Renderer::AddObserver. The built-in renderer::RendererMetrics observer records wall time, CPU time, pixels and memory of each step, aggregates them by step type and exports them as JSON or in the Chrome trace event format. It also compares the peak memory predicted for each step (which is checked against Configuration::RendererMemoryLimit) with the memory actually allocated during it, as counted by the renderer's genlib::MemoryTracker::Account, and flags steps which allocated more than predicted.
 
 	/// @page tutorial_text_messages Handling text messages from scripts
 	/// This tutorial demonstrates how to handle text messages produced by the map scripts (using the Print function).
@@ -153,6 +157,8 @@ namespace geogen
 	/// @link MultipleTiles.cpp Full code @endlink
 	/// 	 
 	/// Whether a map is infinite can be determined by calling runtime::ScriptParameters::IsMapInfinite.
+	///
+	/// If the script doesn't read any of the render rectangle parameters (`Parameters.RenderOriginX`, `Parameters.RenderOriginY`, `Parameters.RenderWidth` and `Parameters.RenderHeight`), the rendering sequence it generates is the same for all tiles. In that case (which can be determined using renderer::RenderingSequence::IsRenderRectangleDependent) the script can be executed only once and its rendering sequence rendered into each tile by passing the tile's rectangle (obtained from runtime::ScriptParameters::GetActualRenderRectangle) to the renderer::Renderer constructor. All other script parameters must remain the same for all tiles.
 	
 
 
@@ -166,6 +172,7 @@ namespace geogen
 	/// - **Console** - C++ code of the command line interface. References antlr3, GeoGen, lpng1612 and zlib128. Builds as an executable.  
 	/// - **examples** - C++ code samples demonstrating usage of the GeoGen library. 
 	/// - **GeoGen** - C++ code of the height map generator library itself. References antlr3. Buils as a static library.  
+	/// - **GeoGen_Bench** - Benchmarks of the generator library (microbenchmarks of height map and height profile operations and end-to-end runs of map scripts), which write their results in JSON. References antlr3 and GeoGen. Builds as an executable (`make bench` builds it and runs it with the shipped example scripts).  
 	/// - **GeoGen_Tests** - A suite of automated C++ tests for the generator library. References antlr3, GeoGen, lpng1612 and zlib128. Builds as an executable.  
 	/// - **lpng1612** - C code of [libpng](http://www.libpng.org/pub/png/libpng.html). Builds as a static library.
 	/// - <b>png++</b> - C++ code of [png++](http://www.nongnu.org/pngpp/), a C++ wrapper for libpng. Headers only (does not build).  
@@ -162,6 +162,8 @@ namespace geogen
 		GGE2801_MainMapNotGenerated = 2801,
 		/// Rendering step requires too much memory.
 		GGE3001_RendererMemoryLimitReached = 3001,
+		/// Rendering was cancelled using a cancellation token or its deadline passed.
+		GGE3002_RendererCancelled = 3002,
 		/// API usage error - such as incorrect parameter or a method being called in incorrect context).
 		GGE4000_ApiUsageError = 4000,
 		/// An unrecoverable internal error in GeoGen occured. These should be reported as bugs (although an incorrect usage of the API might also be sometimes the cause).
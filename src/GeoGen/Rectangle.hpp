@@ -132,6 +132,26 @@ namespace geogen {
 			return *this;
 		}
 
+		/// Compares two rectangles.
+		/// @param other The other rectangle.
+		/// @return True if both position and size of the rectangles are equal.
+		inline bool operator==(const Rectangle& other) const
+		{
+			return
+				this->position.GetX() == other.position.GetX() &&
+				this->position.GetY() == other.position.GetY() &&
+				this->size.GetWidth() == other.size.GetWidth() &&
+				this->size.GetHeight() == other.size.GetHeight();
+		}
+
+		/// Compares two rectangles.
+		/// @param other The other rectangle.
+		/// @return True if either position or size of the rectangles differ.
+		inline bool operator!=(const Rectangle& other) const
+		{
+			return !(*this == other);
+		}
+
 		/// Gets position of top left corner.
 		/// @return The position.
 		inline Point GetPosition() const { return this->position; }
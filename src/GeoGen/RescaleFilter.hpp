@@ -0,0 +1,40 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+#include "String.hpp"
+
+namespace geogen
+{
+	/// Values that represent filters used when rescaling height maps and height profiles.
+	enum RescaleFilter
+	{
+		/// Nearest neighbor. Fastest, produces blocky results when enlarging.
+		RESCALE_FILTER_NEAREST,
+		/// Linear interpolation between the two nearest samples.
+		RESCALE_FILTER_BILINEAR,
+		/// Average of all samples covered by the target pixel. Avoids aliasing when shrinking, same as RESCALE_FILTER_BILINEAR when enlarging.
+		RESCALE_FILTER_BOX,
+		/// Cubic (Catmull-Rom) interpolation between the four nearest samples.
+		RESCALE_FILTER_BICUBIC
+	};
+
+	/// Converts RescaleFilter to string.
+	/// @param filter The filter.
+	/// @return The string.
+	String RescaleFilterToString(RescaleFilter filter);
+}
\ No newline at end of file
@@ -0,0 +1,384 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include "CodeOptimizer.hpp"
+#include "../GeoGenException.hpp"
+#include "../runtime/CompiledScript.hpp"
+#include "../runtime/CodeBlock.hpp"
+#include "../runtime/ScriptFunctionDefinition.hpp"
+#include "../runtime/instructions/BreakInstruction.hpp"
+#include "../runtime/instructions/CallBlockInstruction.hpp"
+#include "../runtime/instructions/CallGlobalInstruction.hpp"
+#include "../runtime/instructions/ContinueInstruction.hpp"
+#include "../runtime/instructions/DeclareGlobalValueInstruction.hpp"
+#include "../runtime/instructions/DeclareLocalValueInstruction.hpp"
+#include "../runtime/instructions/IfInstruction.hpp"
+#include "../runtime/instructions/LoadConstBooleanInstruction.hpp"
+#include "../runtime/instructions/LoadConstNumberInstruction.hpp"
+#include "../runtime/instructions/LoadConstStringInstruction.hpp"
+#include "../runtime/instructions/LoadNullInstruction.hpp"
+#include "../runtime/instructions/LoadScopeReferenceInstruction.hpp"
+#include "../runtime/instructions/LoadScopeValueInstruction.hpp"
+#include "../runtime/instructions/PopInstruction.hpp"
+#include "../runtime/instructions/StoreGlobalValueInstruction.hpp"
+#include "../runtime/instructions/StoreScopeValueInstruction.hpp"
+#include "../runtime/instructions/WhileInstruction.hpp"
+#include "../corelib/BinaryArithmeticOperatorFunctionDefinition.hpp"
+#include "../corelib/LogicalOperatorFunctionDefinition.hpp"
+#include "../corelib/NegationOperatorFunctionDefinition.hpp"
+#include "../corelib/RelationalOperatorFunctionDefinition.hpp"
+#include "../corelib/UnaryArithmeticOperatorFunctionDefinition.hpp"
+
+using namespace std;
+using namespace geogen;
+using namespace geogen::compiler;
+using namespace geogen::corelib;
+using namespace geogen::runtime;
+using namespace geogen::runtime::instructions;
+
+CodeOptimizer::CodeOptimizer(CompiledScript const& compiledScript, OptimizationLevel optimizationLevel)
+: compiledScript(compiledScript), optimizationLevel(optimizationLevel)
+{
+}
+
+void CodeOptimizer::Optimize()
+{
+	if (this->optimizationLevel == OPTIMIZATION_LEVEL_NONE)
+	{
+		return;
+	}
+
+	vector<FunctionDefinition*> const& functionDefinitions = this->compiledScript.GetOwnedFunctionDefinitions();
+
+	// Variables are matched by name only, across all functions of the script. That is conservative, but doesn't require resolving scopes.
+	this->variableReferenceCounts.clear();
+	for (vector<FunctionDefinition*>::const_iterator it = functionDefinitions.begin(); it != functionDefinitions.end(); it++)
+	{
+		ScriptFunctionDefinition* scriptFunctionDefinition = dynamic_cast<ScriptFunctionDefinition*>(*it);
+		if (scriptFunctionDefinition != NULL)
+		{
+			this->CountVariableReferences(scriptFunctionDefinition->GetRootCodeBlock());
+		}
+	}
+
+	for (vector<FunctionDefinition*>::const_iterator it = functionDefinitions.begin(); it != functionDefinitions.end(); it++)
+	{
+		ScriptFunctionDefinition* scriptFunctionDefinition = dynamic_cast<ScriptFunctionDefinition*>(*it);
+		if (scriptFunctionDefinition != NULL)
+		{
+			this->OptimizeCodeBlock(scriptFunctionDefinition->GetRootCodeBlock());
+		}
+	}
+}
+
+void CodeOptimizer::CountVariableReferences(CodeBlock const& codeBlock)
+{
+	for (CodeBlock::const_iterator it = codeBlock.Begin(); it != codeBlock.End(); it++)
+	{
+		Instruction const* instruction = *it;
+
+		if (DeclareLocalValueInstruction const* declareLocal = dynamic_cast<DeclareLocalValueInstruction const*>(instruction))
+		{
+			this->variableReferenceCounts[declareLocal->GetVariableName()]++;
+		}
+		else if (StoreScopeValueInstruction const* storeScope = dynamic_cast<StoreScopeValueInstruction const*>(instruction))
+		{
+			this->variableReferenceCounts[storeScope->GetVariableName()]++;
+		}
+		else if (LoadScopeValueInstruction const* loadScope = dynamic_cast<LoadScopeValueInstruction const*>(instruction))
+		{
+			this->variableReferenceCounts[loadScope->GetVariableName()]++;
+		}
+		else if (LoadScopeReferenceInstruction const* loadReference = dynamic_cast<LoadScopeReferenceInstruction const*>(instruction))
+		{
+			this->variableReferenceCounts[loadReference->GetVariableName()]++;
+		}
+		else if (DeclareGlobalValueInstruction const* declareGlobal = dynamic_cast<DeclareGlobalValueInstruction const*>(instruction))
+		{
+			this->variableReferenceCounts[declareGlobal->GetVariableName()]++;
+		}
+		else if (StoreGlobalValueInstruction const* storeGlobal = dynamic_cast<StoreGlobalValueInstruction const*>(instruction))
+		{
+			this->variableReferenceCounts[storeGlobal->GetVariableName()]++;
+		}
+		else if (IfInstruction const* ifInstruction = dynamic_cast<IfInstruction const*>(instruction))
+		{
+			this->CountVariableReferences(ifInstruction->GetIfBranchCodeBlock());
+			this->CountVariableReferences(ifInstruction->GetElseBranchCodeBlock());
+		}
+		else if (WhileInstruction const* whileInstruction = dynamic_cast<WhileInstruction const*>(instruction))
+		{
+			this->CountVariableReferences(whileInstruction->GetCodeBlock());
+		}
+		else if (CallBlockInstruction const* callBlockInstruction = dynamic_cast<CallBlockInstruction const*>(instruction))
+		{
+			this->CountVariableReferences(callBlockInstruction->GetCodeBlock());
+		}
+	}
+}
+
+void CodeOptimizer::OptimizeCodeBlock(CodeBlock& codeBlock)
+{
+	InstructionVector input = codeBlock.ReleaseInstructions();
+	InstructionVector output;
+
+	bool isUnreachable = false;
+	for (InstructionVector::iterator it = input.begin(); it != input.end(); it++)
+	{
+		Instruction const* instruction = *it;
+
+		if (isUnreachable)
+		{
+			delete instruction;
+			continue;
+		}
+
+		// The instructions are still exclusively owned by the compiler at this point, so their nested code blocks can be modified.
+		if (IfInstruction const* ifInstruction = dynamic_cast<IfInstruction const*>(instruction))
+		{
+			this->OptimizeCodeBlock(const_cast<IfInstruction*>(ifInstruction)->GetIfBranchCodeBlock());
+			this->OptimizeCodeBlock(const_cast<IfInstruction*>(ifInstruction)->GetElseBranchCodeBlock());
+		}
+		else if (WhileInstruction const* whileInstruction = dynamic_cast<WhileInstruction const*>(instruction))
+		{
+			this->OptimizeCodeBlock(const_cast<WhileInstruction*>(whileInstruction)->GetCodeBlock());
+
+			if (this->IsLoopBodyNeverExecuted(whileInstruction->GetCodeBlock()))
+			{
+				delete instruction;
+				continue;
+			}
+		}
+		else if (CallBlockInstruction const* callBlockInstruction = dynamic_cast<CallBlockInstruction const*>(instruction))
+		{
+			this->OptimizeCodeBlock(const_cast<CallBlockInstruction*>(callBlockInstruction)->GetCodeBlock());
+		}
+
+		if (this->TryFoldOperatorCall(output, instruction) || this->TryPruneIf(output, instruction))
+		{
+			continue;
+		}
+
+		if (this->optimizationLevel == OPTIMIZATION_LEVEL_FULL && this->TryRemoveUnusedVariable(output, instruction))
+		{
+			continue;
+		}
+
+		// Constants popped right after they were loaded.
+		if (dynamic_cast<PopInstruction const*>(instruction) != NULL && !output.empty() && (
+			dynamic_cast<LoadConstNumberInstruction const*>(output.back()) != NULL ||
+			dynamic_cast<LoadConstBooleanInstruction const*>(output.back()) != NULL ||
+			dynamic_cast<LoadConstStringInstruction const*>(output.back()) != NULL ||
+			dynamic_cast<LoadNullInstruction const*>(output.back()) != NULL))
+		{
+			delete output.back();
+			output.pop_back();
+			delete instruction;
+			continue;
+		}
+
+		output.push_back(instruction);
+
+		// Break, continue and return always leave the current code block.
+		if (dynamic_cast<BreakInstruction const*>(instruction) != NULL || dynamic_cast<ContinueInstruction const*>(instruction) != NULL)
+		{
+			isUnreachable = true;
+		}
+	}
+
+	for (InstructionVector::iterator it = output.begin(); it != output.end(); it++)
+	{
+		codeBlock.AddInstruction(*it);
+	}
+}
+
+bool CodeOptimizer::TryFoldOperatorCall(InstructionVector& output, Instruction const* instruction) const
+{
+	CallGlobalInstruction const* callInstruction = dynamic_cast<CallGlobalInstruction const*>(instruction);
+	if (callInstruction == NULL || callInstruction->GetArgumentCount() < 1 || (int)output.size() < callInstruction->GetArgumentCount())
+	{
+		return false;
+	}
+
+	FunctionDefinition const* functionDefinition = this->compiledScript.GetGlobalFunctionDefinitions().GetItem(callInstruction->GetFunctionName());
+	if (functionDefinition == NULL)
+	{
+		return false;
+	}
+
+	CodeLocation location = callInstruction->GetLocation();
+	Instruction const* foldedInstruction = NULL;
+
+	try
+	{
+		if (callInstruction->GetArgumentCount() == 2)
+		{
+			LoadConstNumberInstruction const* numberA = dynamic_cast<LoadConstNumberInstruction const*>(output[output.size() - 2]);
+			LoadConstNumberInstruction const* numberB = dynamic_cast<LoadConstNumberInstruction const*>(output[output.size() - 1]);
+			LoadConstBooleanInstruction const* booleanA = dynamic_cast<LoadConstBooleanInstruction const*>(output[output.size() - 2]);
+			LoadConstBooleanInstruction const* booleanB = dynamic_cast<LoadConstBooleanInstruction const*>(output[output.size() - 1]);
+
+			BinaryArithmeticOperatorFunctionDefinition const* arithmeticOperator = dynamic_cast<BinaryArithmeticOperatorFunctionDefinition const*>(functionDefinition);
+			RelationalOperatorFunctionDefinition const* relationalOperator = dynamic_cast<RelationalOperatorFunctionDefinition const*>(functionDefinition);
+			LogicalOperatorFunctionDefinition const* logicalOperator = dynamic_cast<LogicalOperatorFunctionDefinition const*>(functionDefinition);
+
+			if (numberA != NULL && numberB != NULL && arithmeticOperator != NULL)
+			{
+				foldedInstruction = new LoadConstNumberInstruction(location, arithmeticOperator->CallOperator(location, numberA->GetConstNumber(), numberB->GetConstNumber()));
+			}
+			else if (numberA != NULL && numberB != NULL && relationalOperator != NULL)
+			{
+				foldedInstruction = new LoadConstBooleanInstruction(location, relationalOperator->CallOperator(location, numberA->GetConstNumber(), numberB->GetConstNumber()));
+			}
+			else if (booleanA != NULL && booleanB != NULL && logicalOperator != NULL)
+			{
+				foldedInstruction = new LoadConstBooleanInstruction(location, logicalOperator->CallOperator(location, booleanA->GetConstBoolean(), booleanB->GetConstBoolean()));
+			}
+		}
+		else if (callInstruction->GetArgumentCount() == 1)
+		{
+			LoadConstNumberInstruction const* number = dynamic_cast<LoadConstNumberInstruction const*>(output.back());
+			LoadConstBooleanInstruction const* boolean = dynamic_cast<LoadConstBooleanInstruction const*>(output.back());
+
+			UnaryArithmeticOperatorFunctionDefinition const* unaryOperator = dynamic_cast<UnaryArithmeticOperatorFunctionDefinition const*>(functionDefinition);
+			NegationOperatorFunctionDefinition const* negationOperator = dynamic_cast<NegationOperatorFunctionDefinition const*>(functionDefinition);
+
+			if (number != NULL && unaryOperator != NULL)
+			{
+				foldedInstruction = new LoadConstNumberInstruction(location, unaryOperator->CallOperator(location, number->GetConstNumber()));
+			}
+			else if (boolean != NULL && negationOperator != NULL)
+			{
+				foldedInstruction = new LoadConstBooleanInstruction(location, !boolean->GetConstBoolean());
+			}
+		}
+	}
+	catch (GeoGenException&)
+	{
+		// The operation fails (overflow, division by zero...) - leave it to the runtime to report the error.
+		return false;
+	}
+
+	if (foldedInstruction == NULL)
+	{
+		return false;
+	}
+
+	for (int i = 0; i < callInstruction->GetArgumentCount(); i++)
+	{
+		delete output.back();
+		output.pop_back();
+	}
+
+	output.push_back(foldedInstruction);
+	delete instruction;
+
+	return true;
+}
+
+bool CodeOptimizer::TryPruneIf(InstructionVector& output, Instruction const* instruction) const
+{
+	IfInstruction const* ifInstruction = dynamic_cast<IfInstruction const*>(instruction);
+	if (ifInstruction == NULL || output.empty())
+	{
+		return false;
+	}
+
+	LoadConstBooleanInstruction const* condition = dynamic_cast<LoadConstBooleanInstruction const*>(output.back());
+	if (condition == NULL)
+	{
+		return false;
+	}
+
+	IfInstruction* mutableIfInstruction = const_cast<IfInstruction*>(ifInstruction);
+	CodeBlock& takenBranch = condition->GetConstBoolean() ? mutableIfInstruction->GetIfBranchCodeBlock() : mutableIfInstruction->GetElseBranchCodeBlock();
+
+	delete condition;
+	output.pop_back();
+
+	// The branch is still executed in its own code block, so scoping and break/continue block counts stay intact.
+	if (takenBranch.GetInstructionCount() > 0)
+	{
+		CallBlockInstruction* callBlockInstruction = new CallBlockInstruction(ifInstruction->GetLocation());
+		callBlockInstruction->GetCodeBlock().MoveInstructionsFrom(takenBranch);
+		output.push_back(callBlockInstruction);
+	}
+
+	delete instruction;
+
+	return true;
+}
+
+bool CodeOptimizer::TryRemoveUnusedVariable(InstructionVector& output, Instruction const* instruction) const
+{
+	// Declaration without an initializer.
+	DeclareLocalValueInstruction const* declareInstruction = dynamic_cast<DeclareLocalValueInstruction const*>(instruction);
+	if (declareInstruction != NULL && this->IsVariableUnused(declareInstruction->GetVariableName(), 1))
+	{
+		delete instruction;
+		return true;
+	}
+
+	// Declaration with an initializer (DeclareLocalValue x, StoreScopeValue x, Pop). The pop itself is kept, since the initializer value is still on the stack.
+	if (dynamic_cast<PopInstruction const*>(instruction) != NULL && output.size() >= 2)
+	{
+		DeclareLocalValueInstruction const* declareInstruction = dynamic_cast<DeclareLocalValueInstruction const*>(output[output.size() - 2]);
+		StoreScopeValueInstruction const* storeInstruction = dynamic_cast<StoreScopeValueInstruction const*>(output[output.size() - 1]);
+
+		if (declareInstruction != NULL && storeInstruction != NULL &&
+			declareInstruction->GetVariableName() == storeInstruction->GetVariableName() &&
+			this->IsVariableUnused(declareInstruction->GetVariableName(), 2))
+		{
+			delete storeInstruction;
+			delete declareInstruction;
+			output.pop_back();
+			output.pop_back();
+		}
+	}
+
+	return false;
+}
+
+bool CodeOptimizer::IsLoopBodyNeverExecuted(CodeBlock const& codeBlock) const
+{
+	if (codeBlock.GetInstructionCount() == 0)
+	{
+		return false;
+	}
+
+	// Break leaving just the loop.
+	BreakInstruction const* breakInstruction = dynamic_cast<BreakInstruction const*>(*codeBlock.Begin());
+	if (breakInstruction != NULL)
+	{
+		return breakInstruction->GetCodeBlockCount() == 1;
+	}
+
+	// Pruned loop condition - a code block starting with a break leaving the code block and the loop.
+	CallBlockInstruction const* callBlockInstruction = dynamic_cast<CallBlockInstruction const*>(*codeBlock.Begin());
+	if (callBlockInstruction != NULL && callBlockInstruction->GetCodeBlock().GetInstructionCount() > 0)
+	{
+		breakInstruction = dynamic_cast<BreakInstruction const*>(*callBlockInstruction->GetCodeBlock().Begin());
+		return breakInstruction != NULL && breakInstruction->GetCodeBlockCount() == 2;
+	}
+
+	return false;
+}
+
+bool CodeOptimizer::IsVariableUnused(String const& variableName, unsigned expectedReferenceCount) const
+{
+	map<String, unsigned>::const_iterator it = this->variableReferenceCounts.find(variableName);
+	return it != this->variableReferenceCounts.end() && it->second == expectedReferenceCount;
+}
@@ -0,0 +1,75 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+#include <vector>
+#include <map>
+
+#include "../Configuration.hpp"
+#include "../String.hpp"
+
+namespace geogen
+{
+	namespace runtime
+	{
+		class CompiledScript;
+		class CodeBlock;
+
+		namespace instructions
+		{
+			class Instruction;
+		}
+	}
+
+	namespace compiler
+	{
+		/// Optimizes instructions generated by the Compiler. Performed optimizations depend on the OptimizationLevel:
+		/// @li Operators applied to constant numbers and booleans are evaluated during compilation (unless the evaluation triggers an error, which is then left to be reported in runtime).
+		/// @li Branches of if statements with constant conditions are pruned, loops which never execute their body are removed.
+		/// @li Instructions following a break, continue or return in the same code block are removed.
+		/// @li Local variables which are declared and initialized but never used are removed (only at OPTIMIZATION_LEVEL_FULL). The initializer expression is still evaluated.
+		class CodeOptimizer
+		{
+		private:
+			typedef std::vector<runtime::instructions::Instruction const*> InstructionVector;
+
+			runtime::CompiledScript const& compiledScript;
+			OptimizationLevel optimizationLevel;
+			std::map<String, unsigned> variableReferenceCounts;
+
+			// Non-copyable
+			CodeOptimizer(CodeOptimizer const&);
+			CodeOptimizer& operator=(CodeOptimizer const&);
+
+			void CountVariableReferences(runtime::CodeBlock const& codeBlock);
+			void OptimizeCodeBlock(runtime::CodeBlock& codeBlock);
+			bool TryFoldOperatorCall(InstructionVector& output, runtime::instructions::Instruction const* instruction) const;
+			bool TryPruneIf(InstructionVector& output, runtime::instructions::Instruction const* instruction) const;
+			bool TryRemoveUnusedVariable(InstructionVector& output, runtime::instructions::Instruction const* instruction) const;
+			bool IsLoopBodyNeverExecuted(runtime::CodeBlock const& codeBlock) const;
+			bool IsVariableUnused(String const& variableName, unsigned expectedReferenceCount) const;
+		public:
+			/// Initializes a new instance of the CodeOptimizer class.
+			/// @param compiledScript The script whose code is to be optimized. Its function definitions (including the main function) must already be added.
+			/// @param optimizationLevel The optimization level.
+			CodeOptimizer(runtime::CompiledScript const& compiledScript, OptimizationLevel optimizationLevel);
+
+			/// Optimizes code of all functions owned by the script.
+			void Optimize();
+		};
+	}
+}
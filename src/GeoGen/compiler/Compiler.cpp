@@ -23,6 +23,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 #include "../Grammar/output/GeoGenScriptDecls.h"
 
 #include "../runtime/instructions/IfInstruction.hpp"
+#include "../runtime/instructions/WhileInstruction.hpp"
+#include "../runtime/instructions/CallBlockInstruction.hpp"
+#include "../runtime/instructions/CallMemberInstruction.hpp"
+#include "../runtime/instructions/LoadMemberValueInstruction.hpp"
 #include "../runtime/ScriptFunctionDefinition.hpp"
 
 #include "Compiler.hpp"
@@ -30,14 +34,51 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 #include "../corelib/ParametersTypeDefinition.hpp"
 #include "../utils/StringUtils.hpp"
 #include "MainMapNotSupportedByScriptException.hpp"
+#include "CodeOptimizer.hpp"
 
 
 using namespace std;
 using namespace geogen;
 using namespace geogen::runtime;
+using namespace geogen::runtime::instructions;
 using namespace geogen::utils;
 //using namespace geogen_generated;
 
+namespace
+{
+	// Gives each member access instruction its own index into the inline cache entries of virtual machines.
+	void AssignInlineCacheSlots(CodeBlock const& codeBlock, unsigned& slotCount)
+	{
+		for (CodeBlock::const_iterator it = codeBlock.Begin(); it != codeBlock.End(); it++)
+		{
+			// The instructions are owned by the script, which isn't returned to the caller yet.
+			Instruction* instruction = const_cast<Instruction*>(*it);
+
+			if (CallMemberInstruction* callMember = dynamic_cast<CallMemberInstruction*>(instruction))
+			{
+				callMember->SetInlineCacheSlot(slotCount++);
+			}
+			else if (LoadMemberValueInstruction* loadMember = dynamic_cast<LoadMemberValueInstruction*>(instruction))
+			{
+				loadMember->SetInlineCacheSlot(slotCount++);
+			}
+			else if (IfInstruction const* ifInstruction = dynamic_cast<IfInstruction const*>(instruction))
+			{
+				AssignInlineCacheSlots(ifInstruction->GetIfBranchCodeBlock(), slotCount);
+				AssignInlineCacheSlots(ifInstruction->GetElseBranchCodeBlock(), slotCount);
+			}
+			else if (WhileInstruction const* whileInstruction = dynamic_cast<WhileInstruction const*>(instruction))
+			{
+				AssignInlineCacheSlots(whileInstruction->GetCodeBlock(), slotCount);
+			}
+			else if (CallBlockInstruction const* callBlockInstruction = dynamic_cast<CallBlockInstruction const*>(instruction))
+			{
+				AssignInlineCacheSlots(callBlockInstruction->GetCodeBlock(), slotCount);
+			}
+		}
+	}
+}
+
 Compiler::Compiler(Configuration configuration) : configuration(configuration) {}
 
 CompiledScript* Compiler::CompileScript(String const& code) const
@@ -123,6 +164,22 @@ CompiledScript* Compiler::CompileScript(String const& code) const
 				throw MainMapNotSupportedByScriptException(CodeLocation(walker.GetPtr()->lines.size(), 0));
 			}
 		}
+
+		CodeOptimizer optimizer(*script, this->configuration.CompilerOptimizationLevel);
+		optimizer.Optimize();
+
+		// Slots are assigned only once the optimizer has finished rewriting the code.
+		unsigned inlineCacheSlotCount = 0;
+		for (vector<FunctionDefinition*>::const_iterator it = script->GetOwnedFunctionDefinitions().begin(); it != script->GetOwnedFunctionDefinitions().end(); it++)
+		{
+			ScriptFunctionDefinition* scriptFunctionDefinition = dynamic_cast<ScriptFunctionDefinition*>(*it);
+			if (scriptFunctionDefinition != NULL)
+			{
+				AssignInlineCacheSlots(scriptFunctionDefinition->GetRootCodeBlock(), inlineCacheSlotCount);
+			}
+		}
+
+		script->SetInlineCacheSlotCount(inlineCacheSlotCount);
 	}
 
 	return script.release();
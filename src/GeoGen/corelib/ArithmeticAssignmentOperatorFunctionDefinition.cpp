@@ -45,16 +45,14 @@ ArithmeticAssignmentOperatorFunctionDefinition* ArithmeticAssignmentOperatorFunc
 	}
 }
 
-ManagedObject* ArithmeticAssignmentOperatorFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, vector<ManagedObject*> arguments) const
+ManagedObject* ArithmeticAssignmentOperatorFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, NativeArgumentList& arguments) const
 {
 	ReferenceTypeDefinition const* referenceTypeDefinition = dynamic_cast<ReferenceTypeDefinition const*>(vm->GetTypeDefinition(GG_STR("<Reference>")));
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
 
-	vector<TypeDefinition const*> expectedTypes;
-	expectedTypes.push_back(referenceTypeDefinition);
-	expectedTypes.push_back(numberTypeDefinition);
+	TypeDefinition const* expectedTypes[] = { referenceTypeDefinition, numberTypeDefinition };
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments);
+	this->CheckArguments(vm, location, expectedTypes, arguments);
 
 	ReferenceObject* reference = dynamic_cast<ReferenceObject*>(arguments[0]);
 
@@ -40,7 +40,7 @@ ArrayContainsFunctionDefinition* ArrayContainsFunctionDefinition::Create(Method
 	}
 }
 
-ManagedObject* ArrayContainsFunctionDefinition::CallNative(CodeLocation location, runtime::VirtualMachine* vm, runtime::ManagedObject* instance, vector<ManagedObject*> arguments) const
+ManagedObject* ArrayContainsFunctionDefinition::CallNative(CodeLocation location, runtime::VirtualMachine* vm, runtime::ManagedObject* instance, NativeArgumentList& arguments) const
 {
 	this->CheckArguments(location, 1, arguments);
 
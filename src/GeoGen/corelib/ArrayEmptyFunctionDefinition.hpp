@@ -33,7 +33,7 @@ namespace geogen
 		public:
 			ArrayEmptyFunctionDefinition(ArrayTypeDefinition const* owningType) : MemberNativeFunctionDefinition(GG_STR("Empty"), owningType) {};
 
-			virtual runtime::ManagedObject* CallNative(CodeLocation location, runtime::VirtualMachine* vm, runtime::ManagedObject* instance, std::vector<runtime::ManagedObject*> arguments) const;
+			virtual runtime::ManagedObject* CallNative(CodeLocation location, runtime::VirtualMachine* vm, runtime::ManagedObject* instance, runtime::NativeArgumentList& arguments) const;
 
 			virtual runtime::MethodType GetMethodType() const { return runtime::METHOD_TYPE_STATIC; };
 		};
@@ -27,15 +27,15 @@ using namespace geogen;
 using namespace geogen::corelib;
 using namespace geogen::runtime;
 
-ManagedObject* ArrayFromListFunctionDefinition::CallNative(CodeLocation location, runtime::VirtualMachine* vm, runtime::ManagedObject* instance, vector<ManagedObject*> arguments) const
+ManagedObject* ArrayFromListFunctionDefinition::CallNative(CodeLocation location, runtime::VirtualMachine* vm, runtime::ManagedObject* instance, NativeArgumentList& arguments) const
 {	
 	// Make sure the number of arguments is even
-	this->CheckArguments(location, arguments.size() - arguments.size() % 2, arguments);
+	this->CheckArguments(location, arguments.Size() - arguments.Size() % 2, arguments);
 
 	ArrayTypeDefinition const* arrayTypeDefinition = dynamic_cast<ArrayTypeDefinition const*>(instance->GetType());
 	ArrayObject* returnObject = dynamic_cast<ArrayObject*>(arrayTypeDefinition->CreateInstance(vm));
 
-	for (unsigned i = 0; i < arguments.size() / 2; i++)
+	for (unsigned i = 0; i < arguments.Size() / 2; i++)
 	{
 		ManagedObject* key = arguments[unsigned(i * 2 + 1)];
 		ManagedObject* value = arguments[unsigned(i * 2)];
@@ -33,7 +33,7 @@ namespace geogen
 		public:			
 			ArrayFromListFunctionDefinition(ArrayTypeDefinition const* owningType) : MemberNativeFunctionDefinition(GG_STR("<FromList>"), owningType) {}; // This function is not available to scripts, hece the unpronouncable name.
 
-			virtual runtime::ManagedObject* CallNative(CodeLocation location, runtime::VirtualMachine* vm, runtime::ManagedObject* instance, std::vector<runtime::ManagedObject*> arguments) const;
+			virtual runtime::ManagedObject* CallNative(CodeLocation location, runtime::VirtualMachine* vm, runtime::ManagedObject* instance, runtime::NativeArgumentList& arguments) const;
 
 			virtual runtime::MethodType GetMethodType() const { return runtime::METHOD_TYPE_STATIC; };
 		};
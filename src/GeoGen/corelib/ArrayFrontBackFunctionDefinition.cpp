@@ -40,7 +40,7 @@ ArrayFrontBackFunctionDefinition* ArrayFrontBackFunctionDefinition::Create(Metho
 	}
 }
 
-ManagedObject* ArrayFrontBackFunctionDefinition::CallNative(CodeLocation location, runtime::VirtualMachine* vm, runtime::ManagedObject* instance, vector<ManagedObject*> arguments) const
+ManagedObject* ArrayFrontBackFunctionDefinition::CallNative(CodeLocation location, runtime::VirtualMachine* vm, runtime::ManagedObject* instance, NativeArgumentList& arguments) const
 {
 	this->CheckArguments(location, 0, arguments);
 
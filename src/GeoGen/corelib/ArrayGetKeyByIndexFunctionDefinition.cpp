@@ -26,13 +26,12 @@ using namespace geogen;
 using namespace geogen::corelib;
 using namespace geogen::runtime;
 
-ManagedObject* ArrayGetKeyByIndexFunctionDefinition::CallNative(CodeLocation location, runtime::VirtualMachine* vm, runtime::ManagedObject* instance, vector<ManagedObject*> arguments) const
+ManagedObject* ArrayGetKeyByIndexFunctionDefinition::CallNative(CodeLocation location, runtime::VirtualMachine* vm, runtime::ManagedObject* instance, NativeArgumentList& arguments) const
 {
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
-	vector<TypeDefinition const*> expectedTypes;
-	expectedTypes.push_back(numberTypeDefinition);
+	TypeDefinition const* expectedTypes[] = { numberTypeDefinition };
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments);
+	this->CheckArguments(vm, location, expectedTypes, arguments);
 	
 	ArrayObject* thisArray = dynamic_cast<ArrayObject*>(instance);
 
@@ -38,7 +38,7 @@ ArrayRemoveFunctionDefinition* ArrayRemoveFunctionDefinition::Create(Method meth
 	}
 }
 
-ManagedObject* ArrayRemoveFunctionDefinition::CallNative(CodeLocation location, runtime::VirtualMachine* vm, runtime::ManagedObject* instance, vector<ManagedObject*> arguments) const
+ManagedObject* ArrayRemoveFunctionDefinition::CallNative(CodeLocation location, runtime::VirtualMachine* vm, runtime::ManagedObject* instance, NativeArgumentList& arguments) const
 {
 	this->CheckArguments(location, 1, arguments);
 
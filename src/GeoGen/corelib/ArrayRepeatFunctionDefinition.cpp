@@ -26,15 +26,13 @@ using namespace geogen;
 using namespace geogen::corelib;
 using namespace geogen::runtime;
 
-ManagedObject* ArrayRepeatFunctionDefinition::CallNative(CodeLocation location, runtime::VirtualMachine* vm, runtime::ManagedObject* instance, vector<ManagedObject*> arguments) const
+ManagedObject* ArrayRepeatFunctionDefinition::CallNative(CodeLocation location, runtime::VirtualMachine* vm, runtime::ManagedObject* instance, NativeArgumentList& arguments) const
 {
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
 
-	vector<TypeDefinition const*> expectedTypes;
-	expectedTypes.push_back(arguments.size() > 0 ? arguments[0]->GetType() : numberTypeDefinition);
-	expectedTypes.push_back(numberTypeDefinition);
+	TypeDefinition const* expectedTypes[] = { arguments.Size() > 0 ? arguments[0]->GetType() : numberTypeDefinition, numberTypeDefinition };
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments);
+	this->CheckArguments(vm, location, expectedTypes, arguments);
 
 	int number = NumberToInt(dynamic_cast<NumberObject*>(arguments[1])->GetValue());
 
@@ -28,15 +28,14 @@ using namespace geogen::corelib;
 using namespace geogen::runtime;
 using namespace geogen::random;
 
-ManagedObject* ArrayShuffleFunctionDefinition::CallNative(CodeLocation location, runtime::VirtualMachine* vm, runtime::ManagedObject* instance, vector<ManagedObject*> arguments) const
+ManagedObject* ArrayShuffleFunctionDefinition::CallNative(CodeLocation location, runtime::VirtualMachine* vm, runtime::ManagedObject* instance, NativeArgumentList& arguments) const
 {
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
-	vector<TypeDefinition const*> expectedTypes;
-	expectedTypes.push_back(numberTypeDefinition);
+	TypeDefinition const* expectedTypes[] = { numberTypeDefinition };
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments, 0);
+	this->CheckArguments(vm, location, expectedTypes, arguments, 0);
 
-	RandomSeed seed = arguments.size() > 0 ? (RandomSeed)NumberToInt(dynamic_cast<NumberObject*>(arguments[0])->GetValue()) : (RandomSeed)vm->GetCommonRandomSequence().NextUInt();
+	RandomSeed seed = arguments.Size() > 0 ? (RandomSeed)NumberToInt(dynamic_cast<NumberObject*>(arguments[0])->GetValue()) : (RandomSeed)vm->GetCommonRandomSequence().NextUInt();
 
 	RandomSeed finalSeed = CombineSeeds(vm->GetArguments().GetRandomSeed(), seed, CreateSeed(GG_STR("Array.Shuffle")));
 
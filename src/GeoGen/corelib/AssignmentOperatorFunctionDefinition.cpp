@@ -25,7 +25,7 @@ using namespace geogen;
 using namespace geogen::corelib;
 using namespace geogen::runtime;
 
-ManagedObject* AssignmentOperatorFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, vector<ManagedObject*> arguments) const
+ManagedObject* AssignmentOperatorFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, NativeArgumentList& arguments) const
 {
 	this->CheckArguments(location, 1, arguments);
 
@@ -46,15 +46,13 @@ BinaryArithmeticOperatorFunctionDefinition* BinaryArithmeticOperatorFunctionDefi
 	}
 }
 
-ManagedObject* BinaryArithmeticOperatorFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, vector<ManagedObject*> arguments) const
+ManagedObject* BinaryArithmeticOperatorFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, NativeArgumentList& arguments) const
 {
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
     
-    vector<TypeDefinition const*> expectedTypes;
-	expectedTypes.push_back(numberTypeDefinition);
-	expectedTypes.push_back(numberTypeDefinition);
+    TypeDefinition const* expectedTypes[] = { numberTypeDefinition, numberTypeDefinition };
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments);
+	this->CheckArguments(vm, location, expectedTypes, arguments);
 
 	NumberObject* a = dynamic_cast<NumberObject*>(arguments[0]);
 	NumberObject* b = dynamic_cast<NumberObject*>(arguments[1]);
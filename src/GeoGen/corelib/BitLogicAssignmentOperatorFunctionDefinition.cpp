@@ -41,7 +41,7 @@ BitLogicAssignmentOperatorFunctionDefinition* BitLogicAssignmentOperatorFunction
 	}
 }
 
-ManagedObject* BitLogicAssignmentOperatorFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, vector<ManagedObject*> arguments) const
+ManagedObject* BitLogicAssignmentOperatorFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, NativeArgumentList& arguments) const
 {
 	ReferenceTypeDefinition const* referenceTypeDefinition = dynamic_cast<ReferenceTypeDefinition const*>(vm->GetTypeDefinition(GG_STR("<Reference>")));
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
@@ -53,11 +53,9 @@ ManagedObject* BitLogicAssignmentOperatorFunctionDefinition::CallNative(CodeLoca
 		returnsNumber = false;
 	}
 
-	vector<TypeDefinition const*> expectedTypes;
-	expectedTypes.push_back(referenceTypeDefinition);
-	expectedTypes.push_back(returnsNumber ? (TypeDefinition const*)numberTypeDefinition : (TypeDefinition const*)booleanTypeDefinition);
+	TypeDefinition const* expectedTypes[] = { referenceTypeDefinition, returnsNumber ? (TypeDefinition const*)numberTypeDefinition : (TypeDefinition const*)booleanTypeDefinition };
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments);
+	this->CheckArguments(vm, location, expectedTypes, arguments);
 
 	ReferenceObject* reference = dynamic_cast<ReferenceObject*>(arguments[0]);
 
@@ -37,7 +37,7 @@ BitLogicOperatorFunctionDefinition* BitLogicOperatorFunctionDefinition::Create(O
 	}
 }
 
-ManagedObject* BitLogicOperatorFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, vector<ManagedObject*> arguments) const
+ManagedObject* BitLogicOperatorFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, NativeArgumentList& arguments) const
 {
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
 	BooleanTypeDefinition const* booleanTypeDefinition = vm->GetBooleanTypeDefinition();
@@ -46,7 +46,7 @@ ManagedObject* BitLogicOperatorFunctionDefinition::CallNative(CodeLocation locat
 
 	bool returnsNumber = false;
 	std::vector<int> values;
-	for (unsigned i = 0; i < arguments.size(); i++)
+	for (unsigned i = 0; i < arguments.Size(); i++)
 	{
 		ManagedObject* arg = arguments[i];
 
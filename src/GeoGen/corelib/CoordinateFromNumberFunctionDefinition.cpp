@@ -26,15 +26,14 @@ using namespace corelib;
 using namespace runtime;
 using namespace renderer;
 
-ManagedObject* CoordinateFromNumberFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, vector<ManagedObject*> arguments) const
+ManagedObject* CoordinateFromNumberFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, NativeArgumentList& arguments) const
 {
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
 	CoordinateTypeDefinition const* coordinateType = dynamic_cast<CoordinateTypeDefinition const*>(this->GetOwningTypeDefinition());
 
-	vector<TypeDefinition const*> expectedTypes;
-	expectedTypes.push_back(numberTypeDefinition);
+	TypeDefinition const* expectedTypes[] = { numberTypeDefinition };
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments);
+	this->CheckArguments(vm, location, expectedTypes, arguments);
 
 	Number input = dynamic_cast<NumberObject*>(arguments[0])->GetValue();
 
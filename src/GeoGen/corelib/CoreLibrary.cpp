@@ -22,6 +22,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 #include "PointTypeDefinition.hpp"
 #include "ArrayTypeDefinition.hpp"
 #include "DirectionTypeDefinition.hpp"
+#include "RescaleFilterTypeDefinition.hpp"
 #include "ReferenceTypeDefinition.hpp"
 #include "BinaryArithmeticOperatorFunctionDefinition.hpp"
 #include "ArithmeticAssignmentOperatorFunctionDefinition.hpp"
@@ -66,6 +67,7 @@ CoreLibrary::CoreLibrary()
 
 	// Enums
 	this->typeDefinitions.AddItem(DirectionTypeDefinition::Create());
+	this->typeDefinitions.AddItem(RescaleFilterTypeDefinition::Create());
 
     // Core operators
 	this->globalFunctionDefinitions.AddItem(new AssignmentOperatorFunctionDefinition());
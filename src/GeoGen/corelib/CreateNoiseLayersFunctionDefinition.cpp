@@ -33,29 +33,26 @@ using namespace geogen::corelib;
 using namespace geogen::runtime;
 using namespace geogen::genlib;
 
-ManagedObject* CreateNoiseLayersFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, vector<ManagedObject*> arguments) const
+ManagedObject* CreateNoiseLayersFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, NativeArgumentList& arguments) const
 {
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
 	ArrayTypeDefinition const* arrayTypeDefinition = dynamic_cast<ArrayTypeDefinition const*>(vm->GetTypeDefinition(GG_STR("Array")));
 
-	vector<TypeDefinition const*> expectedParameters;
-	expectedParameters.push_back(numberTypeDefinition);
-	expectedParameters.push_back(numberTypeDefinition);
-	expectedParameters.push_back(numberTypeDefinition);
+	TypeDefinition const* expectedParameters[] = { numberTypeDefinition, numberTypeDefinition, numberTypeDefinition };
 	//expectedParameters.push_back(numberTypeDefinition);
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedParameters, arguments, 0);
+	this->CheckArguments(vm, location, expectedParameters, arguments, 0);
 
 	Size1D minimumFeatureSize;
 	Size1D maximumFeatureSize;
 	double persistence;
-	if (arguments.size() == 0)
+	if (arguments.Size() == 0)
 	{
 		minimumFeatureSize = 1;
 		maximumFeatureSize = 256;
 		persistence = 0.5;
 	}
-	else if (arguments.size() == 1)
+	else if (arguments.Size() == 1)
 	{
 		minimumFeatureSize = 1;
 		maximumFeatureSize = (Size1D)NumberToInt(dynamic_cast<NumberObject*>(arguments[0])->GetValue());
@@ -65,7 +62,7 @@ ManagedObject* CreateNoiseLayersFunctionDefinition::CallNative(CodeLocation loca
 	{
 		minimumFeatureSize = (Size1D)NumberToInt(dynamic_cast<NumberObject*>(arguments[0])->GetValue());
 		maximumFeatureSize = (Size1D)NumberToInt(dynamic_cast<NumberObject*>(arguments[1])->GetValue());
-		persistence = arguments.size() > 2 ? dynamic_cast<NumberObject*>(arguments[2])->GetValue() : 0.50;
+		persistence = arguments.Size() > 2 ? dynamic_cast<NumberObject*>(arguments[2])->GetValue() : 0.50;
 	}
 	
 	if (minimumFeatureSize > maximumFeatureSize)
@@ -35,7 +35,7 @@ EqualityOperatorFunctionDefinition* EqualityOperatorFunctionDefinition::Create(O
 	}
 }
 
-ManagedObject* EqualityOperatorFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, vector<ManagedObject*> arguments) const
+ManagedObject* EqualityOperatorFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, NativeArgumentList& arguments) const
 {
 	BooleanTypeDefinition const* booleanTypeDefinition = vm->GetBooleanTypeDefinition();
 
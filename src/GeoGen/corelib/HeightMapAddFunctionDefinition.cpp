@@ -30,29 +30,29 @@ using namespace geogen::corelib;
 using namespace geogen::runtime;
 using namespace geogen::renderer;
 
-ManagedObject* HeightMapAddFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, vector<ManagedObject*> arguments) const
+ManagedObject* HeightMapAddFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, NativeArgumentList& arguments) const
 {
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
     
-    vector<TypeDefinition const*> expectedTypes;
+    TypeDefinition const* expectedTypes[2];
 
 	bool isHeightMode;
-	if (arguments.size() > 0 && arguments[0]->GetType() == this->GetOwningTypeDefinition())
+	if (arguments.Size() > 0 && arguments[0]->GetType() == this->GetOwningTypeDefinition())
 	{
 		isHeightMode = false;
-		expectedTypes.push_back(this->GetOwningTypeDefinition());
+		expectedTypes[0] = this->GetOwningTypeDefinition();
 	}	
 	else 
     {
 		isHeightMode = true;
-		expectedTypes.push_back(numberTypeDefinition);
+		expectedTypes[0] = numberTypeDefinition;
 	}
 
-	expectedTypes.push_back(this->GetOwningTypeDefinition()); // mask
+	expectedTypes[1] = this->GetOwningTypeDefinition(); // mask
 
-	bool hasMask = arguments.size() > 1;
+	bool hasMask = arguments.Size() > 1;
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments, 1);
+	this->CheckArguments(vm, location, expectedTypes, arguments, 1);
 
 	vector<unsigned> argumentSlots;
 	argumentSlots.push_back(vm->GetRendererObjectSlotTable().GetObjectSlotByAddress(instance));
@@ -35,8 +35,13 @@ void HeightMapBlurRenderingStep::Step(Renderer* renderer) const
 
 void HeightMapBlurRenderingStep::UpdateRenderingBounds(Renderer* renderer, std::vector<RenderingBounds*> argumentBounds) const
 {
-	dynamic_cast<RenderingBounds2D*>(argumentBounds[0])->CombineRectangle(
-		Rectangle::Expand(this->GetRenderingBounds(renderer), renderer->GetRenderingSequence().GetScaledSize(this->radius)));
+	RenderingBounds2D::Cast(argumentBounds[0])->CombineRectangle(
+		Rectangle::Expand(this->GetRenderingBounds(renderer), renderer->GetScaledSize(this->radius)));
+}
+
+unsigned HeightMapBlurRenderingStep::GetPeakExtraMemory(Renderer* renderer, std::vector<RenderingBounds const*> argumentBounds) const
+{
+	return RenderingBounds2D::Cast(argumentBounds[0])->GetMemorySize(renderer->GetRenderScale());
 }
 
 void HeightMapBlurRenderingStep::SerializeArguments(IOStream& stream) const
@@ -28,14 +28,13 @@ using namespace geogen::corelib;
 using namespace geogen::runtime;
 using namespace geogen::renderer;
 
-ManagedObject* HeightMapCellNoiseFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, vector<ManagedObject*> arguments) const
+ManagedObject* HeightMapCellNoiseFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, NativeArgumentList& arguments) const
 {
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
 
-	vector<TypeDefinition const*> expectedTypes;
-	expectedTypes.push_back(numberTypeDefinition);
+	TypeDefinition const* expectedTypes[] = { numberTypeDefinition };
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments, 1);
+	this->CheckArguments(vm, location, expectedTypes, arguments, 1);
 
 	Number numberHeight = ((NumberObject*)arguments[0])->GetValue();
 	Size1D size;
@@ -44,14 +43,15 @@ ManagedObject* HeightMapCellNoiseFunctionDefinition::CallNative(CodeLocation loc
 		throw SizeOverflowException(location);
 	}
 
-	random::RandomSeed argumentSeed = arguments.size() > 1 ? (random::RandomSeed)dynamic_cast<NumberObject*>(arguments[1])->GetValue() : 0;
+	random::RandomSeed argumentSeed = arguments.Size() > 1 ? (random::RandomSeed)dynamic_cast<NumberObject*>(arguments[1])->GetValue() : 0;
 	random::RandomSeed compositeSeed = random::CombineSeeds(argumentSeed, vm->GetArguments().GetRandomSeed());
+	random::RandomSeedScheme seedScheme = vm->GetCompiledScript().GetConfiguration().SeedScheme;
 
 	ManagedObject* returnObject = dynamic_cast<HeightMapTypeDefinition const*>(instance->GetType())->CreateInstance(vm);
 
 	vector<unsigned> argumentSlots;
 	unsigned returnObjectSlot = vm->GetRendererObjectSlotTable().GetObjectSlotByAddress(returnObject);
-	RenderingStep* renderingStep = new HeightMapCellNoiseRenderingStep(location, argumentSlots, returnObjectSlot, size, compositeSeed);
+	RenderingStep* renderingStep = new HeightMapCellNoiseRenderingStep(location, argumentSlots, returnObjectSlot, size, compositeSeed, seedScheme);
 	vm->AddRenderingStep(location, renderingStep);
 
 	return returnObject;
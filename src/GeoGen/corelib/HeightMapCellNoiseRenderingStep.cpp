@@ -28,8 +28,8 @@ using namespace genlib;
 
 void HeightMapCellNoiseRenderingStep::Step(Renderer* renderer) const
 {
-	HeightMap* map = new HeightMap(dynamic_cast<RenderingBounds2D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->GetRectangle(), 0, renderer->GetRenderingSequence().GetRenderScale());
-	map->CellNoise(this->meanCellSize, this->seed);
+	HeightMap* map = new HeightMap(renderer->GetRenderingSequenceMetadata().GetRenderingBounds2D(this)->GetRectangle(), 0, renderer->GetRenderScale());
+	map->CellNoise(this->meanCellSize, this->seed, this->seedScheme);
 	
 	RendererObject* object = new RendererObject(RENDERER_OBJECT_TYPE_HEIGHT_MAP, map);
 
@@ -38,10 +38,10 @@ void HeightMapCellNoiseRenderingStep::Step(Renderer* renderer) const
 
 unsigned HeightMapCellNoiseRenderingStep::GetPeakExtraMemory(Renderer* renderer, std::vector<RenderingBounds const*> argumentBounds) const
 {
-	return dynamic_cast<RenderingBounds2D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->GetMemorySize(renderer->GetRenderingSequence().GetRenderScale());
+	return renderer->GetRenderingSequenceMetadata().GetRenderingBounds2D(this)->GetMemorySize(renderer->GetRenderScale());
 }
 
 void HeightMapCellNoiseRenderingStep::SerializeArguments(IOStream& stream) const
 {
-	stream << this->meanCellSize;
+	stream << this->meanCellSize << GG_STR(", ") << this->seed << GG_STR(", ") << this->seedScheme;
 }
\ No newline at end of file
@@ -29,9 +29,10 @@ namespace geogen
 		private:
 			Size1D meanCellSize;
 			random::RandomSeed seed;
+			random::RandomSeedScheme seedScheme;
 		public:
-			HeightMapCellNoiseRenderingStep(CodeLocation location, std::vector<unsigned> const& argumentSlots, unsigned returnSlot, Size1D meanCellSize, random::RandomSeed seed)
-				: RenderingStep2D(location, argumentSlots, returnSlot), meanCellSize(meanCellSize), seed(seed) {};
+			HeightMapCellNoiseRenderingStep(CodeLocation location, std::vector<unsigned> const& argumentSlots, unsigned returnSlot, Size1D meanCellSize, random::RandomSeed seed, random::RandomSeedScheme seedScheme)
+				: RenderingStep2D(location, argumentSlots, returnSlot), meanCellSize(meanCellSize), seed(seed), seedScheme(seedScheme) {};
 
 			virtual String GetName() const { return GG_STR("HeightMap.CellNoise"); };
 
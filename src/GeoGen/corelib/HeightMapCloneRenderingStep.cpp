@@ -30,7 +30,10 @@ void HeightMapCloneRenderingStep::Step(Renderer* renderer) const
 {
 	HeightMap* other = dynamic_cast<HeightMap*>(renderer->GetObjectTable().GetObject(this->GetArgumentSlots()[0])->GetPtr());
 
-	HeightMap* map = new HeightMap(*other, dynamic_cast<RenderingBounds2D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->GetRectangle());
+	Rectangle rectangle = renderer->GetRenderingSequenceMetadata().GetRenderingBounds2D(this)->GetRectangle();
+
+	// A clone of the same area shares the original's data until either of them is modified. If this is the last use of the original, it is released right after this step and the clone becomes the sole owner of the data, so nothing is ever copied.
+	HeightMap* map = other->GetRectangle() == rectangle ? new HeightMap(*other) : new HeightMap(*other, rectangle);
 	RendererObject* object = new RendererObject(RENDERER_OBJECT_TYPE_HEIGHT_MAP, map);
 
 	renderer->GetObjectTable().SetObject(this->GetReturnSlot(), object);
@@ -38,5 +41,12 @@ void HeightMapCloneRenderingStep::Step(Renderer* renderer) const
 
 unsigned HeightMapCloneRenderingStep::GetPeakExtraMemory(Renderer* renderer, std::vector<RenderingBounds const*> argumentBounds) const
 {
-	return dynamic_cast<RenderingBounds2D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->GetMemorySize(renderer->GetRenderingSequence().GetRenderScale());
+	// The shared data is copied by the first step modifying either of the maps, which is covered by the clone being accounted for at its full size from this step on.
+	RenderingBounds2D const* bounds = renderer->GetRenderingSequenceMetadata().GetRenderingBounds2D(this);
+	if (RenderingBounds2D::Cast(argumentBounds[0])->GetRectangle() == bounds->GetRectangle())
+	{
+		return 0;
+	}
+
+	return bounds->GetMemorySize(renderer->GetRenderScale());
 }
@@ -28,14 +28,11 @@ using namespace geogen::corelib;
 using namespace geogen::runtime;
 using namespace geogen::renderer;
 
-ManagedObject* HeightMapCombineFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, vector<ManagedObject*> arguments) const
+ManagedObject* HeightMapCombineFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, NativeArgumentList& arguments) const
 {
-	vector<TypeDefinition const*> expectedTypes;
+	TypeDefinition const* expectedTypes[] = { this->GetOwningTypeDefinition(), this->GetOwningTypeDefinition() };
 
-	expectedTypes.push_back(this->GetOwningTypeDefinition());
-	expectedTypes.push_back(this->GetOwningTypeDefinition());
-
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments);
+	this->CheckArguments(vm, location, expectedTypes, arguments);
 
 	vector<unsigned> argumentSlots;
 	argumentSlots.push_back(vm->GetRendererObjectSlotTable().GetObjectSlotByAddress(instance));
@@ -39,12 +39,12 @@ void HeightMapConvexityMapRenderingStep::Step(Renderer* renderer) const
 
 Rectangle HeightMapConvexityMapRenderingStep::CalculateRenderingBounds(Renderer* renderer, Rectangle argumentBounds) const
 {
-	return Rectangle::Expand(argumentBounds, renderer->GetRenderingSequence().GetScaledSize(this->radius));
+	return Rectangle::Expand(argumentBounds, renderer->GetScaledSize(this->radius));
 }
 
 unsigned HeightMapConvexityMapRenderingStep::GetPeakExtraMemory(Renderer* renderer, std::vector<RenderingBounds const*> argumentBounds) const
 {
-	return dynamic_cast<RenderingBounds2D const*>(argumentBounds[0])->GetMemorySize(renderer->GetRenderingSequence().GetRenderScale());
+	return RenderingBounds2D::Cast(argumentBounds[0])->GetMemorySize(renderer->GetRenderScale());
 }
 
 void HeightMapConvexityMapRenderingStep::SerializeArguments(IOStream& stream) const
@@ -32,22 +32,19 @@ using namespace geogen::corelib;
 using namespace geogen::runtime;
 using namespace geogen::renderer;
 
-ManagedObject* HeightMapCropFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, vector<ManagedObject*> arguments) const
+ManagedObject* HeightMapCropFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, NativeArgumentList& arguments) const
 {
 	PointTypeDefinition const* pointTypeDefinition = dynamic_cast<PointTypeDefinition const*>(vm->GetTypeDefinition(GG_STR("Point")));
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
 
-	vector<TypeDefinition const*> expectedTypes;
-	expectedTypes.push_back(pointTypeDefinition);
-	expectedTypes.push_back(pointTypeDefinition);
-	expectedTypes.push_back(numberTypeDefinition);
+	TypeDefinition const* expectedTypes[] = { pointTypeDefinition, pointTypeDefinition, numberTypeDefinition };
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments, 2);
+	this->CheckArguments(vm, location, expectedTypes, arguments, 2);
 
 	Point fromPoint = dynamic_cast<PointObject*>(arguments[0])->GetAbsolutePoint(vm, location);
 	Point toPoint = dynamic_cast<PointObject*>(arguments[1])->GetAbsolutePoint(vm, location);
 
-	Number heightNumber = arguments.size() > 2 ? dynamic_cast<NumberObject*>(arguments[2])->GetValue() : 0;
+	Number heightNumber = arguments.Size() > 2 ? dynamic_cast<NumberObject*>(arguments[2])->GetValue() : 0;
 	Height height;
 	if (!TryNumberToHeight(heightNumber, height))
 	{
@@ -30,16 +30,13 @@ using namespace geogen::corelib;
 using namespace geogen::runtime;
 using namespace geogen::renderer;
 
-ManagedObject* HeightMapCropHeightsFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, vector<ManagedObject*> arguments) const
+ManagedObject* HeightMapCropHeightsFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, NativeArgumentList& arguments) const
 {
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
 
-	vector<TypeDefinition const*> expectedTypes;
-	expectedTypes.push_back(numberTypeDefinition);
-	expectedTypes.push_back(numberTypeDefinition);
-	expectedTypes.push_back(numberTypeDefinition);
+	TypeDefinition const* expectedTypes[] = { numberTypeDefinition, numberTypeDefinition, numberTypeDefinition };
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments, 2);
+	this->CheckArguments(vm, location, expectedTypes, arguments, 2);
 
 	Number numberMin = ((NumberObject*)arguments[0])->GetValue();
 	Height min;
@@ -55,7 +52,7 @@ ManagedObject* HeightMapCropHeightsFunctionDefinition::CallNative(CodeLocation l
 		throw HeightOverflowException(location);
 	}
 
-	Number numberReplace = arguments.size() > 2 ? ((NumberObject*)arguments[2])->GetValue() : 0;
+	Number numberReplace = arguments.Size() > 2 ? ((NumberObject*)arguments[2])->GetValue() : 0;
 	Height replace;
 	if (!TryNumberToHeight(numberReplace, replace))
 	{
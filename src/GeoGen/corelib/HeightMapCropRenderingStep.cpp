@@ -36,13 +36,13 @@ void HeightMapCropRenderingStep::Step(Renderer* renderer) const
 
 void HeightMapCropRenderingStep::UpdateRenderingBounds(Renderer* renderer, std::vector<RenderingBounds*> argumentBounds) const
 {
-	dynamic_cast<RenderingBounds2D*>(argumentBounds[0])->CombineRectangle(
+	RenderingBounds2D::Cast(argumentBounds[0])->CombineRectangle(
 		Rectangle::Intersect(this->GetRenderingBounds(renderer), this->rectangle));
 }
 
 unsigned HeightMapCropRenderingStep::GetPeakExtraMemory(Renderer* renderer, std::vector<RenderingBounds const*> argumentBounds) const
 {
-	return dynamic_cast<RenderingBounds2D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->GetMemorySize(renderer->GetRenderingSequence().GetRenderScale());
+	return renderer->GetRenderingSequenceMetadata().GetRenderingBounds2D(this)->GetMemorySize(renderer->GetRenderScale());
 }
 
 
@@ -14,6 +14,9 @@ GNU General Public License for more details.
 You should have received a copy of the GNU General Public License
 along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 
+#include <algorithm>
+#include <memory>
+
 #include "HeightMapDistanceMapRenderingStep.hpp"
 #include "../renderer/Renderer.hpp"
 #include "../renderer/RendererObject.hpp"
@@ -31,8 +34,11 @@ void HeightMapDistanceMapRenderingStep::Step(Renderer* renderer) const
 {
 	HeightMap* other = dynamic_cast<HeightMap*>(renderer->GetObjectTable().GetObject(this->GetArgumentSlots()[0])->GetPtr());
 
-	HeightMap* map = new HeightMap(*other);
-	map->DistanceMap(this->maxDistance);
+	// The distance map has to be calculated on the whole argument, but only the part within this step's bounds is needed by the following steps.
+	auto_ptr<HeightMap> fullMap(new HeightMap(*other));
+	fullMap->DistanceMap(this->maxDistance);
+
+	HeightMap* map = new HeightMap(*fullMap, renderer->GetRenderingSequenceMetadata().GetRenderingBounds2D(this)->GetRectangle());
 	RendererObject* object = new RendererObject(RENDERER_OBJECT_TYPE_HEIGHT_MAP, map);
 
 	renderer->GetObjectTable().SetObject(this->GetReturnSlot(), object);
@@ -40,19 +46,19 @@ void HeightMapDistanceMapRenderingStep::Step(Renderer* renderer) const
 
 void HeightMapDistanceMapRenderingStep::UpdateRenderingBounds(Renderer* renderer, std::vector<RenderingBounds*> argumentBounds) const
 {
-	dynamic_cast<RenderingBounds2D*>(argumentBounds[0])->CombineRectangle(
-		Rectangle::Expand(this->GetRenderingBounds(renderer), renderer->GetRenderingSequence().GetScaledSize(this->maxDistance)));
+	RenderingBounds2D::Cast(argumentBounds[0])->CombineRectangle(
+		Rectangle::Expand(this->GetRenderingBounds(renderer), renderer->GetScaledSize(this->maxDistance)));
 }
 
 unsigned HeightMapDistanceMapRenderingStep::GetPeakExtraMemory(Renderer* renderer, std::vector<RenderingBounds const*> argumentBounds) const
 {
-	Scale scale = renderer->GetRenderingSequence().GetRenderScale();
-	RenderingBounds2D const* bounds = dynamic_cast<RenderingBounds2D const*>(argumentBounds[0]);
-	return bounds->GetMemorySize(scale) +
-		std::max(
-			(bounds->GetRectangle() * scale).GetSize().GetWidth(), 
-			(bounds->GetRectangle() * scale).GetSize().GetHeight()
-		) * (2 * sizeof(double)+sizeof(int));
+	Scale scale = renderer->GetRenderScale();
+	RenderingBounds2D const* bounds = RenderingBounds2D::Cast(argumentBounds[0]);
+
+	// The copy of the argument is alive during the calculation and while it is being cropped to the result.
+	return bounds->GetMemorySize(scale) + max(
+		HeightMap::GetDistanceMapExtraMemory((bounds->GetRectangle() * scale).GetSize(), renderer->GetScaledSize(this->maxDistance)),
+		renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this)->GetMemorySize(scale));
 }
 
 void HeightMapDistanceMapRenderingStep::SerializeArguments(IOStream& stream) const
@@ -33,16 +33,13 @@ using namespace geogen::renderer;
 using namespace geogen::random;
 
 
-ManagedObject* HeightMapDistortFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, vector<ManagedObject*> arguments) const
+ManagedObject* HeightMapDistortFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, NativeArgumentList& arguments) const
 {
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
 
-	vector<TypeDefinition const*> expectedTypes;
-	expectedTypes.push_back(numberTypeDefinition);
-	expectedTypes.push_back(numberTypeDefinition);
-	expectedTypes.push_back(numberTypeDefinition);
+	TypeDefinition const* expectedTypes[] = { numberTypeDefinition, numberTypeDefinition, numberTypeDefinition };
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments, 2);
+	this->CheckArguments(vm, location, expectedTypes, arguments, 2);
 
 	Number numberPerturbanceSize = ((NumberObject*)arguments[0])->GetValue();
 	Size1D perturbanceSize;
@@ -58,8 +55,9 @@ ManagedObject* HeightMapDistortFunctionDefinition::CallNative(CodeLocation locat
 		throw SizeOverflowException(location);
 	}
 
-	RandomSeed argumentSeed = arguments.size() > 2 ? (RandomSeed)dynamic_cast<NumberObject*>(arguments[2])->GetValue() : 0;
+	RandomSeed argumentSeed = arguments.Size() > 2 ? (RandomSeed)dynamic_cast<NumberObject*>(arguments[2])->GetValue() : 0;
 	RandomSeed compositeSeed = CombineSeeds(argumentSeed, vm->GetArguments().GetRandomSeed(), CreateSeed(GG_STR("HeightMap.Distort")));
+	RandomSeedScheme seedScheme = vm->GetCompiledScript().GetConfiguration().SeedScheme;
 
 	unsigned returnObjectSlot = vm->GetRendererObjectSlotTable().GetObjectSlotByAddress(instance);
 
@@ -80,7 +78,7 @@ ManagedObject* HeightMapDistortFunctionDefinition::CallNative(CodeLocation locat
 	{
 		vector<unsigned> argumentSlots;
 		argumentSlots.push_back(horizontalNoiseSlot);
-		RenderingStep* renderingStep = new HeightMapNoiseRenderingStep(location, argumentSlots, horizontalNoiseSlot, perturbanceSize, HEIGHT_MAX, compositeSeed, 0, false);
+		RenderingStep* renderingStep = new HeightMapNoiseRenderingStep(location, argumentSlots, horizontalNoiseSlot, perturbanceSize, HEIGHT_MAX, compositeSeed, 0, false, seedScheme);
 		vm->AddRenderingStep(location, renderingStep);
 	}
 
@@ -95,7 +93,7 @@ ManagedObject* HeightMapDistortFunctionDefinition::CallNative(CodeLocation locat
 	{
 		vector<unsigned> argumentSlots;
 		argumentSlots.push_back(verticalNoiseSlot);
-		RenderingStep* renderingStep = new HeightMapNoiseRenderingStep(location, argumentSlots, verticalNoiseSlot, perturbanceSize, HEIGHT_MAX, compositeSeed, 1, false);
+		RenderingStep* renderingStep = new HeightMapNoiseRenderingStep(location, argumentSlots, verticalNoiseSlot, perturbanceSize, HEIGHT_MAX, compositeSeed, 1, false, seedScheme);
 		vm->AddRenderingStep(location, renderingStep);
 	}
 
@@ -37,16 +37,16 @@ void HeightMapDistortRenderingStep::Step(Renderer* renderer) const
 
 void HeightMapDistortRenderingStep::UpdateRenderingBounds(Renderer* renderer, std::vector<RenderingBounds*> argumentBounds) const
 {
-	dynamic_cast<RenderingBounds2D*>(argumentBounds[0])->CombineRectangle(
-		Rectangle::Expand(this->GetRenderingBounds(renderer), renderer->GetRenderingSequence().GetScaledSize(this->maxDistance)));
+	RenderingBounds2D::Cast(argumentBounds[0])->CombineRectangle(
+		Rectangle::Expand(this->GetRenderingBounds(renderer), renderer->GetScaledSize(this->maxDistance)));
 
-	dynamic_cast<RenderingBounds2D*>(argumentBounds[1])->CombineRectangle(this->GetRenderingBounds(renderer));
-	dynamic_cast<RenderingBounds2D*>(argumentBounds[2])->CombineRectangle(this->GetRenderingBounds(renderer));
+	RenderingBounds2D::Cast(argumentBounds[1])->CombineRectangle(this->GetRenderingBounds(renderer));
+	RenderingBounds2D::Cast(argumentBounds[2])->CombineRectangle(this->GetRenderingBounds(renderer));
 }
 
 unsigned HeightMapDistortRenderingStep::GetPeakExtraMemory(Renderer* renderer, std::vector<RenderingBounds const*> argumentBounds) const
 {
-	return 2 * dynamic_cast<RenderingBounds2D const*>(argumentBounds[0])->GetMemorySize(renderer->GetRenderingSequence().GetRenderScale());
+	return 2 * RenderingBounds2D::Cast(argumentBounds[0])->GetMemorySize(renderer->GetRenderScale());
 }
 
 void HeightMapDistortRenderingStep::SerializeArguments(IOStream& stream) const
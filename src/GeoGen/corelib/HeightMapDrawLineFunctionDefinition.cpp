@@ -23,25 +23,23 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 #include "PointObject.hpp"
 #include "HeightMapFlatRenderingStep.hpp"
 #include "HeightOverflowException.hpp"
-#include "HeightMapDrawLineRenderingStep.hpp"
+#include "HeightMapDrawPrimitivesRenderingStep.hpp"
 
 using namespace std;
 using namespace geogen;
 using namespace geogen::corelib;
 using namespace geogen::runtime;
 using namespace geogen::renderer;
+using namespace geogen::genlib;
 
-ManagedObject* HeightMapDrawLineFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, vector<ManagedObject*> arguments) const
+ManagedObject* HeightMapDrawLineFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, NativeArgumentList& arguments) const
 {
 	PointTypeDefinition const* pointTypeDefinition = dynamic_cast<PointTypeDefinition const*>(vm->GetTypeDefinition(GG_STR("Point")));
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
 
-	vector<TypeDefinition const*> expectedTypes;
-	expectedTypes.push_back(pointTypeDefinition);
-	expectedTypes.push_back(pointTypeDefinition);
-	expectedTypes.push_back(numberTypeDefinition);
+	TypeDefinition const* expectedTypes[] = { pointTypeDefinition, pointTypeDefinition, numberTypeDefinition };
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments);
+	this->CheckArguments(vm, location, expectedTypes, arguments);
 
 	Point start = dynamic_cast<PointObject*>(arguments[0])->GetAbsolutePoint(vm, location);
 	Point end = dynamic_cast<PointObject*>(arguments[1])->GetAbsolutePoint(vm, location);
@@ -53,11 +51,15 @@ ManagedObject* HeightMapDrawLineFunctionDefinition::CallNative(CodeLocation loca
 		throw HeightOverflowException(location);
 	}
 
-	vector<unsigned> argumentSlots;
-	argumentSlots.push_back(vm->GetRendererObjectSlotTable().GetObjectSlotByAddress(instance));
+	HeightMapPrimitive primitive = HeightMapPrimitive::CreateLine(start, end, height);
 	unsigned returnObjectSlot = vm->GetRendererObjectSlotTable().GetObjectSlotByAddress(instance);
-	RenderingStep* renderingStep = new HeightMapDrawLineRenderingStep(location, argumentSlots, returnObjectSlot, start, end, height);
-	vm->AddRenderingStep(location, renderingStep);
+	if (!HeightMapDrawPrimitivesRenderingStep::TryAppendPrimitive(vm->GetRenderingSequence(), returnObjectSlot, primitive))
+	{
+		vector<unsigned> argumentSlots;
+		argumentSlots.push_back(vm->GetRendererObjectSlotTable().GetObjectSlotByAddress(instance));
+		RenderingStep* renderingStep = new HeightMapDrawPrimitivesRenderingStep(location, argumentSlots, returnObjectSlot, primitive);
+		vm->AddRenderingStep(location, renderingStep);
+	}
 
 	return instance;
 }
\ No newline at end of file
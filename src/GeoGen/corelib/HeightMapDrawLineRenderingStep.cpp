@@ -1,43 +0,0 @@
-/* GeoGen - Programmable height map generator
-Copyright (C) 2015  Matej Zabsky
-
-This program is free software: you can redistribute it and/or modify
-it under the terms of the GNU General Public License as published by
-the Free Software Foundation, either version 3 of the License, or
-(at your option) any later version.
-
-This program is distributed in the hope that it will be useful,
-but WITHOUT ANY WARRANTY; without even the implied warranty of
-MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-GNU General Public License for more details.
-
-You should have received a copy of the GNU General Public License
-along with this program.  If not, see <http://www.gnu.org/licenses/>. */
-
-#include "HeightMapDrawLineRenderingStep.hpp"
-#include "../renderer/Renderer.hpp"
-#include "../renderer/RendererObject.hpp"
-#include "../InternalErrorException.hpp"
-#include "../genlib/HeightMap.hpp"
-#include "../renderer/RenderingBounds2D.hpp"
-
-using namespace geogen;
-using namespace renderer;
-using namespace corelib;
-using namespace genlib;
-
-void HeightMapDrawLineRenderingStep::Step(Renderer* renderer) const
-{
-	HeightMap* self = dynamic_cast<HeightMap*>(renderer->GetObjectTable().GetObject(this->GetArgumentSlots()[0])->GetPtr());
-
-	self->DrawLine(this->start, this->end, this->height);
-}
-
-void HeightMapDrawLineRenderingStep::SerializeArguments(IOStream& stream) const
-{
-	this->start.Serialize(stream);
-	stream << GG_STR(", ");
-	this->end.Serialize(stream);
-	stream << GG_STR(", ") << this->height;
-	
-}
\ No newline at end of file
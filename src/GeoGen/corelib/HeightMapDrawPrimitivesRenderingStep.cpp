@@ -0,0 +1,63 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include "HeightMapDrawPrimitivesRenderingStep.hpp"
+#include "../renderer/Renderer.hpp"
+#include "../renderer/RendererObject.hpp"
+#include "../InternalErrorException.hpp"
+#include "../genlib/HeightMap.hpp"
+
+using namespace std;
+using namespace geogen;
+using namespace renderer;
+using namespace corelib;
+using namespace genlib;
+
+bool HeightMapDrawPrimitivesRenderingStep::TryAppendPrimitive(RenderingSequence& sequence, unsigned slot, HeightMapPrimitive const& primitive)
+{
+	if (sequence.Size() == 0)
+	{
+		return false;
+	}
+
+	HeightMapDrawPrimitivesRenderingStep* lastStep = dynamic_cast<HeightMapDrawPrimitivesRenderingStep*>(*(sequence.End() - 1));
+	if (lastStep == NULL || lastStep->GetReturnSlot() != slot)
+	{
+		return false;
+	}
+
+	lastStep->primitives.push_back(primitive);
+	return true;
+}
+
+void HeightMapDrawPrimitivesRenderingStep::Step(Renderer* renderer) const
+{
+	HeightMap* self = dynamic_cast<HeightMap*>(renderer->GetObjectTable().GetObject(this->GetArgumentSlots()[0])->GetPtr());
+
+	self->DrawPrimitives(this->primitives);
+}
+
+void HeightMapDrawPrimitivesRenderingStep::SerializeArguments(IOStream& stream) const
+{
+	for (vector<HeightMapPrimitive>::const_iterator it = this->primitives.begin(); it != this->primitives.end(); it++)
+	{
+		stream << (it->Type == HEIGHT_MAP_PRIMITIVE_LINE ? GG_STR("line ") : GG_STR("rectangle "));
+		it->FirstPoint.Serialize(stream);
+		stream << GG_STR(", ");
+		it->SecondPoint.Serialize(stream);
+		stream << GG_STR(", ") << it->DrawHeight << GG_STR("; ");
+	}
+}
\ No newline at end of file
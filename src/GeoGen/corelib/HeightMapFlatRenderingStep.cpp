@@ -28,7 +28,7 @@ using namespace genlib;
 
 void HeightMapFlatRenderingStep::Step(Renderer* renderer) const
 {
-	HeightMap* profile = new HeightMap(dynamic_cast<RenderingBounds2D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->GetRectangle(), this->height, renderer->GetRenderingSequence().GetRenderScale());
+	HeightMap* profile = new HeightMap(renderer->GetRenderingSequenceMetadata().GetRenderingBounds2D(this)->GetRectangle(), this->height, renderer->GetRenderScale());
 	RendererObject* object = new RendererObject(RENDERER_OBJECT_TYPE_HEIGHT_MAP, profile);
 
 	renderer->GetObjectTable().SetObject(this->GetReturnSlot(), object);
@@ -36,7 +36,7 @@ void HeightMapFlatRenderingStep::Step(Renderer* renderer) const
 
 unsigned HeightMapFlatRenderingStep::GetPeakExtraMemory(Renderer* renderer, std::vector<RenderingBounds const*> argumentBounds) const
 {
-	return dynamic_cast<RenderingBounds2D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->GetMemorySize(renderer->GetRenderingSequence().GetRenderScale());
+	return renderer->GetRenderingSequenceMetadata().GetRenderingBounds2D(this)->GetMemorySize(renderer->GetRenderScale());
 }
 
 void HeightMapFlatRenderingStep::SerializeArguments(IOStream& stream) const
@@ -33,14 +33,13 @@ using namespace runtime;
 using namespace renderer;
 using namespace genlib;
 
-ManagedObject* HeightMapFlipFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, vector<ManagedObject*> arguments) const
+ManagedObject* HeightMapFlipFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, NativeArgumentList& arguments) const
 {
 	DirectionTypeDefinition const* directionTypeDefinition = dynamic_cast<DirectionTypeDefinition const*>(vm->GetTypeDefinition(GG_STR("Direction")));
 
-	vector<TypeDefinition const*> expectedTypes;
-	expectedTypes.push_back(directionTypeDefinition);
+	TypeDefinition const* expectedTypes[] = { directionTypeDefinition };
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments);
+	this->CheckArguments(vm, location, expectedTypes, arguments);
 
 	Direction direction = (Direction)NumberToInt(((NumberObject*)arguments[0])->GetValue());
 
@@ -31,25 +31,23 @@ using namespace corelib;
 using namespace runtime;
 using namespace renderer;
 
-ManagedObject* HeightMapGlaciateFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, vector<ManagedObject*> arguments) const
+ManagedObject* HeightMapGlaciateFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, NativeArgumentList& arguments) const
 {
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
 	BooleanTypeDefinition const* booleanTypeDefinition = vm->GetBooleanTypeDefinition();
 
-	vector<TypeDefinition const*> expectedTypes;
-	expectedTypes.push_back(numberTypeDefinition);
-	expectedTypes.push_back(booleanTypeDefinition);
+	TypeDefinition const* expectedTypes[] = { numberTypeDefinition, booleanTypeDefinition };
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments, 0);
+	this->CheckArguments(vm, location, expectedTypes, arguments, 0);
 
-	Number strength = arguments.size() > 0 ? dynamic_cast<NumberObject*>(arguments[0])->GetValue() : 0.2;
+	Number strength = arguments.Size() > 0 ? dynamic_cast<NumberObject*>(arguments[0])->GetValue() : 0.2;
 
 	if (strength < 0 || strength > 1)
 	{
 		throw InvalidStrengthException(location);
 	}
 
-	bool includeNegative = arguments.size() > 1 ? dynamic_cast<BooleanObject*>(arguments[1])->GetValue() : false;
+	bool includeNegative = arguments.Size() > 1 ? dynamic_cast<BooleanObject*>(arguments[1])->GetValue() : false;
 
 	vector<unsigned> argumentSlots;
 	argumentSlots.push_back(vm->GetRendererObjectSlotTable().GetObjectSlotByAddress(instance));
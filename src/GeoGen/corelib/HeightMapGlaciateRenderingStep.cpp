@@ -40,4 +40,12 @@ void HeightMapGlaciateRenderingStep::Step(Renderer* renderer) const
 	}
 
 	self->TransformHeights(&profile, Interval(0, profile.GetLength()), this->includeNegative ? HEIGHT_MIN : 1, HEIGHT_MAX);
+}
+
+unsigned HeightMapGlaciateRenderingStep::GetPeakExtraMemory(Renderer* renderer, std::vector<RenderingBounds const*> argumentBounds) const
+{
+	// The mirrored profile is created next to the original one and then copied over it.
+	return this->includeNegative
+		? 2 * HeightProfile::GetMemorySize(Interval(0, HEIGHT_MAX * 2 - 1), 1)
+		: HeightProfile::GetMemorySize(Interval(0, HEIGHT_MAX), 1);
 }
\ No newline at end of file
@@ -35,6 +35,8 @@ namespace geogen
 			virtual String GetName() const { return GG_STR("HeightMap.Glaciate"); };
 
 			virtual void Step(renderer::Renderer* renderer) const;
+
+			virtual unsigned GetPeakExtraMemory(renderer::Renderer* renderer, std::vector<renderer::RenderingBounds const*> argumentBounds) const;
 		};
 	}
 }
\ No newline at end of file
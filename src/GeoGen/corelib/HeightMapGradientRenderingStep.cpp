@@ -28,7 +28,7 @@ using namespace genlib;
 
 void HeightMapGradientRenderingStep::Step(Renderer* renderer) const
 {
-	HeightMap* map = new HeightMap(dynamic_cast<RenderingBounds2D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->GetRectangle(), 0, renderer->GetRenderingSequence().GetRenderScale());
+	HeightMap* map = new HeightMap(renderer->GetRenderingSequenceMetadata().GetRenderingBounds2D(this)->GetRectangle(), 0, renderer->GetRenderScale());
 	map->Gradient(this->source, this->destination, this->fromHeight, this->toHeight);
 
 	RendererObject* object = new RendererObject(RENDERER_OBJECT_TYPE_HEIGHT_MAP, map);
@@ -38,7 +38,7 @@ void HeightMapGradientRenderingStep::Step(Renderer* renderer) const
 
 unsigned HeightMapGradientRenderingStep::GetPeakExtraMemory(Renderer* renderer, std::vector<RenderingBounds const*> argumentBounds) const
 {
-	return dynamic_cast<RenderingBounds2D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->GetMemorySize(renderer->GetRenderingSequence().GetRenderScale());
+	return renderer->GetRenderingSequenceMetadata().GetRenderingBounds2D(this)->GetMemorySize(renderer->GetRenderScale());
 }
 
 void HeightMapGradientRenderingStep::SerializeArguments(IOStream& stream) const
@@ -34,8 +34,8 @@ void HeightMapMoveRenderingStep::Step(Renderer* renderer) const
 
 void HeightMapMoveRenderingStep::UpdateRenderingBounds(Renderer* renderer, std::vector<RenderingBounds*> argumentBounds) const
 {
-	dynamic_cast<RenderingBounds2D*>(argumentBounds[0])->CombineRectangle(
-		this->GetRenderingBounds(renderer) - this->offset * renderer->GetRenderingSequence().GetRenderScale());
+	RenderingBounds2D::Cast(argumentBounds[0])->CombineRectangle(
+		this->GetRenderingBounds(renderer) - this->offset * renderer->GetRenderScale());
 }
 
 void HeightMapMoveRenderingStep::SerializeArguments(IOStream& stream) const
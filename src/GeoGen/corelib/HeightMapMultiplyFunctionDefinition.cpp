@@ -30,25 +30,25 @@ using namespace geogen::corelib;
 using namespace geogen::runtime;
 using namespace geogen::renderer;
 
-ManagedObject* HeightMapMultiplyFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, vector<ManagedObject*> arguments) const
+ManagedObject* HeightMapMultiplyFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, NativeArgumentList& arguments) const
 {
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
 
-	vector<TypeDefinition const*> expectedTypes;
+	TypeDefinition const* expectedTypes[1];
 
 	bool isNumberMode;
-	if (arguments.size() > 0 && arguments[0]->GetType() == this->GetOwningTypeDefinition())
+	if (arguments.Size() > 0 && arguments[0]->GetType() == this->GetOwningTypeDefinition())
 	{
 		isNumberMode = false;
-		expectedTypes.push_back(this->GetOwningTypeDefinition());
+		expectedTypes[0] = this->GetOwningTypeDefinition();
 	}
 	else
 	{
 		isNumberMode = true;
-		expectedTypes.push_back(numberTypeDefinition);
+		expectedTypes[0] = numberTypeDefinition;
 	}
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments);
+	this->CheckArguments(vm, location, expectedTypes, arguments);
 
 	vector<unsigned> argumentSlots;
 	argumentSlots.push_back(vm->GetRendererObjectSlotTable().GetObjectSlotByAddress(instance));
@@ -35,9 +35,10 @@ namespace geogen
 			random::RandomSeed seed;
 			unsigned seedStep;
 			bool isRidged;
+			random::RandomSeedScheme seedScheme;
 		public:
-			HeightMapNoiseRenderingStep(CodeLocation location, std::vector<unsigned> const& argumentSlots, unsigned returnSlot, Size1D waveLength, Height amplitude, random::RandomSeed seed, unsigned seedStep, bool isRidged)
-				: RenderingStep2D(location, argumentSlots, returnSlot), waveLength(waveLength), amplitude(amplitude), seed(seed), seedStep(seedStep), isRidged(isRidged) {};
+			HeightMapNoiseRenderingStep(CodeLocation location, std::vector<unsigned> const& argumentSlots, unsigned returnSlot, Size1D waveLength, Height amplitude, random::RandomSeed seed, unsigned seedStep, bool isRidged, random::RandomSeedScheme seedScheme)
+				: RenderingStep2D(location, argumentSlots, returnSlot), waveLength(waveLength), amplitude(amplitude), seed(seed), seedStep(seedStep), isRidged(isRidged), seedScheme(seedScheme) {};
 
 			virtual String GetName() const { return GG_STR("HeightMap.NoiseLayer"); };
 
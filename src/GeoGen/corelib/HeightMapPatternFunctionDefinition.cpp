@@ -30,16 +30,13 @@ using namespace geogen::corelib;
 using namespace geogen::runtime;
 using namespace geogen::renderer;
 
-ManagedObject* HeightMapPatternFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, vector<ManagedObject*> arguments) const
+ManagedObject* HeightMapPatternFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, NativeArgumentList& arguments) const
 {
 	PointTypeDefinition const* pointTypeDefinition = dynamic_cast<PointTypeDefinition const*>(vm->GetTypeDefinition(GG_STR("Point")));
 
-	vector<TypeDefinition const*> expectedTypes;
-	expectedTypes.push_back(this->GetOwningTypeDefinition());
-	expectedTypes.push_back(pointTypeDefinition);
-	expectedTypes.push_back(pointTypeDefinition);
+	TypeDefinition const* expectedTypes[] = { this->GetOwningTypeDefinition(), pointTypeDefinition, pointTypeDefinition };
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments);
+	this->CheckArguments(vm, location, expectedTypes, arguments);
 
 	Point origin = dynamic_cast<PointObject*>(arguments[1])->GetAbsolutePoint(vm, location);
 	Point toPoint = dynamic_cast<PointObject*>(arguments[2])->GetAbsolutePoint(vm, location);
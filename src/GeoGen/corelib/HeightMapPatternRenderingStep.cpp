@@ -28,7 +28,7 @@ using namespace genlib;
 
 void HeightMapPatternRenderingStep::Step(Renderer* renderer) const
 {
-	HeightMap* map = new HeightMap(dynamic_cast<RenderingBounds2D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->GetRectangle(), 0, renderer->GetRenderingSequence().GetRenderScale());
+	HeightMap* map = new HeightMap(renderer->GetRenderingSequenceMetadata().GetRenderingBounds2D(this)->GetRectangle(), 0, renderer->GetRenderScale());
 	HeightMap* pattern = dynamic_cast<HeightMap*>(renderer->GetObjectTable().GetObject(this->GetArgumentSlots()[0])->GetPtr());
 
 	map->Pattern(pattern, this->repeatRectangle);
@@ -40,13 +40,13 @@ void HeightMapPatternRenderingStep::Step(Renderer* renderer) const
 
 void HeightMapPatternRenderingStep::UpdateRenderingBounds(Renderer* renderer, std::vector<RenderingBounds*> argumentBounds) const
 {
-	dynamic_cast<RenderingBounds2D*>(argumentBounds[0])->CombineRectangle(
+	RenderingBounds2D::Cast(argumentBounds[0])->CombineRectangle(
 		this->repeatRectangle);
 }
 
 unsigned HeightMapPatternRenderingStep::GetPeakExtraMemory(Renderer* renderer, std::vector<RenderingBounds const*> argumentBounds) const
 {
-	return dynamic_cast<RenderingBounds2D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->GetMemorySize(renderer->GetRenderingSequence().GetRenderScale());
+	return renderer->GetRenderingSequenceMetadata().GetRenderingBounds2D(this)->GetMemorySize(renderer->GetRenderScale());
 }
 
 void HeightMapPatternRenderingStep::SerializeArguments(IOStream& stream) const
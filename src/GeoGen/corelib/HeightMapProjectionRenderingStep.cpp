@@ -32,7 +32,7 @@ void HeightMapProjectionRenderingStep::Step(Renderer* renderer) const
 {
 	HeightProfile* profile = dynamic_cast<HeightProfile*>(renderer->GetObjectTable().GetObject(this->GetArgumentSlots()[0])->GetPtr());
 
-	HeightMap* map = new HeightMap(dynamic_cast<RenderingBounds2D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->GetRectangle(), 0, renderer->GetRenderingSequence().GetRenderScale());
+	HeightMap* map = new HeightMap(renderer->GetRenderingSequenceMetadata().GetRenderingBounds2D(this)->GetRectangle(), 0, renderer->GetRenderScale());
 	map->Projection(profile, this->direction);
 
 	RendererObject* object = new RendererObject(RENDERER_OBJECT_TYPE_HEIGHT_MAP, map);
@@ -47,7 +47,7 @@ void HeightMapProjectionRenderingStep::SerializeArguments(IOStream& stream) cons
 
 unsigned HeightMapProjectionRenderingStep::GetPeakExtraMemory(Renderer* renderer, std::vector<RenderingBounds const*> argumentBounds) const
 {
-	return dynamic_cast<RenderingBounds2D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->GetMemorySize(renderer->GetRenderingSequence().GetRenderScale());
+	return renderer->GetRenderingSequenceMetadata().GetRenderingBounds2D(this)->GetMemorySize(renderer->GetRenderScale());
 }
 
 void HeightMapProjectionRenderingStep::UpdateRenderingBounds(Renderer* renderer, std::vector<RenderingBounds*> argumentBounds) const
@@ -55,7 +55,7 @@ void HeightMapProjectionRenderingStep::UpdateRenderingBounds(Renderer* renderer,
 	Point thisPosition = this->GetRenderingBounds(renderer).GetPosition();
 	Size2D thisSize = this->GetRenderingBounds(renderer).GetSize();
 
-	dynamic_cast<RenderingBounds1D*>(argumentBounds[0])->CombineInterval(
+	RenderingBounds1D::Cast(argumentBounds[0])->CombineInterval(
 		Interval(
 			this->direction == DIRECTION_HORIZONTAL ? thisPosition.GetY() : thisPosition.GetX(),
 			this->direction == DIRECTION_HORIZONTAL ? thisSize.GetHeight() : thisSize.GetWidth()));
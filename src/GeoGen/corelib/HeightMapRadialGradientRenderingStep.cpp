@@ -28,7 +28,7 @@ using namespace genlib;
 
 void HeightMapRadialGradientRenderingStep::Step(Renderer* renderer) const
 {
-	HeightMap* map = new HeightMap(dynamic_cast<RenderingBounds2D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->GetRectangle(), 0, renderer->GetRenderingSequence().GetRenderScale());
+	HeightMap* map = new HeightMap(renderer->GetRenderingSequenceMetadata().GetRenderingBounds2D(this)->GetRectangle(), 0, renderer->GetRenderScale());
 	map->RadialGradient(this->point, this->radius, this->fromHeight, this->toHeight);
 	
 	RendererObject* object = new RendererObject(RENDERER_OBJECT_TYPE_HEIGHT_MAP, map);
@@ -37,7 +37,7 @@ void HeightMapRadialGradientRenderingStep::Step(Renderer* renderer) const
 
 unsigned HeightMapRadialGradientRenderingStep::GetPeakExtraMemory(Renderer* renderer, std::vector<RenderingBounds const*> argumentBounds) const
 {
-	return dynamic_cast<RenderingBounds2D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->GetMemorySize(renderer->GetRenderingSequence().GetRenderScale());
+	return renderer->GetRenderingSequenceMetadata().GetRenderingBounds2D(this)->GetMemorySize(renderer->GetRenderScale());
 }
 
 void HeightMapRadialGradientRenderingStep::SerializeArguments(IOStream& stream) const
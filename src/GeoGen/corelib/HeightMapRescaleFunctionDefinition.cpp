@@ -23,6 +23,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 #include "InvalidScaleException.hpp"
 #include "HeightMapRescaleRenderingStep.hpp"
 #include "NumberTypeDefinition.hpp"
+#include "RescaleFilterTypeDefinition.hpp"
 
 using namespace std;
 using namespace geogen;
@@ -30,15 +31,15 @@ using namespace geogen::corelib;
 using namespace geogen::runtime;
 using namespace geogen::renderer;
 
-ManagedObject* HeightMapRescaleFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, vector<ManagedObject*> arguments) const
+ManagedObject* HeightMapRescaleFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, NativeArgumentList& arguments) const
 {
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
 
-	vector<TypeDefinition const*> expectedTypes;
-	expectedTypes.push_back(numberTypeDefinition);
-	expectedTypes.push_back(numberTypeDefinition);
+	RescaleFilterTypeDefinition const* rescaleFilterTypeDefinition = dynamic_cast<RescaleFilterTypeDefinition const*>(vm->GetTypeDefinition(GG_STR("RescaleFilter")));
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments, 1);
+	TypeDefinition const* expectedTypes[] = { numberTypeDefinition, numberTypeDefinition, rescaleFilterTypeDefinition };
+
+	this->CheckArguments(vm, location, expectedTypes, arguments, 1);
 
 	Number numberHorizontalScale = ((NumberObject*)arguments[0])->GetValue();
 	Scale horizontalScale;
@@ -47,17 +48,19 @@ ManagedObject* HeightMapRescaleFunctionDefinition::CallNative(CodeLocation locat
 		throw InvalidScaleException(location);
 	}
 
-	Number numberVerticalScale = arguments.size() > 1 ? ((NumberObject*)arguments[1])->GetValue() : numberHorizontalScale;
+	Number numberVerticalScale = arguments.Size() > 1 ? ((NumberObject*)arguments[1])->GetValue() : numberHorizontalScale;
 	Scale verticalScale;
 	if (!TryNumberToScale(numberVerticalScale, verticalScale))
 	{
 		throw InvalidScaleException(location);
 	}
 
+	RescaleFilter filter = arguments.Size() > 2 ? (RescaleFilter)NumberToInt(dynamic_cast<NumberObject*>(arguments[2])->GetValue()) : RESCALE_FILTER_BILINEAR;
+
 	vector<unsigned> argumentSlots;
 	argumentSlots.push_back(vm->GetRendererObjectSlotTable().GetObjectSlotByAddress(instance));
 	unsigned returnObjectSlot = vm->GetRendererObjectSlotTable().GetObjectSlotByAddress(instance);
-	RenderingStep* renderingStep = new HeightMapRescaleRenderingStep(location, argumentSlots, returnObjectSlot, horizontalScale, verticalScale);
+	RenderingStep* renderingStep = new HeightMapRescaleRenderingStep(location, argumentSlots, returnObjectSlot, horizontalScale, verticalScale, filter);
 	vm->AddRenderingStep(location, renderingStep);
 
 	return instance;
@@ -30,14 +30,14 @@ void HeightMapRescaleRenderingStep::Step(Renderer* renderer) const
 {
 	HeightMap* self = dynamic_cast<HeightMap*>(renderer->GetObjectTable().GetObject(this->GetArgumentSlots()[0])->GetPtr());
 
-	self->Rescale(this->horizontalScale, this->verticalScale);
+	self->Rescale(this->horizontalScale, this->verticalScale, this->filter);
 }
 
 void HeightMapRescaleRenderingStep::UpdateRenderingBounds(Renderer* renderer, std::vector<RenderingBounds*> argumentBounds) const
 {
 	Rectangle thisRect = this->GetRenderingBounds(renderer);
 
-	dynamic_cast<RenderingBounds2D*>(argumentBounds[0])->CombineRectangle(
+	RenderingBounds2D::Cast(argumentBounds[0])->CombineRectangle(
 		Rectangle(
 			Point(Height(thisRect.GetPosition().GetX() / this->horizontalScale), Height(thisRect.GetPosition().GetY() / this->verticalScale)),
 			Size2D((Size1D)RoundAway(thisRect.GetSize().GetWidth() / this->horizontalScale), (Size1D)RoundAway(thisRect.GetSize().GetHeight() / this->verticalScale))));
@@ -45,15 +45,16 @@ void HeightMapRescaleRenderingStep::UpdateRenderingBounds(Renderer* renderer, st
 
 unsigned HeightMapRescaleRenderingStep::GetPeakExtraMemory(Renderer* renderer, std::vector<RenderingBounds const*> argumentBounds) const
 {
-	Rectangle thisRect = dynamic_cast<RenderingBounds2D const*>(argumentBounds[0])->GetRectangle();
+	Rectangle thisRect = RenderingBounds2D::Cast(argumentBounds[0])->GetRectangle();
 	Rectangle newRectangle(Point(Coordinate(thisRect.GetPosition().GetX() * horizontalScale), Coordinate(thisRect.GetPosition().GetY() * verticalScale)), Size2D(Size1D(thisRect.GetSize().GetWidth() * horizontalScale), Size1D(thisRect.GetSize().GetHeight() * verticalScale)));
 
-	return HeightMap::GetMemorySize(newRectangle, renderer->GetRenderingSequence().GetRenderScale());
+	Scale scale = renderer->GetRenderScale();
+	return HeightMap::GetMemorySize(newRectangle, scale) + HeightMap::GetRescaleExtraMemory((thisRect * scale).GetSize(), (newRectangle * scale).GetSize());
 }
 
 void HeightMapRescaleRenderingStep::SimulateOnRenderingBounds(RenderingBounds* renderingBounds) const
 {
-	RenderingBounds2D* bounds2d = dynamic_cast<RenderingBounds2D*>(renderingBounds);
+	RenderingBounds2D* bounds2d = RenderingBounds2D::Cast(renderingBounds);
 	Rectangle newRectangle(Point(Coordinate(bounds2d->GetRectangle().GetPosition().GetX() * this->horizontalScale), Coordinate(bounds2d->GetRectangle().GetPosition().GetY() * this->verticalScale)), Size2D(Size1D(bounds2d->GetRectangle().GetSize().GetWidth() * this->horizontalScale), Size1D(bounds2d->GetRectangle().GetSize().GetHeight() * this->verticalScale)));
 
 	bounds2d->SetRectangle(newRectangle);
@@ -61,5 +62,5 @@ void HeightMapRescaleRenderingStep::SimulateOnRenderingBounds(RenderingBounds* r
 
 void HeightMapRescaleRenderingStep::SerializeArguments(IOStream& stream) const
 {
-	stream << this->horizontalScale << GG_STR(", ") << this->verticalScale;
+	stream << this->horizontalScale << GG_STR(", ") << this->verticalScale << GG_STR(", ") << RescaleFilterToString(this->filter);
 }
\ No newline at end of file
@@ -17,6 +17,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 #pragma once
 
 #include "../Number.hpp"
+#include "../RescaleFilter.hpp"
 #include "../renderer/RenderingStep2D.hpp"
 
 namespace geogen
@@ -28,9 +29,10 @@ namespace geogen
 		private:
 			Scale horizontalScale;
 			Scale verticalScale;
+			RescaleFilter filter;
 		public:
-			HeightMapRescaleRenderingStep(CodeLocation location, std::vector<unsigned> const& argumentSlots, unsigned returnSlot, Scale horizontalScale, Scale verticalScale)
-				: RenderingStep2D(location, argumentSlots, returnSlot), horizontalScale(horizontalScale), verticalScale(verticalScale) {};
+			HeightMapRescaleRenderingStep(CodeLocation location, std::vector<unsigned> const& argumentSlots, unsigned returnSlot, Scale horizontalScale, Scale verticalScale, RescaleFilter filter)
+				: RenderingStep2D(location, argumentSlots, returnSlot), horizontalScale(horizontalScale), verticalScale(verticalScale), filter(filter) {};
 
 			virtual String GetName() const { return GG_STR("HeightMap.Rescale"); };
 
@@ -40,15 +40,20 @@ void HeightMapShiftRenderingStep::UpdateRenderingBounds(Renderer* renderer, std:
 {
 	Rectangle thisRect = this->GetRenderingBounds(renderer);
 
-	dynamic_cast<RenderingBounds2D*>(argumentBounds[0])->CombineRectangle(
-		Rectangle::Expand(this->GetRenderingBounds(renderer), renderer->GetRenderingSequence().GetScaledSize(this->maxDistance), this->direction));
+	RenderingBounds2D::Cast(argumentBounds[0])->CombineRectangle(
+		Rectangle::Expand(this->GetRenderingBounds(renderer), renderer->GetScaledSize(this->maxDistance), this->direction));
 
-	dynamic_cast<RenderingBounds1D*>(argumentBounds[1])->CombineInterval(
+	RenderingBounds1D::Cast(argumentBounds[1])->CombineInterval(
 		Interval(
 		this->direction == DIRECTION_HORIZONTAL ? thisRect.GetPosition().GetY() : thisRect.GetPosition().GetX(),
 		this->direction == DIRECTION_HORIZONTAL ? thisRect.GetSize().GetHeight() : thisRect.GetSize().GetWidth()));
 }
 
+unsigned HeightMapShiftRenderingStep::GetPeakExtraMemory(Renderer* renderer, std::vector<RenderingBounds const*> argumentBounds) const
+{
+	return RenderingBounds2D::Cast(argumentBounds[0])->GetMemorySize(renderer->GetRenderScale());
+}
+
 void HeightMapShiftRenderingStep::SerializeArguments(IOStream& stream) const
 {
 	stream << this->maxDistance << GG_STR(", ") << DirectionToString(this->direction);
@@ -37,6 +37,8 @@ namespace geogen
 
 			virtual void UpdateRenderingBounds(renderer::Renderer* renderer, std::vector<renderer::RenderingBounds*> argumentBounds) const;
 
+			virtual unsigned GetPeakExtraMemory(renderer::Renderer* renderer, std::vector<renderer::RenderingBounds const*> argumentBounds) const;
+
 			virtual void Step(renderer::Renderer* renderer) const;
 
 			virtual void SerializeArguments(IOStream& stream) const;
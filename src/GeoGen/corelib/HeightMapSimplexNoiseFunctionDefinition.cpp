@@ -0,0 +1,58 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include "HeightMapSimplexNoiseFunctionDefinition.hpp"
+#include "../runtime/VirtualMachine.hpp"
+#include "../runtime/ManagedObject.hpp"
+#include "../genlib/NoiseLayersFactory.hpp"
+#include "HeightMapTypeDefinition.hpp"
+#include "ArrayTypeDefinition.hpp"
+#include "NumberTypeDefinition.hpp"
+#include "HeightMapSimplexNoiseRenderingStep.hpp"
+#include "ParseNoiseInput.hpp"
+
+using namespace std;
+using namespace geogen;
+using namespace geogen::corelib;
+using namespace geogen::runtime;
+using namespace geogen::renderer;
+using namespace geogen::random;
+using namespace geogen::genlib;
+
+ManagedObject* HeightMapSimplexNoiseFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, NativeArgumentList& arguments) const
+{
+	ArrayTypeDefinition const* arrayTypeDefinition = dynamic_cast<ArrayTypeDefinition const*>(vm->GetTypeDefinition(GG_STR("Array")));
+	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
+
+	TypeDefinition const* expectedTypes[] = { arrayTypeDefinition, numberTypeDefinition };
+	
+	this->CheckArguments(vm, location, expectedTypes, arguments, 0);
+
+	NoiseLayers layers = ParseNoiseInput(vm, location, arguments, NoiseLayersFactory::CreateDefaultSimplexLayers());
+
+	RandomSeed argumentSeed = arguments.Size() > 1 ? (RandomSeed)dynamic_cast<NumberObject*>(arguments[1])->GetValue() : 0;
+	RandomSeed compositeSeed = CombineSeeds(argumentSeed, vm->GetArguments().GetRandomSeed(), CreateSeed(GG_STR("HeightMap.SimplexNoise")));
+	RandomSeedScheme seedScheme = vm->GetCompiledScript().GetConfiguration().SeedScheme;
+
+	ManagedObject* returnObject = dynamic_cast<HeightMapTypeDefinition const*>(instance->GetType())->CreateInstance(vm);
+	
+	// All the layers are generated by a single step, in a single pass over the map
+	unsigned objectSlot = vm->GetRendererObjectSlotTable().GetObjectSlotByAddress(returnObject);
+	RenderingStep* renderingStep = new HeightMapSimplexNoiseRenderingStep(location, vector<unsigned>(), objectSlot, layers, compositeSeed, seedScheme);
+	vm->AddRenderingStep(location, renderingStep);
+
+	return returnObject;
+}
\ No newline at end of file
@@ -32,18 +32,14 @@ using namespace corelib;
 using namespace runtime;
 using namespace renderer;
 
-ManagedObject* HeightMapStratifyFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, vector<ManagedObject*> arguments) const
+ManagedObject* HeightMapStratifyFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, NativeArgumentList& arguments) const
 {
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
 	BooleanTypeDefinition const* booleanTypeDefinition = vm->GetBooleanTypeDefinition();
 
-	vector<TypeDefinition const*> expectedTypes;
-	expectedTypes.push_back(numberTypeDefinition);
-	expectedTypes.push_back(numberTypeDefinition);
-	expectedTypes.push_back(numberTypeDefinition);
-	expectedTypes.push_back(booleanTypeDefinition);
+	TypeDefinition const* expectedTypes[] = { numberTypeDefinition, numberTypeDefinition, numberTypeDefinition, booleanTypeDefinition };
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments, 1);
+	this->CheckArguments(vm, location, expectedTypes, arguments, 1);
 
 	int numberOfStrata = static_cast<int>(dynamic_cast<NumberObject*>(arguments[0])->GetValue());
 
@@ -52,21 +48,21 @@ ManagedObject* HeightMapStratifyFunctionDefinition::CallNative(CodeLocation loca
 		throw InvalidNumberOfStrataException(location);
 	}
 
-	Number steepness = arguments.size() > 1 ? dynamic_cast<NumberObject*>(arguments[1])->GetValue() : 0.5;
+	Number steepness = arguments.Size() > 1 ? dynamic_cast<NumberObject*>(arguments[1])->GetValue() : 0.5;
 
 	if (steepness < 0 || steepness > 1)
 	{
 		throw InvalidStrengthException(location);
 	}
 
-	Number smoothness = arguments.size() > 2 ? dynamic_cast<NumberObject*>(arguments[2])->GetValue() : 0.5;
+	Number smoothness = arguments.Size() > 2 ? dynamic_cast<NumberObject*>(arguments[2])->GetValue() : 0.5;
 
 	if (smoothness < 0 || smoothness > 1)
 	{
 		throw InvalidStrengthException(location);
 	}
 
-	bool includeNegative = arguments.size() > 3 ? dynamic_cast<BooleanObject*>(arguments[3])->GetValue() : false;
+	bool includeNegative = arguments.Size() > 3 ? dynamic_cast<BooleanObject*>(arguments[3])->GetValue() : false;
 
 	vector<unsigned> argumentSlots;
 	argumentSlots.push_back(vm->GetRendererObjectSlotTable().GetObjectSlotByAddress(instance));
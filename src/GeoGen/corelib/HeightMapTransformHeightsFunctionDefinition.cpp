@@ -35,40 +35,35 @@ using namespace geogen::corelib;
 using namespace geogen::runtime;
 using namespace geogen::renderer;
 
-ManagedObject* HeightMapTransformHeightsFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, vector<ManagedObject*> arguments) const
+ManagedObject* HeightMapTransformHeightsFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, NativeArgumentList& arguments) const
 {
 	HeightProfileTypeDefinition const* heightProfileTypeDefinition = dynamic_cast<HeightProfileTypeDefinition const*>(vm->GetTypeDefinition(GG_STR("HeightProfile")));
 	CoordinateTypeDefinition const* coordinateTypeDefinition = dynamic_cast<CoordinateTypeDefinition const*>(vm->GetTypeDefinition(GG_STR("Coordinate")));
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
 
-	vector<TypeDefinition const*> expectedTypes;
-	expectedTypes.push_back(heightProfileTypeDefinition);
-	expectedTypes.push_back(coordinateTypeDefinition);
-	expectedTypes.push_back(coordinateTypeDefinition);
-	expectedTypes.push_back(numberTypeDefinition);
-	expectedTypes.push_back(numberTypeDefinition);
+	TypeDefinition const* expectedTypes[] = { heightProfileTypeDefinition, coordinateTypeDefinition, coordinateTypeDefinition, numberTypeDefinition, numberTypeDefinition };
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments, 1);
+	this->CheckArguments(vm, location, expectedTypes, arguments, 1);
 
-	CoordinateObject* startObject = arguments.size() > 1 ? dynamic_cast<CoordinateObject*>(arguments[1]) : NULL;
-	CoordinateObject* endObject = arguments.size() > 2 ? dynamic_cast<CoordinateObject*>(arguments[2]) : NULL;
+	CoordinateObject* startObject = arguments.Size() > 1 ? dynamic_cast<CoordinateObject*>(arguments[1]) : NULL;
+	CoordinateObject* endObject = arguments.Size() > 2 ? dynamic_cast<CoordinateObject*>(arguments[2]) : NULL;
 
 	if ((startObject != NULL && startObject->IsRelative()) || (endObject != NULL && endObject->IsRelative()))
 	{
 		throw UnknownRelativeCoordinateDirectionException(location);
 	}
 
-	Coordinate intervalStart = arguments.size() > 1 ? startObject->GetValue(): 0;
-	Coordinate intervalEnd = arguments.size() > 2 ? endObject->GetValue(): 100;
+	Coordinate intervalStart = arguments.Size() > 1 ? startObject->GetValue(): 0;
+	Coordinate intervalEnd = arguments.Size() > 2 ? endObject->GetValue(): 100;
 
-	Number numberMinHeight = arguments.size() > 3 ? ((NumberObject*)arguments[3])->GetValue() : 0;
+	Number numberMinHeight = arguments.Size() > 3 ? ((NumberObject*)arguments[3])->GetValue() : 0;
 	Height minHeight;
 	if (!TryNumberToHeight(numberMinHeight, minHeight))
 	{
 		throw HeightOverflowException(location);
 	}
 
-	Number numberMaxHeight = arguments.size() > 4 ? ((NumberObject*)arguments[4])->GetValue() : 1;
+	Number numberMaxHeight = arguments.Size() > 4 ? ((NumberObject*)arguments[4])->GetValue() : 1;
 	Height maxHeight;
 	if (!TryNumberToHeight(numberMaxHeight, maxHeight))
 	{
@@ -40,9 +40,9 @@ void HeightMapTransformHeightsRenderingStep::UpdateRenderingBounds(Renderer* ren
 {
 	Rectangle thisRect = this->GetRenderingBounds(renderer);
 
-	dynamic_cast<RenderingBounds2D*>(argumentBounds[0])->CombineRectangle(this->GetRenderingBounds(renderer));
+	RenderingBounds2D::Cast(argumentBounds[0])->CombineRectangle(this->GetRenderingBounds(renderer));
 
-	dynamic_cast<RenderingBounds1D*>(argumentBounds[1])->CombineInterval(this->interval);
+	RenderingBounds1D::Cast(argumentBounds[1])->CombineInterval(this->interval);
 }
 
 void HeightMapTransformHeightsRenderingStep::SerializeArguments(IOStream& stream) const
@@ -30,7 +30,7 @@ void HeightMapTransformRenderingStep::Step(Renderer* renderer) const
 {
 	HeightMap* self = dynamic_cast<HeightMap*>(renderer->GetObjectTable().GetObject(this->GetArgumentSlots()[0])->GetPtr());
 
-	self->Transform(this->matrix, dynamic_cast<RenderingBounds2D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->GetRectangle());
+	self->Transform(this->matrix, renderer->GetRenderingSequenceMetadata().GetRenderingBounds2D(this)->GetRectangle());
 }
 
 void HeightMapTransformRenderingStep::UpdateRenderingBounds(Renderer* renderer, std::vector<RenderingBounds*> argumentBounds) const
@@ -41,13 +41,13 @@ void HeightMapTransformRenderingStep::UpdateRenderingBounds(Renderer* renderer,
 
 	Rectangle transformedRectangle = invertedMatrix.TransformRectangle(thisRect);
 
-	dynamic_cast<RenderingBounds2D*>(argumentBounds[0])->CombineRectangle(transformedRectangle);
+	RenderingBounds2D::Cast(argumentBounds[0])->CombineRectangle(transformedRectangle);
 }
 
 unsigned HeightMapTransformRenderingStep::GetPeakExtraMemory(Renderer* renderer, std::vector<RenderingBounds const*> argumentBounds) const
 {
-	Rectangle rect = this->matrix.TransformRectangle(dynamic_cast<RenderingBounds2D const*>(argumentBounds[0])->GetRectangle());
-	return HeightMap::GetMemorySize(rect, renderer->GetRenderingSequence().GetRenderScale());
+	Rectangle rect = this->matrix.TransformRectangle(RenderingBounds2D::Cast(argumentBounds[0])->GetRectangle());
+	return HeightMap::GetMemorySize(rect, renderer->GetRenderScale());
 }
 
 void HeightMapTransformRenderingStep::SerializeArguments(IOStream& stream) const
@@ -54,6 +54,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 #include "HeightMapProjectionFunctionDefinition.hpp"
 #include "HeightMapRadialGradientFunctionDefinition.hpp"
 #include "HeightMapRidgedNoiseFunctionDefinition.hpp"
+#include "HeightMapSimplexNoiseFunctionDefinition.hpp"
 #include "HeightMapPatternFunctionDefinition.hpp"
 
 using namespace geogen;
@@ -100,4 +101,5 @@ HeightMapTypeDefinition::HeightMapTypeDefinition() : RendererTypeDefinition(GG_S
 	this->GetStaticFunctionDefinitions().AddItem(new HeightMapPatternFunctionDefinition(this));
 	this->GetStaticFunctionDefinitions().AddItem(new HeightMapNoiseFunctionDefinition(this));
 	this->GetStaticFunctionDefinitions().AddItem(new HeightMapRidgedNoiseFunctionDefinition(this));
+	this->GetStaticFunctionDefinitions().AddItem(new HeightMapSimplexNoiseFunctionDefinition(this));
 }
\ No newline at end of file
@@ -34,13 +34,13 @@ void HeightProfileBlurRenderingStep::Step(Renderer* renderer) const
 
 void HeightProfileBlurRenderingStep::UpdateRenderingBounds(Renderer* renderer, std::vector<RenderingBounds*> argumentBounds) const
 {
-	dynamic_cast<RenderingBounds1D*>(argumentBounds[0])->CombineInterval(
-		Interval::Expand(this->GetRenderingBounds(renderer), renderer->GetRenderingSequence().GetScaledSize(this->radius)));
+	RenderingBounds1D::Cast(argumentBounds[0])->CombineInterval(
+		Interval::Expand(this->GetRenderingBounds(renderer), renderer->GetScaledSize(this->radius)));
 }
 
 unsigned HeightProfileBlurRenderingStep::GetPeakExtraMemory(Renderer* renderer, std::vector<RenderingBounds const*> argumentBounds) const
 {
-	return dynamic_cast<RenderingBounds1D const*>(argumentBounds[0])->GetMemorySize(renderer->GetRenderingSequence().GetRenderScale());
+	return RenderingBounds1D::Cast(argumentBounds[0])->GetMemorySize(renderer->GetRenderScale());
 }
 
 
@@ -32,17 +32,14 @@ using namespace geogen::corelib;
 using namespace geogen::runtime;
 using namespace geogen::renderer;
 
-ManagedObject* HeightProfileCropFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, vector<ManagedObject*> arguments) const
+ManagedObject* HeightProfileCropFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, NativeArgumentList& arguments) const
 {
 	CoordinateTypeDefinition const* coordinateTypeDefinition = dynamic_cast<CoordinateTypeDefinition const*>(vm->GetTypeDefinition(GG_STR("Coordinate")));
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
 
-	vector<TypeDefinition const*> expectedTypes;
-	expectedTypes.push_back(coordinateTypeDefinition);
-	expectedTypes.push_back(coordinateTypeDefinition);
-	expectedTypes.push_back(numberTypeDefinition);
+	TypeDefinition const* expectedTypes[] = { coordinateTypeDefinition, coordinateTypeDefinition, numberTypeDefinition };
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments, 2);
+	this->CheckArguments(vm, location, expectedTypes, arguments, 2);
 
 	CoordinateObject* startObject = dynamic_cast<CoordinateObject*>(arguments[0]);
 	CoordinateObject* endObject = dynamic_cast<CoordinateObject*>(arguments[1]);
@@ -55,7 +52,7 @@ ManagedObject* HeightProfileCropFunctionDefinition::CallNative(CodeLocation loca
 	Coordinate start = (Coordinate)startObject->GetValue();
 	Coordinate end = (Coordinate)endObject->GetValue();
 
-	Number numberHeight = arguments.size() > 2 ? ((NumberObject*)arguments[2])->GetValue() : 0;
+	Number numberHeight = arguments.Size() > 2 ? ((NumberObject*)arguments[2])->GetValue() : 0;
 	Height height;
 	if (!TryNumberToHeight(numberHeight, height))
 	{
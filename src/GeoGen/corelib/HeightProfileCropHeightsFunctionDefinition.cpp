@@ -28,16 +28,13 @@ using namespace geogen::corelib;
 using namespace geogen::runtime;
 using namespace geogen::renderer;
 
-ManagedObject* HeightProfileCropHeightsFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, vector<ManagedObject*> arguments) const
+ManagedObject* HeightProfileCropHeightsFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, NativeArgumentList& arguments) const
 {
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
 
-	vector<TypeDefinition const*> expectedTypes;
-	expectedTypes.push_back(numberTypeDefinition);
-	expectedTypes.push_back(numberTypeDefinition);
-	expectedTypes.push_back(numberTypeDefinition);
+	TypeDefinition const* expectedTypes[] = { numberTypeDefinition, numberTypeDefinition, numberTypeDefinition };
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments, 2);
+	this->CheckArguments(vm, location, expectedTypes, arguments, 2);
 
 	Number numberMinHeight = ((NumberObject*)arguments[0])->GetValue();
 	Height minHeight;
@@ -53,7 +50,7 @@ ManagedObject* HeightProfileCropHeightsFunctionDefinition::CallNative(CodeLocati
 		throw HeightOverflowException(location);
 	}
 
-	Number numberReplace = arguments.size() > 2 ? ((NumberObject*)arguments[2])->GetValue() : 0;
+	Number numberReplace = arguments.Size() > 2 ? ((NumberObject*)arguments[2])->GetValue() : 0;
 	Height replace;
 	if (!TryNumberToHeight(numberReplace, replace))
 	{
@@ -35,13 +35,13 @@ void HeightProfileCropRenderingStep::Step(Renderer* renderer) const
 
 void HeightProfileCropRenderingStep::UpdateRenderingBounds(Renderer* renderer, std::vector<RenderingBounds*> argumentBounds) const
 {
-	dynamic_cast<RenderingBounds1D*>(argumentBounds[0])->CombineInterval(
+	RenderingBounds1D::Cast(argumentBounds[0])->CombineInterval(
 		Interval::Intersect(this->GetRenderingBounds(renderer), this->interval));
 }
 
 unsigned HeightProfileCropRenderingStep::GetPeakExtraMemory(Renderer* renderer, std::vector<RenderingBounds const*> argumentBounds) const
 {
-	return dynamic_cast<RenderingBounds1D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->GetMemorySize(renderer->GetRenderingSequence().GetRenderScale());
+	return renderer->GetRenderingSequenceMetadata().GetRenderingBounds1D(this)->GetMemorySize(renderer->GetRenderScale());
 }
 
 void HeightProfileCropRenderingStep::SerializeArguments(IOStream& stream) const
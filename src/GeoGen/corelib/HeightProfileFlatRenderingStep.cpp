@@ -28,7 +28,7 @@ using namespace genlib;
 
 void HeightProfileFlatRenderingStep::Step(Renderer* renderer) const
 {
-	HeightProfile* profile = new HeightProfile(dynamic_cast<RenderingBounds1D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->GetInterval(), this->height, renderer->GetRenderingSequence().GetRenderScale());
+	HeightProfile* profile = new HeightProfile(renderer->GetRenderingSequenceMetadata().GetRenderingBounds1D(this)->GetInterval(), this->height, renderer->GetRenderScale());
 	RendererObject* object = new RendererObject(RENDERER_OBJECT_TYPE_HEIGHT_PROFILE, profile);
 
 	renderer->GetObjectTable().SetObject(this->GetReturnSlot(), object);
@@ -36,7 +36,7 @@ void HeightProfileFlatRenderingStep::Step(Renderer* renderer) const
 
 unsigned HeightProfileFlatRenderingStep::GetPeakExtraMemory(Renderer* renderer, std::vector<RenderingBounds const*> argumentBounds) const
 {
-	return dynamic_cast<RenderingBounds1D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->GetMemorySize(renderer->GetRenderingSequence().GetRenderScale());
+	return renderer->GetRenderingSequenceMetadata().GetRenderingBounds1D(this)->GetMemorySize(renderer->GetRenderScale());
 }
 
 void HeightProfileFlatRenderingStep::SerializeArguments(IOStream& stream) const
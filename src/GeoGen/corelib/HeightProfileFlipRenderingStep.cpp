@@ -37,5 +37,5 @@ void HeightProfileFlipRenderingStep::UpdateRenderingBounds(Renderer* renderer, s
 	Interval current = this->GetRenderingBounds(renderer);
 	Interval flippedInterval = Interval(-current.GetStart() - current.GetLength(), current.GetLength());
 
-	dynamic_cast<RenderingBounds1D*>(argumentBounds[0])->CombineInterval(flippedInterval);
+	RenderingBounds1D::Cast(argumentBounds[0])->CombineInterval(flippedInterval);
 }
\ No newline at end of file
@@ -37,24 +37,22 @@ using namespace geogen::corelib;
 using namespace geogen::runtime;
 using namespace geogen::renderer;
 
-ManagedObject* HeightProfileFromArrayFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, vector<ManagedObject*> arguments) const
+ManagedObject* HeightProfileFromArrayFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, NativeArgumentList& arguments) const
 {
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
 	CoordinateTypeDefinition const* coordinateTypeDefinition = dynamic_cast<CoordinateTypeDefinition const*>(vm->GetTypeDefinition(GG_STR("Coordinate")));
 	ArrayTypeDefinition const* arrayTypeDefinition = dynamic_cast<ArrayTypeDefinition const*>(vm->GetTypeDefinition(GG_STR("Array")));
 	DirectionTypeDefinition const* directionTypeDefinition = dynamic_cast<DirectionTypeDefinition const*>(vm->GetTypeDefinition(GG_STR("Direction")));
 
-	vector<TypeDefinition const*> expectedTypes;
-	expectedTypes.push_back(arrayTypeDefinition);
-	expectedTypes.push_back(directionTypeDefinition);
+	TypeDefinition const* expectedTypes[] = { arrayTypeDefinition, directionTypeDefinition };
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments, 1);
+	this->CheckArguments(vm, location, expectedTypes, arguments, 1);
 
 	ArrayObject* arrayObject = (ArrayObject*)arguments[0];
 
 	bool hasDirection = false;
 	Direction direction = DIRECTION_HORIZONTAL;
-	if (arguments.size() > 1)
+	if (arguments.Size() > 1)
 	{
 		direction = (Direction)NumberToInt(dynamic_cast<NumberObject*>(arguments[1])->GetValue());
 		hasDirection = true;
@@ -29,7 +29,7 @@ using namespace std;
 
 void HeightProfileFromArrayRenderingStep::Step(Renderer* renderer) const
 {
-	HeightProfile* profile = new HeightProfile(dynamic_cast<RenderingBounds1D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->GetInterval(), 0, renderer->GetRenderingSequence().GetRenderScale());
+	HeightProfile* profile = new HeightProfile(renderer->GetRenderingSequenceMetadata().GetRenderingBounds1D(this)->GetInterval(), 0, renderer->GetRenderScale());
 	profile->FromArray(this->heights);
 	RendererObject* object = new RendererObject(RENDERER_OBJECT_TYPE_HEIGHT_PROFILE, profile);
 
@@ -38,7 +38,7 @@ void HeightProfileFromArrayRenderingStep::Step(Renderer* renderer) const
 
 unsigned HeightProfileFromArrayRenderingStep::GetPeakExtraMemory(Renderer* renderer, std::vector<RenderingBounds const*> argumentBounds) const
 {
-	return dynamic_cast<RenderingBounds1D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->GetMemorySize(renderer->GetRenderingSequence().GetRenderScale());
+	return renderer->GetRenderingSequenceMetadata().GetRenderingBounds1D(this)->GetMemorySize(renderer->GetRenderScale());
 }
 
 void HeightProfileFromArrayRenderingStep::SerializeArguments(IOStream& stream) const
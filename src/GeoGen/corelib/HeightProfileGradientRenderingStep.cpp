@@ -28,7 +28,7 @@ using namespace genlib;
 
 void HeightProfileGradientRenderingStep::Step(Renderer* renderer) const
 {
-	HeightProfile* profile = new HeightProfile(dynamic_cast<RenderingBounds1D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->GetInterval(), 0, renderer->GetRenderingSequence().GetRenderScale());
+	HeightProfile* profile = new HeightProfile(renderer->GetRenderingSequenceMetadata().GetRenderingBounds1D(this)->GetInterval(), 0, renderer->GetRenderScale());
 	profile->Gradient(this->source, this->destination, this->heightFrom, this->heightTo, true);
 	RendererObject* object = new RendererObject(RENDERER_OBJECT_TYPE_HEIGHT_PROFILE, profile);
 
@@ -37,7 +37,7 @@ void HeightProfileGradientRenderingStep::Step(Renderer* renderer) const
 
 unsigned HeightProfileGradientRenderingStep::GetPeakExtraMemory(Renderer* renderer, std::vector<RenderingBounds const*> argumentBounds) const
 {
-	return dynamic_cast<RenderingBounds1D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->GetMemorySize(renderer->GetRenderingSequence().GetRenderScale());
+	return renderer->GetRenderingSequenceMetadata().GetRenderingBounds1D(this)->GetMemorySize(renderer->GetRenderScale());
 }
 
 void HeightProfileGradientRenderingStep::SerializeArguments(IOStream& stream) const
@@ -34,8 +34,8 @@ void HeightProfileMoveRenderingStep::Step(Renderer* renderer) const
 
 void HeightProfileMoveRenderingStep::UpdateRenderingBounds(Renderer* renderer, std::vector<RenderingBounds*> argumentBounds) const
 {
-	dynamic_cast<RenderingBounds1D*>(argumentBounds[0])->CombineInterval(
-		this->GetRenderingBounds(renderer) - Coordinate(this->offset * renderer->GetRenderingSequence().GetRenderScale()));
+	RenderingBounds1D::Cast(argumentBounds[0])->CombineInterval(
+		this->GetRenderingBounds(renderer) - Coordinate(this->offset * renderer->GetRenderScale()));
 }
 
 void HeightProfileMoveRenderingStep::SerializeArguments(IOStream& stream) const
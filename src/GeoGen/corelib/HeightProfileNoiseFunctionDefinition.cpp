@@ -20,8 +20,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 #include "ArrayTypeDefinition.hpp"
 #include "NumberTypeDefinition.hpp"
 #include "../runtime/ManagedObject.hpp"
-#include "HeightProfileFlatRenderingStep.hpp"
-#include "HeightProfileNoiseRenderingStep.hpp"
+#include "HeightProfileNoiseLayersRenderingStep.hpp"
 #include "ParseNoiseInput.hpp"
 #include "../random/RandomSeed.hpp"
 
@@ -33,40 +32,27 @@ using namespace renderer;
 using namespace genlib;
 using namespace random;
 
-ManagedObject* HeightProfileNoiseFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, vector<ManagedObject*> arguments) const
+ManagedObject* HeightProfileNoiseFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, NativeArgumentList& arguments) const
 {
 	ArrayTypeDefinition const* arrayTypeDefinition = dynamic_cast<ArrayTypeDefinition const*>(vm->GetTypeDefinition(GG_STR("Array")));
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
 
-	vector<TypeDefinition const*> expectedTypes;
-	expectedTypes.push_back(arrayTypeDefinition);
-	expectedTypes.push_back(numberTypeDefinition);
+	TypeDefinition const* expectedTypes[] = { arrayTypeDefinition, numberTypeDefinition };
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments, 0);
+	this->CheckArguments(vm, location, expectedTypes, arguments, 0);
 
 	NoiseLayers layers = ParseNoiseInput(vm, location, arguments);
 
-	RandomSeed argumentSeed = arguments.size() > 1 ? (RandomSeed)dynamic_cast<NumberObject*>(arguments[1])->GetValue() : 0;
+	RandomSeed argumentSeed = arguments.Size() > 1 ? (RandomSeed)dynamic_cast<NumberObject*>(arguments[1])->GetValue() : 0;
 	RandomSeed compositeSeed = CombineSeeds(argumentSeed, vm->GetArguments().GetRandomSeed());
+	RandomSeedScheme seedScheme = vm->GetCompiledScript().GetConfiguration().SeedScheme;
 
 	ManagedObject* returnObject = dynamic_cast<HeightProfileTypeDefinition const*>(instance->GetType())->CreateInstance(vm);
 
-	// First create an empty height map
+	// All the layers are generated by a single step, in a single pass over the profile
 	unsigned objectSlot = vm->GetRendererObjectSlotTable().GetObjectSlotByAddress(returnObject);
-	RenderingStep* flatRenderingStep = new HeightProfileFlatRenderingStep(location, vector<unsigned>(), objectSlot, 0);
-	vm->AddRenderingStep(location, flatRenderingStep);
-
-	// Then generate the noise layer by layer
-	vector<unsigned> argumentSlots;
-	argumentSlots.push_back(objectSlot);
-
-	unsigned i = 0;
-	for (NoiseLayers::const_iterator it = layers.begin(); it != layers.end(); it++)
-	{
-		RenderingStep* renderingStep = new HeightProfileNoiseRenderingStep(location, argumentSlots, objectSlot, it->first, it->second, compositeSeed, i);
-		vm->AddRenderingStep(location, renderingStep);
-		i++;
-	}
+	RenderingStep* renderingStep = new HeightProfileNoiseLayersRenderingStep(location, vector<unsigned>(), objectSlot, layers, compositeSeed, seedScheme);
+	vm->AddRenderingStep(location, renderingStep);
 
 	return returnObject;
 }
\ No newline at end of file
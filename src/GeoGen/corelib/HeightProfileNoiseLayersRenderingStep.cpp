@@ -0,0 +1,53 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include "HeightProfileNoiseLayersRenderingStep.hpp"
+#include "../renderer/Renderer.hpp"
+#include "../renderer/RendererObject.hpp"
+#include "../InternalErrorException.hpp"
+#include "../genlib/HeightProfile.hpp"
+#include "../renderer/RenderingBounds1D.hpp"
+
+using namespace geogen;
+using namespace renderer;
+using namespace corelib;
+using namespace genlib;
+
+void HeightProfileNoiseLayersRenderingStep::Step(Renderer* renderer) const
+{
+	HeightProfile* profile = new HeightProfile(renderer->GetRenderingSequenceMetadata().GetRenderingBounds1D(this)->GetInterval(), 0, renderer->GetRenderScale());
+	profile->AddNoiseLayers(this->layers, this->seed, 0, this->seedScheme);
+
+	RendererObject* object = new RendererObject(RENDERER_OBJECT_TYPE_HEIGHT_PROFILE, profile);
+
+	renderer->GetObjectTable().SetObject(this->GetReturnSlot(), object);
+}
+
+unsigned HeightProfileNoiseLayersRenderingStep::GetPeakExtraMemory(Renderer* renderer, std::vector<RenderingBounds const*>) const
+{
+	return renderer->GetRenderingSequenceMetadata().GetRenderingBounds1D(this)->GetMemorySize(renderer->GetRenderScale());
+}
+
+void HeightProfileNoiseLayersRenderingStep::SerializeArguments(IOStream& stream) const
+{
+	stream << GG_STR("{");
+	for (NoiseLayers::const_iterator it = this->layers.begin(); it != this->layers.end(); it++)
+	{
+		stream << (it == this->layers.begin() ? GG_STR(" ") : GG_STR(", ")) << it->first << GG_STR(": ") << it->second;
+	}
+
+	stream << GG_STR(" }, ") << this->seed << GG_STR(", ") << this->seedScheme;
+}
\ No newline at end of file
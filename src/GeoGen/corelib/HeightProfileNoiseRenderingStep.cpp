@@ -1,38 +0,0 @@
-/* GeoGen - Programmable height map generator
-Copyright (C) 2015  Matej Zabsky
-
-This program is free software: you can redistribute it and/or modify
-it under the terms of the GNU General Public License as published by
-the Free Software Foundation, either version 3 of the License, or
-(at your option) any later version.
-
-This program is distributed in the hope that it will be useful,
-but WITHOUT ANY WARRANTY; without even the implied warranty of
-MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-GNU General Public License for more details.
-
-You should have received a copy of the GNU General Public License
-along with this program.  If not, see <http://www.gnu.org/licenses/>. */
-
-#include "HeightProfileNoiseRenderingStep.hpp"
-#include "../renderer/Renderer.hpp"
-#include "../renderer/RendererObject.hpp"
-#include "../InternalErrorException.hpp"
-#include "../genlib/HeightProfile.hpp"
-#include "../renderer/RenderingBounds1D.hpp"
-
-using namespace geogen;
-using namespace renderer;
-using namespace corelib;
-using namespace genlib;
-
-void HeightProfileNoiseRenderingStep::Step(Renderer* renderer) const
-{
-	HeightProfile* self = dynamic_cast<HeightProfile*>(renderer->GetObjectTable().GetObject(this->GetArgumentSlots()[0])->GetPtr());
-	self->NoiseLayer(this->waveLength, this->amplitude, this->seed, this->seedStep);
-}
-
-void HeightProfileNoiseRenderingStep::SerializeArguments(IOStream& stream) const
-{
-	stream << waveLength << GG_STR(", ") << amplitude << GG_STR(", ") << this->seed << GG_STR(", ") << this->seedStep;
-}
\ No newline at end of file
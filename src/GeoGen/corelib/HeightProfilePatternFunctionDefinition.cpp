@@ -33,17 +33,14 @@ using namespace geogen::corelib;
 using namespace geogen::runtime;
 using namespace geogen::renderer;
 
-ManagedObject* HeightProfilePatternFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, vector<ManagedObject*> arguments) const
+ManagedObject* HeightProfilePatternFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, NativeArgumentList& arguments) const
 {
 	CoordinateTypeDefinition const* coordinateTypeDefinition = dynamic_cast<CoordinateTypeDefinition const*>(vm->GetTypeDefinition(GG_STR("Coordinate")));
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
 
-	vector<TypeDefinition const*> expectedTypes;
-	expectedTypes.push_back(this->GetOwningTypeDefinition());
-	expectedTypes.push_back(coordinateTypeDefinition);
-	expectedTypes.push_back(coordinateTypeDefinition);
+	TypeDefinition const* expectedTypes[] = { this->GetOwningTypeDefinition(), coordinateTypeDefinition, coordinateTypeDefinition };
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments);
+	this->CheckArguments(vm, location, expectedTypes, arguments);
 
 	CoordinateObject* startObject = dynamic_cast<CoordinateObject*>(arguments[1]);
 	CoordinateObject* endObject = dynamic_cast<CoordinateObject*>(arguments[2]);
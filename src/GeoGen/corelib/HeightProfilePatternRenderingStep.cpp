@@ -28,7 +28,7 @@ using namespace genlib;
 
 void HeightProfilePatternRenderingStep::Step(Renderer* renderer) const
 {
-	HeightProfile* profile = new HeightProfile(dynamic_cast<RenderingBounds1D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->GetInterval(), 0, renderer->GetRenderingSequence().GetRenderScale());
+	HeightProfile* profile = new HeightProfile(renderer->GetRenderingSequenceMetadata().GetRenderingBounds1D(this)->GetInterval(), 0, renderer->GetRenderScale());
 	HeightProfile* pattern = dynamic_cast<HeightProfile*>(renderer->GetObjectTable().GetObject(this->GetArgumentSlots()[0])->GetPtr());
 	profile->Pattern(pattern, this->repeatInterval);
 	RendererObject* object = new RendererObject(RENDERER_OBJECT_TYPE_HEIGHT_PROFILE, profile);
@@ -38,13 +38,13 @@ void HeightProfilePatternRenderingStep::Step(Renderer* renderer) const
 
 void HeightProfilePatternRenderingStep::UpdateRenderingBounds(Renderer* renderer, std::vector<RenderingBounds*> argumentBounds) const
 {
-	dynamic_cast<RenderingBounds1D*>(argumentBounds[0])->CombineInterval(
+	RenderingBounds1D::Cast(argumentBounds[0])->CombineInterval(
 		this->repeatInterval);
 }
 
 unsigned HeightProfilePatternRenderingStep::GetPeakExtraMemory(Renderer* renderer, std::vector<RenderingBounds const*> argumentBounds) const
 {
-	return dynamic_cast<RenderingBounds1D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->GetMemorySize(renderer->GetRenderingSequence().GetRenderScale());
+	return renderer->GetRenderingSequenceMetadata().GetRenderingBounds1D(this)->GetMemorySize(renderer->GetRenderScale());
 }
 
 void HeightProfilePatternRenderingStep::SerializeArguments(IOStream& stream) const
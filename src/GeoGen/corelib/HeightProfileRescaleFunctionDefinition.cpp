@@ -20,6 +20,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 #include "HeightProfileTypeDefinition.hpp"
 #include "HeightProfileRescaleRenderingStep.hpp"
 #include "NumberTypeDefinition.hpp"
+#include "RescaleFilterTypeDefinition.hpp"
 #include "../renderer/RenderingBounds1D.hpp"
 #include "InvalidScaleException.hpp"
 
@@ -29,14 +30,15 @@ using namespace geogen::corelib;
 using namespace geogen::runtime;
 using namespace geogen::renderer;
 
-ManagedObject* HeightProfileRescaleFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, vector<ManagedObject*> arguments) const
+ManagedObject* HeightProfileRescaleFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, NativeArgumentList& arguments) const
 {
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
 
-	vector<TypeDefinition const*> expectedTypes;
-	expectedTypes.push_back(numberTypeDefinition);
+	RescaleFilterTypeDefinition const* rescaleFilterTypeDefinition = dynamic_cast<RescaleFilterTypeDefinition const*>(vm->GetTypeDefinition(GG_STR("RescaleFilter")));
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments);
+	TypeDefinition const* expectedTypes[] = { numberTypeDefinition, rescaleFilterTypeDefinition };
+
+	this->CheckArguments(vm, location, expectedTypes, arguments, 1);
 
 	Number numberScale = dynamic_cast<NumberObject*>(arguments[0])->GetValue();
 	Scale scale;
@@ -45,9 +47,12 @@ ManagedObject* HeightProfileRescaleFunctionDefinition::CallNative(CodeLocation l
 		throw InvalidScaleException(location);
 	}
 
+	RescaleFilter filter = arguments.Size() > 1 ? (RescaleFilter)NumberToInt(dynamic_cast<NumberObject*>(arguments[1])->GetValue()) : RESCALE_FILTER_BILINEAR;
+
 	vector<unsigned> argumentSlots;
+	argumentSlots.push_back(vm->GetRendererObjectSlotTable().GetObjectSlotByAddress(instance));
 	unsigned returnObjectSlot = vm->GetRendererObjectSlotTable().GetObjectSlotByAddress(instance);
-	RenderingStep* renderingStep = new HeightProfileRescaleRenderingStep(location, argumentSlots, returnObjectSlot, scale);
+	RenderingStep* renderingStep = new HeightProfileRescaleRenderingStep(location, argumentSlots, returnObjectSlot, scale, filter);
 	vm->AddRenderingStep(location, renderingStep);
 
 	return instance;
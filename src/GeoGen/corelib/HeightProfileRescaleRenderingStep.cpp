@@ -29,14 +29,14 @@ using namespace genlib;
 void HeightProfileRescaleRenderingStep::Step(Renderer* renderer) const
 {
 	HeightProfile* self = dynamic_cast<HeightProfile*>(renderer->GetObjectTable().GetObject(this->GetArgumentSlots()[0])->GetPtr());
-	self->Rescale(this->scale);
+	self->Rescale(this->scale, this->filter);
 }
 
 void HeightProfileRescaleRenderingStep::UpdateRenderingBounds(Renderer* renderer, std::vector<RenderingBounds*> argumentBounds) const
 {
 	Interval thisInterval = this->GetRenderingBounds(renderer);
 
-	dynamic_cast<RenderingBounds1D*>(argumentBounds[0])->CombineInterval(
+	RenderingBounds1D::Cast(argumentBounds[0])->CombineInterval(
 		Interval(
 		(Coordinate)RoundAway(thisInterval.GetStart() / this->scale),
 		(Size1D)RoundAway(thisInterval.GetLength() / this->scale)));
@@ -44,15 +44,15 @@ void HeightProfileRescaleRenderingStep::UpdateRenderingBounds(Renderer* renderer
 
 unsigned HeightProfileRescaleRenderingStep::GetPeakExtraMemory(Renderer* renderer, std::vector<RenderingBounds const*> argumentBounds) const
 {
-	Interval thisInterval = dynamic_cast<RenderingBounds1D const*>(argumentBounds[0])->GetInterval();
+	Interval thisInterval = RenderingBounds1D::Cast(argumentBounds[0])->GetInterval();
 	Interval newInterval(Coordinate(thisInterval.GetStart() * scale), Size1D(thisInterval.GetLength() * scale));
 
-	return HeightProfile::GetMemorySize(newInterval, renderer->GetRenderingSequence().GetRenderScale());
+	return HeightProfile::GetMemorySize(newInterval, renderer->GetRenderScale());
 }
 
 void HeightProfileRescaleRenderingStep::SimulateOnRenderingBounds(RenderingBounds* renderingBounds) const
 {
-	RenderingBounds1D* bounds1d = dynamic_cast<RenderingBounds1D*>(renderingBounds);
+	RenderingBounds1D* bounds1d = RenderingBounds1D::Cast(renderingBounds);
 	Interval newInterval(Coordinate(bounds1d->GetInterval().GetStart() * scale), Size1D(bounds1d->GetInterval().GetLength() * scale));
 
 	bounds1d->SetInterval(newInterval);
@@ -60,5 +60,5 @@ void HeightProfileRescaleRenderingStep::SimulateOnRenderingBounds(RenderingBound
 
 void HeightProfileRescaleRenderingStep::SerializeArguments(IOStream& stream) const
 {
-	stream << this->scale;
+	stream << this->scale << GG_STR(", ") << RescaleFilterToString(this->filter);
 }
\ No newline at end of file
@@ -17,6 +17,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 #pragma once
 
 #include "../Number.hpp"
+#include "../RescaleFilter.hpp"
 #include "../renderer/RenderingStep1D.hpp"
 
 namespace geogen
@@ -27,9 +28,10 @@ namespace geogen
 		{
 		private:
 			Scale scale;
+			RescaleFilter filter;
 		public:
-			HeightProfileRescaleRenderingStep(CodeLocation location, std::vector<unsigned> const& argumentSlots, unsigned returnSlot, Scale scale)
-				: RenderingStep1D(location, argumentSlots, returnSlot), scale(scale) {};
+			HeightProfileRescaleRenderingStep(CodeLocation location, std::vector<unsigned> const& argumentSlots, unsigned returnSlot, Scale scale, RescaleFilter filter)
+				: RenderingStep1D(location, argumentSlots, returnSlot), scale(scale), filter(filter) {};
 
 			virtual String GetName() const { return GG_STR("HeightProfile.Rescale"); };
 
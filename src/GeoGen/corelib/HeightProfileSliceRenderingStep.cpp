@@ -30,7 +30,7 @@ using namespace genlib;
 
 void HeightProfileSliceRenderingStep::Step(Renderer* renderer) const
 {
-	HeightProfile* profile = new HeightProfile(dynamic_cast<RenderingBounds1D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->GetInterval(), 0, renderer->GetRenderingSequence().GetRenderScale());
+	HeightProfile* profile = new HeightProfile(renderer->GetRenderingSequenceMetadata().GetRenderingBounds1D(this)->GetInterval(), 0, renderer->GetRenderScale());
 	HeightMap* heightMap = dynamic_cast<HeightMap*>(renderer->GetObjectTable().GetObject(this->GetArgumentSlots()[0])->GetPtr());
 	profile->Slice(heightMap, this->direction, this->coordinate);
 	RendererObject* object = new RendererObject(RENDERER_OBJECT_TYPE_HEIGHT_PROFILE, profile);
@@ -42,7 +42,7 @@ void HeightProfileSliceRenderingStep::UpdateRenderingBounds(Renderer* renderer,
 {
 	Interval thisInterval = this->GetRenderingBounds(renderer);
 
-	dynamic_cast<RenderingBounds2D*>(argumentBounds[0])->CombineRectangle(
+	RenderingBounds2D::Cast(argumentBounds[0])->CombineRectangle(
 		this->direction == DIRECTION_HORIZONTAL ?
 		Rectangle(Point(thisInterval.GetStart(), this->coordinate), Size2D(thisInterval.GetLength(), 1)) :
 		Rectangle(Point(this->coordinate, thisInterval.GetStart()), Size2D(1, thisInterval.GetLength())));
@@ -50,7 +50,7 @@ void HeightProfileSliceRenderingStep::UpdateRenderingBounds(Renderer* renderer,
 
 unsigned HeightProfileSliceRenderingStep::GetPeakExtraMemory(Renderer* renderer, std::vector<RenderingBounds const*> argumentBounds) const
 {
-	return dynamic_cast<RenderingBounds1D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->GetMemorySize(renderer->GetRenderingSequence().GetRenderScale());
+	return renderer->GetRenderingSequenceMetadata().GetRenderingBounds1D(this)->GetMemorySize(renderer->GetRenderScale());
 }
 
 void HeightProfileSliceRenderingStep::SerializeArguments(IOStream& stream) const
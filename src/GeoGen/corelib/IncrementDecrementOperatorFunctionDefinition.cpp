@@ -41,15 +41,14 @@ IncrementDecrementOperatorFunctionDefinition* IncrementDecrementOperatorFunction
 	}
 }
 
-ManagedObject* IncrementDecrementOperatorFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, vector<ManagedObject*> arguments) const
+ManagedObject* IncrementDecrementOperatorFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, NativeArgumentList& arguments) const
 {
 	ReferenceTypeDefinition const* referenceTypeDefinition = dynamic_cast<ReferenceTypeDefinition const*>(vm->GetTypeDefinition(GG_STR("<Reference>")));
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
 
-	vector<TypeDefinition const*> expectedTypes;
-	expectedTypes.push_back(referenceTypeDefinition);
+	TypeDefinition const* expectedTypes[] = { referenceTypeDefinition };
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments);
+	this->CheckArguments(vm, location, expectedTypes, arguments);
 
 	ReferenceObject* reference = dynamic_cast<ReferenceObject*>(arguments[0]);
 
@@ -34,15 +34,13 @@ LogicalOperatorFunctionDefinition* LogicalOperatorFunctionDefinition::Create(Ope
 	}
 }
 
-ManagedObject* LogicalOperatorFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, vector<ManagedObject*> arguments) const
+ManagedObject* LogicalOperatorFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, NativeArgumentList& arguments) const
 {
 	BooleanTypeDefinition const* booleanTypeDefinition = vm->GetBooleanTypeDefinition();
 
-	vector<TypeDefinition const*> expectedTypes;
-	expectedTypes.push_back(booleanTypeDefinition);
-	expectedTypes.push_back(booleanTypeDefinition);
+	TypeDefinition const* expectedTypes[] = { booleanTypeDefinition, booleanTypeDefinition };
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments);
+	this->CheckArguments(vm, location, expectedTypes, arguments);
 
 	BooleanObject* a = dynamic_cast<BooleanObject*>(arguments[0]);
 	BooleanObject* b = dynamic_cast<BooleanObject*>(arguments[1]);
@@ -49,9 +49,16 @@ namespace geogen
 		public:
 			static LogicalOperatorFunctionDefinition* Create(Operator op);
 
+			/// Evaluates the operator on plain values, without involving a virtual machine.
+			/// @param location Location of the operator in the code (used when reporting errors).
+			/// @param a The first operand.
+			/// @param b The second operand.
+			/// @return The result of the operation.
+			inline bool CallOperator(CodeLocation location, bool a, bool b) const { return this->function(location, a, b); }
+
 			virtual FunctionType GetFunctionType() const { return FUNCTION_TYPE_OPERATOR; }
 
-			virtual runtime::ManagedObject* CallNative(CodeLocation location, runtime::VirtualMachine* vm, std::vector<runtime::ManagedObject*> arguments) const;
+			virtual runtime::ManagedObject* CallNative(CodeLocation location, runtime::VirtualMachine* vm, runtime::NativeArgumentList& arguments) const;
 		};
 	}
 }
\ No newline at end of file
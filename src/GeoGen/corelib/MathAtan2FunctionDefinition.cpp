@@ -27,15 +27,13 @@ using namespace geogen;
 using namespace geogen::corelib;
 using namespace geogen::runtime;
 
-ManagedObject* MathAtan2FunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, vector<ManagedObject*> arguments) const
+ManagedObject* MathAtan2FunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, NativeArgumentList& arguments) const
 {
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
 
-	vector<TypeDefinition const*> expectedParameters;
-	expectedParameters.push_back(numberTypeDefinition);
-	expectedParameters.push_back(numberTypeDefinition);
+	TypeDefinition const* expectedParameters[] = { numberTypeDefinition, numberTypeDefinition };
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedParameters, arguments);
+	this->CheckArguments(vm, location, expectedParameters, arguments);
 
 	Number result = atan2(dynamic_cast<NumberObject*>(arguments[0])->GetValue(), dynamic_cast<NumberObject*>(arguments[1])->GetValue());
 
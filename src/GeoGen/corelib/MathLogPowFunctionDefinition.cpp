@@ -40,15 +40,13 @@ MathLogPowFunctionDefinition* MathLogPowFunctionDefinition::Create(Function func
 	}
 }
 
-ManagedObject* MathLogPowFunctionDefinition::CallNative(CodeLocation location, runtime::VirtualMachine* vm, vector<ManagedObject*> arguments) const
+ManagedObject* MathLogPowFunctionDefinition::CallNative(CodeLocation location, runtime::VirtualMachine* vm, NativeArgumentList& arguments) const
 {
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
 
-	vector<TypeDefinition const*> expectedParameterTypes;
-	expectedParameterTypes.push_back(numberTypeDefinition);
-	expectedParameterTypes.push_back(numberTypeDefinition);
+	TypeDefinition const* expectedParameterTypes[] = { numberTypeDefinition, numberTypeDefinition };
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedParameterTypes, arguments);
+	this->CheckArguments(vm, location, expectedParameterTypes, arguments);
 
 	Number arg1 = dynamic_cast<NumberObject*>(arguments[0])->GetValue();
 	Number arg2 = dynamic_cast<NumberObject*>(arguments[1])->GetValue();
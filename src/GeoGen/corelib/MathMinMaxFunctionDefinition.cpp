@@ -37,10 +37,10 @@ MathMinMaxFunctionDefinition* MathMinMaxFunctionDefinition::Create(Function func
 	}
 }
 
-Number MathMinMaxFunctionDefinition::Min(std::vector<runtime::ManagedObject*> arguments) const
+Number MathMinMaxFunctionDefinition::Min(NativeArgumentList const& arguments) const
 {
 	Number result = dynamic_cast<NumberObject*>(arguments[0])->GetValue();
-	for (unsigned i = 1; i < arguments.size(); i++)
+	for (unsigned i = 1; i < arguments.Size(); i++)
 	{
 		if (result > dynamic_cast<NumberObject*>(arguments[i])->GetValue())
 		{
@@ -51,10 +51,10 @@ Number MathMinMaxFunctionDefinition::Min(std::vector<runtime::ManagedObject*> ar
 	return result;
 }
 
-Number MathMinMaxFunctionDefinition::Max(std::vector<runtime::ManagedObject*> arguments) const
+Number MathMinMaxFunctionDefinition::Max(NativeArgumentList const& arguments) const
 {
 	Number result = dynamic_cast<NumberObject*>(arguments[0])->GetValue();
-	for (unsigned i = 1; i < arguments.size(); i++)
+	for (unsigned i = 1; i < arguments.Size(); i++)
 	{
 		if (result < dynamic_cast<NumberObject*>(arguments[i])->GetValue())
 		{
@@ -65,20 +65,18 @@ Number MathMinMaxFunctionDefinition::Max(std::vector<runtime::ManagedObject*> ar
 	return result;
 }
 
-ManagedObject* MathMinMaxFunctionDefinition::CallNative(CodeLocation location, runtime::VirtualMachine* vm, vector<ManagedObject*> arguments) const
+ManagedObject* MathMinMaxFunctionDefinition::CallNative(CodeLocation location, runtime::VirtualMachine* vm, NativeArgumentList& arguments) const
 {
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
 
-	int parameterCount = std::max(static_cast<size_t>(2u), arguments.size());
-	vector<TypeDefinition const*> expectedParameterTypes;
+	unsigned parameterCount = std::max(2u, arguments.Size());
+	this->CheckArguments(location, parameterCount, arguments);
 
-	for (int i = 0; i < parameterCount; i++)
+	for (unsigned i = 0; i < parameterCount; i++)
 	{
-		expectedParameterTypes.push_back(numberTypeDefinition);
+		this->CheckArgument(vm, location, numberTypeDefinition, arguments, i);
 	}
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedParameterTypes, arguments);
-
 	Number result;
 	switch (this->function)
 	{
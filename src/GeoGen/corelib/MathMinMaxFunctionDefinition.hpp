@@ -47,12 +47,12 @@ namespace geogen
 			{
 			};
 
-			Number Min(std::vector<runtime::ManagedObject*> arguments) const;
-			Number Max(std::vector<runtime::ManagedObject*> arguments) const;
+			Number Min(runtime::NativeArgumentList const& arguments) const;
+			Number Max(runtime::NativeArgumentList const& arguments) const;
 		public:
 			static MathMinMaxFunctionDefinition* Create(Function op);
 
-			virtual runtime::ManagedObject* CallNative(CodeLocation location, runtime::VirtualMachine* vm, std::vector<runtime::ManagedObject*> arguments) const;
+			virtual runtime::ManagedObject* CallNative(CodeLocation location, runtime::VirtualMachine* vm, runtime::NativeArgumentList& arguments) const;
 		};
 	}
 }
\ No newline at end of file
@@ -27,14 +27,13 @@ using namespace geogen;
 using namespace geogen::corelib;
 using namespace geogen::runtime;
 
-ManagedObject* MathSqrtFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, vector<ManagedObject*> arguments) const
+ManagedObject* MathSqrtFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, NativeArgumentList& arguments) const
 {
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
 
-	vector<TypeDefinition const*> expectedParameters;
-	expectedParameters.push_back(numberTypeDefinition);
+	TypeDefinition const* expectedParameters[] = { numberTypeDefinition };
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedParameters, arguments);
+	this->CheckArguments(vm, location, expectedParameters, arguments);
 
 	Number input = dynamic_cast<NumberObject*>(arguments[0])->GetValue();
 
@@ -30,7 +30,7 @@ namespace geogen
 		public:
 			MathSqrtFunctionDefinition() : GlobalNativeFunctionDefinition(GG_STR("Sqrt")) {};
 
-			virtual runtime::ManagedObject* CallNative(CodeLocation location, runtime::VirtualMachine* vm, std::vector<runtime::ManagedObject*> arguments) const;
+			virtual runtime::ManagedObject* CallNative(CodeLocation location, runtime::VirtualMachine* vm, runtime::NativeArgumentList& arguments) const;
 		};
 	}
 }
\ No newline at end of file
@@ -53,14 +53,13 @@ MathTrigonometricFunctionDefinition* MathTrigonometricFunctionDefinition::Create
 	}
 }
 
-ManagedObject* MathTrigonometricFunctionDefinition::CallNative(CodeLocation location, runtime::VirtualMachine* vm, vector<ManagedObject*> arguments) const
+ManagedObject* MathTrigonometricFunctionDefinition::CallNative(CodeLocation location, runtime::VirtualMachine* vm, NativeArgumentList& arguments) const
 {
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
 
-	vector<TypeDefinition const*> expectedParameterTypes;
-	expectedParameterTypes.push_back(numberTypeDefinition);
+	TypeDefinition const* expectedParameterTypes[] = { numberTypeDefinition };
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedParameterTypes, arguments);
+	this->CheckArguments(vm, location, expectedParameterTypes, arguments);
 
 	Number input = dynamic_cast<NumberObject*>(arguments[0])->GetValue();
 
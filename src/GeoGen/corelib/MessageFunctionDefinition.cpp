@@ -41,25 +41,22 @@ MessageFunctionDefinition* MessageFunctionDefinition::Create(Function function)
 	}
 }
 
-ManagedObject* MessageFunctionDefinition::CallNative(CodeLocation location, runtime::VirtualMachine* vm, vector<ManagedObject*> arguments) const
+ManagedObject* MessageFunctionDefinition::CallNative(CodeLocation location, runtime::VirtualMachine* vm, NativeArgumentList& arguments) const
 {
 	StringTypeDefinition const* stringTypeDefinition = dynamic_cast<StringTypeDefinition const*>(vm->GetTypeDefinition(GG_STR("String")));
 
-	vector<TypeDefinition const*> expectedParameterTypes;
-	expectedParameterTypes.push_back(stringTypeDefinition);
-	if (arguments.size() > 1){
-		for (unsigned i = 1; i < arguments.size(); i++)
-		{
-			expectedParameterTypes.push_back(arguments[i]->GetType());
-		}
+	// The format string is followed by any number of arguments of any type
+	if (arguments.Size() < 1)
+	{
+		this->CheckArguments(location, 1, arguments);
 	}
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedParameterTypes, arguments);
+	this->CheckArgument(vm, location, stringTypeDefinition, arguments, 0);
 
 	String formatStr = dynamic_cast<StringObject*>(arguments[0])->GetValue();
 	vector<String> strArgs;
-	if (arguments.size() > 1){
-		for (unsigned i = 1; i < arguments.size(); i++)
+	if (arguments.Size() > 1){
+		for (unsigned i = 1; i < arguments.Size(); i++)
 		{
 			strArgs.push_back(arguments[i]->GetStringValue());
 		}
@@ -28,24 +28,22 @@ using namespace geogen::corelib;
 using namespace geogen::runtime;
 using namespace geogen::renderer;
 
-ManagedObject* NumberFromCoordinateFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, vector<ManagedObject*> arguments) const
+ManagedObject* NumberFromCoordinateFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, NativeArgumentList& arguments) const
 {
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
 	CoordinateTypeDefinition const* coordinateTypeDefinition = dynamic_cast<CoordinateTypeDefinition const*>(vm->GetTypeDefinition(GG_STR("Coordinate")));
 	TypeDefinition const* directionTypeDefinition = vm->GetTypeDefinition(GG_STR("Direction"));
 
-	vector<TypeDefinition const*> expectedTypes;
-	expectedTypes.push_back(coordinateTypeDefinition);
-	expectedTypes.push_back(directionTypeDefinition);
+	TypeDefinition const* expectedTypes[] = { coordinateTypeDefinition, directionTypeDefinition };
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments, 1);
+	this->CheckArguments(vm, location, expectedTypes, arguments, 1);
 
 	CoordinateObject* coordinateValue = dynamic_cast<CoordinateObject*>(arguments[0]);
 
 	if (coordinateValue->IsRelative())
 	{
 		// Direction has to be supplied for relative coordinate.
-		if (arguments.size() < 2)
+		if (arguments.Size() < 2)
 		{
 			throw UnknownRelativeCoordinateDirectionException(location);
 		}
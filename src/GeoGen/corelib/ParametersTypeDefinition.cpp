@@ -152,4 +152,31 @@ void ParametersTypeDefinition::Initialize(VirtualMachine* vm) const
 ManagedObject* ParametersTypeDefinition::Copy(VirtualMachine* vm, ManagedObject* a) const
 {
 	return a;
+}
+
+bool ParametersTypeDefinition::IsRenderRectangleMemberAccess(ManagedObject* instance, String const& memberName)
+{
+	if (!instance->IsStaticObject() || instance->GetType()->GetName() != GG_STR("Parameters"))
+	{
+		return false;
+	}
+
+	return
+		memberName == GG_STR("RenderOriginX") ||
+		memberName == GG_STR("RenderOriginY") ||
+		memberName == GG_STR("RenderWidth") ||
+		memberName == GG_STR("RenderHeight");
+}
+
+bool ParametersTypeDefinition::IsRenderScaleMemberAccess(ManagedObject* instance, String const& memberName, ScriptParameters const& parameters)
+{
+	if (!instance->IsStaticObject() || instance->GetType()->GetName() != GG_STR("Parameters"))
+	{
+		return false;
+	}
+
+	return
+		memberName == GG_STR("RenderScale") ||
+		(memberName == GG_STR("MapWidth") && parameters.IsMapSizeRenderScaleDependent(DIRECTION_HORIZONTAL)) ||
+		(memberName == GG_STR("MapHeight") && parameters.IsMapSizeRenderScaleDependent(DIRECTION_VERTICAL));
 }
\ No newline at end of file
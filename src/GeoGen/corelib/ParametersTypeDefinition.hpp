@@ -38,6 +38,19 @@ namespace geogen
 			//virtual ManagedObject* CreateInstance(Number value) const;
 
 			virtual runtime::ManagedObject* Copy(runtime::VirtualMachine* vm, runtime::ManagedObject* a) const;
+
+			/// Determines whether reading a member of an object makes the rendering sequence dependent on the render rectangle (the object is the Parameters static instance and the member is one of the render rectangle parameters).
+			/// @param instance The object whose member is being read.
+			/// @param memberName Name of the member.
+			/// @return True if the member access reads the render rectangle.
+			static bool IsRenderRectangleMemberAccess(runtime::ManagedObject* instance, String const& memberName);
+
+			/// Determines whether reading a member of an object makes the rendering sequence dependent on the render scale (the object is the Parameters static instance and the member is the render scale or a map size derived from it).
+			/// @param instance The object whose member is being read.
+			/// @param memberName Name of the member.
+			/// @param parameters Parameters of the script run.
+			/// @return True if the member access reads the render scale.
+			static bool IsRenderScaleMemberAccess(runtime::ManagedObject* instance, String const& memberName, runtime::ScriptParameters const& parameters);
 		};
 	}
 }
\ No newline at end of file
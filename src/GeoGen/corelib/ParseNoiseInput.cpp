@@ -36,13 +36,13 @@ using namespace corelib;
 using namespace runtime;
 using namespace genlib;
 
-genlib::NoiseLayers geogen::corelib::ParseNoiseInput(VirtualMachine* vm, CodeLocation location, std::vector<runtime::ManagedObject*> arguments)
+genlib::NoiseLayers geogen::corelib::ParseNoiseInput(VirtualMachine* vm, CodeLocation location, NativeArgumentList const& arguments, NoiseLayers const& defaultLayers)
 {
 	ArrayTypeDefinition const* arrayTypeDefinition = dynamic_cast<ArrayTypeDefinition const*>(vm->GetTypeDefinition(GG_STR("Array")));
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
 
 	NoiseLayers layers;
-	if (arguments.size() > 0)
+	if (arguments.Size() > 0)
 	{
 		ArrayObject* array = dynamic_cast<ArrayObject*>(arguments[0]);
 
@@ -86,7 +86,7 @@ genlib::NoiseLayers geogen::corelib::ParseNoiseInput(VirtualMachine* vm, CodeLoc
 	}
 	else
 	{
-		layers = NoiseLayersFactory::CreateDefaultLayers();
+		layers = defaultLayers;
 	}
 
 	return layers;
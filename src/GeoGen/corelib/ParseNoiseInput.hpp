@@ -21,6 +21,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 #include "../CodeLocation.hpp"
 #include "../genlib/NoiseLayersFactory.hpp"
 #include "../runtime/ManagedObjectHolder.hpp"
+#include "../runtime/NativeArgumentList.hpp"
 
 namespace geogen
 {
@@ -36,7 +37,8 @@ namespace geogen
 		/// @param vm The virtual machine.
 		/// @param location The code location of the call.
 		/// @param arguments Call arguments.
+		/// @param defaultLayers The layers used if the layers argument is omitted.
 		/// @return The layers object.
-		genlib::NoiseLayers ParseNoiseInput(runtime::VirtualMachine* vm, CodeLocation location, std::vector<runtime::ManagedObject*> arguments);
+		genlib::NoiseLayers ParseNoiseInput(runtime::VirtualMachine* vm, CodeLocation location, runtime::NativeArgumentList const& arguments, genlib::NoiseLayers const& defaultLayers = genlib::NoiseLayersFactory::CreateDefaultLayers());
 	}
 }
\ No newline at end of file
@@ -29,17 +29,15 @@ using namespace geogen::corelib;
 using namespace geogen::runtime;
 using namespace geogen::renderer;
 
-ManagedObject* PointCreateFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, vector<ManagedObject*> arguments) const
+ManagedObject* PointCreateFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, NativeArgumentList& arguments) const
 {
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
 	CoordinateTypeDefinition const* coordinateTypeDefinition = dynamic_cast<CoordinateTypeDefinition const*>(vm->GetTypeDefinition(GG_STR("Coordinate")));
 	PointTypeDefinition const* coordinateType = dynamic_cast<PointTypeDefinition const*>(this->GetOwningTypeDefinition());
 
-	vector<TypeDefinition const*> expectedTypes;	
-	expectedTypes.push_back(coordinateTypeDefinition);	
-	expectedTypes.push_back(coordinateTypeDefinition);
+	TypeDefinition const* expectedTypes[] = { coordinateTypeDefinition, coordinateTypeDefinition };
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments);
+	this->CheckArguments(vm, location, expectedTypes, arguments);
 
 	CoordinateObject* coordX = dynamic_cast<CoordinateObject*>(arguments[0]);
 	CoordinateObject* coordY = dynamic_cast<CoordinateObject*>(arguments[1]);
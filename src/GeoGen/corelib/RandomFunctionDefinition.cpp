@@ -27,21 +27,16 @@ using namespace geogen;
 using namespace geogen::corelib;
 using namespace geogen::runtime;
 
-ManagedObject* RandomFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, vector<ManagedObject*> arguments) const
+ManagedObject* RandomFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, NativeArgumentList& arguments) const
 {
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
 
-	vector<TypeDefinition const*> expectedParameters;
-	if (arguments.size() > 0)
-	{
-		expectedParameters.push_back(numberTypeDefinition);
-		expectedParameters.push_back(numberTypeDefinition);
-	}
-	
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedParameters, arguments);
+	// Either no arguments or both min and max
+	TypeDefinition const* expectedParameters[] = { numberTypeDefinition, numberTypeDefinition };
+	this->CheckArguments(vm, location, expectedParameters, arguments.Size() > 0 ? 2 : 0, arguments);
 
 	Number n;
-	if (arguments.size() > 0)
+	if (arguments.Size() > 0)
 	{
 		Number minValue = dynamic_cast<NumberObject*>(arguments[0])->GetValue();
 		Number maxValue = dynamic_cast<NumberObject*>(arguments[1])->GetValue();
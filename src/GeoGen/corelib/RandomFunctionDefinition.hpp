@@ -31,7 +31,7 @@ namespace geogen
 		public:
 			RandomFunctionDefinition() : GlobalNativeFunctionDefinition(GG_STR("Random")) {};
 
-			virtual runtime::ManagedObject* CallNative(CodeLocation location, runtime::VirtualMachine* vm, std::vector<runtime::ManagedObject*> arguments) const;
+			virtual runtime::ManagedObject* CallNative(CodeLocation location, runtime::VirtualMachine* vm, runtime::NativeArgumentList& arguments) const;
 		};
 	}
 }
\ No newline at end of file
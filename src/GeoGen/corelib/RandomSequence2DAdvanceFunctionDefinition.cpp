@@ -26,10 +26,9 @@ using namespace geogen::corelib;
 using namespace geogen::runtime;
 using namespace geogen::random;
 
-ManagedObject* RandomSequence2DAdvanceFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, vector<ManagedObject*> arguments) const
+ManagedObject* RandomSequence2DAdvanceFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, NativeArgumentList& arguments) const
 {
-	vector<TypeDefinition const*> expectedTypes;
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments);
+	this->CheckArguments(location, 0, arguments);
 
 	RandomSequence2D& sequence = dynamic_cast<RandomSequence2DObject*>(instance)->GetSequence();
 
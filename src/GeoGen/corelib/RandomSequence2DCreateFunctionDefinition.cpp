@@ -28,18 +28,17 @@ using namespace geogen::runtime;
 using namespace geogen::renderer;
 using namespace geogen::random;
 
-ManagedObject* RandomSequence2DCreateFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, vector<ManagedObject*> arguments) const
+ManagedObject* RandomSequence2DCreateFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, NativeArgumentList& arguments) const
 {
 	NumberTypeDefinition const* numberTypeDefinition = vm->GetNumberTypeDefinition();
 	RandomSequence2DTypeDefinition const* sequenceTypeDefinition = dynamic_cast<RandomSequence2DTypeDefinition const*>(vm->GetTypeDefinition(GG_STR("RandomSequence2D")));
 
-	vector<TypeDefinition const*> expectedTypes;
-	expectedTypes.push_back(numberTypeDefinition);
+	TypeDefinition const* expectedTypes[] = { numberTypeDefinition };
 
-	vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments, 0);
+	this->CheckArguments(vm, location, expectedTypes, arguments, 0);
 
 	RandomSeed passedSeed = 0;
-	if (arguments.size() > 0)
+	if (arguments.Size() > 0)
 	{
 		passedSeed = (RandomSeed)NumberToInt(dynamic_cast<NumberObject*>(arguments[0])->GetValue());
 	}
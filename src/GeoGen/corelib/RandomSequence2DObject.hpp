@@ -29,7 +29,7 @@ namespace geogen
 			random::RandomSeed seed;
 			random::RandomSequence2D sequence;
 		public:
-			RandomSequence2DObject(VirtualMachine* vm, TypeDefinition const* type, random::RandomSeed randomSeed) : ManagedObject(vm, type), sequence(randomSeed), seed(randomSeed)
+			RandomSequence2DObject(VirtualMachine* vm, TypeDefinition const* type, random::RandomSeed randomSeed, random::RandomSeedScheme seedScheme) : ManagedObject(vm, type), sequence(randomSeed, seedScheme), seed(randomSeed)
 			{
 			};
 			inline random::RandomSequence2D& GetSequence() { return this->sequence; }
@@ -43,7 +43,7 @@ RandomSequence2DTypeDefinition::RandomSequence2DTypeDefinition() : TypeDefinitio
 
 ManagedObject* RandomSequence2DTypeDefinition::CreateInstance(VirtualMachine* vm, RandomSeed randomSeed) const
 {
-	auto_ptr<ManagedObject> object(new RandomSequence2DObject(vm, this, randomSeed));
+	auto_ptr<ManagedObject> object(new RandomSequence2DObject(vm, this, randomSeed, vm->GetCompiledScript().GetConfiguration().SeedScheme));
 	vm->GetMemoryManager().RegisterObject(object.get());
 	return object.release();
 }
@@ -30,18 +30,18 @@ using namespace geogen;
 using namespace geogen::corelib;
 using namespace geogen::runtime;
 
-ManagedObject* RelativeCoordinateOperatorFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, vector<ManagedObject*> arguments) const
+ManagedObject* RelativeCoordinateOperatorFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, NativeArgumentList& arguments) const
 {
 	CoordinateTypeDefinition const* coordinateTypeDefinition = dynamic_cast<CoordinateTypeDefinition const*>(vm->GetTypeDefinition(GG_STR("Coordinate")));
 	PointTypeDefinition const* pointTypeDefinition = dynamic_cast<PointTypeDefinition const*>(vm->GetTypeDefinition(GG_STR("Point")));
 
-	vector<TypeDefinition const*> expectedTypes;
+	TypeDefinition const* expectedTypes[1];
 
-	if (arguments.size() > 0 && arguments[0]->GetType() == pointTypeDefinition)
+	if (arguments.Size() > 0 && arguments[0]->GetType() == pointTypeDefinition)
 	{
-		expectedTypes.push_back(pointTypeDefinition);
+		expectedTypes[0] = pointTypeDefinition;
 
-		vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments);
+		this->CheckArguments(vm, location, expectedTypes, arguments);
 
 		if (vm->GetArguments().GetMapWidth() == MAP_SIZE_INFINITE && vm->GetArguments().GetMapHeight() == MAP_SIZE_INFINITE)
 		{
@@ -60,9 +60,9 @@ ManagedObject* RelativeCoordinateOperatorFunctionDefinition::CallNative(CodeLoca
 	}
 	else 
 	{
-		expectedTypes.push_back(coordinateTypeDefinition);
+		expectedTypes[0] = coordinateTypeDefinition;
 
-		vector<ManagedObjectHolder> convertedObjectHolders = this->CheckArguments(vm, location, expectedTypes, arguments);
+		this->CheckArguments(vm, location, expectedTypes, arguments);
 
 		CoordinateObject* input = dynamic_cast<CoordinateObject*>(arguments[0]);
 		if (input->IsRelative())
@@ -0,0 +1,35 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include "RescaleFilterTypeDefinition.hpp"
+#include "../runtime/ManagedObject.hpp"
+#include "../RescaleFilter.hpp"
+
+using namespace geogen;
+using namespace corelib;
+using namespace runtime;
+using namespace std;
+
+RescaleFilterTypeDefinition* RescaleFilterTypeDefinition::Create()
+{
+	map<String, int> definitions;
+	definitions[RescaleFilterToString(RESCALE_FILTER_NEAREST)] = (int)RESCALE_FILTER_NEAREST;
+	definitions[RescaleFilterToString(RESCALE_FILTER_BILINEAR)] = (int)RESCALE_FILTER_BILINEAR;
+	definitions[RescaleFilterToString(RESCALE_FILTER_BOX)] = (int)RESCALE_FILTER_BOX;
+	definitions[RescaleFilterToString(RESCALE_FILTER_BICUBIC)] = (int)RESCALE_FILTER_BICUBIC;
+
+	return new RescaleFilterTypeDefinition(definitions);
+}
\ No newline at end of file
@@ -48,9 +48,15 @@ namespace geogen
 		public:
 			static UnaryArithmeticOperatorFunctionDefinition* Create(Operator op);
 
+			/// Evaluates the operator on plain values, without involving a virtual machine.
+			/// @param location Location of the operator in the code (used when reporting errors).
+			/// @param a The operand.
+			/// @return The result of the operation.
+			inline Number CallOperator(CodeLocation location, Number a) const { return this->function(location, a); }
+
 			virtual FunctionType GetFunctionType() const { return FUNCTION_TYPE_OPERATOR; }
 
-			virtual runtime::ManagedObject* CallNative(CodeLocation location, runtime::VirtualMachine* vm, std::vector<runtime::ManagedObject*> arguments) const;
+			virtual runtime::ManagedObject* CallNative(CodeLocation location, runtime::VirtualMachine* vm, runtime::NativeArgumentList& arguments) const;
 		};
 	}
 }
\ No newline at end of file
@@ -14,6 +14,9 @@ GNU General Public License for more details.
 You should have received a copy of the GNU General Public License
 along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 
+#include <algorithm>
+#include <cmath>
+
 #include "../InternalErrorException.hpp"
 #include "YieldRenderingStep.hpp"
 #include "../renderer/RenderingBounds2D.hpp"
@@ -31,7 +34,10 @@ using namespace genlib;
 void YieldRenderingStep::Step(renderer::Renderer* renderer) const
 {
 	HeightMap* internalData = dynamic_cast<HeightMap*>(renderer->GetObjectTable().GetObject(this->GetArgumentSlots()[0])->GetPtr());
-	HeightMap* copiedData = new HeightMap(*internalData, this->rect);
+	Rectangle renderRectangle = this->GetRenderRectangle(renderer);
+
+	// A map of exactly the rendered area shares its data with the rendered map. If this is the last use of the object, it is released right after this step, which leaves the rendered map the sole owner of the data.
+	HeightMap* copiedData = internalData->GetRectangle() == renderRectangle ? new HeightMap(*internalData) : new HeightMap(*internalData, renderRectangle);
 
 	if (!renderer->GetRenderedMapTable().AddItem(this->name, copiedData))
 	{
@@ -39,14 +45,45 @@ void YieldRenderingStep::Step(renderer::Renderer* renderer) const
 	}
 }
 
+Rectangle YieldRenderingStep::GetRenderRectangle(Renderer* renderer) const
+{
+	Rectangle renderRectangle = renderer->IsRenderRectangleOverridden() ? renderer->GetRenderRectangleOverride() : this->rect;
+
+	// The render rectangle is in pixels of the scale the sequence was generated with, rendering at a different scale has to cover the same area of the map.
+	double ratio = renderer->GetRenderScale() / renderer->GetRenderingSequence().GetRenderScale();
+	if (ratio != 1)
+	{
+		Point position(Coordinate(floor(renderRectangle.GetPosition().GetX() * ratio)), Coordinate(floor(renderRectangle.GetPosition().GetY() * ratio)));
+		Size2D size(max(Size1D(1), Size1D(renderRectangle.GetSize().GetWidth() * ratio)), max(Size1D(1), Size1D(renderRectangle.GetSize().GetHeight() * ratio)));
+		renderRectangle = Rectangle(position, size);
+	}
+
+	return renderRectangle;
+}
+
 void YieldRenderingStep::UpdateRenderingBounds(Renderer* renderer, std::vector<RenderingBounds*> argumentBounds) const
 {
-	dynamic_cast<RenderingBounds2D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->CombineRectangle(this->rect);
+	renderer->GetRenderingSequenceMetadata().GetRenderingBounds2D(this)->CombineRectangle(this->GetRenderRectangle(renderer));
 
-	dynamic_cast<RenderingBounds2D*>(argumentBounds[0])->CombineRectangle(
+	RenderingBounds2D::Cast(argumentBounds[0])->CombineRectangle(
 		this->GetRenderingBounds(renderer));
 }
 
+unsigned YieldRenderingStep::GetRetainedMemory(Renderer* renderer) const
+{
+	// The render rectangle is already in pixels.
+	return HeightMap::GetMemorySize(this->GetRenderRectangle(renderer), 1);
+}
+
+bool YieldRenderingStep::IsRetainedMemoryShared(Renderer* renderer, std::vector<RenderingBounds const*> argumentBounds) const
+{
+	vector<unsigned> const& releasedSlots = renderer->GetRenderingSequenceMetadata().GetObjectIndexesToRelease(this);
+
+	return
+		RenderingBounds2D::Cast(argumentBounds[0])->GetRectangle() == this->GetRenderRectangle(renderer) &&
+		find(releasedSlots.begin(), releasedSlots.end(), this->GetArgumentSlots()[0]) != releasedSlots.end();
+}
+
 void YieldRenderingStep::SerializeArguments(IOStream& stream) const
 {
 	this->rect.Serialize(stream);
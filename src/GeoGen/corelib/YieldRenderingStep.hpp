@@ -29,6 +29,8 @@ namespace geogen
 		private:
 			String name;
 			Rectangle rect;
+
+			Rectangle GetRenderRectangle(renderer::Renderer* renderer) const;
 		public:
 			YieldRenderingStep(CodeLocation location, std::vector<unsigned> const& argumentSlots, unsigned returnSlot, String name, Rectangle rect)
 				: RenderingStep2D(location, argumentSlots, returnSlot), name(name), rect(rect) {
@@ -40,6 +42,10 @@ namespace geogen
 
 			virtual void UpdateRenderingBounds(renderer::Renderer* renderer, std::vector<renderer::RenderingBounds*> argumentBounds) const;
 
+			virtual unsigned GetRetainedMemory(renderer::Renderer* renderer) const;
+
+			virtual bool IsRetainedMemoryShared(renderer::Renderer* renderer, std::vector<renderer::RenderingBounds const*> argumentBounds) const;
+
 			virtual void SerializeArguments(IOStream& stream) const;
 		};
 	}
@@ -0,0 +1,55 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include "BilinearSampler.hpp"
+
+using namespace geogen;
+using namespace genlib;
+
+const double BilinearSampler::SNAP_DISTANCE = 0.00005;
+
+void BilinearSampler::SampleLine(Height* output, unsigned count, double const* xs, double const* ys, Height outsideHeight) const
+{
+	double minX = -SNAP_DISTANCE;
+	double minY = -SNAP_DISTANCE;
+	double maxX = this->maxX + SNAP_DISTANCE;
+	double maxY = this->maxY + SNAP_DISTANCE;
+
+	// Points of a line which lie within the data form a single span, so the bounds are only tested outside of the interpolation loop.
+	unsigned start = 0;
+	while (start < count && (xs[start] < minX || xs[start] > maxX || ys[start] < minY || ys[start] > maxY))
+	{
+		output[start] = outsideHeight;
+		start++;
+	}
+
+	unsigned end = count;
+	while (end > start && (xs[end - 1] < minX || xs[end - 1] > maxX || ys[end - 1] < minY || ys[end - 1] > maxY))
+	{
+		end--;
+		output[end] = outsideHeight;
+	}
+
+	this->SamplePoints(output + start, end - start, xs + start, ys + start);
+}
+
+void BilinearSampler::SamplePoints(Height* output, unsigned count, double const* xs, double const* ys) const
+{
+	for (unsigned i = 0; i < count; i++)
+	{
+		output[i] = this->Sample(xs[i], ys[i]);
+	}
+}
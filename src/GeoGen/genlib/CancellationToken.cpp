@@ -0,0 +1,74 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include "CancellationToken.hpp"
+#include "../CancellationException.hpp"
+#include "../utils/WallClock.hpp"
+
+using namespace geogen;
+using namespace genlib;
+using namespace utils;
+
+namespace
+{
+	CancellationToken const* currentToken = NULL;
+}
+
+#pragma omp threadprivate(currentToken)
+
+CancellationToken::Scope::Scope(CancellationToken const* token)
+: previousToken(currentToken)
+{
+	currentToken = token;
+}
+
+CancellationToken::Scope::~Scope()
+{
+	currentToken = this->previousToken;
+}
+
+void CancellationToken::SetTimeout(unsigned long long timeout)
+{
+	this->deadline = GetWallClockMicroseconds() + timeout;
+}
+
+void CancellationToken::Reset()
+{
+	this->isCancelled = false;
+	this->deadline = 0;
+}
+
+bool CancellationToken::IsDeadlineExceeded() const
+{
+	return this->deadline != 0 && GetWallClockMicroseconds() >= this->deadline;
+}
+
+void CancellationToken::ThrowIfCancelled() const
+{
+	if (this->isCancelled)
+	{
+		throw CancellationException(false);
+	}
+	else if (this->IsDeadlineExceeded())
+	{
+		throw CancellationException(true);
+	}
+}
+
+CancellationToken const* CancellationToken::GetCurrent()
+{
+	return currentToken;
+}
\ No newline at end of file
@@ -24,13 +24,326 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 #include "../ApiUsageException.hpp"
 #include "../random/RandomSequence2D.hpp"
 #include "HeightProfile.hpp"
+#include "ResamplingKernel.hpp"
+#include "HeightSpanKernels.hpp"
+#include "MemoryTracker.hpp"
+#include "SimplexNoise.hpp"
+#include "CancellationToken.hpp"
+#include "../CancellationException.hpp"
 #include "../InternalErrorException.hpp"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 using namespace geogen;
 using namespace genlib;
 using namespace random;
 using namespace std;
 
+namespace
+{
+	/// Checks the cancellation token assigned to the calling thread (see CancellationToken::Scope) once per band of HeightMap::CANCELLATION_CHECK_BAND_HEIGHT rows or columns. Once the token is found cancelled, all remaining rows are skipped.
+	/// Can be shared by threads of a parallel loop, which can't be left by an exception, so ThrowIfCancelled has to be called after the loop.
+	class BandCancellation
+	{
+	private:
+		CancellationToken const* token;
+		volatile bool isCancelled;
+	public:
+		BandCancellation() : token(CancellationToken::GetCurrent()), isCancelled(false) {}
+
+		/// Determines whether processing of a row (or column) should be skipped.
+		inline bool IsCancelled(int row)
+		{
+			if (!this->isCancelled && this->token != NULL && row % HeightMap::CANCELLATION_CHECK_BAND_HEIGHT == 0 && this->token->IsCancelled())
+			{
+				this->isCancelled = true;
+			}
+
+			return this->isCancelled;
+		}
+
+		/// Determines whether any row was skipped.
+		inline bool WasCancelled() const
+		{
+			return this->isCancelled;
+		}
+
+		/// Throws CancellationException if any row was skipped.
+		inline void ThrowIfCancelled() const
+		{
+			if (this->isCancelled)
+			{
+				throw CancellationException(this->token->IsDeadlineExceeded());
+			}
+		}
+	};
+
+	/// Felzenszwalb-Huttenlocher 1D squared distance transform (http://cs.brown.edu/~pff/dt/) of @a n values from @a f into @a d.
+	/// @a v and @a z are scratch arrays of at least @a n and @a n + 1 items.
+	template<typename T>
+	void DistanceTransform1D(T const* f, T* d, unsigned n, int* v, double* z)
+	{
+		if (n == 0)
+		{
+			return;
+		}
+
+		int k = 0;
+		v[0] = 0;
+		z[0] = -HUGE_VAL;
+		z[1] = HUGE_VAL;
+		for (unsigned q = 1; q < n; q++)
+		{
+			double fq = double(f[q]) + Square(double(q));
+			double s = (fq - (double(f[v[k]]) + Square(double(v[k])))) / double(2 * int(q) - 2 * v[k]);
+			while (s <= z[k])
+			{
+				k--;
+				s = (fq - (double(f[v[k]]) + Square(double(v[k])))) / double(2 * int(q) - 2 * v[k]);
+			}
+
+			k++;
+			v[k] = q;
+			z[k] = s;
+			z[k + 1] = HUGE_VAL;
+		}
+
+		k = 0;
+		for (unsigned q = 0; q < n; q++)
+		{
+			while (z[k + 1] < q)
+			{
+				k++;
+			}
+
+			d[q] = T(Square(double(int(q) - v[k])) + double(f[v[k]]));
+		}
+	}
+
+	/// Exact euclidean distance transform of @a heightData (non-positive heights are the sources) limited to @a maximumDistance.
+	/// Rows and blocks of columns are processed in parallel, each thread reuses its own scratch arrays.
+	template<typename T>
+	void DistanceTransform(Height* heightData, Size1D width, Size1D height, Size1D maximumDistance)
+	{
+		BandCancellation cancellation;
+		T maximumValue = T(Square(double(maximumDistance)));
+		unsigned length = max(width, height);
+		unsigned blockWidth = HeightMap::DISTANCE_MAP_COLUMN_BLOCK_WIDTH;
+
+		std::vector<T> values(width * height);
+		MemoryTracker::ScopedAllocation valuesAllocation(values.size() * sizeof(T));
+		MemoryTracker::Account* memoryAccount = MemoryTracker::GetCurrentAccount();
+
+		#pragma omp parallel
+		{
+			MemoryTracker::AccountScope memoryAccountScope(memoryAccount);
+			std::vector<T> d(length);
+			std::vector<int> v(length);
+			std::vector<double> z(length + 1);
+			std::vector<T> columns(blockWidth * height);
+			MemoryTracker::ScopedAllocation scratchAllocation(length * (sizeof(T) + sizeof(int) + sizeof(double)) + sizeof(double) + columns.size() * sizeof(T));
+
+			// Horizontal pass, initializes the buffer on the fly
+			#pragma omp for schedule(static)
+			for (int y = 0; y < int(height); y++)
+			{
+				if (cancellation.IsCancelled(y))
+				{
+					continue;
+				}
+
+				T* row = &values[y * width];
+				Height const* heightRow = heightData + y * width;
+				for (unsigned x = 0; x < width; x++)
+				{
+					row[x] = heightRow[x] <= 0 ? T(0) : maximumValue;
+				}
+
+				DistanceTransform1D<T>(row, &d[0], width, &v[0], &z[0]);
+				std::copy(d.begin(), d.begin() + width, row);
+			}
+
+			// Vertical pass, a block of columns is gathered into contiguous memory to avoid striding through the entire buffer for each column
+			#pragma omp for schedule(static)
+			for (int block = 0; block < int((width + blockWidth - 1) / blockWidth); block++)
+			{
+				if (cancellation.IsCancelled(block * blockWidth))
+				{
+					continue;
+				}
+
+				unsigned startX = block * blockWidth;
+				unsigned currentBlockWidth = min(blockWidth, width - startX);
+
+				for (unsigned y = 0; y < height; y++)
+				{
+					T const* row = &values[y * width + startX];
+					for (unsigned i = 0; i < currentBlockWidth; i++)
+					{
+						columns[i * height + y] = row[i];
+					}
+				}
+
+				for (unsigned i = 0; i < currentBlockWidth; i++)
+				{
+					T* column = &columns[i * height];
+					DistanceTransform1D<T>(column, &d[0], height, &v[0], &z[0]);
+					std::copy(d.begin(), d.begin() + height, column);
+				}
+
+				for (unsigned y = 0; y < height; y++)
+				{
+					Height* heightRow = heightData + y * width + startX;
+					for (unsigned i = 0; i < currentBlockWidth; i++)
+					{
+						heightRow[i] = Height(sqrt(double(columns[i * height + y])) * double(HEIGHT_MAX) / double(maximumDistance));
+					}
+				}
+			}
+		}
+
+		cancellation.ThrowIfCancelled();
+	}
+
+	// Tolerates rounding errors on the strip boundaries, which used to be tested using exact distances.
+	const double GRADIENT_STRIP_EPSILON = 1e-12;
+
+	/// Determines whether position @a t along a gradient vector lies within the gradient strip.
+	inline bool IsInsideGradientStrip(double t)
+	{
+		return t >= -GRADIENT_STRIP_EPSILON && t <= 1 + GRADIENT_STRIP_EPSILON;
+	}
+
+	/// Fills a row of a linear gradient. Position along the gradient vector (@a startT in the first pixel) grows by @a stepT with each pixel.
+	/// Positions outside of range <0, 1> are saturated to @a fromHeight or @a toHeight as whole spans.
+	void FillLinearGradientRow(Height* row, Size1D width, double startT, double stepT, Height fromHeight, Height toHeight, double heightFactor)
+	{
+		long long spanStart;
+		long long spanEnd;
+		if (stepT == 0)
+		{
+			bool inside = IsInsideGradientStrip(startT);
+			spanStart = inside ? 0 : width;
+			spanEnd = width;
+		}
+		else
+		{
+			double boundA = (-GRADIENT_STRIP_EPSILON - startT) / stepT;
+			double boundB = (1 + GRADIENT_STRIP_EPSILON - startT) / stepT;
+			spanStart = (long long)std::min(double(width), std::max(0.0, ceil(std::min(boundA, boundB))));
+			spanEnd = (long long)std::min(double(width), std::max(double(spanStart), floor(std::max(boundA, boundB)) + 1));
+
+			// The bounds may be off by a pixel due to rounding, fix them up using the same expression as the fill loop.
+			while (spanStart > 0 && IsInsideGradientStrip(startT + stepT * (spanStart - 1))) spanStart--;
+			while (spanStart < spanEnd && !IsInsideGradientStrip(startT + stepT * spanStart)) spanStart++;
+			while (spanEnd < width && IsInsideGradientStrip(startT + stepT * spanEnd)) spanEnd++;
+			while (spanEnd > spanStart && !IsInsideGradientStrip(startT + stepT * (spanEnd - 1))) spanEnd--;
+		}
+
+		bool fromOnLeft = stepT > 0 || (stepT == 0 && startT < 0);
+		std::fill(row, row + spanStart, fromOnLeft ? fromHeight : toHeight);
+
+		for (long long x = spanStart; x < spanEnd; x++)
+		{
+			row[x] = Height(fromHeight + heightFactor * std::max(0.0, startT + stepT * x));
+		}
+
+		std::fill(row + spanEnd, row + width, fromOnLeft ? toHeight : fromHeight);
+	}
+
+	// Gets pointer to the first height of a row of a physical rectangle of a map. The map has to be made unique (see HeightMap::MakeUnique) before the loop, this doesn't check it.
+	inline Height* GetRowPtr(Height* heights, Size1D width, Rectangle physicalRect, int row)
+	{
+		return heights + (physicalRect.GetPosition().GetY() + row) * int(width) + physicalRect.GetPosition().GetX();
+	}
+
+	// Gets pointer to the first height of a row of a physical rectangle of a map which is only read.
+	inline Height const* GetRowPtr(HeightMap const* map, Rectangle physicalRect, int row)
+	{
+		return map->GetHeightDataPtr() + (physicalRect.GetPosition().GetY() + row) * int(map->GetWidth()) + physicalRect.GetPosition().GetX();
+	}
+
+	// A single noise layer, with everything which doesn't depend on the row prepared in advance. See HeightMap::AddNoiseLayers.
+	struct PreparedNoiseLayer
+	{
+		Size1D waveLength;
+		Height amplitude;
+		bool isInterpolated;
+		vector<unsigned> columnHashes;
+
+		// Only for interpolated layers
+		Size1D gridWidth;
+		vector<Size1D> gridColumns;
+		vector<double> remainderXs;
+	};
+
+	// Evaluates the bicubic polynomial defined by 4x4 grid heights (@a gridRow0 points to the top left one).
+	inline double EvaluateBicubic(int const* gridRow0, Size1D gridWidth, double remainderX, double remainderY)
+	{
+		int const* gridRow1 = gridRow0 + gridWidth;
+		int const* gridRow2 = gridRow1 + gridWidth;
+		int const* gridRow3 = gridRow2 + gridWidth;
+
+		double height00 = (Height)gridRow0[0];
+		double height10 = (Height)gridRow0[1];
+		double height20 = (Height)gridRow0[2];
+		double height30 = (Height)gridRow0[3];
+		double height01 = (Height)gridRow1[0];
+		double height11 = (Height)gridRow1[1];
+		double height21 = (Height)gridRow1[2];
+		double height31 = (Height)gridRow1[3];
+		double height02 = (Height)gridRow2[0];
+		double height12 = (Height)gridRow2[1];
+		double height22 = (Height)gridRow2[2];
+		double height32 = (Height)gridRow2[3];
+		double height03 = (Height)gridRow3[0];
+		double height13 = (Height)gridRow3[1];
+		double height23 = (Height)gridRow3[2];
+		double height33 = (Height)gridRow3[3];
+
+		// Prepare coefficients for the bicubic polynomial.
+		// TODO: These need to be recalculated only when the grid cell changes
+		double a00 = height11;
+		double a01 = -.5*height10 + .5*height12;
+		double a02 = height10 - 2.5*height11 + 2 * height12 - .5*height13;
+		double a03 = -.5*height10 + 1.5*height11 - 1.5*height12 + .5*height13;
+		double a10 = -.5*height01 + .5*height21;
+		double a11 = .25*height00 - .25*height02 - .25*height20 + .25*height22;
+		double a12 = -.5*height00 + 1.25*height01 - height02 + .25*height03 + .5*height20 - 1.25*height21 + height22 - .25*height23;
+		double a13 = .25*height00 - .75*height01 + .75*height02 - .25*height03 - .25*height20 + .75*height21 - .75*height22 + .25*height23;
+		double a20 = height01 - 2.5*height11 + 2 * height21 - .5*height31;
+		double a21 = -.5*height00 + .5*height02 + 1.25*height10 - 1.25*height12 - height20 + height22 + .25*height30 - .25*height32;
+		double a22 = height00 - 2.5*height01 + 2 * height02 - .5*height03 - 2.5*height10 + 6.25*height11 - 5 * height12 + 1.25*height13 + 2 * height20 - 5 * height21 + 4 * height22 - height23 - .5*height30 + 1.25*height31 - height32 + .25*height33;
+		double a23 = -.5*height00 + 1.5*height01 - 1.5*height02 + .5*height03 + 1.25*height10 - 3.75*height11 + 3.75*height12 - 1.25*height13 - height20 + 3 * height21 - 3 * height22 + height23 + .25*height30 - .75*height31 + .75*height32 - .25*height33;
+		double a30 = -.5*height01 + 1.5*height11 - 1.5*height21 + .5*height31;
+		double a31 = .25*height00 - .25*height02 - .75*height10 + .75*height12 + .75*height20 - .75*height22 - .25*height30 + .25*height32;
+		double a32 = -.5*height00 + 1.25*height01 - height02 + .25*height03 + 1.5*height10 - 3.75*height11 + 3 * height12 - .75*height13 - 1.5*height20 + 3.75*height21 - 3 * height22 + .75*height23 + .5*height30 - 1.25*height31 + height32 - .25*height33;
+		double a33 = .25*height00 - .75*height01 + .75*height02 - .25*height03 - .75*height10 + 2.25*height11 - 2.25*height12 + .75*height13 + .75*height20 - 2.25*height21 + 2.25*height22 - .75*height23 - .25*height30 + .75*height31 - .75*height32 + .25*height33;
+
+		// Calculate value of the bicubic polynomial.
+		double remainderX2 = remainderX * remainderX;
+		double remainderX3 = remainderX2 * remainderX;
+		double remainderY2 = remainderY * remainderY;
+		double remainderY3 = remainderY2 * remainderY;
+
+		return (a00 + a01 * remainderY + a02 * remainderY2 + a03 * remainderY3) +
+			(a10 + a11 * remainderY + a12 * remainderY2 + a13 * remainderY3) * remainderX +
+			(a20 + a21 * remainderY + a22 * remainderY2 + a23 * remainderY3) * remainderX2 +
+			(a30 + a31 * remainderY + a32 * remainderY2 + a33 * remainderY3) * remainderX3;
+	}
+
+	unsigned GetMaxThreadCount()
+	{
+#ifdef _OPENMP
+		return omp_get_max_threads();
+#else
+		return 1;
+#endif
+	}
+}
+
 #define FOR_EACH_IN_RECT(x, y, rect) \
 	for (Coordinate y = rect.GetPosition().GetY(); y < rect.GetEndingPoint().GetY(); y++) \
 		for (Coordinate x = rect.GetPosition().GetX(); x < rect.GetEndingPoint().GetX(); x++)
@@ -38,13 +351,9 @@ using namespace std;
 HeightMap::HeightMap(Rectangle rectangle, Height height, Scale scale)
 :rectangle(rectangle), scale(scale)
 {
-	this->heightData = new Height[rectangle.GetSize().GetTotalLength()];
+	this->heightData = MemoryTracker::AllocateHeights(rectangle.GetSize().GetTotalLength());
 	
-	Rectangle physicalRect = this->GetPhysicalRectangleUnscaled(rectangle);
-	FOR_EACH_IN_RECT(x, y, physicalRect)
-	{
-		(*this)(x, y) = height;
-	}
+	std::fill(this->heightData, this->heightData + rectangle.GetSize().GetTotalLength(), height);
 }
 
 HeightMap::HeightMap(HeightMap const& other)
@@ -52,102 +361,127 @@ HeightMap::HeightMap(HeightMap const& other)
 	this->rectangle = other.rectangle;
 	this->scale = other.scale;
 
-	this->heightData = new Height[this->rectangle.GetSize().GetTotalLength()]; 
-	memcpy(this->heightData, other.heightData, sizeof(Height) * this->rectangle.GetSize().GetTotalLength());
+	// The data is copied lazily, by MakeUnique called from the first modifying operation of either of the maps.
+	this->heightData = MemoryTracker::ShareHeights(other.heightData);
 }
 
 HeightMap::HeightMap(HeightMap const& other, Rectangle cutoutRect)
 {
 	this->rectangle = cutoutRect;
-	this->heightData = new Height[cutoutRect.GetSize().GetTotalLength()];
+	this->heightData = MemoryTracker::AllocateHeights(cutoutRect.GetSize().GetTotalLength());
 	this->scale = other.scale;
 
 	Rectangle physicalRect = this->GetPhysicalRectangleUnscaled(cutoutRect);
 
 	// Fill all pixels with 0, because the cuout rect might have only partially overlapped with the original rect.
-	FOR_EACH_IN_RECT(x, y, physicalRect)
-	{
-		(*this)(x, y) = 0;
-	}
+	std::fill(this->heightData, this->heightData + physicalRect.GetSize().GetTotalLength(), 0);
 
 	Rectangle intersection = this->GetPhysicalRectangleUnscaled(Rectangle::Intersect(other.rectangle, cutoutRect));
 
+	Size1D width = this->GetWidth();
 	Point offset = cutoutRect.GetPosition() - other.rectangle.GetPosition();
 	FOR_EACH_IN_RECT(x, y, intersection)
 	{
-		(*this)(x, y) = other(x + offset.GetX(), y + offset.GetY());
+		this->heightData[x + width * y] = other(x + offset.GetX(), y + offset.GetY());
 	}
 }
 
 HeightMap& HeightMap::operator=(HeightMap const& other)
 {
+	// The other data is shared before the current data is released, so self-assignment is safe.
+	Height* sharedData = MemoryTracker::ShareHeights(other.heightData);
+	MemoryTracker::ReleaseHeights(this->heightData);
+
 	this->rectangle = other.rectangle;
 	this->scale = other.scale;
+	this->heightData = sharedData;
 
-	delete [] this->heightData;
+	return *this;
+}
 
-	this->heightData = new Height[this->rectangle.GetSize().GetTotalLength()];
-	memcpy(this->heightData, other.heightData, sizeof(Height) * this->rectangle.GetSize().GetTotalLength());
+void HeightMap::MakeUnique()
+{
+	if (MemoryTracker::IsShared(this->heightData))
+	{
+		Height* uniqueData = MemoryTracker::AllocateHeights(this->rectangle.GetSize().GetTotalLength());
+		memcpy(uniqueData, this->heightData, sizeof(Height) * this->rectangle.GetSize().GetTotalLength());
 
-	return *this;
+		MemoryTracker::ReleaseHeights(this->heightData);
+		this->heightData = uniqueData;
+	}
 }
 
 HeightMap::~HeightMap()
 {
-	delete[] this->heightData;
+	MemoryTracker::ReleaseHeights(this->heightData);
 }
 
 void HeightMap::Abs()
 {
+	this->MakeUnique();
+
 	Rectangle operationRect = this->GetPhysicalRectangleUnscaled(this->rectangle);
 
+	Size1D width = this->GetWidth();
 	FOR_EACH_IN_RECT(x, y, operationRect)
 	{
-		(*this)(x, y) = (*this)(x, y) > 0 ? (*this)(x, y) : -(*this)(x, y);
+		Height& height = this->heightData[x + width * y];
+		height = height > 0 ? height : -height;
 	}
 }
 
 void HeightMap::Add(Height addend)
 {
+	this->MakeUnique();
+
 	Rectangle operationRect = this->GetPhysicalRectangleUnscaled(this->rectangle);
 
+	Size1D width = this->GetWidth();
 	FOR_EACH_IN_RECT(x, y, operationRect)
 	{
-		(*this)(x, y) = AddHeights((*this)(x, y), addend);
+		Height& height = this->heightData[x + width * y];
+		height = AddHeights(height, addend);
 	}
 }
 
 void HeightMap::AddMasked(Height addend, HeightMap* mask)
 {
+	this->MakeUnique();
+
 	if (!mask->rectangle.Contains(this->rectangle))
 	{
 		throw ApiUsageException(GG_STR("Mask is too small."));
 	}
 
 	Rectangle operationRect = this->GetPhysicalRectangleUnscaled(this->rectangle);
+	Rectangle maskRect = mask->GetPhysicalRectangleUnscaled(this->rectangle);
 
-	Point maskOffset = mask->GetRectangle().GetPosition() - this->rectangle.GetPosition();
-	FOR_EACH_IN_RECT(x, y, operationRect)
+	#pragma omp parallel for schedule(static)
+	for (int y = 0; y < int(operationRect.GetSize().GetHeight()); y++)
 	{
-		double maskHeight = max((*mask)(x + maskOffset.GetX(), y + maskOffset.GetY()), Height(0));
-		(*this)(x, y) = AddHeights((*this)(x, y), Height(addend * maskHeight / (double)HEIGHT_MAX));
+		HeightSpanKernels::AddMasked(GetRowPtr(this->heightData, this->GetWidth(), operationRect, y), addend, GetRowPtr(mask, maskRect, y), operationRect.GetSize().GetWidth());
 	}
 }
 
 void HeightMap::AddMap(HeightMap* addend)
 {
+	this->MakeUnique();
+
 	Rectangle intersection = Rectangle::Intersect(this->rectangle, addend->rectangle);
 	Rectangle operationRect = this->GetPhysicalRectangleUnscaled(intersection);
+	Rectangle addendRect = addend->GetPhysicalRectangleUnscaled(intersection);
 
-	Point offset = this->rectangle.GetPosition() - intersection.GetPosition();
-	FOR_EACH_IN_RECT(x, y, operationRect) 
+	#pragma omp parallel for schedule(static)
+	for (int y = 0; y < int(operationRect.GetSize().GetHeight()); y++)
 	{
-		(*this)(x, y) = AddHeights((*this)(x, y), (*addend)(x + offset.GetX(), y + offset.GetY()));
+		HeightSpanKernels::Add(GetRowPtr(this->heightData, this->GetWidth(), operationRect, y), GetRowPtr(addend, addendRect, y), operationRect.GetSize().GetWidth());
 	}
 }
 
 void HeightMap::AddMapMasked(HeightMap* addend, HeightMap* mask)
 {
+	this->MakeUnique();
+
 	Rectangle intersection = Rectangle::Intersect(this->rectangle, addend->rectangle);
 	
 	if (!mask->rectangle.Contains(intersection))
@@ -156,14 +490,13 @@ void HeightMap::AddMapMasked(HeightMap* addend, HeightMap* mask)
 	}
 	
 	Rectangle operationRect = this->GetPhysicalRectangleUnscaled(intersection);
+	Rectangle addendRect = addend->GetPhysicalRectangleUnscaled(intersection);
+	Rectangle maskRect = mask->GetPhysicalRectangleUnscaled(intersection);
 
-	Point addendOffset = this->rectangle.GetPosition() - intersection.GetPosition();
-	Point maskOffset = this->rectangle.GetPosition() - mask->GetRectangle().GetPosition();
-	FOR_EACH_IN_RECT(x, y, operationRect)
+	#pragma omp parallel for schedule(static)
+	for (int y = 0; y < int(operationRect.GetSize().GetHeight()); y++)
 	{
-		Height addendHeight = (*addend)(x + addendOffset.GetX(), y + addendOffset.GetY());
-		double maskHeight = max((*mask)(x + maskOffset.GetX(), y + maskOffset.GetY()), Height(0));
-		(*this)(x, y) = AddHeights((*this)(x, y), Height(addendHeight * maskHeight / (double)HEIGHT_MAX));
+		HeightSpanKernels::AddMasked(GetRowPtr(this->heightData, this->GetWidth(), operationRect, y), GetRowPtr(addend, addendRect, y), GetRowPtr(mask, maskRect, y), operationRect.GetSize().GetWidth());
 	}
 }
 
@@ -181,18 +514,22 @@ void HeightMap::Blur(Size1D radius, Direction direction)
 	}
 
 	// Allocate the new array.
-	Height* new_data = new Height[this->rectangle.GetSize().GetTotalLength()];
+	Height* new_data = MemoryTracker::AllocateHeights(this->rectangle.GetSize().GetTotalLength());
 
 	Size1D scaledRadius = this->GetScaledSize(radius);
 
+	// The original data is only read, the blurred heights are written into the new array.
+	HeightMap const& source = *this;
+
+	BandCancellation cancellation;
 	if (direction == DIRECTION_HORIZONTAL) {
-		for (Coordinate y = 0; y < (Coordinate)this->GetHeight(); y++) {
+		for (Coordinate y = 0; y < (Coordinate)this->GetHeight() && !cancellation.IsCancelled(y); y++) {
 			// Prefill the window with value of the left edge + n leftmost values (where n is kernel size).
 			Size1D window_size = scaledRadius * 2 + 1;
-			long long window_value = (long long)(*this)(0, y) * scaledRadius;
+			long long window_value = (long long)source(0, y) * scaledRadius;
 
 			for (Coordinate x = 0; x < (Coordinate)scaledRadius + 1; x++) {
-				window_value += (long long)(*this)(x, y);
+				window_value += (long long)source(x, y);
 			}
 
 			/* In every step shift the window one tile to the right  (= subtract its leftmost cell and add
@@ -200,13 +537,13 @@ void HeightMap::Blur(Size1D radius, Direction direction)
 			for (Coordinate x = 0; x < (Coordinate)this->GetWidth(); x++) {
 				// If the window is approaching right border, use the rightmost value as fill.
 				if (x < (Coordinate)scaledRadius + 1) {
-					window_value += (long long)(*this)(x + scaledRadius + 1, y) - (long long)(*this)(0, y);
+					window_value += (long long)source(x + scaledRadius + 1, y) - (long long)source(0, y);
 				}
 				else if (x + scaledRadius + 1 < (Coordinate)this->GetWidth()) {
-					window_value += (long long)(*this)(x + scaledRadius + 1, y) - (long long)(*this)(x - scaledRadius, y);
+					window_value += (long long)source(x + scaledRadius + 1, y) - (long long)source(x - scaledRadius, y);
 				}
 				else {
-					window_value += (long long)(*this)(this->GetWidth() - 1, y) - (long long)(*this)(x - scaledRadius, y);
+					window_value += (long long)source(this->GetWidth() - 1, y) - (long long)source(x - scaledRadius, y);
 				}
 
 				// Set the value of current tile to arithmetic average of window tiles.
@@ -215,13 +552,13 @@ void HeightMap::Blur(Size1D radius, Direction direction)
 		}
 	}
 	else {
-		for (Coordinate x = 0; x < (Coordinate)this->GetWidth(); x++) {
+		for (Coordinate x = 0; x < (Coordinate)this->GetWidth() && !cancellation.IsCancelled(x); x++) {
 			// Prefill the window with value of the left edge + n topmost values (where n is radius).
 			Size1D window_size = scaledRadius * 2 + 1;
-			long long window_value = (long long)(*this)(x, 0) * scaledRadius;
+			long long window_value = (long long)source(x, 0) * scaledRadius;
 
 			for (Size1D y = 0; y < (Coordinate)scaledRadius + 1; y++) {
-				window_value += (long long)(*this)(x, y);
+				window_value += (long long)source(x, y);
 			}
 
 			/* In every step shift the window one tile to the bottom  (= subtract its topmost cell and add
@@ -229,13 +566,13 @@ void HeightMap::Blur(Size1D radius, Direction direction)
 			for (Coordinate y = 0; y < (Coordinate)this->GetHeight(); y++) {
 				// If the window is approaching right border, use the rightmost value as fill.
 				if (y < (Coordinate)scaledRadius + 1) {
-					window_value += (long long)(*this)(x, y + scaledRadius + 1) - (long long)(*this)(x, 0);
+					window_value += (long long)source(x, y + scaledRadius + 1) - (long long)source(x, 0);
 				}
 				else if (y + scaledRadius + 1 < this->GetHeight()) {
-					window_value += (long long)(*this)(x, y + scaledRadius + 1) - (long long)(*this)(x, y - scaledRadius);
+					window_value += (long long)source(x, y + scaledRadius + 1) - (long long)source(x, y - scaledRadius);
 				}
 				else {
-					window_value += (long long)(*this)(x, this->GetHeight() - 1) - (long long)(*this)(x, y - scaledRadius);
+					window_value += (long long)source(x, this->GetHeight() - 1) - (long long)source(x, y - scaledRadius);
 				}
 
 				// Set the value of current tile to arithmetic average of window tiles. 
@@ -244,15 +581,23 @@ void HeightMap::Blur(Size1D radius, Direction direction)
 		}
 	}
 
+	if (cancellation.WasCancelled())
+	{
+		MemoryTracker::ReleaseHeights(new_data);
+		cancellation.ThrowIfCancelled();
+	}
+
 	// Relink and delete the original array data
-	delete[] this->heightData;
+	MemoryTracker::ReleaseHeights(this->heightData);
 	this->heightData = new_data;
 }
 
-void HeightMap::CellNoise(Size1D meanCellSize, RandomSeed seed)
+void HeightMap::CellNoise(Size1D meanCellSize, RandomSeed seed, RandomSeedScheme seedScheme)
 {
-	RandomSequence2D randomSequenceX(seed);
-	RandomSequence2D randomSequenceY(CreateSeed(seed));
+	this->MakeUnique();
+
+	RandomSequence2D randomSequenceX(seed, seedScheme);
+	RandomSequence2D randomSequenceY(CreateSeed(seed), seedScheme);
 
 	// Place one random point in each cell of a regular grid. Set height according to distance of the nearest random point.
 	int gridSize = meanCellSize; // Signed, because it gets minus-ed later
@@ -261,6 +606,7 @@ void HeightMap::CellNoise(Size1D meanCellSize, RandomSeed seed)
 	double maximumDistance = sqrt(2 * (double)gridSize * (double)gridSize); 
 	
 	Rectangle operationRect = this->GetPhysicalRectangleUnscaled(this->rectangle);
+	Size1D width = this->GetWidth();
 	FOR_EACH_IN_RECT(x, y, operationRect)
 	{
 		Point logicalPoint = this->GetLogicalPoint(Point(x, y));
@@ -300,35 +646,38 @@ void HeightMap::CellNoise(Size1D meanCellSize, RandomSeed seed)
 			}
 		}
 
-		(*this)(x, y) = currentClosestDistance * HEIGHT_MAX / maximumDistance;
+		this->heightData[x + width * y] = currentClosestDistance * HEIGHT_MAX / maximumDistance;
 	}
 }
 
 void HeightMap::ClampHeights(Height min, Height max)
 {
+	this->MakeUnique();
+
 	Rectangle operationRect = this->GetPhysicalRectangleUnscaled(this->rectangle);
 
+	Size1D width = this->GetWidth();
 	FOR_EACH_IN_RECT(x, y, operationRect)
 	{
-		(*this)(x, y) = std::min(max, std::max(min, (*this)(x, y)));
+		Height& height = this->heightData[x + width * y];
+		height = std::min(max, std::max(min, height));
 	}
 }
 
 void HeightMap::Combine(HeightMap* other, HeightMap* mask)
 {
+	this->MakeUnique();
+
 	Rectangle intersection = Rectangle::Intersect(Rectangle::Intersect(this->rectangle, other->rectangle), mask->rectangle);
 
 	Rectangle operationRect = this->GetPhysicalRectangleUnscaled(intersection);
+	Rectangle otherRect = other->GetPhysicalRectangleUnscaled(intersection);
+	Rectangle maskRect = mask->GetPhysicalRectangleUnscaled(intersection);
 
-	Point otherOffset = this->rectangle.GetPosition() - other->GetRectangle().GetPosition();
-	Point maskOffset = this->rectangle.GetPosition() - mask->GetRectangle().GetPosition();
-	FOR_EACH_IN_RECT(x, y, operationRect)
+	#pragma omp parallel for schedule(static)
+	for (int y = 0; y < int(operationRect.GetSize().GetHeight()); y++)
 	{
-		Height thisHeight = (*this)(x, y);
-		Height otherHeight = (*other)(x + otherOffset.GetX(), y + otherOffset.GetY());
-		Height maskHeight = max((*mask)(x + maskOffset.GetX(), y + maskOffset.GetY()), Height(0));
-		double factor = maskHeight / (double)HEIGHT_MAX;
-		(*this)(x, y) = Height(thisHeight * factor) + Height(otherHeight * (1 - factor));
+		HeightSpanKernels::Lerp(GetRowPtr(this->heightData, this->GetWidth(), operationRect, y), GetRowPtr(other, otherRect, y), GetRowPtr(mask, maskRect, y), operationRect.GetSize().GetWidth());
 	}
 }
 
@@ -345,24 +694,30 @@ void HeightMap::ConvexityMap(Size1D radius)
 
 void HeightMap::Crop(Rectangle fillRectangle, Height height)
 {
+	this->MakeUnique();
+
 	Rectangle operationRect = this->GetPhysicalRectangleUnscaled(this->rectangle);
 
+	Size1D width = this->GetWidth();
 	FOR_EACH_IN_RECT(x, y, operationRect)
 	{
 		if (!rectangle.Contains(this->GetLogicalPoint(Point(x, y))))
 		{
-			(*this)(x, y) = height;
+			this->heightData[x + width * y] = height;
 		}
 	}
 }
 
 void HeightMap::CropHeights(Height min, Height max, Height replace)
 {
+	this->MakeUnique();
+
 	Rectangle operationRect = this->GetPhysicalRectangleUnscaled(this->rectangle);
 
+	Size1D width = this->GetWidth();
 	FOR_EACH_IN_RECT(x, y, operationRect)
 	{
-		Height& height = (*this)(x, y);
+		Height& height = this->heightData[x + width * y];
 		if (height > max || height < min)
 		{
 			height = replace;
@@ -372,112 +727,32 @@ void HeightMap::CropHeights(Height min, Height max, Height replace)
 
 void HeightMap::DistanceMap(Size1D maximumDistance)
 {
-	Size1D scaledMaximumDistance = this->GetScaledSize(maximumDistance);
+	this->MakeUnique();
 
-	// Implementation from http://cs.brown.edu/~pff/dt/
+	Size1D scaledMaximumDistance = this->GetScaledSize(maximumDistance);
 
-	// Higher than integer precision is required for intermediate results
-	double* heights = new double[this->GetRectangle().GetSize().GetTotalLength()];
-	for (unsigned i = 0; i < this->GetRectangle().GetSize().GetTotalLength(); i++)
+	// All intermediate values are whole squared distances no greater than the squared maximum distance, so a 32-bit integer is enough unless the distance is huge.
+	if (scaledMaximumDistance <= DISTANCE_MAP_MAX_INTEGER_DISTANCE)
 	{
-		heights[i] = this->heightData[i] <= 0 ? 0 : Square(scaledMaximumDistance);
+		DistanceTransform<unsigned>(this->heightData, this->GetWidth(), this->GetHeight(), scaledMaximumDistance);
 	}
-
-	// Horizontal
-	for (unsigned y = 0; y < this->GetHeight(); y++)
+	else
 	{
-		unsigned n = this->GetWidth();
-
-		double *d = new double[n];
-		int *v = new int[n];
-		double *z = new double[n + 1];
-		int k = 0;
-		v[0] = 0;
-		z[0] = INT_MIN;
-		z[1] = INT_MAX;
-		for (unsigned q = 1; q <= n - 1; q++) {
-			double s = double((heights[q + y * this->GetHeight()] + Square(q)) - double(heights[v[k] + y * this->GetHeight()] + Square(v[k]))) / double(2 * q - 2 * v[k]);
-			while (s <= z[k]) {
-				k--;
-				s = double((heights[q + y * this->GetHeight()] + Square(q)) - double(heights[v[k] + y * this->GetHeight()] + Square(v[k]))) / double(2 * q - 2 * v[k]);
-			}
-			k++;
-			v[k] = q;
-			z[k] = s;
-			z[k + 1] = INT_MAX;
-		}
-
-		k = 0;
-		for (unsigned q = 0; q <= n - 1; q++) {
-			while (z[k + 1] < q)
-				k++;
-
-			double value = double(Square(q - v[k]) + heights[v[k] + y * this->GetHeight()]);
-			d[q] = double(Square(q - v[k]) + heights[v[k] + y * this->GetHeight()]) /** double(HEIGHT_MAX) / double(distance)*/;
-		}
-
-		delete[] v;
-		delete[] z;
-
-		for (unsigned q = 0; q < n; q++)
-		{
-			heights[q + y * this->GetHeight()] = d[q];
-		}
-		delete[] d;
+		DistanceTransform<double>(this->heightData, this->GetWidth(), this->GetHeight(), scaledMaximumDistance);
 	}
+}
 
+unsigned HeightMap::GetDistanceMapExtraMemory(Size2D size, Size1D scaledMaximumDistance)
+{
+	unsigned valueSize = scaledMaximumDistance <= DISTANCE_MAP_MAX_INTEGER_DISTANCE ? sizeof(unsigned) : sizeof(double);
+	unsigned length = max(size.GetWidth(), size.GetHeight());
 
-	// Vertical
-	for (unsigned x = 0; x < this->GetWidth(); x++)
-	{
-		unsigned n = this->GetHeight();
-
-		double *d = new double[n];
-		int *v = new int[n];
-		double *z = new double[n + 1];
-		int k = 0;
-		v[0] = 0;
-		z[0] = INT_MIN;
-		z[1] = INT_MAX;
-		for (unsigned q = 1; q <= n - 1; q++) {
-			double s = double((heights[x + q * this->GetHeight()] + Square(q)) - double(heights[x + v[k] * this->GetHeight()] + Square(v[k]))) / double(2 * q - 2 * v[k]);
-			while (s <= z[k]) {
-				k--;
-				s = double((heights[x + q * this->GetHeight()] + Square(q)) - double(heights[x + v[k] * this->GetHeight()] + Square(v[k]))) / double(2 * q - 2 * v[k]);
-			}
-			k++;
-			v[k] = q;
-			z[k] = s;
-			z[k + 1] = INT_MAX;
-		}
-
-		k = 0;
-		for (unsigned q = 0; q <= n - 1; q++) {
-			while (z[k + 1] < q)
-				k++;
-
-			double value = double(Square(q - v[k]) + heights[x + v[k] * this->GetHeight()]);
-			d[q] = double(Square(q - v[k]) + heights[x + v[k] * this->GetHeight()]) /** double(HEIGHT_MAX) / double(distance)*/;
-		}
-
-		delete[] v;
-		delete[] z;
-
-		for (unsigned q = 0; q < n; q++)
-		{
-			heights[x + q * this->GetHeight()] = d[q];
-		}
-		delete[] d;
-	}
-	
-	for (unsigned i = 0; i < this->GetRectangle().GetSize().GetTotalLength(); i++)
-	{
-		this->heightData[i] = Height(sqrt(heights[i]) * double(HEIGHT_MAX) / double(scaledMaximumDistance));
-	}
-
-	delete[] heights;
+	// Full-size buffer of squared distances + per-thread envelope scratch and a block of columns
+	unsigned scratchSize = length * (sizeof(int) + sizeof(double) + valueSize) + sizeof(double) + length * DISTANCE_MAP_COLUMN_BLOCK_WIDTH * valueSize;
+	return size.GetTotalLength() * valueSize + GetMaxThreadCount() * scratchSize;
 }
 
+
 void HeightMap::Distort(HeightMap* horizontalDistortionMap, HeightMap* verticalDistortionMap, Size1D maxDistance)
 {
 	Size1D scaledMaximumDistance = this->GetScaledSize(maxDistance);
@@ -486,20 +761,48 @@ void HeightMap::Distort(HeightMap* horizontalDistortionMap, HeightMap* verticalD
 	Rectangle logicalRect = Rectangle::Intersect(contraction, Rectangle::Intersect(verticalDistortionMap->rectangle, horizontalDistortionMap->rectangle));
 	Rectangle physicalRect = this->GetPhysicalRectangleUnscaled(logicalRect);
 
+	if (physicalRect.GetSize().GetTotalLength() == 0)
+	{
+		return;
+	}
+
+	// The copy keeps the original data for sampling, while this map gets its own data to write into.
 	HeightMap copy(*this);
+	this->MakeUnique();
+	BilinearSampler sampler(copy.heightData, copy.rectangle.GetSize());
 
 	Point horizontalOffset = this->rectangle.GetPosition() - horizontalDistortionMap->GetRectangle().GetPosition();
 	Point verticalOffset = this->rectangle.GetPosition() - verticalDistortionMap->GetRectangle().GetPosition();
-	FOR_EACH_IN_RECT(x, y, physicalRect)
-	{		
-		Height horizontalDistortionMapHeight = (*horizontalDistortionMap)(x + horizontalOffset.GetX(), y + horizontalOffset.GetY());
-		double sourceOffsetX = horizontalDistortionMapHeight * (double)scaledMaximumDistance / (double)HEIGHT_MAX;
+	BandCancellation cancellation;
+	#pragma omp parallel
+	{
+		std::vector<double> sourceXs(physicalRect.GetSize().GetWidth());
+		std::vector<double> sourceYs(physicalRect.GetSize().GetWidth());
+
+		#pragma omp for schedule(static)
+		for (int y = physicalRect.GetPosition().GetY(); y < physicalRect.GetEndingPoint().GetY(); y++)
+		{
+			if (cancellation.IsCancelled(y))
+			{
+				continue;
+			}
+
+			Coordinate startX = physicalRect.GetPosition().GetX();
+			Height const* horizontalRow = GetRowPtr(horizontalDistortionMap, Rectangle(horizontalOffset + Point(startX, y), Size2D(physicalRect.GetSize().GetWidth(), 1)), 0);
+			Height const* verticalRow = GetRowPtr(verticalDistortionMap, Rectangle(verticalOffset + Point(startX, y), Size2D(physicalRect.GetSize().GetWidth(), 1)), 0);
 
-		Height verticalDistortionMapHeight = (*verticalDistortionMap)(x + verticalOffset.GetX(), y + verticalOffset.GetY());
-		double sourceOffsetY = verticalDistortionMapHeight * (double)scaledMaximumDistance / (double)HEIGHT_MAX;
+			unsigned i = 0;
+			for (Coordinate x = startX; x < physicalRect.GetEndingPoint().GetX(); x++, i++)
+			{
+				sourceXs[i] = x + horizontalRow[i] * (double)scaledMaximumDistance / (double)HEIGHT_MAX;
+				sourceYs[i] = y + verticalRow[i] * (double)scaledMaximumDistance / (double)HEIGHT_MAX;
+			}
 
-		(*this)(x, y) = copy(x + sourceOffsetX, y + sourceOffsetY);
+			sampler.SamplePoints(GetRowPtr(this->heightData, this->GetWidth(), physicalRect, y - physicalRect.GetPosition().GetY()), i, &sourceXs[0], &sourceYs[0]);
+		}
 	}
+
+	cancellation.ThrowIfCancelled();
 }
 
 
@@ -537,12 +840,36 @@ static inline DrawLine_OutCode DrawLine_ComputeOutCode(double x, double y, Recta
 	return (DrawLine_OutCode)code;
 }
 
-void HeightMap::DrawLine(Point start, Point end, Height height)
+static inline void DrawLine_SetPixel(Height* heights, Size1D width, double x, double y, Height height, Rectangle clipRectangle)
 {
-	Rectangle operationRect = this->GetPhysicalRectangleUnscaled(this->rectangle);
-	
-	Point actualStart = this->GetPhysicalPoint(start.GetX() <= end.GetX() ? start : end);
-	Point actualEnd = this->GetPhysicalPoint(start.GetX() <= end.GetX() ? end : start);
+	Point point = Point(Coordinate(x), Coordinate(y));
+	if (clipRectangle.Contains(point))
+	{
+		heights[point.GetX() + width * point.GetY()] = height;
+	}
+}
+
+// A line clipped to the entire map and prepared for the DDA line drawing algorithm (http://en.wikipedia.org/wiki/Digital_differential_analyzer_(graphics_algorithm)). The line advances by one pixel per step along its major axis, each step is evaluated from the start of the line, so any range of the steps can be drawn on its own.
+struct DrawLine_Line
+{
+	bool IsVisible;
+	bool IsXMajor;
+	double MajorStart;
+	double MajorStep;
+	double MinorStart;
+	double MinorStep;
+	long long StepCount;
+
+	inline double GetMajor(long long step) const { return this->MajorStart + this->MajorStep * step; }
+	inline double GetMinor(long long step) const { return this->MinorStart + this->MinorStep * step; }
+	inline double GetX(long long step) const { return this->IsXMajor ? this->GetMajor(step) : this->GetMinor(step); }
+	inline double GetY(long long step) const { return this->IsXMajor ? this->GetMinor(step) : this->GetMajor(step); }
+};
+
+static DrawLine_Line DrawLine_Prepare(Point start, Point end, Rectangle operationRect)
+{
+	Point actualStart = start.GetX() <= end.GetX() ? start : end;
+	Point actualEnd = start.GetX() <= end.GetX() ? end : start;
 	  
 	double endX = actualEnd.GetX();  
 	double endY = actualEnd.GetY();
@@ -616,52 +943,186 @@ void HeightMap::DrawLine(Point start, Point end, Height height)
 		}
 	}
 
+	DrawLine_Line line;
+	line.IsVisible = accept;
 	if (!accept)
+	{
+		return line;
+	}
+
+	double majorStart, majorEnd;
+	if (abs(endX - startX) >= abs(endY - startY))
+	{
+		line.IsXMajor = true;
+		line.MajorStart = majorStart = startX;
+		line.MajorStep = 1;
+		line.MinorStart = startY;
+		line.MinorStep = double(actualEnd.GetY() - actualStart.GetY()) / double(actualEnd.GetX() - actualStart.GetX());
+		majorEnd = endX;
+	}
+	else
+	{
+		line.IsXMajor = false;
+		line.MajorStart = majorStart = startY;
+		line.MajorStep = startY < endY ? 1 : -1;
+		line.MinorStart = startX;
+		line.MinorStep = line.MajorStep * double(actualEnd.GetX() - actualStart.GetX()) / double(actualEnd.GetY() - actualStart.GetY());
+		majorEnd = endY;
+	}
+
+	// The first pixel is drawn at the start, then the line advances until it reaches or passes the end.
+	double majorLength = abs(majorEnd - majorStart);
+	line.StepCount = (long long)ceil(majorLength) + 1;
+	while (line.StepCount > 1 && double(line.StepCount - 2) >= majorLength)
+	{
+		line.StepCount--;
+	}
+
+	if (line.StepCount == 1)
+	{
+		// A single point, the step along the minor axis may not even be a number.
+		line.MinorStep = 0;
+	}
+
+	return line;
+}
+
+// Finds the steps of a line which fall into an interval of pixels along its major axis. Returns false if there are none.
+static bool DrawLine_GetStepRange(DrawLine_Line const& line, Coordinate min, Coordinate max, long long& firstStep, long long& lastStep)
+{
+	// The pixel coordinate is monotonic in the step, so the estimates only have to be corrected for rounding errors.
+	bool isAscending = line.MajorStep > 0;
+	long long lastLineStep = line.StepCount - 1;
+	firstStep = std::max(0LL, std::min(lastLineStep, (long long)floor(isAscending ? min - line.MajorStart : line.MajorStart - max)));
+	lastStep = std::max(0LL, std::min(lastLineStep, (long long)ceil(isAscending ? max - line.MajorStart : line.MajorStart - min)));
+
+	#define DRAWLINE_IS_BEFORE(step) (isAscending ? Coordinate(line.GetMajor(step)) < min : Coordinate(line.GetMajor(step)) >= max)
+	#define DRAWLINE_IS_AFTER(step) (isAscending ? Coordinate(line.GetMajor(step)) >= max : Coordinate(line.GetMajor(step)) < min)
+
+	while (firstStep > 0 && !DRAWLINE_IS_BEFORE(firstStep - 1)) firstStep--;
+	while (firstStep <= lastLineStep && DRAWLINE_IS_BEFORE(firstStep)) firstStep++;
+	while (lastStep < lastLineStep && !DRAWLINE_IS_AFTER(lastStep + 1)) lastStep++;
+	while (lastStep >= 0 && DRAWLINE_IS_AFTER(lastStep)) lastStep--;
+
+	#undef DRAWLINE_IS_BEFORE
+	#undef DRAWLINE_IS_AFTER
+
+	return firstStep <= lastStep;
+}
+
+void HeightMap::DrawLine(Point start, Point end, Height height)
+{
+	this->MakeUnique();
+
+	this->DrawLine(start, end, height, this->GetPhysicalRectangleUnscaled(this->rectangle));
+}
+
+void HeightMap::DrawLine(Point start, Point end, Height height, Rectangle clipRectangle)
+{
+	// The line is always clipped to the entire map, so the drawn pixels don't depend on the clip rectangle, which only limits which of them are written.
+	DrawLine_Line line = DrawLine_Prepare(this->GetPhysicalPoint(start), this->GetPhysicalPoint(end), this->GetPhysicalRectangleUnscaled(this->rectangle));
+	if (!line.IsVisible)
 	{
 		return;
 	}
 
-	double currentX = startX;
-	double currentY = startY;
+	// Only the steps entering the clip rectangle along the major axis are evaluated, the minor axis is checked per pixel.
+	long long firstStep, lastStep;
+	if (line.IsXMajor ?
+		!DrawLine_GetStepRange(line, clipRectangle.GetPosition().GetX(), clipRectangle.GetEndingPoint().GetX(), firstStep, lastStep) :
+		!DrawLine_GetStepRange(line, clipRectangle.GetPosition().GetY(), clipRectangle.GetEndingPoint().GetY(), firstStep, lastStep))
+	{
+		return;
+	}
 
-	// DDA line drawing algorithm (http://en.wikipedia.org/wiki/Digital_differential_analyzer_(graphics_algorithm))
-	if (abs(endX - currentX) >= abs(endY - currentY))
+	for (long long step = firstStep; step <= lastStep; step++)
 	{
-		double deltaY = double(actualEnd.GetY() - actualStart.GetY()) / double(actualEnd.GetX() - actualStart.GetX());
+		DrawLine_SetPixel(this->heightData, this->GetWidth(), line.GetX(step), line.GetY(step), height, clipRectangle);
+	}
+}
 
-		//(*this)(actualStart.GetX(), actualEnd.GetY()) = height;
-		(*this)(Coordinate(currentX), Coordinate(currentY)) = height;
+void HeightMap::DrawPrimitives(std::vector<HeightMapPrimitive> const& primitives)
+{
+	this->MakeUnique();
+
+	Rectangle operationRect = this->GetPhysicalRectangleUnscaled(this->rectangle);
+	unsigned tileColumns = (operationRect.GetSize().GetWidth() + DRAW_PRIMITIVES_TILE_SIZE - 1) / DRAW_PRIMITIVES_TILE_SIZE;
+	unsigned tileRows = (operationRect.GetSize().GetHeight() + DRAW_PRIMITIVES_TILE_SIZE - 1) / DRAW_PRIMITIVES_TILE_SIZE;
 
-		while (currentX < endX)
+	// Indexes of primitives overlapping each tile, in drawing order.
+	std::vector<std::vector<unsigned> > tilePrimitives(tileColumns * tileRows);
+	for (unsigned i = 0; i < primitives.size(); i++)
+	{
+		HeightMapPrimitive const& primitive = primitives[i];
+		if (primitive.Type == HEIGHT_MAP_PRIMITIVE_LINE)
 		{
-			currentX += 1;
-			currentY += deltaY;
-			(*this)(Coordinate(currentX), Coordinate(currentY)) = height;
+			DrawLine_Line line = DrawLine_Prepare(this->GetPhysicalPoint(primitive.FirstPoint), this->GetPhysicalPoint(primitive.SecondPoint), operationRect);
+			if (!line.IsVisible)
+			{
+				continue;
+			}
+
+			// The line is only binned into the tiles it crosses. Each band of tiles along the major axis is entered by a contiguous range of steps, whose first and last pixel bound the tiles crossed along the minor axis.
+			Coordinate majorLength = line.IsXMajor ? operationRect.GetSize().GetWidth() : operationRect.GetSize().GetHeight();
+			Coordinate minorLength = line.IsXMajor ? operationRect.GetSize().GetHeight() : operationRect.GetSize().GetWidth();
+			Coordinate firstMajor = std::max(0, std::min(majorLength - 1, Coordinate(line.GetMajor(0))));
+			Coordinate lastMajor = std::max(0, std::min(majorLength - 1, Coordinate(line.GetMajor(line.StepCount - 1))));
+			for (Coordinate band = std::min(firstMajor, lastMajor) / DRAW_PRIMITIVES_TILE_SIZE; band <= std::max(firstMajor, lastMajor) / Coordinate(DRAW_PRIMITIVES_TILE_SIZE); band++)
+			{
+				long long firstStep, lastStep;
+				if (!DrawLine_GetStepRange(line, band * DRAW_PRIMITIVES_TILE_SIZE, (band + 1) * DRAW_PRIMITIVES_TILE_SIZE, firstStep, lastStep))
+				{
+					continue;
+				}
+
+				Coordinate firstMinor = std::max(0, std::min(minorLength - 1, Coordinate(line.GetMinor(firstStep))));
+				Coordinate lastMinor = std::max(0, std::min(minorLength - 1, Coordinate(line.GetMinor(lastStep))));
+				for (Coordinate tile = std::min(firstMinor, lastMinor) / DRAW_PRIMITIVES_TILE_SIZE; tile <= std::max(firstMinor, lastMinor) / Coordinate(DRAW_PRIMITIVES_TILE_SIZE); tile++)
+				{
+					tilePrimitives[line.IsXMajor ? band + tile * tileColumns : tile + band * tileColumns].push_back(i);
+				}
+			}
+
+			continue;
 		}
-	}
-	else
-	{
-		double deltaX = double(actualEnd.GetX() - actualStart.GetX()) / double(actualEnd.GetY() - actualStart.GetY());
 
-		//(*this)(actualStart.GetX(), actualEnd.GetY()) = height;
-		(*this)(Coordinate(currentX), Coordinate(currentY)) = height;
+		Rectangle boundsRect = Rectangle::Intersect(operationRect, this->GetPhysicalRectangle(Rectangle(primitive.FirstPoint, primitive.SecondPoint)));
+		if (boundsRect.GetSize().GetTotalLength() == 0)
+		{
+			continue;
+		}
 
-		if (currentY < endY)
+		for (Coordinate tileY = boundsRect.GetPosition().GetY() / DRAW_PRIMITIVES_TILE_SIZE; tileY <= (boundsRect.GetEndingPoint().GetY() - 1) / Coordinate(DRAW_PRIMITIVES_TILE_SIZE); tileY++)
 		{
-			while (currentY < endY)
+			for (Coordinate tileX = boundsRect.GetPosition().GetX() / DRAW_PRIMITIVES_TILE_SIZE; tileX <= (boundsRect.GetEndingPoint().GetX() - 1) / Coordinate(DRAW_PRIMITIVES_TILE_SIZE); tileX++)
 			{
-				currentX += deltaX;
-				currentY += 1;
-				(*this)(Coordinate(currentX), Coordinate(currentY)) = height;
+				tilePrimitives[tileX + tileY * tileColumns].push_back(i);
 			}
 		}
-		else
+	}
+
+	// Each pixel belongs to a single tile, so the tiles can be drawn independently as long as the order of primitives within the tile is kept.
+	#pragma omp parallel for schedule(dynamic)
+	for (int tile = 0; tile < int(tilePrimitives.size()); tile++)
+	{
+		Rectangle tileRect = Rectangle::Intersect(operationRect, Rectangle(
+			Point((tile % tileColumns) * DRAW_PRIMITIVES_TILE_SIZE, (tile / tileColumns) * DRAW_PRIMITIVES_TILE_SIZE),
+			Size2D(DRAW_PRIMITIVES_TILE_SIZE, DRAW_PRIMITIVES_TILE_SIZE)));
+
+		for (std::vector<unsigned>::const_iterator it = tilePrimitives[tile].begin(); it != tilePrimitives[tile].end(); it++)
 		{
-			while (currentY > endY)
+			HeightMapPrimitive const& primitive = primitives[*it];
+			if (primitive.Type == HEIGHT_MAP_PRIMITIVE_LINE)
 			{
-				currentX -= deltaX;
-				currentY -= 1;
-				(*this)(Coordinate(currentX), Coordinate(currentY)) = height;
+				this->DrawLine(primitive.FirstPoint, primitive.SecondPoint, primitive.DrawHeight, tileRect);
+			}
+			else
+			{
+				Rectangle fillRect = Rectangle::Intersect(tileRect, this->GetPhysicalRectangle(Rectangle(primitive.FirstPoint, primitive.SecondPoint)));
+				FOR_EACH_IN_RECT(x, y, fillRect)
+				{
+					this->heightData[x + this->GetWidth() * y] = primitive.DrawHeight;
+				}
 			}
 		}
 	}
@@ -669,77 +1130,78 @@ void HeightMap::DrawLine(Point start, Point end, Height height)
 
 void HeightMap::FillRectangle(Rectangle fillRectangle, Height height)
 {
+	this->MakeUnique();
+
 	Rectangle operationRect = Rectangle::Intersect(this->GetPhysicalRectangleUnscaled(this->rectangle), this->GetPhysicalRectangle(fillRectangle));
+	Size1D width = this->GetWidth();
 	FOR_EACH_IN_RECT(x, y, operationRect)
 	{
-		(*this)(x, y) = height;
+		this->heightData[x + width * y] = height;
 	}
 }
 
 void HeightMap::Gradient(Point source, Point destination, Height fromHeight, Height toHeight)
 {
+	this->MakeUnique();
+
 	// Points are not used because greater value type is required for calculations below.
 	long long gradientOffsetX = destination.GetX() - (long long)source.GetX();
 	long long gradientOffsetY = destination.GetY() - (long long)source.GetY();
-
-	Point gradientOffset((Coordinate)gradientOffsetX, (Coordinate)gradientOffsetY);
-
-	// Width of the gradient strip.
-	double maxDistance = source.GetDistanceTo(destination);//  sqrt((double)(abs(gradientOffsetX) * abs(gradientOffsetX) + abs(gradientOffsetY) * abs(gradientOffsetY)));
+	long long squaredLength = gradientOffsetX * gradientOffsetX + gradientOffsetY * gradientOffsetY;
 
 	Rectangle operationRect = this->GetPhysicalRectangleUnscaled(this->rectangle);
+	Size1D width = this->GetWidth();
 
-	FOR_EACH_IN_RECT(x, y, operationRect)
+	if (squaredLength == 0)
 	{
-		double logicalX = this->GetLogicalX(x);
-		double logicalY = this->GetLogicalY(y);
-
-		double currentOffsetX = logicalX - (double)source.GetX();
-		double currentOffsetY = logicalY - (double)source.GetY();
+		std::fill(this->heightData, this->heightData + operationRect.GetSize().GetTotalLength(), fromHeight);
+		return;
+	}
 
-		// Get the point on the gradient vector (vector going through both source and destination point) to which is the current point closest.
-		double crossX = (gradientOffsetX * (gradientOffsetX * currentOffsetX + gradientOffsetY * currentOffsetY)) / double(gradientOffsetX * gradientOffsetX + gradientOffsetY * gradientOffsetY);
-		double crossY = (gradientOffsetY * (gradientOffsetX * currentOffsetX + gradientOffsetY * currentOffsetY)) / double(gradientOffsetX * gradientOffsetX + gradientOffsetY * gradientOffsetY);
+	// Width of the gradient strip.
+	double maxDistance = source.GetDistanceTo(destination);
 
-		// Calculate the distance from the "from" point to the intersection with gradient vector.
-		double distance = sqrt(crossX * crossX + crossY * crossY);
+	/* Position of a point along the gradient vector (0 in the source, 1 in the destination) is an affine function of its coordinates,
+	so each row can be evaluated incrementally. The height factor replicates the original lerp over the truncated strip width. */
+	double inverseSquaredLength = 1 / double(squaredLength);
+	double heightFactor = ((long long)toHeight - (long long)fromHeight) * maxDistance / (Coordinate)maxDistance;
+	double stepT = gradientOffsetX * inverseSquaredLength / this->scale;
+	double originOffsetX = this->GetLogicalX(0) - (double)source.GetX();
 
-		// Distance from  the intersection point to the destination point.
-		double reverseDistance = sqrt((crossX - gradientOffsetX) * (crossX - gradientOffsetX) + (crossY - gradientOffsetY) * (crossY - gradientOffsetY));
-			
-		// Apply it to the array data.
-		if (distance <= maxDistance && reverseDistance <= maxDistance) {
-			// TODO: lerp uses only coordinate, not long long
-			(*this)(x, y) = Lerp(0, (Coordinate)maxDistance, fromHeight, toHeight, distance);
-		}
-		else if (reverseDistance < distance) {
-			(*this)(x, y) = toHeight;
-		}
-		else {
-			(*this)(x, y) = fromHeight;
-		}
+	#pragma omp parallel for schedule(static)
+	for (int y = 0; y < int(operationRect.GetSize().GetHeight()); y++)
+	{
+		double startT = (gradientOffsetX * originOffsetX + gradientOffsetY * (this->GetLogicalY(y) - (double)source.GetY())) * inverseSquaredLength;
+		FillLinearGradientRow(this->heightData + y * width, width, startT, stepT, fromHeight, toHeight, heightFactor);
 	}
 }
 
 void HeightMap::Intersect(HeightMap* other)
 {
+	this->MakeUnique();
+
 	Rectangle intersection = Rectangle::Intersect(this->rectangle, other->rectangle);
 	Rectangle operationRect = this->GetPhysicalRectangleUnscaled(intersection);
+	Rectangle otherRect = other->GetPhysicalRectangleUnscaled(intersection);
 
-	Point offset = this->rectangle.GetPosition() - other->GetRectangle().GetPosition();
-	FOR_EACH_IN_RECT(x, y, operationRect)
+	#pragma omp parallel for schedule(static)
+	for (int y = 0; y < int(operationRect.GetSize().GetHeight()); y++)
 	{
-		(*this)(x, y) = min((*other)(x + offset.GetX(), y + offset.GetY()), (*this)(x, y));
+		HeightSpanKernels::Min(GetRowPtr(this->heightData, this->GetWidth(), operationRect, y), GetRowPtr(other, otherRect, y), operationRect.GetSize().GetWidth());
 	}
 }
 
 void HeightMap::Invert()
 {
+	this->MakeUnique();
+
 	Rectangle operationRect = this->GetPhysicalRectangleUnscaled(this->rectangle);
 
+	Size1D width = this->GetWidth();
 	FOR_EACH_IN_RECT(x, y, operationRect)
 	{
-		(*this)(x, y) = -(*this)(x, y);
+		Height& height = this->heightData[x + width * y];
+		height = -height;
 	}
 }
 
@@ -751,29 +1213,37 @@ void HeightMap::Move(Point offset)
 
 void HeightMap::Multiply(double factor)
 {
+	this->MakeUnique();
+
 	Rectangle operationRect = this->GetPhysicalRectangleUnscaled(this->rectangle);
 
+	Size1D width = this->GetWidth();
 	FOR_EACH_IN_RECT(x, y, operationRect)
 	{
-		(*this)(x, y) = (Height)min((double)HEIGHT_MAX, max((double)HEIGHT_MIN, (*this)(x, y) * factor));
+		Height& height = this->heightData[x + width * y];
+		height = (Height)min((double)HEIGHT_MAX, max((double)HEIGHT_MIN, height * factor));
 	}
 }
 
 void HeightMap::MultiplyMap(HeightMap* factor)
 {
+	this->MakeUnique();
+
 	Rectangle intersection = Rectangle::Intersect(this->rectangle, factor->rectangle);
 	Rectangle operationRect = this->GetPhysicalRectangleUnscaled(intersection);
+	Rectangle factorRect = factor->GetPhysicalRectangleUnscaled(intersection);
 
-	Point offset = this->rectangle.GetPosition() - intersection.GetPosition();
-	FOR_EACH_IN_RECT(x, y, operationRect)
+	#pragma omp parallel for schedule(static)
+	for (int y = 0; y < int(operationRect.GetSize().GetHeight()); y++)
 	{
-		double currentFactor = ((*factor)(x + offset.GetX(), y + offset.GetY()) / (double)HEIGHT_MAX);
-		(*this)(x, y) = Height((*this)(x, y) * currentFactor);
+		HeightSpanKernels::Multiply(GetRowPtr(this->heightData, this->GetWidth(), operationRect, y), GetRowPtr(factor, factorRect, y), operationRect.GetSize().GetWidth());
 	}
 }
 
 void HeightMap::Pattern(HeightMap* pattern, Rectangle repeatRectangle)
 {
+	this->MakeUnique();
+
 	if (repeatRectangle.GetSize().GetTotalLength() == 0)
 	{
 		return;
@@ -781,18 +1251,22 @@ void HeightMap::Pattern(HeightMap* pattern, Rectangle repeatRectangle)
 
 	Rectangle physicalRepeatRect = Rectangle::Intersect(pattern->GetPhysicalRectangle(repeatRectangle), pattern->GetPhysicalRectangleUnscaled(pattern->GetRectangle()));
 	Rectangle operationRect = this->GetPhysicalRectangleUnscaled(this->rectangle);
+	HeightMap const& source = *pattern;
+	Size1D width = this->GetWidth();
 
 	FOR_EACH_IN_RECT(x, y, operationRect)
 	{
 		Point patternPoint = Point((x + this->GetOriginX()) % physicalRepeatRect.GetSize().GetWidth(), (y + this->GetOriginY()) % physicalRepeatRect.GetSize().GetHeight());
 		if (patternPoint.GetX() < 0) patternPoint += Point(physicalRepeatRect.GetSize().GetWidth(), 0);
 		if (patternPoint.GetY() < 0) patternPoint += Point(0, physicalRepeatRect.GetSize().GetHeight());
-		(*this)(x, y) = (*pattern)(patternPoint + physicalRepeatRect.GetPosition());
+		this->heightData[x + width * y] = source(patternPoint + physicalRepeatRect.GetPosition());
 	}
 }
 
 void HeightMap::Projection(HeightProfile* profile, Direction direction)
 {
+	this->MakeUnique();
+
 	Rectangle profileRect;
 	if (direction == DIRECTION_HORIZONTAL)
 	{
@@ -805,6 +1279,7 @@ void HeightMap::Projection(HeightProfile* profile, Direction direction)
 	else throw InternalErrorException(GG_STR("Invalid direction."));
 
 	Rectangle operationRect = this->GetPhysicalRectangleUnscaled(Rectangle::Intersect(this->rectangle, profileRect));
+	Size1D width = this->GetWidth();
 
 
 	if (direction == DIRECTION_HORIZONTAL)
@@ -815,7 +1290,7 @@ void HeightMap::Projection(HeightProfile* profile, Direction direction)
 
 		FOR_EACH_IN_RECT(x, y, operationRect)
 		{
-			(*this)(x, y) = (*profile)(y);
+			this->heightData[x + width * y] = (*profile)(y);
 		}
 	}
 	else if (direction == DIRECTION_VERTICAL)
@@ -826,7 +1301,7 @@ void HeightMap::Projection(HeightProfile* profile, Direction direction)
 
 		FOR_EACH_IN_RECT(x, y, operationRect)
 		{
-			(*this)(x, y) = (*profile)(x);
+			this->heightData[x + width * y] = (*profile)(x);
 		}
 	}
 	else throw InternalErrorException(GG_STR("Invalid direction."));
@@ -834,67 +1309,144 @@ void HeightMap::Projection(HeightProfile* profile, Direction direction)
 
 void HeightMap::RadialGradient(Point point, Size1D radius, Height fromHeight, Height toHeight)
 {
+	this->MakeUnique();
+
 	Point physicalCenter = this->GetPhysicalPoint(point);
-	double scaledRadius = this->GetScaledSize(radius);
+	Size1D scaledRadius = this->GetScaledSize(radius);
+
+	long long squaredRadius = (long long)scaledRadius * (long long)scaledRadius;
+	double heightFactor = scaledRadius > 0 ? ((long long)toHeight - (long long)fromHeight) / double(scaledRadius) : 0;
 
 	Rectangle physicalRect = this->GetPhysicalRectangleUnscaled(this->rectangle);
-	FOR_EACH_IN_RECT(x, y, physicalRect)
+	Size1D width = this->GetWidth();
+
+	#pragma omp parallel for schedule(static)
+	for (int y = 0; y < int(physicalRect.GetSize().GetHeight()); y++)
 	{
-		double distance = physicalCenter.GetDistanceTo(Point(x, y));
+		Height* row = this->heightData + y * width;
 
-		if (distance > scaledRadius)
+		long long offsetY = y - (long long)physicalCenter.GetY();
+		long long remaining = squaredRadius - offsetY * offsetY;
+		if (remaining < 0)
 		{
-			(*this)(x, y) = toHeight;
+			std::fill(row, row + width, toHeight);
+			continue;
 		}
-		else
+
+		// Points of the row within the radius form a single span, everything outside of it is saturated.
+		long long halfWidth = (long long)sqrt(double(remaining));
+		while (halfWidth * halfWidth > remaining) halfWidth--;
+		while ((halfWidth + 1) * (halfWidth + 1) <= remaining) halfWidth++;
+
+		long long spanStart = std::min((long long)width, std::max(0LL, physicalCenter.GetX() - halfWidth));
+		long long spanEnd = std::min((long long)width, std::max(spanStart, physicalCenter.GetX() + halfWidth + 1));
+
+		std::fill(row, row + spanStart, toHeight);
+
+		double squaredOffsetY = double(offsetY * offsetY);
+		double offsetX = double(spanStart - physicalCenter.GetX());
+		for (long long x = spanStart; x < spanEnd; x++, offsetX++)
 		{
-			(*this)(x, y) = fromHeight + (Height)(((long long)toHeight - (long long)fromHeight) * distance / scaledRadius);
+			row[x] = fromHeight + Height(heightFactor * sqrt(offsetX * offsetX + squaredOffsetY));
 		}
+
+		std::fill(row + spanEnd, row + width, toHeight);
 	}
 }
 
-void HeightMap::Rescale(Scale horizontalScale, Scale verticalScale)
+void HeightMap::Rescale(Scale horizontalScale, Scale verticalScale, RescaleFilter filter)
 {
 	Rectangle newRectangle(Point(Coordinate(this->rectangle.GetPosition().GetX() * horizontalScale), Coordinate(this->rectangle.GetPosition().GetY() * verticalScale)), Size2D(Size1D(this->rectangle.GetSize().GetWidth() * horizontalScale), Size1D(this->rectangle.GetSize().GetHeight() * verticalScale)));
 
 	// Allocate the new array.
-	Height* newData = new Height[newRectangle.GetSize().GetTotalLength()];
+	Height* newData = MemoryTracker::AllocateHeights(newRectangle.GetSize().GetTotalLength());
 
-	Rectangle operationRect = newRectangle - newRectangle.GetPosition();
-	
-	double actualHorizontalScale = (newRectangle.GetSize().GetWidth() - 1) / (double)(this->rectangle.GetSize().GetWidth() - 1);
-	double actualVerticalScale = (newRectangle.GetSize().GetHeight() - 1) / (double)(this->rectangle.GetSize().GetHeight() - 1);
-	FOR_EACH_IN_RECT(x, y, operationRect)
+	Size1D oldWidth = this->rectangle.GetSize().GetWidth();
+	Size1D oldHeight = this->rectangle.GetSize().GetHeight();
+	Size1D newWidth = newRectangle.GetSize().GetWidth();
+	Size1D newHeight = newRectangle.GetSize().GetHeight();
+
+	if (newWidth > 0 && newHeight > 0)
 	{
-		newData[x + newRectangle.GetSize().GetWidth() * y] = (*this)(double(x / actualHorizontalScale), double(y / actualVerticalScale));
+		ResamplingKernel horizontalKernel(oldWidth, newWidth, filter);
+		ResamplingKernel verticalKernel(oldHeight, newHeight, filter);
+
+		// The horizontal pass resamples each source row which is needed by the vertical pass.
+		vector<Height> intermediate(oldHeight * newWidth);
+		MemoryTracker::ScopedAllocation intermediateAllocation(intermediate.size() * sizeof(Height));
+		BandCancellation cancellation;
+
+		#pragma omp parallel for schedule(static)
+		for (int y = 0; y < int(oldHeight); y++)
+		{
+			if (!cancellation.IsCancelled(y) && verticalKernel.IsSourceUsed(y))
+			{
+				horizontalKernel.ResampleLine(&intermediate[0] + newWidth * y, this->heightData + oldWidth * y);
+			}
+		}
+
+		// The vertical pass processes bands of target rows one block of columns at a time, so the few intermediate rows shared by the band stay in cache.
+		int bandCount = int((newHeight + RESCALE_ROW_BAND_HEIGHT - 1) / RESCALE_ROW_BAND_HEIGHT);
+
+		#pragma omp parallel for schedule(static)
+		for (int band = 0; band < bandCount; band++)
+		{
+			if (cancellation.IsCancelled(band * RESCALE_ROW_BAND_HEIGHT))
+			{
+				continue;
+			}
+
+			Size1D bandEnd = min(Size1D((band + 1) * RESCALE_ROW_BAND_HEIGHT), newHeight);
+			for (Size1D blockStart = 0; blockStart < newWidth; blockStart += RESCALE_COLUMN_BLOCK_WIDTH)
+			{
+				unsigned blockWidth = min(Size1D(RESCALE_COLUMN_BLOCK_WIDTH), newWidth - blockStart);
+				for (Size1D y = band * RESCALE_ROW_BAND_HEIGHT; y < bandEnd; y++)
+				{
+					verticalKernel.ResampleAcrossLines(newData + newWidth * y + blockStart, blockWidth, &intermediate[0] + blockStart, newWidth, y);
+				}
+			}
+		}
+
+		if (cancellation.WasCancelled())
+		{
+			MemoryTracker::ReleaseHeights(newData);
+			cancellation.ThrowIfCancelled();
+		}
 	}
 
 	// Relink and delete the original array data
-	delete[] this->heightData;
+	MemoryTracker::ReleaseHeights(this->heightData);
 	this->heightData = newData;
 	this->rectangle = newRectangle;
 }
 
+unsigned HeightMap::GetRescaleExtraMemory(Size2D originalSize, Size2D newSize)
+{
+	// Horizontally rescaled rows of the original map
+	return originalSize.GetHeight() * newSize.GetWidth() * sizeof(Height);
+}
+
 void HeightMap::Resize(Rectangle rectangle, Height height)
 {
-	HeightMap old(*this);
+	HeightMap const old(*this);
 
-	delete[] this->heightData;
+	MemoryTracker::ReleaseHeights(this->heightData);
 
-	this->heightData = new Height[rectangle.GetSize().GetTotalLength()];
+	this->heightData = MemoryTracker::AllocateHeights(rectangle.GetSize().GetTotalLength());
 	this->rectangle = rectangle;
 
 	Rectangle operationRectangle = this->GetPhysicalRectangleUnscaled(this->rectangle);
 	Point offset = this->rectangle.GetPosition() - old.GetRectangle().GetPosition();
+	Size1D width = this->GetWidth();
 	FOR_EACH_IN_RECT(x, y, operationRectangle)
 	{
 		if (old.GetRectangle().Contains(this->GetLogicalPoint(Point(x, y))))
 		{
-			(*this)(x, y) = old(Point(x, y) + offset);
+			this->heightData[x + width * y] = old(Point(x, y) + offset);
 		}
 		else
 		{
-			(*this)(x, y) = height;
+			this->heightData[x + width * y] = height;
 		}
 	}
 }
@@ -927,151 +1479,319 @@ void HeightMap::Shift(HeightProfile* profile, Size1D maximumDistance, Direction
 	}
 
 	// Allocate the new array.
-	Height* newData = new Height[this->rectangle.GetSize().GetTotalLength()];
+	Height* newData = MemoryTracker::AllocateHeights(this->rectangle.GetSize().GetTotalLength());
 	memset(newData, 0, sizeof(Height)* this->rectangle.GetSize().GetTotalLength());
 
 	double factor = maximumDistance / double(HEIGHT_MAX);
 
-	if (direction == DIRECTION_HORIZONTAL)
+	Size1D width = physicalRect.GetSize().GetWidth();
+	if (physicalRect.GetSize().GetTotalLength() > 0)
 	{
-		FOR_EACH_IN_RECT(x, y, physicalRect)
-		{			
-			newData[x + this->GetWidth() * y] = (*this)(x - (*profile)(y + profileOffset) * factor, double(y));
+		// Shift of each row (horizontal direction) or column (vertical direction) is constant.
+		std::vector<double> columnOffsets(width, 0);
+		if (direction == DIRECTION_VERTICAL)
+		{
+			for (Size1D i = 0; i < width; i++)
+			{
+				columnOffsets[i] = (*profile)(physicalRect.GetPosition().GetX() + Coordinate(i) + profileOffset) * factor;
+			}
 		}
-	}
-	else if (direction == DIRECTION_VERTICAL)
-	{
-		FOR_EACH_IN_RECT(x, y, physicalRect)
+
+		BilinearSampler sampler(this->heightData, this->rectangle.GetSize());
+		BandCancellation cancellation;
+
+		#pragma omp parallel
 		{
-			newData[x + this->GetWidth() * y] = (*this)(double(x), y - (*profile)(x + profileOffset)* factor);
+			std::vector<double> sourceXs(width);
+			std::vector<double> sourceYs(width);
+
+			#pragma omp for schedule(static)
+			for (int y = physicalRect.GetPosition().GetY(); y < physicalRect.GetEndingPoint().GetY(); y++)
+			{
+				if (cancellation.IsCancelled(y))
+				{
+					continue;
+				}
+
+				double rowOffset = direction == DIRECTION_HORIZONTAL ? (*profile)(y + profileOffset) * factor : 0;
+
+				for (Size1D i = 0; i < width; i++)
+				{
+					sourceXs[i] = (physicalRect.GetPosition().GetX() + Coordinate(i)) - rowOffset;
+					sourceYs[i] = y - columnOffsets[i];
+				}
+
+				sampler.SamplePoints(newData + physicalRect.GetPosition().GetX() + this->GetWidth() * y, width, &sourceXs[0], &sourceYs[0]);
+			}
+		}
+
+		if (cancellation.WasCancelled())
+		{
+			MemoryTracker::ReleaseHeights(newData);
+			cancellation.ThrowIfCancelled();
 		}
 	}
 
-	delete[] this->heightData;
+	MemoryTracker::ReleaseHeights(this->heightData);
 	this->heightData = newData;
 }
 
-void HeightMap::Noise(NoiseLayers const& layers, RandomSeed seed)
+void HeightMap::Noise(NoiseLayers const& layers, RandomSeed seed, RandomSeedScheme seedScheme)
 {
 	this->FillRectangle(RECTANGLE_MAX, 0);
+	this->AddNoiseLayers(layers, seed, 0, false, seedScheme);
+}
 
-	unsigned i = 0;
-	for (NoiseLayers::const_iterator it = layers.begin(); it != layers.end(); it++)
-	{		
-		this->NoiseLayer(it->first, it->second, seed, i, false);
-		i++;
-	}
+void HeightMap::NoiseLayer(Size1D waveLength, Height amplitude, RandomSeed seed, unsigned seedStep, bool isRidged, RandomSeedScheme seedScheme)
+{
+	NoiseLayers layers;
+	layers[waveLength] = amplitude;
+
+	this->AddNoiseLayers(layers, seed, seedStep, isRidged, seedScheme);
 }
 
-void HeightMap::NoiseLayer(Size1D waveLength, Height amplitude, RandomSeed seed, unsigned seedStep, bool isRidged)
+void HeightMap::AddNoiseLayers(NoiseLayers const& layers, RandomSeed seed, unsigned firstSeedStep, bool isRidged, RandomSeedScheme seedScheme)
 {
-	RandomSequence2D randomSequence(seed);
-	for (unsigned i = 0; i < seedStep; i++)
+	this->MakeUnique();
+
+	Rectangle operationRect = this->GetPhysicalRectangleUnscaled(this->rectangle);
+	Size1D width = operationRect.GetSize().GetWidth();
+	Size1D height = operationRect.GetSize().GetHeight();
+
+	if (width == 0 || height == 0)
 	{
-		randomSequence.Advance();
+		return;
 	}
 
-	Rectangle operationRect = this->GetPhysicalRectangleUnscaled(this->rectangle);
+	vector<Coordinate> logicalXs(width);
+	vector<double> exactLogicalXs(width);
+	for (Coordinate x = 0; x < Coordinate(width); x++)
+	{
+		logicalXs[x] = this->GetLogicalPoint(Point(x, 0)).GetX();
+		exactLogicalXs[x] = this->GetLogicalX(x);
+	}
+
+	/* Everything which depends only on the X coordinate is prepared for all layers in advance. The random heights 
+	of interpolated layers are only needed in grid points (multiples of the wave length), so only the grid columns 
+	covering the map are hashed. */
+	vector<PreparedNoiseLayer> preparedLayers(layers.size());
+	unsigned layerIndex = 0;
+	for (NoiseLayers::const_iterator it = layers.begin(); it != layers.end(); it++, layerIndex++)
+	{
+		PreparedNoiseLayer& layer = preparedLayers[layerIndex];
+		layer.waveLength = it->first;
+		layer.amplitude = it->second;
+		layer.isInterpolated = this->GetScaledSize(layer.waveLength) > 1;
+
+		RandomSequence2D randomSequence(seed, firstSeedStep + layerIndex, seedScheme);
+
+		if (!layer.isInterpolated)
+		{
+			// For wave length 1 no interpolation is necessary.
+			layer.columnHashes.resize(width);
+			randomSequence.GetColumnHashes(&logicalXs[0], width, &layer.columnHashes[0]);
+			continue;
+		}
+
+		Coordinate waveLength = layer.waveLength;
+		layer.gridColumns.resize(width);
+		layer.remainderXs.resize(width);
+
+		Coordinate firstCellX = PreviousMultipleOfInclusive((Coordinate)floor(exactLogicalXs[0]), waveLength);
+		Coordinate lastCellX = PreviousMultipleOfInclusive((Coordinate)floor(exactLogicalXs[width - 1]), waveLength);
+		Coordinate gridStartX = PreviousMultipleOfExclusive(firstCellX, waveLength);
+		layer.gridWidth = Size1D((lastCellX - gridStartX) / waveLength) + 3;
+
+		for (Coordinate x = 0; x < Coordinate(width); x++)
+		{
+			Coordinate coordinateX1 = PreviousMultipleOfInclusive((Coordinate)floor(exactLogicalXs[x]), waveLength);
 
-	Size1D physicalWaveLength = this->GetScaledSize(waveLength);
+			// Index of grid column X0.
+			layer.gridColumns[x] = Size1D((coordinateX1 - gridStartX) / waveLength) - 1;
+			layer.remainderXs[x] = (exactLogicalXs[x] - coordinateX1) / (double)waveLength;
+		}
+
+		layer.columnHashes.resize(layer.gridWidth);
+		randomSequence.GetColumnHashes(gridStartX, waveLength, layer.gridWidth, &layer.columnHashes[0]);
+	}
 
-	if (physicalWaveLength <= 1)
+	/* Each row is accumulated from all the layers while it stays in cache and written back to the map only once. 
+	The accumulated height is rounded and clamped after each layer, so the result is the same as if the layers were
+	added one by one. Interpolated layers need four rows of grid heights, which change only when the row crosses into 
+	another grid cell. */
+	BandCancellation cancellation;
+	#pragma omp parallel
 	{
-		// For wave length 1 no interpolation is necessary.
+		vector<int> accumulator(width);
+		vector<int> rowHeights(width);
+		vector<vector<int> > gridHeights(preparedLayers.size());
+		vector<Coordinate> currentCellYs(preparedLayers.size());
+		vector<bool> isGridValid(preparedLayers.size(), false);
 
-		FOR_EACH_IN_RECT(x, y, operationRect)
+		for (unsigned i = 0; i < preparedLayers.size(); i++)
 		{
-			Point logicalPoint = this->GetLogicalPoint(Point(x, y));
+			if (preparedLayers[i].isInterpolated)
+			{
+				gridHeights[i].resize(4 * preparedLayers[i].gridWidth);
+			}
+		}
 
-			if (isRidged)
+		#pragma omp for schedule(static)
+		for (int y = 0; y < int(height); y++)
+		{
+			if (cancellation.IsCancelled(y))
 			{
-				(*this)(x, y) += abs((Height)randomSequence.GetInt(logicalPoint, -amplitude, +amplitude));
+				continue;
 			}
-			else
+
+			Height* row = this->heightData + y * width;
+			std::copy(row, row + width, accumulator.begin());
+
+			double logicalY = this->GetLogicalY(y);
+
+			for (unsigned i = 0; i < preparedLayers.size(); i++)
 			{
-				(*this)(x, y) += (Height)randomSequence.GetInt(logicalPoint, -amplitude, +amplitude);
+				PreparedNoiseLayer const& layer = preparedLayers[i];
+				int amplitude = layer.amplitude;
+
+				if (!layer.isInterpolated)
+				{
+					RandomSequence2D::GetRowInts(&layer.columnHashes[0], this->GetLogicalPoint(Point(0, y)).GetY(), width, -amplitude, +amplitude, &rowHeights[0]);
+
+					for (Size1D x = 0; x < width; x++)
+					{
+						if (isRidged)
+						{
+							accumulator[x] = (Height)(accumulator[x] + abs((Height)rowHeights[x]));
+						}
+						else
+						{
+							accumulator[x] = (Height)(accumulator[x] + (Height)rowHeights[x]);
+						}
+					}
+
+					continue;
+				}
+
+				Coordinate waveLength = layer.waveLength;
+				Size1D gridWidth = layer.gridWidth;
+				int* grid = &gridHeights[i][0];
+
+				Coordinate coordinateY1 = PreviousMultipleOfInclusive((Coordinate)floor(logicalY), waveLength);
+				if (!isGridValid[i] || coordinateY1 != currentCellYs[i])
+				{
+					Coordinate coordinateY0 = PreviousMultipleOfExclusive(coordinateY1, waveLength);
+					Coordinate coordinateY2 = NextMultipleOfExclusive((Coordinate)floor(logicalY), waveLength);
+					Coordinate coordinateY3 = NextMultipleOfExclusive(coordinateY2, waveLength);
+
+					RandomSequence2D::GetRowInts(&layer.columnHashes[0], coordinateY0, gridWidth, -amplitude, +amplitude, grid);
+					RandomSequence2D::GetRowInts(&layer.columnHashes[0], coordinateY1, gridWidth, -amplitude, +amplitude, grid + gridWidth);
+					RandomSequence2D::GetRowInts(&layer.columnHashes[0], coordinateY2, gridWidth, -amplitude, +amplitude, grid + 2 * gridWidth);
+					RandomSequence2D::GetRowInts(&layer.columnHashes[0], coordinateY3, gridWidth, -amplitude, +amplitude, grid + 3 * gridWidth);
+
+					currentCellYs[i] = coordinateY1;
+					isGridValid[i] = true;
+				}
+
+				double remainderY = (logicalY - coordinateY1) / (double)waveLength;
+
+				for (Size1D x = 0; x < width; x++)
+				{
+					double result = EvaluateBicubic(grid + layer.gridColumns[x], gridWidth, layer.remainderXs[x], remainderY);
+
+					if (isRidged)
+					{
+						accumulator[x] = (Height)std::max(min(abs(result) + accumulator[x], (double)HEIGHT_MAX), (double)HEIGHT_MIN);
+					}
+					else
+					{
+						accumulator[x] = (Height)std::max(min(result + accumulator[x], (double)HEIGHT_MAX), (double)HEIGHT_MIN);
+					}
+				}
 			}
+
+			std::copy(accumulator.begin(), accumulator.end(), row);
 		}
 	}
-	else if (physicalWaveLength > 1)
+
+	cancellation.ThrowIfCancelled();
+}
+
+void HeightMap::AddSimplexNoiseLayers(NoiseLayers const& layers, RandomSeed seed, unsigned firstSeedStep, RandomSeedScheme seedScheme)
+{
+	this->MakeUnique();
+
+	Rectangle operationRect = this->GetPhysicalRectangleUnscaled(this->rectangle);
+	Size1D width = operationRect.GetSize().GetWidth();
+	Size1D height = operationRect.GetSize().GetHeight();
+
+	if (width == 0 || height == 0)
+	{
+		return;
+	}
+
+	vector<double> logicalXs(width);
+	for (Coordinate x = 0; x < Coordinate(width); x++)
+	{
+		logicalXs[x] = this->GetLogicalX(x);
+	}
+
+	vector<RandomSequence2D*> randomSequences;
+	for (NoiseLayers::const_iterator it = layers.begin(); it != layers.end(); it++)
 	{
-		FOR_EACH_IN_RECT(x, y, operationRect)
-		{
-			double logicalX = this->GetLogicalX(x);
-			double logicalY = this->GetLogicalY(y);
+		randomSequences.push_back(new RandomSequence2D(seed, firstSeedStep + unsigned(randomSequences.size()), seedScheme));
+	}
+
+	// Same as in AddNoiseLayers, each row is accumulated from all the layers and written back to the map only once.
+	BandCancellation cancellation;
+	#pragma omp parallel
+	{
+		vector<int> accumulator(width);
+		vector<double> layerXs(width);
+		vector<double> layerHeights(width);
 
-			Coordinate coordinateX1 = PreviousMultipleOfInclusive((Coordinate)floor(logicalX), waveLength);
-			Coordinate coordinateX0 = PreviousMultipleOfExclusive(coordinateX1, waveLength);
-			Coordinate coordinateX2 = NextMultipleOfExclusive((Coordinate)floor(logicalX), waveLength);
-			Coordinate coordinateX3 = NextMultipleOfExclusive(coordinateX2, waveLength);
-
-			Coordinate coordinateY1 = PreviousMultipleOfInclusive((Coordinate)floor(logicalY), waveLength);
-			Coordinate coordinateY0 = PreviousMultipleOfExclusive(coordinateY1, waveLength);
-			Coordinate coordinateY2 = NextMultipleOfExclusive((Coordinate)floor(logicalY), waveLength);
-			Coordinate coordinateY3 = NextMultipleOfExclusive(coordinateY2, waveLength);
-
-			double height00 = (Height)randomSequence.GetInt(Point(coordinateX0, coordinateY0), -amplitude, +amplitude);
-			double height10 = (Height)randomSequence.GetInt(Point(coordinateX1, coordinateY0), -amplitude, +amplitude);
-			double height20 = (Height)randomSequence.GetInt(Point(coordinateX2, coordinateY0), -amplitude, +amplitude);
-			double height30 = (Height)randomSequence.GetInt(Point(coordinateX3, coordinateY0), -amplitude, +amplitude);
-			double height01 = (Height)randomSequence.GetInt(Point(coordinateX0, coordinateY1), -amplitude, +amplitude);
-			double height11 = (Height)randomSequence.GetInt(Point(coordinateX1, coordinateY1), -amplitude, +amplitude);
-			double height21 = (Height)randomSequence.GetInt(Point(coordinateX2, coordinateY1), -amplitude, +amplitude);
-			double height31 = (Height)randomSequence.GetInt(Point(coordinateX3, coordinateY1), -amplitude, +amplitude);
-			double height02 = (Height)randomSequence.GetInt(Point(coordinateX0, coordinateY2), -amplitude, +amplitude);
-			double height12 = (Height)randomSequence.GetInt(Point(coordinateX1, coordinateY2), -amplitude, +amplitude);
-			double height22 = (Height)randomSequence.GetInt(Point(coordinateX2, coordinateY2), -amplitude, +amplitude);
-			double height32 = (Height)randomSequence.GetInt(Point(coordinateX3, coordinateY2), -amplitude, +amplitude);
-			double height03 = (Height)randomSequence.GetInt(Point(coordinateX0, coordinateY3), -amplitude, +amplitude);
-			double height13 = (Height)randomSequence.GetInt(Point(coordinateX1, coordinateY3), -amplitude, +amplitude);
-			double height23 = (Height)randomSequence.GetInt(Point(coordinateX2, coordinateY3), -amplitude, +amplitude);
-			double height33 = (Height)randomSequence.GetInt(Point(coordinateX3, coordinateY3), -amplitude, +amplitude);
-
-			// Prepare coefficients for the bicubic polynomial.
-			// TODO: These need to be recalculated only when the grid cell changes
-			double a00 = height11;
-			double a01 = -.5*height10 + .5*height12;
-			double a02 = height10 - 2.5*height11 + 2 * height12 - .5*height13;
-			double a03 = -.5*height10 + 1.5*height11 - 1.5*height12 + .5*height13;
-			double a10 = -.5*height01 + .5*height21;
-			double a11 = .25*height00 - .25*height02 - .25*height20 + .25*height22;
-			double a12 = -.5*height00 + 1.25*height01 - height02 + .25*height03 + .5*height20 - 1.25*height21 + height22 - .25*height23;
-			double a13 = .25*height00 - .75*height01 + .75*height02 - .25*height03 - .25*height20 + .75*height21 - .75*height22 + .25*height23;
-			double a20 = height01 - 2.5*height11 + 2 * height21 - .5*height31;
-			double a21 = -.5*height00 + .5*height02 + 1.25*height10 - 1.25*height12 - height20 + height22 + .25*height30 - .25*height32;
-			double a22 = height00 - 2.5*height01 + 2 * height02 - .5*height03 - 2.5*height10 + 6.25*height11 - 5 * height12 + 1.25*height13 + 2 * height20 - 5 * height21 + 4 * height22 - height23 - .5*height30 + 1.25*height31 - height32 + .25*height33;
-			double a23 = -.5*height00 + 1.5*height01 - 1.5*height02 + .5*height03 + 1.25*height10 - 3.75*height11 + 3.75*height12 - 1.25*height13 - height20 + 3 * height21 - 3 * height22 + height23 + .25*height30 - .75*height31 + .75*height32 - .25*height33;
-			double a30 = -.5*height01 + 1.5*height11 - 1.5*height21 + .5*height31;
-			double a31 = .25*height00 - .25*height02 - .75*height10 + .75*height12 + .75*height20 - .75*height22 - .25*height30 + .25*height32;
-			double a32 = -.5*height00 + 1.25*height01 - height02 + .25*height03 + 1.5*height10 - 3.75*height11 + 3 * height12 - .75*height13 - 1.5*height20 + 3.75*height21 - 3 * height22 + .75*height23 + .5*height30 - 1.25*height31 + height32 - .25*height33;
-			double a33 = .25*height00 - .75*height01 + .75*height02 - .25*height03 - .75*height10 + 2.25*height11 - 2.25*height12 + .75*height13 + .75*height20 - 2.25*height21 + 2.25*height22 - .75*height23 - .25*height30 + .75*height31 - .75*height32 + .25*height33;
-
-			double remainderX = (logicalX - coordinateX1) / (double)waveLength;
-			double remainderY = (logicalY - coordinateY1) / (double)waveLength;
-
-			// Calculate value of the bicubic polynomial.
-			double remainderX2 = remainderX * remainderX;
-			double remainderX3 = remainderX2 * remainderX;
-			double remainderY2 = remainderY * remainderY;
-			double remainderY3 = remainderY2 * remainderY;
-
-			double result = (a00 + a01 * remainderY + a02 * remainderY2 + a03 * remainderY3) +
-				(a10 + a11 * remainderY + a12 * remainderY2 + a13 * remainderY3) * remainderX +
-				(a20 + a21 * remainderY + a22 * remainderY2 + a23 * remainderY3) * remainderX2 +
-				(a30 + a31 * remainderY + a32 * remainderY2 + a33 * remainderY3) * remainderX3;
-
-			if (isRidged)
+		#pragma omp for schedule(static)
+		for (int y = 0; y < int(height); y++)
+		{
+			if (cancellation.IsCancelled(y))
 			{
-				(*this)(x, y) = (Height)std::max(min(abs(result) + (*this)(x, y), (double)HEIGHT_MAX), (double)HEIGHT_MIN);
+				continue;
 			}
-			else 
+
+			Height* row = this->heightData + y * width;
+			std::copy(row, row + width, accumulator.begin());
+
+			double logicalY = this->GetLogicalY(y);
+
+			unsigned layerIndex = 0;
+			for (NoiseLayers::const_iterator it = layers.begin(); it != layers.end(); it++, layerIndex++)
 			{
-				(*this)(x, y) = (Height)std::max(min(result + (*this)(x, y), (double)HEIGHT_MAX), (double)HEIGHT_MIN);
+				double frequency = 1.0 / double(it->first);
+				double amplitude = it->second;
+
+				for (Size1D x = 0; x < width; x++)
+				{
+					layerXs[x] = logicalXs[x] * frequency;
+				}
+
+				SimplexNoise::EvaluateRow(*randomSequences[layerIndex], &layerXs[0], logicalY * frequency, width, &layerHeights[0]);
+
+				for (Size1D x = 0; x < width; x++)
+				{
+					accumulator[x] = (Height)std::max(min(layerHeights[x] * amplitude + accumulator[x], (double)HEIGHT_MAX), (double)HEIGHT_MIN);
+				}
 			}
+
+			std::copy(accumulator.begin(), accumulator.end(), row);
 		}
+	}
 
-		// Don't bother with too short wave lengths
+	for (vector<RandomSequence2D*>::iterator it = randomSequences.begin(); it != randomSequences.end(); it++)
+	{
+		delete *it;
 	}
+
+	cancellation.ThrowIfCancelled();
 }
 
 void HeightMap::Transform(TransformationMatrix const& matrix, Rectangle transformedRectangle)
@@ -1081,29 +1801,65 @@ void HeightMap::Transform(TransformationMatrix const& matrix, Rectangle transfor
 	auto_ptr<HeightMap> oldThis = auto_ptr<HeightMap>(new HeightMap(*this));
 
 	this->rectangle = transformedRectangle;
-	delete[] heightData;
-	this->heightData = new Height[transformedRectangle.GetSize().GetTotalLength()];
-
-	this->FillRectangle(RECTANGLE_MAX, 0);
+	MemoryTracker::ReleaseHeights(heightData);
+	this->heightData = MemoryTracker::AllocateHeights(transformedRectangle.GetSize().GetTotalLength());
 
 	Rectangle operationRect = this->GetPhysicalRectangleUnscaled(transformedRectangle);
-	FOR_EACH_IN_RECT(x, y, operationRect)
+	Size1D width = operationRect.GetSize().GetWidth();
+	if (width == 0)
 	{
-		Point logicalPoint = this->GetLogicalPoint(Point(x, y));
-		double transformedX = invertedMatrix.GetTransformedX(logicalPoint);
-		double transformedY = invertedMatrix.GetTransformedY(logicalPoint);
-		double sourceX = oldThis->GetPhysicalCoordinate(transformedX, DIRECTION_HORIZONTAL);
-		double sourceY = oldThis->GetPhysicalCoordinate(transformedY, DIRECTION_VERTICAL);
-		(*this)(x, y) = (*oldThis)(sourceX, sourceY);
+		return;
+	}
+
+	// Logical X coordinates are the same for all rows.
+	std::vector<Coordinate> logicalXs(width);
+	for (Size1D x = 0; x < width; x++)
+	{
+		logicalXs[x] = this->GetLogicalPoint(Point(x, 0)).GetX();
+	}
+
+	BilinearSampler sampler(oldThis->heightData, oldThis->rectangle.GetSize());
+	BandCancellation cancellation;
+
+	#pragma omp parallel
+	{
+		std::vector<double> sourceXs(width);
+		std::vector<double> sourceYs(width);
+
+		#pragma omp for schedule(static)
+		for (int y = 0; y < int(operationRect.GetSize().GetHeight()); y++)
+		{
+			if (cancellation.IsCancelled(y))
+			{
+				continue;
+			}
+
+			// A row of the transformed map is a line in the original map, points which don't map into the original map are left empty.
+			Coordinate logicalY = this->GetLogicalPoint(Point(0, y)).GetY();
+			for (Size1D x = 0; x < width; x++)
+			{
+				Point logicalPoint(logicalXs[x], logicalY);
+				sourceXs[x] = oldThis->GetPhysicalCoordinate(invertedMatrix.GetTransformedX(logicalPoint), DIRECTION_HORIZONTAL);
+				sourceYs[x] = oldThis->GetPhysicalCoordinate(invertedMatrix.GetTransformedY(logicalPoint), DIRECTION_VERTICAL);
+			}
+
+			sampler.SampleLine(this->heightData + y * width, width, &sourceXs[0], &sourceYs[0], 0);
+		}
 	}
+
+	cancellation.ThrowIfCancelled();
 }
 
 void HeightMap::TransformHeights(HeightProfile* function, Interval interval, Height min, Height max)
 {
+	this->MakeUnique();
+
 	Rectangle operationRectangle = this->GetPhysicalRectangleUnscaled(this->rectangle);
+	Size1D width = this->GetWidth();
 	FOR_EACH_IN_RECT(x, y, operationRectangle)
 	{
-		Height oldHeight = (*this)(x, y);
+		Height& height = this->heightData[x + width * y];
+		Height oldHeight = height;
 		if (oldHeight >= min && oldHeight <= max)
 		{
 			double functionFraction = ((long long)(oldHeight) - (long long)(min)) / double((long long)(max) - (long long)(min));
@@ -1111,19 +1867,22 @@ void HeightMap::TransformHeights(HeightProfile* function, Interval interval, Hei
 
 			Height functionHeight = (*function)(functionCoordinate);
 
-			(*this)(x, y) = (*function)(functionCoordinate);
+			height = (*function)(functionCoordinate);
 		}
 	}
 }
 
 void HeightMap::Unify(HeightMap* other)
 {
+	this->MakeUnique();
+
 	Rectangle intersection = Rectangle::Intersect(this->rectangle, other->rectangle);
 	Rectangle operationRect = this->GetPhysicalRectangleUnscaled(intersection);
+	Rectangle otherRect = other->GetPhysicalRectangleUnscaled(intersection);
 
-	Point offset = this->rectangle.GetPosition() - other->GetRectangle().GetPosition();
-	FOR_EACH_IN_RECT(x, y, operationRect)
+	#pragma omp parallel for schedule(static)
+	for (int y = 0; y < int(operationRect.GetSize().GetHeight()); y++)
 	{
-		(*this)(x, y) = max((*other)(x + offset.GetX(), y + offset.GetY()), (*this)(x, y));
+		HeightSpanKernels::Max(GetRowPtr(this->heightData, this->GetWidth(), operationRect, y), GetRowPtr(other, otherRect, y), operationRect.GetSize().GetWidth());
 	}
 }
\ No newline at end of file
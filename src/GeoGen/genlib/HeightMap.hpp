@@ -24,8 +24,12 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 #include "../Interval.hpp"
 #include "DataObject.hpp"
 #include "../Direction.hpp"
+#include "../RescaleFilter.hpp"
 #include "NoiseLayersFactory.hpp"
 #include "TransformationMatrix.hpp"
+#include "BilinearSampler.hpp"
+#include "HeightMapPrimitive.hpp"
+#include "MemoryTracker.hpp"
 #include "../random/RandomSeed.hpp"
 #include "../InternalErrorException.hpp"
 
@@ -36,12 +40,16 @@ namespace geogen
 		class HeightProfile;
 
 		/// A height map.
+		///
+		/// Copies of a height map (made by the copy constructor or the assignment operator) share its data until either of them is modified by one of the operations, which copy the data first if it is shared (see MakeUnique).
 		class HeightMap : public DataObject
 		{
 		private:
 			Rectangle rectangle;
 			Height* heightData;
 			Scale scale;
+
+			void DrawLine(Point start, Point end, Height height, Rectangle clipRectangle);
 		public:
 			HeightMap(Rectangle rectangle, Height height = 0, Scale scale = 1);
 			~HeightMap();
@@ -49,6 +57,43 @@ namespace geogen
 			HeightMap(HeightMap const& other, Rectangle cutoutRect);
 			HeightMap& operator=(HeightMap const& other);
 
+			/// Makes sure the data of this map isn't shared with any of its copies, copying it if it is. Called by all modifying operations, including the non-const operator().
+			void MakeUnique();
+
+			/// Determines whether the data of this map is shared with any of its copies.
+			/// @return True if the data is shared.
+			inline bool IsShared() const { return MemoryTracker::IsShared(this->heightData); }
+
+			/// Number of rows (or columns) long running operations process between two checks of the CancellationToken assigned to the calling thread.
+			static const unsigned CANCELLATION_CHECK_BAND_HEIGHT = 16;
+
+			/// Maximum scaled distance of DistanceMap for which the intermediate squared distances fit into 32-bit integers.
+			static const Size1D DISTANCE_MAP_MAX_INTEGER_DISTANCE = 65535;
+
+			/// Number of columns processed together by a single thread in the vertical pass of DistanceMap.
+			static const unsigned DISTANCE_MAP_COLUMN_BLOCK_WIDTH = 32;
+
+			/// Gets peak memory allocated by DistanceMap in addition to the height map itself.
+			/// @param size Physical size of the height map.
+			/// @param scaledMaximumDistance The maximum distance, already scaled.
+			/// @return The memory size.
+			static unsigned GetDistanceMapExtraMemory(Size2D size, Size1D scaledMaximumDistance);
+
+			/// Width and height of the tiles DrawPrimitives bins the primitives into, in pixels.
+			static const Size1D DRAW_PRIMITIVES_TILE_SIZE = 64;
+
+			/// Number of target rows processed together by a single thread in the vertical pass of Rescale.
+			static const unsigned RESCALE_ROW_BAND_HEIGHT = 16;
+
+			/// Number of columns processed together in the vertical pass of Rescale, so the source rows of a single band stay in cache.
+			static const unsigned RESCALE_COLUMN_BLOCK_WIDTH = 1024;
+
+			/// Gets peak memory allocated by Rescale in addition to the original and the rescaled height map.
+			/// @param originalSize Physical size of the original height map.
+			/// @param newSize Physical size of the rescaled height map.
+			/// @return The memory size.
+			static unsigned GetRescaleExtraMemory(Size2D originalSize, Size2D newSize);
+
 			/// Gets memory size of a height map with specified rectangle.
 			/// @param interval The rectangle.
 			/// @return The memory size.
@@ -59,10 +104,16 @@ namespace geogen
 			virtual unsigned GetMemorySize() const { return GetMemorySize(this->rectangle, this->scale); };
 
 			inline Rectangle GetRectangle() const { return this->rectangle; }
-			inline Height* GetHeightDataPtr() { return this->heightData; }
+			inline Height* GetHeightDataPtr() { this->MakeUnique(); return this->heightData; }
+			inline Height const* GetHeightDataPtr() const { return this->heightData; }
 
+			/// Gets a writable reference to a height, making the data unique first (see MakeUnique). Reading many heights through it is slow, loops should use the const overload or GetHeightDataPtr.
+			/// @param x The physical X coordinate.
+			/// @param y The physical Y coordinate.
+			/// @return The height.
 			inline Height& operator() (Coordinate x, Coordinate y)
 			{
+				this->MakeUnique();
 				return this->heightData[x + this->rectangle.GetSize().GetWidth() * y];
 			}
 
@@ -71,8 +122,12 @@ namespace geogen
 				return this->heightData[x + this->rectangle.GetSize().GetWidth() * y];
 			}
 
+			/// Gets a writable reference to a height, making the data unique first (see MakeUnique).
+			/// @param p The physical point.
+			/// @return The height.
 			inline Height& operator() (Point p)
 			{
+				this->MakeUnique();
 				return this->heightData[p.GetX() + this->rectangle.GetSize().GetWidth() * p.GetY()];
 			}
 
@@ -83,19 +138,7 @@ namespace geogen
 
 			inline Height operator() (double x, double y)
 			{
-				// Rudimentary protection against some floating point math errors
-				if (floor(x) + 0.00005 > x) x = floor(x);
-				if (floor(y) + 0.00005 > y) y = floor(y);
-
-				Coordinate leftCoord = Coordinate(floor(x));
-				Coordinate rightCoord = Coordinate(ceil(x));
-				Coordinate topCoord = Coordinate(floor(y));
-				Coordinate bottomCoord = Coordinate(ceil(y));
-				
-				// TODO: Optimize.
-				Height top = leftCoord == rightCoord ? (*this)(leftCoord, topCoord) : Lerp(leftCoord, rightCoord, (*this)(leftCoord, topCoord), (*this)(rightCoord, topCoord), x);
-				Height bottom = leftCoord == rightCoord ? (*this)(leftCoord, bottomCoord) : Lerp(leftCoord, rightCoord, (*this)(leftCoord, bottomCoord), (*this)(rightCoord, bottomCoord), x);
-				return topCoord == bottomCoord ? top : Lerp(topCoord, bottomCoord, top, bottom, y);
+				return BilinearSampler(this->heightData, this->rectangle.GetSize()).Sample(x, y);
 			}
 
 			inline Coordinate GetOriginX() const { return this->rectangle.GetPosition().GetX(); }
@@ -173,9 +216,25 @@ namespace geogen
 			void AddMasked(Height addend, HeightMap* mask);
 			void AddMap(HeightMap* addend);
 			void AddMapMasked(HeightMap* addend, HeightMap* mask);
+
+			/// Adds multiple layers of random noise to the map in a single pass. The result is the same as if NoiseLayer was called for each of the layers, with seed steps starting at @a firstSeedStep.
+			/// @param layers The noise layers.
+			/// @param seed The random seed.
+			/// @param firstSeedStep Seed step of the first layer.
+			/// @param isRidged True to add absolute values of the noise.
+			/// @param seedScheme The scheme used to derive seeds of individual layers from @a seed.
+			void AddNoiseLayers(NoiseLayers const& layers, random::RandomSeed seed, unsigned firstSeedStep, bool isRidged, random::RandomSeedScheme seedScheme = random::RANDOM_SEED_SCHEME_SEQUENTIAL);
+
+			/// Adds multiple layers of simplex noise (see SimplexNoise) to the map in a single pass. Each layer uses grid with cells of the layer's wave length.
+			/// @param layers The noise layers.
+			/// @param seed The random seed.
+			/// @param firstSeedStep Seed step of the first layer.
+			/// @param seedScheme The scheme used to derive seeds of individual layers from @a seed.
+			void AddSimplexNoiseLayers(NoiseLayers const& layers, random::RandomSeed seed, unsigned firstSeedStep, random::RandomSeedScheme seedScheme = random::RANDOM_SEED_SCHEME_SEQUENTIAL);
+
 			void Blur(Size1D radius);
 			void Blur(Size1D radius, Direction direction);
-			void CellNoise(Size1D meanCellSize, random::RandomSeed seed);
+			void CellNoise(Size1D meanCellSize, random::RandomSeed seed, random::RandomSeedScheme seedScheme = random::RANDOM_SEED_SCHEME_SEQUENTIAL);
 			void ClampHeights(Height min, Height max);
 			void Combine(HeightMap* other, HeightMap* mask);
 			void ConvexityMap(Size1D radius);
@@ -185,6 +244,10 @@ namespace geogen
 			void DistanceMap(Size1D distance);
 			void Distort(HeightMap* horizontalDistortionMap, HeightMap* verticalDistortionMap, Size1D maxDistance);
 			void DrawLine(Point start, Point end, Height height);
+
+			/// Draws a list of lines and rectangles in a single pass. The result is the same as if DrawLine and FillRectangle were called for the primitives in order, but the primitives are binned into tiles of DRAW_PRIMITIVES_TILE_SIZE pixels first, so each tile is only touched by the primitives overlapping it and the tiles are drawn in parallel.
+			/// @param primitives The primitives.
+			void DrawPrimitives(std::vector<HeightMapPrimitive> const& primitives);
 			void FillRectangle(Rectangle fillRectangle, Height height);
 			void Gradient(Point source, Point destination, Height fromHeight, Height toHeight);
 			void Intersect(HeightMap* other);
@@ -192,8 +255,8 @@ namespace geogen
 			void Move(Point offset);
 			void Multiply(double factor);
 			void MultiplyMap(HeightMap* factor);
-			void Noise(NoiseLayers const& layers, random::RandomSeed seed);
-			void NoiseLayer(Size1D waveLength, Height amplitude, random::RandomSeed seed, unsigned seedStep, bool isRidged);
+			void Noise(NoiseLayers const& layers, random::RandomSeed seed, random::RandomSeedScheme seedScheme = random::RANDOM_SEED_SCHEME_SEQUENTIAL);
+			void NoiseLayer(Size1D waveLength, Height amplitude, random::RandomSeed seed, unsigned seedStep, bool isRidged, random::RandomSeedScheme seedScheme = random::RANDOM_SEED_SCHEME_SEQUENTIAL);
 			//void NormalMap();
 			//void Outline();
 
@@ -204,7 +267,7 @@ namespace geogen
 			void RadialGradient(Point point, Size1D radius, Height fromHeight, Height toHeight);
 			//void Pattern(Rectangle repeatRectangle);
 			void Pattern(HeightMap* pattern, Rectangle repeatRectangle);
-			void Rescale(Scale horizontalScale, Scale verticalScale);
+			void Rescale(Scale horizontalScale, Scale verticalScale, RescaleFilter filter = RESCALE_FILTER_BILINEAR);
 			void Resize(Rectangle rectangle, Height height);
 			void Shift(HeightProfile* profile, Size1D maximumDistance, Direction direction);
 			//void SelectHeights(Height min, Height max);
@@ -0,0 +1,74 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+#include "../Number.hpp"
+#include "../Point.hpp"
+
+namespace geogen
+{
+	namespace genlib
+	{
+		/// Type of a HeightMapPrimitive.
+		enum HeightMapPrimitiveType
+		{
+			/// A line, drawn the same way as by HeightMap::DrawLine.
+			HEIGHT_MAP_PRIMITIVE_LINE,
+
+			/// A rectangle, filled the same way as by HeightMap::FillRectangle.
+			HEIGHT_MAP_PRIMITIVE_RECTANGLE
+		};
+
+		/// A line or a rectangle drawn by HeightMap::DrawPrimitives.
+		struct HeightMapPrimitive
+		{
+			/// The primitive type.
+			HeightMapPrimitiveType Type;
+
+			/// Start of the line or a corner of the rectangle, in logical coordinates.
+			Point FirstPoint;
+
+			/// End of the line or the opposite corner of the rectangle (both corners are included), in logical coordinates.
+			Point SecondPoint;
+
+			/// Height the primitive is drawn with.
+			Height DrawHeight;
+
+			/// Creates a line.
+			/// @param start The start point.
+			/// @param end The end point.
+			/// @param height The height.
+			/// @return The primitive.
+			static inline HeightMapPrimitive CreateLine(Point start, Point end, Height height)
+			{
+				HeightMapPrimitive primitive = { HEIGHT_MAP_PRIMITIVE_LINE, start, end, height };
+				return primitive;
+			}
+
+			/// Creates a rectangle.
+			/// @param firstCorner The first corner.
+			/// @param secondCorner The opposite corner.
+			/// @param height The height.
+			/// @return The primitive.
+			static inline HeightMapPrimitive CreateRectangle(Point firstCorner, Point secondCorner, Height height)
+			{
+				HeightMapPrimitive primitive = { HEIGHT_MAP_PRIMITIVE_RECTANGLE, firstCorner, secondCorner, height };
+				return primitive;
+			}
+		};
+	}
+}
\ No newline at end of file
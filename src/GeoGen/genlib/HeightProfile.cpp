@@ -18,11 +18,14 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 #include <cstring>
 #include <cmath>
 #include <memory>
+#include <vector>
 
 #include "HeightProfile.hpp"
 #include "../random/RandomSequence2D.hpp"
 #include "../ApiUsageException.hpp"
 #include "HeightMap.hpp"
+#include "ResamplingKernel.hpp"
+#include "MemoryTracker.hpp"
 
 using namespace geogen;
 using namespace genlib;
@@ -35,7 +38,7 @@ using namespace std;
 HeightProfile::HeightProfile(Interval interval, Height height, Scale scale)
 :interval(interval), scale(scale)
 {
-	this->heightData = new Height[interval.GetLength()];
+	this->heightData = MemoryTracker::AllocateHeights(interval.GetLength());
 
 	Interval operationInterval = this->GetPhysicalIntervalUnscaled(this->interval);
 	FOR_EACH_IN_INTERVAL(x, operationInterval)
@@ -49,14 +52,14 @@ HeightProfile::HeightProfile(HeightProfile const& other)
 	this->interval = other.interval;
 	this->scale = other.scale;
 
-	this->heightData = new Height[this->interval.GetLength()];
+	this->heightData = MemoryTracker::AllocateHeights(this->interval.GetLength());
 	memcpy(this->heightData, other.heightData, sizeof(Height) * this->interval.GetLength());
 }
 
 HeightProfile::HeightProfile(HeightProfile const& other, Interval cutoutInterval)
 {
 	this->interval = cutoutInterval;
-	this->heightData = new Height[cutoutInterval.GetLength()];
+	this->heightData = MemoryTracker::AllocateHeights(cutoutInterval.GetLength());
 	this->scale = other.scale;
 
 	Interval physicalInterval = this->GetPhysicalIntervalUnscaled(cutoutInterval);
@@ -81,9 +84,9 @@ HeightProfile& HeightProfile::operator=(HeightProfile const& other)
 	this->interval = other.interval;
 	this->scale = other.scale;
 
-	delete[] this->heightData;
+	MemoryTracker::ReleaseHeights(this->heightData);
 
-	this->heightData = new Height[this->interval.GetLength()];
+	this->heightData = MemoryTracker::AllocateHeights(this->interval.GetLength());
 	memcpy(this->heightData, other.heightData, sizeof(Height) * this->interval.GetLength());
 
 	return *this;
@@ -91,7 +94,7 @@ HeightProfile& HeightProfile::operator=(HeightProfile const& other)
 
 HeightProfile::~HeightProfile()
 {
-	delete[] this->heightData;
+	MemoryTracker::ReleaseHeights(this->heightData);
 }
 
 void HeightProfile::Abs()
@@ -172,7 +175,7 @@ void HeightProfile::Blur(Size1D radius)
 	}
 
 	// Allocate the new array.
-	Height* newData = new Height[this->interval.GetLength()];
+	Height* newData = MemoryTracker::AllocateHeights(this->interval.GetLength());
 
 	Size1D scaledRadius = this->GetScaledSize(radius);
 
@@ -203,7 +206,7 @@ void HeightProfile::Blur(Size1D radius)
 	}
 
 	// Relink and delete the original array data
-	delete[] this->heightData;
+	MemoryTracker::ReleaseHeights(this->heightData);
 	this->heightData = newData;
 }
 
@@ -405,73 +408,90 @@ void HeightProfile::MultiplyProfile(HeightProfile* factor)
 	}
 }
 
-void HeightProfile::Noise(NoiseLayers const& layers, RandomSeed seed)
+void HeightProfile::Noise(NoiseLayers const& layers, RandomSeed seed, RandomSeedScheme seedScheme)
 {
 	this->FillInterval(INTERVAL_MAX, 0);
-
-	unsigned i = 0;
-	for (NoiseLayers::const_iterator it = layers.begin(); it != layers.end(); it++)
-	{
-		this->NoiseLayer(it->first, it->second, seed, i);
-		i++;
-	}
+	this->AddNoiseLayers(layers, seed, 0, seedScheme);
 }
 
-void HeightProfile::NoiseLayer(Size1D waveLength, Height amplitude, random::RandomSeed seed, unsigned seedStep)
+void HeightProfile::NoiseLayer(Size1D waveLength, Height amplitude, random::RandomSeed seed, unsigned seedStep, random::RandomSeedScheme seedScheme)
 {
-	RandomSequence2D randomSequence(seed);
-	for (unsigned i = 0; i < seedStep; i++)
-	{
-		randomSequence.Advance();
-	}
+	NoiseLayers layers;
+	layers[waveLength] = amplitude;
+
+	this->AddNoiseLayers(layers, seed, seedStep, seedScheme);
+}
 
+void HeightProfile::AddNoiseLayers(NoiseLayers const& layers, random::RandomSeed seed, unsigned firstSeedStep, random::RandomSeedScheme seedScheme)
+{
 	Interval operationInterval = this->GetPhysicalIntervalUnscaled(this->interval);
 
-	Size1D physicalWaveLength = this->GetScaledSize(waveLength);
+	// The sequences of all layers are created in advance, so each height can be accumulated from all the layers at once.
+	vector<RandomSequence2D*> randomSequences;
+	vector<Size1D> physicalWaveLengths;
+	for (NoiseLayers::const_iterator it = layers.begin(); it != layers.end(); it++)
+	{
+		randomSequences.push_back(new RandomSequence2D(seed, firstSeedStep + unsigned(randomSequences.size()), seedScheme));
+		physicalWaveLengths.push_back(this->GetScaledSize(it->first));
+	}
 
-	if (physicalWaveLength == 1)
+	FOR_EACH_IN_INTERVAL(x, operationInterval)
 	{
-		// For wave length 1 no interpolation is necessary.
+		// The height is rounded and clamped after each layer, so the result is the same as if the layers were added one by one.
+		int accumulatedHeight = (*this)(x);
 
-		FOR_EACH_IN_INTERVAL(x, operationInterval)
+		unsigned layerIndex = 0;
+		for (NoiseLayers::const_iterator it = layers.begin(); it != layers.end(); it++, layerIndex++)
 		{
-			Coordinate logicalCoordinate = this->GetLogicalCoordinate(x);
-
-			(*this)(x) += (Height)randomSequence.GetInt(logicalCoordinate, -amplitude, +amplitude);
+			Size1D waveLength = it->first;
+			Height amplitude = it->second;
+			RandomSequence2D& randomSequence = *randomSequences[layerIndex];
+
+			if (physicalWaveLengths[layerIndex] == 1)
+			{
+				// For wave length 1 no interpolation is necessary.
+				Coordinate logicalCoordinate = this->GetLogicalCoordinate(x);
+
+				accumulatedHeight = (Height)(accumulatedHeight + (Height)randomSequence.GetInt(logicalCoordinate, -amplitude, +amplitude));
+			}
+			else if (physicalWaveLengths[layerIndex] > 1)
+			{
+				double logicalCoordinate = this->GetLogicalCoordinate((double)x);
+
+				Coordinate coordinate1 = PreviousMultipleOfInclusive((Coordinate)floor(logicalCoordinate), waveLength);
+				Coordinate coordinate0 = PreviousMultipleOfExclusive(coordinate1, waveLength);
+				Coordinate coordinate2 = NextMultipleOfInclusive((Coordinate)floor(logicalCoordinate), waveLength);
+				Coordinate coordinate3 = NextMultipleOfExclusive(coordinate2, waveLength);
+
+				double height0 = randomSequence.GetInt(coordinate0, -amplitude, +amplitude);
+				double height1 = randomSequence.GetInt(coordinate1, -amplitude, +amplitude);
+				double height2 = randomSequence.GetInt(coordinate2, -amplitude, +amplitude);
+				double height3 = randomSequence.GetInt(coordinate3, -amplitude, +amplitude);
+
+				// Coefficients for the bicubic polynomial
+				double a0 = (height3 - height2) - (height0 - height1);
+				double a1 = (height0 - height1) - a0;
+				double a2 = height2 - height0;
+				double a3 = height1;
+
+				double remainder = (logicalCoordinate - coordinate1) / (double)waveLength;
+
+				// Calculate value of the cubic polynomial.
+				double result = a0 * remainder * remainder * remainder + a1 * remainder * remainder + a2 * remainder + a3;
+
+				accumulatedHeight = (Height)std::max(min(result + accumulatedHeight, (double)HEIGHT_MAX), (double)HEIGHT_MIN);
+			}
+
+			// Don't bother with too short wave lengths
 		}
-	}
-	else if (physicalWaveLength > 1)
-	{
-		FOR_EACH_IN_INTERVAL(x, operationInterval)
-		{
-			double logicalCoordinate = this->GetLogicalCoordinate((double)x);
-	
-			Coordinate coordinate1 = PreviousMultipleOfInclusive((Coordinate)floor(logicalCoordinate), waveLength);
-			Coordinate coordinate0 = PreviousMultipleOfExclusive(coordinate1, waveLength);
-			Coordinate coordinate2 = NextMultipleOfInclusive((Coordinate)floor(logicalCoordinate), waveLength);
-			Coordinate coordinate3 = NextMultipleOfExclusive(coordinate2, waveLength);
-
-			double height0 = randomSequence.GetInt(coordinate0, -amplitude, +amplitude);
-			double height1 = randomSequence.GetInt(coordinate1, -amplitude, +amplitude);
-			double height2 = randomSequence.GetInt(coordinate2, -amplitude, +amplitude);
-			double height3 = randomSequence.GetInt(coordinate3, -amplitude, +amplitude);
-
-			// Coefficients for the bicubic polynomial
-			double a0 = (height3 - height2) - (height0 - height1);
-			double a1 = (height0 - height1) - a0;
-			double a2 = height2 - height0;
-			double a3 = height1;
-
-			double remainder = (logicalCoordinate - coordinate1) / (double)waveLength;
 
-			// Calculate value of the cubic polynomial.
-			double result = a0 * remainder * remainder * remainder + a1 * remainder * remainder + a2 * remainder + a3;
-
-			(*this)(x) = (Height)std::max(min(result + (*this)(x), (double)HEIGHT_MAX), (double)HEIGHT_MIN);
-		}
+		(*this)(x) = (Height)accumulatedHeight;
 	}
 
-	// Don't bother with too short wave lengths
+	for (vector<RandomSequence2D*>::iterator it = randomSequences.begin(); it != randomSequences.end(); it++)
+	{
+		delete *it;
+	}
 }
 
 void HeightProfile::Pattern(HeightProfile* pattern, Interval repeatInterval)
@@ -492,23 +512,20 @@ void HeightProfile::Pattern(HeightProfile* pattern, Interval repeatInterval)
 	}
 }
 
-void HeightProfile::Rescale(Scale scale)
+void HeightProfile::Rescale(Scale scale, RescaleFilter filter)
 {
 	Interval newInterval(Coordinate(this->interval.GetStart() * scale), Size1D(this->interval.GetLength() * scale));
 
 	// Allocate the new array.
-	Height* newData = new Height[newInterval.GetLength()];
-
-	Interval operationInterval = newInterval - newInterval.GetStart();
+	Height* newData = MemoryTracker::AllocateHeights(newInterval.GetLength());
 
-	double actualScale = (newInterval.GetLength() - 1) / (double)(this->interval.GetLength() - 1);
-	FOR_EACH_IN_INTERVAL(x, operationInterval)
+	if (newInterval.GetLength() > 0)
 	{
-		newData[x] = (*this)(double(x / actualScale));
+		ResamplingKernel(this->interval.GetLength(), newInterval.GetLength(), filter).ResampleLine(newData, this->heightData);
 	}
 
 	// Relink and delete the original array data
-	delete[] this->heightData;
+	MemoryTracker::ReleaseHeights(this->heightData);
 	this->heightData = newData;
 	this->interval = newInterval;
 }
@@ -517,9 +534,9 @@ void HeightProfile::Resize(Interval interval, Height height)
 {
 	HeightProfile old(*this);
 
-	delete[] this->heightData;
+	MemoryTracker::ReleaseHeights(this->heightData);
 
-	this->heightData = new Height[interval.GetLength()];
+	this->heightData = MemoryTracker::AllocateHeights(interval.GetLength());
 	this->interval = interval;
 
 	Interval operationInterval = this->GetPhysicalIntervalUnscaled(this->interval);
@@ -568,6 +585,7 @@ void HeightProfile::Slice(HeightMap* heightMap, Direction direction, Coordinate
 	}
 	else throw ApiUsageException(GG_STR("Invalid direction."));
 	
+	HeightMap const& source = *heightMap;
 
 	if (direction == DIRECTION_HORIZONTAL)
 	{
@@ -576,7 +594,7 @@ void HeightProfile::Slice(HeightMap* heightMap, Direction direction, Coordinate
 		Coordinate offset = heightMap->GetOriginX() - this->GetStart();
 		FOR_EACH_IN_INTERVAL(x, physicalInterval)
 		{
-			(*this)(x) = (*heightMap)(x + offset, physicalCoordinate);
+			(*this)(x) = source(x + offset, physicalCoordinate);
 		}
 	}
 	else if (direction == DIRECTION_VERTICAL)
@@ -586,7 +604,7 @@ void HeightProfile::Slice(HeightMap* heightMap, Direction direction, Coordinate
 		Coordinate offset = this->GetStart() - heightMap->GetOriginY();
 		FOR_EACH_IN_INTERVAL(x, physicalInterval)
 		{
-			(*this)(x) = (*heightMap)(physicalCoordinate, x + offset);
+			(*this)(x) = source(physicalCoordinate, x + offset);
 		}
 	}
 }
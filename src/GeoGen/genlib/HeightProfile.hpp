@@ -21,6 +21,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 
 #include "../Interval.hpp"
 #include "../Number.hpp"
+#include "../RescaleFilter.hpp"
 #include "DataObject.hpp"
 #include "NoiseLayersFactory.hpp"
 #include "../random/RandomSeed.hpp"
@@ -240,17 +241,26 @@ namespace geogen
 			/// @param [in,out] factor If non-null, the factor.
 			void MultiplyProfile(HeightProfile* factor);
 
+			/// Adds multiple layers of random noise to the profile in a single pass. The result is the same as if NoiseLayer was called for each of the layers, with seed steps starting at @a firstSeedStep.
+			/// @param layers The noise layers.
+			/// @param seed The random seed.
+			/// @param firstSeedStep Seed step of the first layer.
+			/// @param seedScheme The scheme used to derive seeds of individual layers from @a seed.
+			void AddNoiseLayers(NoiseLayers const& layers, random::RandomSeed seed, unsigned firstSeedStep, random::RandomSeedScheme seedScheme = random::RANDOM_SEED_SCHEME_SEQUENTIAL);
+
 			/// Fills the map with random noise.
 			/// @param layers The noise layers.
 			/// @param seed The random seed.
-			void Noise(NoiseLayers const& layers, random::RandomSeed seed);
+			/// @param seedScheme The scheme used to derive seeds of individual layers from @a seed.
+			void Noise(NoiseLayers const& layers, random::RandomSeed seed, random::RandomSeedScheme seedScheme = random::RANDOM_SEED_SCHEME_SEQUENTIAL);
 
 			/// Adds a single layer of random noise to the map.
 			/// @param waveLength The wave length.
 			/// @param amplitude The amplitude.
 			/// @param seed The random seed.
 			/// @param seedStep Number of the seed step.
-			void NoiseLayer(Size1D waveLength, Height amplitude, random::RandomSeed seed, unsigned seedStep);
+			/// @param seedScheme The scheme used to derive the seed step from @a seed.
+			void NoiseLayer(Size1D waveLength, Height amplitude, random::RandomSeed seed, unsigned seedStep, random::RandomSeedScheme seedScheme = random::RANDOM_SEED_SCHEME_SEQUENTIAL);
 
 			/// Creates a height profile filled with an interval of pattern repeated indefinitely in both directions. 
 			/// @param pattern The pattern profile.
@@ -259,7 +269,8 @@ namespace geogen
 
 			/// Scales the entire height profile up (if the scale is greater than 1) or down (if the scale is less than 1) by given scale. Scale must be greater than 0.
 			/// @param scale The scale.
-			void Rescale(Scale scale);
+			/// @param filter The filter used to calculate the new heights.
+			void Rescale(Scale scale, RescaleFilter filter = RESCALE_FILTER_BILINEAR);
 
 			/// Changes size of physical data array to logical @a interval. Any newly created pixels will
 			/// have @a height.
@@ -0,0 +1,310 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include "HeightSpanKernels.hpp"
+#include "../utils/SimdSupport.hpp"
+
+using namespace geogen;
+using namespace genlib;
+using namespace utils;
+
+namespace
+{
+	inline Height ClampHeight(int height)
+	{
+		return Height(height > HEIGHT_MAX ? HEIGHT_MAX : (height < HEIGHT_MIN ? HEIGHT_MIN : height));
+	}
+
+#ifdef GEOGEN_SIMD_SSE2
+	inline __m128i ClampHeights(__m128i heights)
+	{
+		// Saturated 16 bit arithmetic already took care of the upper bound, only HEIGHT_MIN is one above the lowest 16 bit value.
+		return _mm_max_epi16(heights, _mm_set1_epi16(HEIGHT_MIN));
+	}
+
+	inline __m128i ScaleHeights(__m128i heights, __m128i factors)
+	{
+		__m128i negative = _mm_srai_epi16(_mm_xor_si128(heights, factors), 15);
+		__m128i heightSigns = _mm_srai_epi16(heights, 15);
+		__m128i factorSigns = _mm_srai_epi16(factors, 15);
+		__m128i heightMagnitudes = _mm_sub_epi16(_mm_xor_si128(heights, heightSigns), heightSigns);
+		__m128i factorMagnitudes = _mm_sub_epi16(_mm_xor_si128(factors, factorSigns), factorSigns);
+
+		__m128i productsLow = _mm_mullo_epi16(heightMagnitudes, factorMagnitudes);
+		__m128i productsHigh = _mm_mulhi_epu16(heightMagnitudes, factorMagnitudes);
+		__m128i products[2] = { _mm_unpacklo_epi16(productsLow, productsHigh), _mm_unpackhi_epi16(productsLow, productsHigh) };
+		__m128i signs[2] = { _mm_unpacklo_epi16(negative, negative), _mm_unpackhi_epi16(negative, negative) };
+
+		for (int i = 0; i < 2; i++)
+		{
+			__m128i quotients = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(products[i], _mm_srli_epi32(products[i], 15)), _mm_set1_epi32(1)), 15);
+			products[i] = _mm_sub_epi32(_mm_xor_si128(quotients, signs[i]), signs[i]);
+		}
+
+		return ClampHeights(_mm_packs_epi32(products[0], products[1]));
+	}
+#endif
+
+#ifdef GEOGEN_SIMD_AVX2
+	GEOGEN_AVX2_TARGET inline __m256i ClampHeights(__m256i heights)
+	{
+		return _mm256_max_epi16(heights, _mm256_set1_epi16(HEIGHT_MIN));
+	}
+
+	// Unpacking and packing both work within 128 bit lanes, so the heights end up in their original order.
+	GEOGEN_AVX2_TARGET inline __m256i ScaleHeights(__m256i heights, __m256i factors)
+	{
+		__m256i negative = _mm256_srai_epi16(_mm256_xor_si256(heights, factors), 15);
+		__m256i heightMagnitudes = _mm256_abs_epi16(heights);
+		__m256i factorMagnitudes = _mm256_abs_epi16(factors);
+
+		__m256i productsLow = _mm256_mullo_epi16(heightMagnitudes, factorMagnitudes);
+		__m256i productsHigh = _mm256_mulhi_epu16(heightMagnitudes, factorMagnitudes);
+		__m256i products[2] = { _mm256_unpacklo_epi16(productsLow, productsHigh), _mm256_unpackhi_epi16(productsLow, productsHigh) };
+		__m256i signs[2] = { _mm256_unpacklo_epi16(negative, negative), _mm256_unpackhi_epi16(negative, negative) };
+
+		for (int i = 0; i < 2; i++)
+		{
+			__m256i quotients = _mm256_srli_epi32(_mm256_add_epi32(_mm256_add_epi32(products[i], _mm256_srli_epi32(products[i], 15)), _mm256_set1_epi32(1)), 15);
+			products[i] = _mm256_sub_epi32(_mm256_xor_si256(quotients, signs[i]), signs[i]);
+		}
+
+		return ClampHeights(_mm256_packs_epi32(products[0], products[1]));
+	}
+#endif
+
+	/* Each operation is a functor with an overload for a single height and for each supported vector type. The second
+	argument is the other map (or the mask, for operations with a constant operand), the third one is the mask. */
+
+	struct AddOperation
+	{
+		inline Height operator()(Height target, Height addend) const { return ClampHeight(int(target) + int(addend)); }
+#ifdef GEOGEN_SIMD_SSE2
+		inline __m128i operator()(__m128i target, __m128i addend) const { return ClampHeights(_mm_adds_epi16(target, addend)); }
+#endif
+#ifdef GEOGEN_SIMD_AVX2
+		GEOGEN_AVX2_TARGET inline __m256i operator()(__m256i target, __m256i addend) const { return ClampHeights(_mm256_adds_epi16(target, addend)); }
+#endif
+	};
+
+	struct AddMaskedOperation
+	{
+		inline Height operator()(Height target, Height addend, Height mask) const { return ClampHeight(int(target) + int(HeightSpanKernels::ScaleHeight(addend, mask > 0 ? mask : 0))); }
+#ifdef GEOGEN_SIMD_SSE2
+		inline __m128i operator()(__m128i target, __m128i addend, __m128i mask) const { return ClampHeights(_mm_adds_epi16(target, ScaleHeights(addend, _mm_max_epi16(mask, _mm_setzero_si128())))); }
+#endif
+#ifdef GEOGEN_SIMD_AVX2
+		GEOGEN_AVX2_TARGET inline __m256i operator()(__m256i target, __m256i addend, __m256i mask) const { return ClampHeights(_mm256_adds_epi16(target, ScaleHeights(addend, _mm256_max_epi16(mask, _mm256_setzero_si256())))); }
+#endif
+	};
+
+	struct AddMaskedConstantOperation
+	{
+		Height addend;
+
+		AddMaskedConstantOperation(Height addend) : addend(addend) {}
+
+		inline Height operator()(Height target, Height mask) const { return AddMaskedOperation()(target, this->addend, mask); }
+#ifdef GEOGEN_SIMD_SSE2
+		inline __m128i operator()(__m128i target, __m128i mask) const { return AddMaskedOperation()(target, _mm_set1_epi16(this->addend), mask); }
+#endif
+#ifdef GEOGEN_SIMD_AVX2
+		GEOGEN_AVX2_TARGET inline __m256i operator()(__m256i target, __m256i mask) const { return AddMaskedOperation()(target, _mm256_set1_epi16(this->addend), mask); }
+#endif
+	};
+
+	struct MultiplyOperation
+	{
+		inline Height operator()(Height target, Height factor) const { return HeightSpanKernels::ScaleHeight(target, factor); }
+#ifdef GEOGEN_SIMD_SSE2
+		inline __m128i operator()(__m128i target, __m128i factor) const { return ScaleHeights(target, factor); }
+#endif
+#ifdef GEOGEN_SIMD_AVX2
+		GEOGEN_AVX2_TARGET inline __m256i operator()(__m256i target, __m256i factor) const { return ScaleHeights(target, factor); }
+#endif
+	};
+
+	struct MinOperation
+	{
+		inline Height operator()(Height target, Height other) const { return target < other ? target : other; }
+#ifdef GEOGEN_SIMD_SSE2
+		inline __m128i operator()(__m128i target, __m128i other) const { return _mm_min_epi16(target, other); }
+#endif
+#ifdef GEOGEN_SIMD_AVX2
+		GEOGEN_AVX2_TARGET inline __m256i operator()(__m256i target, __m256i other) const { return _mm256_min_epi16(target, other); }
+#endif
+	};
+
+	struct MaxOperation
+	{
+		inline Height operator()(Height target, Height other) const { return target > other ? target : other; }
+#ifdef GEOGEN_SIMD_SSE2
+		inline __m128i operator()(__m128i target, __m128i other) const { return _mm_max_epi16(target, other); }
+#endif
+#ifdef GEOGEN_SIMD_AVX2
+		GEOGEN_AVX2_TARGET inline __m256i operator()(__m256i target, __m256i other) const { return _mm256_max_epi16(target, other); }
+#endif
+	};
+
+	struct LerpOperation
+	{
+		inline Height operator()(Height target, Height other, Height mask) const
+		{
+			Height factor = mask > 0 ? mask : 0;
+			return ClampHeight(int(HeightSpanKernels::ScaleHeight(target, factor)) + int(HeightSpanKernels::ScaleHeight(other, HEIGHT_MAX - factor)));
+		}
+#ifdef GEOGEN_SIMD_SSE2
+		inline __m128i operator()(__m128i target, __m128i other, __m128i mask) const
+		{
+			__m128i factor = _mm_max_epi16(mask, _mm_setzero_si128());
+			__m128i inverseFactor = _mm_sub_epi16(_mm_set1_epi16(HEIGHT_MAX), factor);
+			return ClampHeights(_mm_adds_epi16(ScaleHeights(target, factor), ScaleHeights(other, inverseFactor)));
+		}
+#endif
+#ifdef GEOGEN_SIMD_AVX2
+		GEOGEN_AVX2_TARGET inline __m256i operator()(__m256i target, __m256i other, __m256i mask) const
+		{
+			__m256i factor = _mm256_max_epi16(mask, _mm256_setzero_si256());
+			__m256i inverseFactor = _mm256_sub_epi16(_mm256_set1_epi16(HEIGHT_MAX), factor);
+			return ClampHeights(_mm256_adds_epi16(ScaleHeights(target, factor), ScaleHeights(other, inverseFactor)));
+		}
+#endif
+	};
+
+#ifdef GEOGEN_SIMD_AVX2
+	template<typename Operation>
+	GEOGEN_AVX2_TARGET unsigned ApplyAvx2(Operation const& operation, Height* target, Height const* source, unsigned count)
+	{
+		unsigned i = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			__m256i result = operation(_mm256_loadu_si256((__m256i const*)(target + i)), _mm256_loadu_si256((__m256i const*)(source + i)));
+			_mm256_storeu_si256((__m256i*)(target + i), result);
+		}
+
+		return i;
+	}
+
+	template<typename Operation>
+	GEOGEN_AVX2_TARGET unsigned ApplyAvx2(Operation const& operation, Height* target, Height const* source, Height const* mask, unsigned count)
+	{
+		unsigned i = 0;
+		for (; i + 16 <= count; i += 16)
+		{
+			__m256i result = operation(_mm256_loadu_si256((__m256i const*)(target + i)), _mm256_loadu_si256((__m256i const*)(source + i)), _mm256_loadu_si256((__m256i const*)(mask + i)));
+			_mm256_storeu_si256((__m256i*)(target + i), result);
+		}
+
+		return i;
+	}
+#endif
+
+	template<typename Operation>
+	void Apply(Operation const& operation, Height* target, Height const* source, unsigned count)
+	{
+		unsigned i = 0;
+#ifdef GEOGEN_SIMD_AVX2
+		if (IsAvx2Supported())
+		{
+			i = ApplyAvx2(operation, target, source, count);
+		}
+#endif
+#ifdef GEOGEN_SIMD_SSE2
+		for (; i + 8 <= count; i += 8)
+		{
+			__m128i result = operation(_mm_loadu_si128((__m128i const*)(target + i)), _mm_loadu_si128((__m128i const*)(source + i)));
+			_mm_storeu_si128((__m128i*)(target + i), result);
+		}
+#endif
+		for (; i < count; i++)
+		{
+			target[i] = operation(target[i], source[i]);
+		}
+	}
+
+	template<typename Operation>
+	void Apply(Operation const& operation, Height* target, Height const* source, Height const* mask, unsigned count)
+	{
+		unsigned i = 0;
+#ifdef GEOGEN_SIMD_AVX2
+		if (IsAvx2Supported())
+		{
+			i = ApplyAvx2(operation, target, source, mask, count);
+		}
+#endif
+#ifdef GEOGEN_SIMD_SSE2
+		for (; i + 8 <= count; i += 8)
+		{
+			__m128i result = operation(_mm_loadu_si128((__m128i const*)(target + i)), _mm_loadu_si128((__m128i const*)(source + i)), _mm_loadu_si128((__m128i const*)(mask + i)));
+			_mm_storeu_si128((__m128i*)(target + i), result);
+		}
+#endif
+		for (; i < count; i++)
+		{
+			target[i] = operation(target[i], source[i], mask[i]);
+		}
+	}
+}
+
+void HeightSpanKernels::Add(Height* target, Height const* addend, unsigned count)
+{
+	Apply(AddOperation(), target, addend, count);
+}
+
+void HeightSpanKernels::AddMasked(Height* target, Height const* addend, Height const* mask, unsigned count)
+{
+	Apply(AddMaskedOperation(), target, addend, mask, count);
+}
+
+void HeightSpanKernels::AddMasked(Height* target, Height addend, Height const* mask, unsigned count)
+{
+	Apply(AddMaskedConstantOperation(addend), target, mask, count);
+}
+
+void HeightSpanKernels::Multiply(Height* target, Height const* factor, unsigned count)
+{
+	Apply(MultiplyOperation(), target, factor, count);
+}
+
+void HeightSpanKernels::Min(Height* target, Height const* other, unsigned count)
+{
+	Apply(MinOperation(), target, other, count);
+}
+
+void HeightSpanKernels::Max(Height* target, Height const* other, unsigned count)
+{
+	Apply(MaxOperation(), target, other, count);
+}
+
+void HeightSpanKernels::Lerp(Height* target, Height const* other, Height const* mask, unsigned count)
+{
+	Apply(LerpOperation(), target, other, mask, count);
+}
+
+String HeightSpanKernels::GetInstructionSetName()
+{
+#ifdef GEOGEN_SIMD_AVX2
+	if (IsAvx2Supported())
+	{
+		return GG_STR("AVX2");
+	}
+#endif
+#ifdef GEOGEN_SIMD_SSE2
+	return GG_STR("SSE2");
+#else
+	return GG_STR("Scalar");
+#endif
+}
\ No newline at end of file
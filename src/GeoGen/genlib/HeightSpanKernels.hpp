@@ -0,0 +1,99 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+#include "../Number.hpp"
+#include "../String.hpp"
+
+namespace geogen
+{
+	namespace genlib
+	{
+		/// Kernels combining a span of heights (typically a row of a height map) with spans of another height map and a mask, used by the pixel-wise operations on multiple maps (HeightMap::AddMap, HeightMap::Combine, HeightMap::Unify etc.).
+		///
+		/// The kernels use the widest vector instruction set available on the running CPU (AVX2 or SSE2) and fall back to plain C++ otherwise. All code paths use integer arithmetic and give exactly the same results. Results of additions and multiplications are clamped to range <geogen::HEIGHT_MIN, geogen::HEIGHT_MAX>.
+		class HeightSpanKernels
+		{
+		private:
+			HeightSpanKernels() {};
+		public:
+			/// Multiplies a height by a factor expressed as a height (geogen::HEIGHT_MAX corresponding to 1). The result is rounded towards zero.
+			/// @param height The height.
+			/// @param factor The factor.
+			/// @return The scaled height.
+			static inline Height ScaleHeight(Height height, Height factor)
+			{
+				int product = int(height) * int(factor);
+				unsigned magnitude = product < 0 ? unsigned(-product) : unsigned(product);
+
+				// Exact division by 32767 for all products of two heights.
+				int quotient = int((magnitude + (magnitude >> 15) + 1) >> 15);
+				int result = product < 0 ? -quotient : quotient;
+				return Height(result > HEIGHT_MAX ? HEIGHT_MAX : (result < HEIGHT_MIN ? HEIGHT_MIN : result));
+			}
+
+			/// Adds a span of heights to the target span.
+			/// @param target The target span.
+			/// @param addend The added heights.
+			/// @param count Number of heights in each span.
+			static void Add(Height* target, Height const* addend, unsigned count);
+
+			/// Adds a span of heights multiplied by a mask to the target span. Negative mask heights are treated as 0.
+			/// @param target The target span.
+			/// @param addend The added heights.
+			/// @param mask The mask.
+			/// @param count Number of heights in each span.
+			static void AddMasked(Height* target, Height const* addend, Height const* mask, unsigned count);
+
+			/// Adds a single height multiplied by a mask to the target span. Negative mask heights are treated as 0.
+			/// @param target The target span.
+			/// @param addend The added height.
+			/// @param mask The mask.
+			/// @param count Number of heights in each span.
+			static void AddMasked(Height* target, Height addend, Height const* mask, unsigned count);
+
+			/// Multiplies the target span by a span of factors (see ScaleHeight).
+			/// @param target The target span.
+			/// @param factor The factors.
+			/// @param count Number of heights in each span.
+			static void Multiply(Height* target, Height const* factor, unsigned count);
+
+			/// Replaces each target height with the lower of it and the other height.
+			/// @param target The target span.
+			/// @param other The other span.
+			/// @param count Number of heights in each span.
+			static void Min(Height* target, Height const* other, unsigned count);
+
+			/// Replaces each target height with the higher of it and the other height.
+			/// @param target The target span.
+			/// @param other The other span.
+			/// @param count Number of heights in each span.
+			static void Max(Height* target, Height const* other, unsigned count);
+
+			/// Interpolates between the target span and the other span. Mask height geogen::HEIGHT_MAX keeps the target height, 0 (or any negative height) replaces it with the other height.
+			/// @param target The target span.
+			/// @param other The other span.
+			/// @param mask The mask.
+			/// @param count Number of heights in each span.
+			static void Lerp(Height* target, Height const* other, Height const* mask, unsigned count);
+
+			/// Gets name of the instruction set used by the kernels on this CPU.
+			/// @return "AVX2", "SSE2" or "Scalar".
+			static String GetInstructionSetName();
+		};
+	}
+}
\ No newline at end of file
@@ -0,0 +1,226 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+
+#include <algorithm>
+
+#include "MemoryTracker.hpp"
+
+using namespace geogen;
+using namespace genlib;
+
+namespace
+{
+	// Number of bytes in front of each height array storing its length and number of its owners. Big enough to keep the array aligned as if it was allocated directly.
+	const unsigned long long HEIGHTS_HEADER_SIZE = 16;
+
+	struct HeightsHeader
+	{
+		unsigned long long Count;
+		unsigned long long ReferenceCount;
+	};
+
+	inline HeightsHeader* GetHeightsHeader(Height const* heights)
+	{
+		return (HeightsHeader*)((char*)heights - HEIGHTS_HEADER_SIZE);
+	}
+
+	MemoryTracker::Account* currentAccount = NULL;
+}
+
+#pragma omp threadprivate(currentAccount)
+
+unsigned long long MemoryTracker::currentMemory = 0;
+unsigned long long MemoryTracker::peakMemory = 0;
+unsigned long long MemoryTracker::allocatedMemory = 0;
+
+unsigned long long MemoryTracker::Account::GetCurrentMemory() const
+{
+	unsigned long long memory;
+	#pragma omp critical (geogen_memory_tracker)
+	{
+		memory = this->currentMemory;
+	}
+
+	return memory;
+}
+
+unsigned long long MemoryTracker::Account::GetPeakMemory() const
+{
+	unsigned long long memory;
+	#pragma omp critical (geogen_memory_tracker)
+	{
+		memory = this->peakMemory;
+	}
+
+	return memory;
+}
+
+void MemoryTracker::Account::ResetPeakMemory()
+{
+	#pragma omp critical (geogen_memory_tracker)
+	{
+		this->peakMemory = this->currentMemory;
+	}
+}
+
+MemoryTracker::AccountScope::AccountScope(Account* account)
+: previousAccount(currentAccount)
+{
+	currentAccount = account;
+}
+
+MemoryTracker::AccountScope::~AccountScope()
+{
+	currentAccount = this->previousAccount;
+}
+
+Height* MemoryTracker::AllocateHeights(unsigned long long count)
+{
+	char* block = new char[HEIGHTS_HEADER_SIZE + count * sizeof(Height)];
+	((HeightsHeader*)block)->Count = count;
+	((HeightsHeader*)block)->ReferenceCount = 1;
+
+	RegisterAllocation(count * sizeof(Height));
+
+	return (Height*)(block + HEIGHTS_HEADER_SIZE);
+}
+
+Height* MemoryTracker::ShareHeights(Height* heights)
+{
+	HeightsHeader* header = GetHeightsHeader(heights);
+
+	#pragma omp critical (geogen_memory_tracker_references)
+	{
+		header->ReferenceCount++;
+	}
+
+	return heights;
+}
+
+bool MemoryTracker::IsShared(Height const* heights)
+{
+	HeightsHeader* header = GetHeightsHeader(heights);
+
+	bool isShared;
+	#pragma omp critical (geogen_memory_tracker_references)
+	{
+		isShared = header->ReferenceCount > 1;
+	}
+
+	return isShared;
+}
+
+void MemoryTracker::ReleaseHeights(Height* heights)
+{
+	if (heights == NULL)
+	{
+		return;
+	}
+
+	HeightsHeader* header = GetHeightsHeader(heights);
+
+	unsigned long long referenceCount;
+	#pragma omp critical (geogen_memory_tracker_references)
+	{
+		referenceCount = --header->ReferenceCount;
+	}
+
+	if (referenceCount > 0)
+	{
+		return;
+	}
+
+	RegisterRelease(header->Count * sizeof(Height));
+
+	delete[] (char*)header;
+}
+
+void MemoryTracker::RegisterAllocation(unsigned long long size)
+{
+	#pragma omp critical (geogen_memory_tracker)
+	{
+		currentMemory += size;
+		allocatedMemory += size;
+		peakMemory = std::max(peakMemory, currentMemory);
+
+		if (currentAccount != NULL)
+		{
+			currentAccount->currentMemory += size;
+			currentAccount->peakMemory = std::max(currentAccount->peakMemory, currentAccount->currentMemory);
+		}
+	}
+}
+
+void MemoryTracker::RegisterRelease(unsigned long long size)
+{
+	#pragma omp critical (geogen_memory_tracker)
+	{
+		currentMemory -= std::min(size, currentMemory);
+
+		// Memory allocated before the account was assigned may be released under it, so it is clamped the same way.
+		if (currentAccount != NULL)
+		{
+			currentAccount->currentMemory -= std::min(size, currentAccount->currentMemory);
+		}
+	}
+}
+
+unsigned long long MemoryTracker::GetCurrentMemory()
+{
+	unsigned long long memory;
+	#pragma omp critical (geogen_memory_tracker)
+	{
+		memory = currentMemory;
+	}
+
+	return memory;
+}
+
+unsigned long long MemoryTracker::GetPeakMemory()
+{
+	unsigned long long memory;
+	#pragma omp critical (geogen_memory_tracker)
+	{
+		memory = peakMemory;
+	}
+
+	return memory;
+}
+
+unsigned long long MemoryTracker::GetAllocatedMemory()
+{
+	unsigned long long memory;
+	#pragma omp critical (geogen_memory_tracker)
+	{
+		memory = allocatedMemory;
+	}
+
+	return memory;
+}
+
+void MemoryTracker::ResetPeakMemory()
+{
+	#pragma omp critical (geogen_memory_tracker)
+	{
+		peakMemory = currentMemory;
+	}
+}
+
+MemoryTracker::Account* MemoryTracker::GetCurrentAccount()
+{
+	return currentAccount;
+}
\ No newline at end of file
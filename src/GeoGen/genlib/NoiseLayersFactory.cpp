@@ -33,5 +33,13 @@ NoiseLayers NoiseLayersFactory::CreateDefaultLayers()
 		amplitude /= 2;
 	}
 
+	return layers;
+}
+
+NoiseLayers NoiseLayersFactory::CreateDefaultSimplexLayers()
+{
+	NoiseLayers layers = CreateDefaultLayers();
+	layers.erase(layers.begin(), layers.lower_bound(4));
+
 	return layers;
 }
\ No newline at end of file
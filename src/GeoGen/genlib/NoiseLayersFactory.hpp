@@ -33,6 +33,10 @@ namespace geogen
 			NoiseLayersFactory(){};
 		public:
 			static NoiseLayers CreateDefaultLayers();
+
+			/// Creates the default layers for simplex noise. Same as CreateDefaultLayers, except for the layers with wave length shorter than 4 pixels, which would add mostly aliasing with simplex noise.
+			/// @return The layers.
+			static NoiseLayers CreateDefaultSimplexLayers();
 		};
 	}
 }
\ No newline at end of file
@@ -0,0 +1,155 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include <algorithm>
+
+#include "ResamplingKernel.hpp"
+#include "../InternalErrorException.hpp"
+
+using namespace geogen;
+using namespace genlib;
+using namespace std;
+
+const double ResamplingKernel::SNAP_DISTANCE = 0.00005;
+
+ResamplingKernel::ResamplingKernel(Size1D sourceLength, Size1D targetLength, RescaleFilter filter)
+: filter(filter), sourceLength(sourceLength), targetLength(targetLength), usedSources(sourceLength, false)
+{
+	double actualScale = (targetLength - 1) / (double)(sourceLength - 1);
+	double maxSource = double(sourceLength) - 1;
+
+	// Shrinking with the box filter averages all samples within the target pixel's footprint, otherwise it behaves as the bilinear filter.
+	RescaleFilter effectiveFilter = filter == RESCALE_FILTER_BOX && !(actualScale < 1) ? RESCALE_FILTER_BILINEAR : filter;
+	if (effectiveFilter == RESCALE_FILTER_BILINEAR)
+	{
+		this->filter = RESCALE_FILTER_BILINEAR;
+	}
+
+	double footprintRadius = 0.5 / actualScale;
+
+	this->offsets.reserve(targetLength + 1);
+	for (Size1D t = 0; t < targetLength; t++)
+	{
+		this->offsets.push_back(this->indices.size());
+
+		// Written so that NaN coordinates (in degenerate cases with single sample lines) end up on the edge as well.
+		double s = double(t / actualScale);
+		s = s > 0 ? (s < maxSource ? s : maxSource) : 0;
+
+		Size1D left = Size1D(s);
+		double fraction = s - left;
+		fraction = fraction < SNAP_DISTANCE ? 0 : fraction;
+
+		switch (effectiveFilter)
+		{
+		case RESCALE_FILTER_NEAREST:
+			this->AddSample(min(Size1D(s + 0.5), sourceLength - 1), 1);
+			break;
+		case RESCALE_FILTER_BILINEAR:
+			// The right sample is only read when actually interpolated, which keeps the edges in bounds.
+			this->AddSample(left, 1 - fraction);
+			this->AddSample(left + (fraction != 0 ? 1 : 0), fraction);
+			break;
+		case RESCALE_FILTER_BOX:
+		{
+			double from = max(s - footprintRadius, -0.5);
+			double to = min(s + footprintRadius, maxSource + 0.5);
+			Size1D first = Size1D(from + 0.5);
+			Size1D last = min(Size1D(to + 0.5), sourceLength - 1);
+			for (Size1D i = first; i <= last; i++)
+			{
+				double overlap = min(to, i + 0.5) - max(from, i - 0.5);
+				if (overlap > 0)
+				{
+					this->AddSample(i, overlap / (to - from));
+				}
+			}
+
+			break;
+		}
+		case RESCALE_FILTER_BICUBIC:
+		{
+			// Catmull-Rom spline, samples beyond the edges are replaced with the edge sample.
+			double f = fraction;
+			double sampleWeights[] = {
+				((-0.5 * f + 1) * f - 0.5) * f,
+				(1.5 * f - 2.5) * f * f + 1,
+				((-1.5 * f + 2) * f + 0.5) * f,
+				(0.5 * f - 0.5) * f * f
+			};
+
+			for (int i = 0; i < 4; i++)
+			{
+				int index = int(left) + i - 1;
+				if (sampleWeights[i] != 0)
+				{
+					this->AddSample(Size1D(min(max(index, 0), int(sourceLength) - 1)), sampleWeights[i]);
+				}
+			}
+
+			break;
+		}
+		default:
+			throw InternalErrorException(GG_STR("Invalid RescaleFilter."));
+		}
+	}
+
+	this->offsets.push_back(this->indices.size());
+}
+
+void ResamplingKernel::AddSample(Size1D index, double weight)
+{
+	this->indices.push_back(index);
+	this->weights.push_back(weight);
+	this->usedSources[index] = true;
+}
+
+void ResamplingKernel::ResampleLine(Height* output, Height const* source) const
+{
+	for (Size1D t = 0; t < this->targetLength; t++)
+	{
+		output[t] = this->Resample(source, t, 1);
+	}
+}
+
+void ResamplingKernel::ResampleAcrossLines(Height* output, unsigned count, Height const* source, Size1D stride, Size1D target) const
+{
+	// Each of the used source lines is read sequentially.
+	unsigned offset = this->offsets[target];
+	switch (this->filter)
+	{
+	case RESCALE_FILTER_NEAREST:
+		copy(source + this->indices[offset] * stride, source + this->indices[offset] * stride + count, output);
+		break;
+	case RESCALE_FILTER_BILINEAR:
+	{
+		Height const* left = source + this->indices[offset] * stride;
+		Height const* right = source + this->indices[offset + 1] * stride;
+		double fraction = this->weights[offset + 1];
+		for (unsigned i = 0; i < count; i++)
+		{
+			output[i] = Height(left[i] + (right[i] - left[i]) * fraction);
+		}
+
+		break;
+	}
+	default:
+		for (unsigned i = 0; i < count; i++)
+		{
+			output[i] = this->Resample(source + i, target, stride);
+		}
+	}
+}
\ No newline at end of file
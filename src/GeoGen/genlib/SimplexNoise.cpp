@@ -0,0 +1,142 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "SimplexNoise.hpp"
+
+using namespace std;
+using namespace geogen;
+using namespace genlib;
+using namespace random;
+
+namespace
+{
+	// Factors for skewing coordinates into the grid of triangles and back.
+	const double SKEW = 0.36602540378443864676; // (sqrt(3) - 1) / 2
+	const double UNSKEW = 0.21132486540518711775; // (3 - sqrt(3)) / 6
+
+	// Sum of contributions of the three corners with unit gradients never exceeds 1 / NORMALIZATION.
+	const double NORMALIZATION = 99.204334582718712976990005025589;
+
+	// Unit gradients in 16 evenly spaced directions.
+	const double GRADIENTS[16][2] = {
+		{ 1, 0 }, { 0.92387953251128674, 0.38268343236508977 }, { 0.70710678118654752, 0.70710678118654752 }, { 0.38268343236508977, 0.92387953251128674 },
+		{ 0, 1 }, { -0.38268343236508977, 0.92387953251128674 }, { -0.70710678118654752, 0.70710678118654752 }, { -0.92387953251128674, 0.38268343236508977 },
+		{ -1, 0 }, { -0.92387953251128674, -0.38268343236508977 }, { -0.70710678118654752, -0.70710678118654752 }, { -0.38268343236508977, -0.92387953251128674 },
+		{ 0, -1 }, { 0.38268343236508977, -0.92387953251128674 }, { 0.70710678118654752, -0.70710678118654752 }, { 0.92387953251128674, -0.38268343236508977 }
+	};
+
+	// floor for values in range of Coordinate, without the call to the library function.
+	inline Coordinate FloorToCoordinate(double value)
+	{
+		Coordinate truncated = (Coordinate)value;
+		return value < double(truncated) ? truncated - 1 : truncated;
+	}
+
+	// Contribution of a corner with gradient selected by @a hash to a point at offset [@a x, @a y] from the corner. Branch-free, so that the loops calling it can be vectorized.
+	inline double GetCornerContribution(unsigned hash, double x, double y)
+	{
+		double const* gradient = GRADIENTS[hash >> 28];
+		double falloff = std::max(0.0, 0.5 - x * x - y * y);
+		falloff *= falloff;
+
+		return falloff * falloff * (gradient[0] * x + gradient[1] * y);
+	}
+}
+
+double SimplexNoise::Evaluate(RandomSequence2D const& randomSequence, double x, double y)
+{
+	// Find the grid cell (a pair of triangles) containing the point.
+	double skew = (x + y) * SKEW;
+	Coordinate i = FloorToCoordinate(x + skew);
+	Coordinate j = FloorToCoordinate(y + skew);
+
+	// Offset of the point from the first corner of the cell, in the unskewed space.
+	double unskew = double(i + j) * UNSKEW;
+	double x0 = x - (double(i) - unskew);
+	double y0 = y - (double(j) - unskew);
+
+	// The lower triangle contains the points with x0 > y0, its middle corner is [i + 1, j], otherwise it is [i, j + 1].
+	Coordinate middleOffsetI = x0 > y0 ? 1 : 0;
+	Coordinate middleOffsetJ = 1 - middleOffsetI;
+
+	double x1 = x0 - middleOffsetI + UNSKEW;
+	double y1 = y0 - middleOffsetJ + UNSKEW;
+	double x2 = x0 - 1 + 2 * UNSKEW;
+	double y2 = y0 - 1 + 2 * UNSKEW;
+
+	double sum = 
+		GetCornerContribution(randomSequence.GetInt(Point(i, j)), x0, y0) +
+		GetCornerContribution(randomSequence.GetInt(Point(i + middleOffsetI, j + middleOffsetJ)), x1, y1) +
+		GetCornerContribution(randomSequence.GetInt(Point(i + 1, j + 1)), x2, y2);
+
+	return std::max(-1.0, std::min(1.0, sum * NORMALIZATION));
+}
+
+void SimplexNoise::EvaluateRow(RandomSequence2D const& randomSequence, double const* xs, double y, unsigned count, double* output)
+{
+	if (count == 0)
+	{
+		return;
+	}
+
+	// Columns of the grid touched by the row (the corners of a cell are in columns i and i + 1).
+	Coordinate minI = numeric_limits<Coordinate>::max();
+	Coordinate maxI = numeric_limits<Coordinate>::min();
+	for (unsigned k = 0; k < count; k++)
+	{
+		Coordinate i = FloorToCoordinate(xs[k] + (xs[k] + y) * SKEW);
+		minI = min(minI, i);
+		maxI = max(maxI, i);
+	}
+
+	// The column part of the hashes is calculated only once for the whole row (see RandomSequence2D::GetColumnHashes). Each corner then needs only the row part, which is the single Hash(columnHash, j) also used by RandomSequence2D::GetRowInts.
+	vector<unsigned> columnHashes(maxI - minI + 2);
+	randomSequence.GetColumnHashes(minI, 1, columnHashes.size(), &columnHashes[0]);
+
+	for (unsigned k = 0; k < count; k++)
+	{
+		double x = xs[k];
+
+		// The same calculation as in Evaluate, so both give exactly the same values.
+		double skew = (x + y) * SKEW;
+		Coordinate i = FloorToCoordinate(x + skew);
+		Coordinate j = FloorToCoordinate(y + skew);
+
+		double unskew = double(i + j) * UNSKEW;
+		double x0 = x - (double(i) - unskew);
+		double y0 = y - (double(j) - unskew);
+
+		Coordinate middleOffsetI = x0 > y0 ? 1 : 0;
+		Coordinate middleOffsetJ = 1 - middleOffsetI;
+
+		double x1 = x0 - middleOffsetI + UNSKEW;
+		double y1 = y0 - middleOffsetJ + UNSKEW;
+		double x2 = x0 - 1 + 2 * UNSKEW;
+		double y2 = y0 - 1 + 2 * UNSKEW;
+
+		double sum =
+			GetCornerContribution(Hash(columnHashes[i - minI], j), x0, y0) +
+			GetCornerContribution(Hash(columnHashes[i - minI + middleOffsetI], j + middleOffsetJ), x1, y1) +
+			GetCornerContribution(Hash(columnHashes[i - minI + 1], j + 1), x2, y2);
+
+		output[k] = std::max(-1.0, std::min(1.0, sum * NORMALIZATION));
+	}
+}
\ No newline at end of file
@@ -25,6 +25,15 @@ namespace geogen
 		/// Numeric pseudo-random generator seed.
 		typedef unsigned RandomSeed;
 
+		/// Versions of the scheme used to derive individual steps of a RandomSequence2D (such as layers of a noise) from its seed. Newer schemes are opt-in, so that seeds used with older versions of the generator keep producing the same maps.
+		enum RandomSeedScheme
+		{
+			/// Version 1. Each step is the next number generated by a Mersenne Twister initialized with the seed, so reaching step n requires generating n numbers.
+			RANDOM_SEED_SCHEME_SEQUENTIAL,
+			/// Version 2. Each step is a hash of the seed and the step number, so any step can be reached directly. Produces different numbers than RANDOM_SEED_SCHEME_SEQUENTIAL.
+			RANDOM_SEED_SCHEME_COUNTER
+		};
+
 		/// Creates a random seed from a number.
 		/// @param n The number.
 		/// @return The seed.
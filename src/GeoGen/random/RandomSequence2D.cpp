@@ -0,0 +1,186 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include "RandomSequence2D.hpp"
+#include "../utils/SimdSupport.hpp"
+
+using namespace geogen;
+using namespace random;
+using namespace utils;
+
+/* Hash(current, x, y) is Hash(Hash(current, x), y), where Hash(a, b) is Hash(((a * 1028385129 + b * 945191568 + 2015177)) ^ 1028385129).
+The inner hash depends only on the column, which leaves a single hash of a single number for each point of a row. */
+
+namespace
+{
+	const unsigned FACTOR_A = 1028385129;
+	const unsigned FACTOR_B = 945191568;
+	const unsigned ADDEND = 2015177;
+
+	const unsigned STEP_SALT = 2654435769u;
+
+	inline unsigned HashColumnHash(unsigned columnHash, unsigned rowAddend)
+	{
+		return Hash((columnHash * FACTOR_A + rowAddend) ^ FACTOR_A);
+	}
+
+#ifdef GEOGEN_SIMD_SSE2
+	inline __m128i MultiplyLow(__m128i a, __m128i b)
+	{
+		// SSE2 can only multiply even lanes into 64 bit results.
+		__m128i even = _mm_mul_epu32(a, b);
+		__m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+		return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+	}
+
+	inline __m128i HashColumnHashes(__m128i columnHashes, __m128i rowAddend)
+	{
+		__m128i x = _mm_xor_si128(_mm_add_epi32(MultiplyLow(columnHashes, _mm_set1_epi32(FACTOR_A)), rowAddend), _mm_set1_epi32(FACTOR_A));
+		x = MultiplyLow(_mm_xor_si128(_mm_srli_epi32(x, 16), x), _mm_set1_epi32(4256233));
+		x = MultiplyLow(_mm_xor_si128(_mm_srli_epi32(x, 16), x), _mm_set1_epi32(4256249));
+		return _mm_xor_si128(_mm_srli_epi32(x, 16), x);
+	}
+#endif
+
+#ifdef GEOGEN_SIMD_AVX2
+	GEOGEN_AVX2_TARGET unsigned HashRowAvx2(unsigned const* columnHashes, unsigned rowAddend, unsigned count, int* output)
+	{
+		__m256i rowAddendVector = _mm256_set1_epi32(rowAddend);
+		unsigned i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			__m256i x = _mm256_loadu_si256((__m256i const*)(columnHashes + i));
+			x = _mm256_xor_si256(_mm256_add_epi32(_mm256_mullo_epi32(x, _mm256_set1_epi32(FACTOR_A)), rowAddendVector), _mm256_set1_epi32(FACTOR_A));
+			x = _mm256_mullo_epi32(_mm256_xor_si256(_mm256_srli_epi32(x, 16), x), _mm256_set1_epi32(4256233));
+			x = _mm256_mullo_epi32(_mm256_xor_si256(_mm256_srli_epi32(x, 16), x), _mm256_set1_epi32(4256249));
+			_mm256_storeu_si256((__m256i*)(output + i), _mm256_xor_si256(_mm256_srli_epi32(x, 16), x));
+		}
+
+		return i;
+	}
+#endif
+
+	// Division-free remainder (D. Lemire, O. Kaser, N. Kurz: Faster Remainder by Direct Computation), exact for all 32 bit numbers and divisors. The high half of the 64 x 32 bit product is assembled from two 64 bit multiplications.
+	inline unsigned FastRemainder(unsigned number, unsigned long long magic, unsigned divisor)
+	{
+		unsigned long long lowBits = magic * number;
+		return unsigned(((lowBits >> 32) * divisor + (((lowBits & 0xFFFFFFFFu) * divisor) >> 32)) >> 32);
+	}
+}
+
+RandomSequence2D::RandomSequence2D(RandomSeed seed, RandomSeedScheme seedScheme)
+: mtRand(NULL), seed(seed), step(0), seedScheme(seedScheme)
+{
+	if (seedScheme == RANDOM_SEED_SCHEME_SEQUENTIAL)
+	{
+		this->mtRand = new mtrand::MTRand_int32(seed);
+		this->current = (*this->mtRand)();
+	}
+	else
+	{
+		this->current = Hash(seed, STEP_SALT);
+	}
+}
+
+RandomSequence2D::RandomSequence2D(RandomSeed seed, unsigned step, RandomSeedScheme seedScheme)
+: mtRand(NULL), seed(seed), step(step), seedScheme(seedScheme)
+{
+	if (seedScheme == RANDOM_SEED_SCHEME_SEQUENTIAL)
+	{
+		// The Mersenne Twister can't skip ahead, the numbers have to be generated one by one
+		this->mtRand = new mtrand::MTRand_int32(seed);
+		this->current = (*this->mtRand)();
+		for (unsigned i = 0; i < step; i++)
+		{
+			this->current = (*this->mtRand)();
+		}
+	}
+	else
+	{
+		this->current = Hash(seed, step + STEP_SALT);
+	}
+}
+
+RandomSequence2D::~RandomSequence2D()
+{
+	delete this->mtRand;
+}
+
+void RandomSequence2D::Advance()
+{
+	this->step++;
+
+	if (this->seedScheme == RANDOM_SEED_SCHEME_SEQUENTIAL)
+	{
+		this->current = (*this->mtRand)();
+	}
+	else
+	{
+		this->current = Hash(this->seed, this->step + STEP_SALT);
+	}
+}
+
+void RandomSequence2D::GetColumnHashes(Coordinate const* xs, unsigned count, unsigned* columnHashes) const
+{
+	for (unsigned i = 0; i < count; i++)
+	{
+		columnHashes[i] = Hash(this->current, xs[i]);
+	}
+}
+
+void RandomSequence2D::GetColumnHashes(Coordinate startX, Coordinate stepX, unsigned count, unsigned* columnHashes) const
+{
+	for (unsigned i = 0; i < count; i++)
+	{
+		columnHashes[i] = Hash(this->current, startX + Coordinate(i) * stepX);
+	}
+}
+
+void RandomSequence2D::GetRowInts(unsigned const* columnHashes, Coordinate y, unsigned count, int* output)
+{
+	unsigned rowAddend = unsigned(y) * FACTOR_B + ADDEND;
+
+	unsigned i = 0;
+#ifdef GEOGEN_SIMD_AVX2
+	if (IsAvx2Supported())
+	{
+		i = HashRowAvx2(columnHashes, rowAddend, count, output);
+	}
+#endif
+#ifdef GEOGEN_SIMD_SSE2
+	__m128i rowAddendVector = _mm_set1_epi32(rowAddend);
+	for (; i + 4 <= count; i += 4)
+	{
+		_mm_storeu_si128((__m128i*)(output + i), HashColumnHashes(_mm_loadu_si128((__m128i const*)(columnHashes + i)), rowAddendVector));
+	}
+#endif
+	for (; i < count; i++)
+	{
+		output[i] = HashColumnHash(columnHashes[i], rowAddend);
+	}
+}
+
+void RandomSequence2D::GetRowInts(unsigned const* columnHashes, Coordinate y, unsigned count, int min, int max, int* output)
+{
+	GetRowInts(columnHashes, y, count, output);
+
+	unsigned divisor = (unsigned)(int)(max - min + 1);
+	unsigned long long magic = ~0ull / divisor + 1;
+	for (unsigned i = 0; i < count; i++)
+	{
+		output[i] = min + int(FastRemainder((unsigned)output[i], magic, divisor));
+	}
+}
\ No newline at end of file
@@ -28,16 +28,41 @@ namespace geogen
 		class RandomSequence2D
 		{
 		private:
-			mtrand::MTRand_int32 mtRand;
+			mtrand::MTRand_int32* mtRand;
+			RandomSeed seed;
+			unsigned step;
+			RandomSeedScheme seedScheme;
 			int current;
+
+			// Non-copyable
+			RandomSequence2D(RandomSequence2D const&);
+			RandomSequence2D& operator=(RandomSequence2D const&);
 		public:
 
 			/// Constructor.
 			/// @param seed The seed.
-			RandomSequence2D(RandomSeed seed) : mtRand(seed) { this->current = this->mtRand(); }
+			/// @param seedScheme The scheme used to derive steps of the sequence from the seed.
+			RandomSequence2D(RandomSeed seed, RandomSeedScheme seedScheme = RANDOM_SEED_SCHEME_SEQUENTIAL);
+
+			/// Constructor, which creates the sequence already advanced by @a step steps. With RANDOM_SEED_SCHEME_COUNTER this takes constant time, with RANDOM_SEED_SCHEME_SEQUENTIAL it is equivalent to calling Advance @a step times.
+			/// @param seed The seed.
+			/// @param step Number of the step.
+			/// @param seedScheme The scheme used to derive steps of the sequence from the seed.
+			RandomSequence2D(RandomSeed seed, unsigned step, RandomSeedScheme seedScheme);
+
+			/// Destructor.
+			~RandomSequence2D();
 
 			/// Advances the sequence.
-			inline void Advance() { this->current = this->mtRand(); }
+			void Advance();
+
+			/// Gets number of the current step.
+			/// @return The step.
+			inline unsigned GetStep() const { return this->step; }
+
+			/// Gets the scheme used to derive steps of the sequence from the seed.
+			/// @return The seed scheme.
+			inline RandomSeedScheme GetSeedScheme() const { return this->seedScheme; }
 
 			/// Returns a number corresponding to @a point, in range <INT_MIN, INT_MAX>. Does not advance the sequence.
 			/// @param point The point.
@@ -63,6 +88,35 @@ namespace geogen
 			/// @param point The point.
 			/// @return The number.
 			inline double GetDouble(Point point) { return (double)((unsigned)this->GetInt(point)) * (1. / 4294967295.); }
+
+			/// Calculates the part of the numbers which depends only on the X coordinate, for a set of columns. The column hashes can then be used to calculate numbers for any number of rows using GetRowInts, which is much cheaper than calling GetInt for each point.
+			/// @param xs X coordinates of the columns.
+			/// @param count Number of columns.
+			/// @param columnHashes The output array, receives @a count column hashes.
+			void GetColumnHashes(Coordinate const* xs, unsigned count, unsigned* columnHashes) const;
+
+			/// Calculates the part of the numbers which depends only on the X coordinate, for columns [@a startX + i * @a stepX] (see GetColumnHashes(Coordinate const*, unsigned, unsigned*)).
+			/// @param startX X coordinate of the first column.
+			/// @param stepX Distance between two columns.
+			/// @param count Number of columns.
+			/// @param columnHashes The output array, receives @a count column hashes.
+			void GetColumnHashes(Coordinate startX, Coordinate stepX, unsigned count, unsigned* columnHashes) const;
+
+			/// Returns numbers corresponding to points on a single row, in range <INT_MIN, INT_MAX>. Gives exactly the same numbers as GetInt(Point) called for each of the points.
+			/// @param columnHashes Hashes of columns of the points, obtained from GetColumnHashes.
+			/// @param y The Y coordinate of the row.
+			/// @param count Number of points.
+			/// @param output The output array, receives @a count numbers.
+			static void GetRowInts(unsigned const* columnHashes, Coordinate y, unsigned count, int* output);
+
+			/// Returns numbers corresponding to points on a single row, in range <@a min, @a max>. Gives exactly the same numbers as GetInt(Point, int, int) called for each of the points.
+			/// @param columnHashes Hashes of columns of the points, obtained from GetColumnHashes.
+			/// @param y The Y coordinate of the row.
+			/// @param count Number of points.
+			/// @param min The minimum.
+			/// @param max The maximum.
+			/// @param output The output array, receives @a count numbers.
+			static void GetRowInts(unsigned const* columnHashes, Coordinate y, unsigned count, int min, int max, int* output);
 		};
 	}
 }
\ No newline at end of file
@@ -0,0 +1,139 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include <algorithm>
+
+#include "ProgressiveRenderer.hpp"
+#include "../ApiUsageException.hpp"
+#include "../runtime/ScriptParameters.hpp"
+
+using namespace std;
+using namespace geogen;
+using namespace renderer;
+
+ProgressiveRenderer::ProgressiveRenderer(RenderingSequence const& renderingSequence, unsigned levelCount, Configuration configuration)
+: renderingSequence(renderingSequence), configuration(configuration), currentLevel(0), currentRenderer(NULL), finishedRenderer(NULL)
+{
+	if (levelCount == 0)
+	{
+		throw ApiUsageException(GG_STR("Level count must be greater than 0."));
+	}
+
+	// A sequence generated for a specific render scale can't be rendered at any other scale.
+	if (renderingSequence.IsRenderScaleDependent())
+	{
+		levelCount = 1;
+	}
+
+	Scale scale = renderingSequence.GetRenderScale();
+	for (unsigned i = 0; i < levelCount && scale >= runtime::RENDER_SCALE_MIN; i++)
+	{
+		this->levelScales.push_back(scale);
+		scale /= 2;
+	}
+
+	reverse(this->levelScales.begin(), this->levelScales.end());
+
+	this->StartLevel();
+}
+
+ProgressiveRenderer::~ProgressiveRenderer()
+{
+	delete this->currentRenderer;
+	delete this->finishedRenderer;
+}
+
+void ProgressiveRenderer::StartLevel()
+{
+	this->currentRenderer = new Renderer(this->renderingSequence, this->levelScales[this->currentLevel], this->configuration);
+	this->currentRenderer->CalculateMetadata();
+}
+
+RenderedMapTable& ProgressiveRenderer::GetRenderedMapTable()
+{
+	if (this->finishedRenderer == NULL)
+	{
+		throw ApiUsageException(GG_STR("No level was finished yet."));
+	}
+
+	return this->finishedRenderer->GetRenderedMapTable();
+}
+
+RendererStepResult ProgressiveRenderer::Step()
+{
+	if (this->IsFinished())
+	{
+		return RENDERER_STEP_RESULT_FINISHED;
+	}
+
+	if (this->currentRenderer->Step() == RENDERER_STEP_RESULT_FINISHED)
+	{
+		// Maps of the previous level are replaced by the finer ones.
+		delete this->finishedRenderer;
+		this->finishedRenderer = this->currentRenderer;
+		this->currentRenderer = NULL;
+		this->currentLevel++;
+
+		if (this->IsFinished())
+		{
+			return RENDERER_STEP_RESULT_FINISHED;
+		}
+
+		this->StartLevel();
+	}
+
+	return RENDERER_STEP_RESULT_RUNNING;
+}
+
+void ProgressiveRenderer::RunLevel()
+{
+	unsigned level = this->currentLevel;
+	while (!this->IsFinished() && this->currentLevel == level)
+	{
+		this->Step();
+	}
+}
+
+void ProgressiveRenderer::Run()
+{
+	while (!this->IsFinished())
+	{
+		this->Step();
+	}
+}
+
+double ProgressiveRenderer::GetProgress() const
+{
+	// Cost of each level is proportional to its pixel count, which grows with square of the scale.
+	double total = 0;
+	double done = 0;
+	for (unsigned i = 0; i < this->levelScales.size(); i++)
+	{
+		double cost = this->levelScales[i] * this->levelScales[i];
+		total += cost;
+
+		if (i < this->currentLevel)
+		{
+			done += cost;
+		}
+		else if (i == this->currentLevel)
+		{
+			done += cost * this->currentRenderer->GetProgress() / 100;
+		}
+	}
+
+	return done * 100 / total;
+}
\ No newline at end of file
@@ -15,12 +15,16 @@ You should have received a copy of the GNU General Public License
 along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 
 #include <numeric>
+#include <algorithm>
 
 #include "Renderer.hpp"
 #include "../InternalErrorException.hpp"
 #include "RenderingStep.hpp"
 #include "RenderingBounds.hpp"
 #include "MemoryLimitException.hpp"
+#include "../CancellationException.hpp"
+#include "../ApiUsageException.hpp"
+#include "../runtime/ScriptParameters.hpp"
 
 using namespace std;
 using namespace geogen;
@@ -29,10 +33,33 @@ using namespace renderer;
 const String Renderer::MAP_NAME_MAIN = GG_STR("main");
 
 Renderer::Renderer(RenderingSequence const& renderingSequence, Configuration configuration)
-: configuration(configuration), renderingSequence(renderingSequence), nextStep(renderingSequence.Begin()), objectTable(renderingSequence.GetRequiredObjectTableSize()), status(RENDERER_STATUS_READY), renderingSequenceMetadata(renderingSequence), graph(renderingSequence), stepCounter(0)
+: configuration(configuration), renderingSequence(renderingSequence), nextStep(renderingSequence.Begin()), objectTable(renderingSequence.GetRequiredObjectTableSize()), status(RENDERER_STATUS_READY), renderingSequenceMetadata(renderingSequence), graph(renderingSequence), stepCounter(0), isRenderRectangleOverridden(false), renderScale(renderingSequence.GetRenderScale()), cancellationToken(NULL)
 {
 }
 
+Renderer::Renderer(RenderingSequence const& renderingSequence, Rectangle renderRectangle, Configuration configuration)
+: configuration(configuration), renderingSequence(renderingSequence), nextStep(renderingSequence.Begin()), objectTable(renderingSequence.GetRequiredObjectTableSize()), status(RENDERER_STATUS_READY), renderingSequenceMetadata(renderingSequence), graph(renderingSequence), stepCounter(0), isRenderRectangleOverridden(true), renderRectangleOverride(renderRectangle), renderScale(renderingSequence.GetRenderScale()), cancellationToken(NULL)
+{
+	if (renderingSequence.IsRenderRectangleDependent())
+	{
+		throw ApiUsageException(GG_STR("The rendering sequence depends on the render rectangle it was generated with and can't be rendered into a different one."));
+	}
+}
+
+Renderer::Renderer(RenderingSequence const& renderingSequence, Scale renderScale, Configuration configuration)
+: configuration(configuration), renderingSequence(renderingSequence), nextStep(renderingSequence.Begin()), objectTable(renderingSequence.GetRequiredObjectTableSize()), status(RENDERER_STATUS_READY), renderingSequenceMetadata(renderingSequence), graph(renderingSequence), stepCounter(0), isRenderRectangleOverridden(false), renderScale(renderScale), cancellationToken(NULL)
+{
+	if (renderingSequence.IsRenderScaleDependent() && renderScale != renderingSequence.GetRenderScale())
+	{
+		throw ApiUsageException(GG_STR("The rendering sequence depends on the render scale it was generated with and can't be rendered at a different one."));
+	}
+
+	if (renderScale < runtime::RENDER_SCALE_MIN || renderScale > runtime::RENDER_SCALE_MAX)
+	{
+		throw ApiUsageException(GG_STR("Render scale out of range."));
+	}
+}
+
 RendererStepResult Renderer::Step()
 {
 	if (this->nextStep == this->renderingSequence.End())
@@ -41,12 +68,46 @@ RendererStepResult Renderer::Step()
 		return RENDERER_STEP_RESULT_FINISHED;
 	}
 
+	// Covers the observers and the release of objects no longer needed too, so the account sees all memory changes caused by the step.
+	genlib::MemoryTracker::AccountScope memoryAccountScope(&this->memoryAccount);
+
 	if (this->configuration.RendererMemoryLimit < this->GetRenderingSequenceMetadata().GetMemoryRequirement(*this->nextStep))
 	{
 		throw MemoryLimitException((*this->nextStep)->GetLocation(), this->configuration.RendererMemoryLimit, this->GetRenderingSequenceMetadata().GetMemoryRequirement(*this->nextStep));
 	}
 
-	(*this->nextStep)->Step(this);
+	if (this->cancellationToken != NULL)
+	{
+		this->cancellationToken->ThrowIfCancelled();
+	}
+
+	for (vector<RendererObserver*>::iterator it = this->observers.begin(); it != this->observers.end(); it++)
+	{
+		(*it)->BeforeStep(*this, *this->nextStep);
+	}
+
+	try
+	{
+		genlib::CancellationToken::Scope cancellationScope(this->cancellationToken);
+		(*this->nextStep)->Step(this);
+	}
+	catch (CancellationException&)
+	{
+		// The interrupted step may have left its objects in an unspecified state, so the render can't continue.
+		for (unsigned slot = 0; slot < this->objectTable.GetSize(); slot++)
+		{
+			this->objectTable.ReleaseObject(slot);
+		}
+
+		this->renderedMapTable.Clear();
+		this->status = RENDERER_STATUS_FAULTED;
+		throw;
+	}
+
+	for (vector<RendererObserver*>::iterator it = this->observers.begin(); it != this->observers.end(); it++)
+	{
+		(*it)->AfterStep(*this, *this->nextStep);
+	}
 
 	// Release objects that won't be required by any future steps
 	vector<unsigned> const& objectsToRelease = this->GetRenderingSequenceMetadata().GetObjectIndexesToRelease(*this->nextStep);
@@ -75,6 +136,16 @@ void Renderer::Run()
 	}
 }
 
+void Renderer::AddObserver(RendererObserver* observer)
+{
+	this->observers.push_back(observer);
+}
+
+void Renderer::RemoveObserver(RendererObserver* observer)
+{
+	this->observers.erase(std::remove(this->observers.begin(), this->observers.end(), observer), this->observers.end());
+}
+
 void Renderer::CalculateMetadata()
 {
 	this->CalculateRenderingBounds();
@@ -114,6 +185,13 @@ void Renderer::CalculateObjectLifetimes()
 				isObjectAlive[*it2] = false;
 			}
 		}
+
+		// A step which creates a new object in a slot (instead of modifying one of its arguments) ends lifetime of the slot's previous occupant, whose last use is found further back.
+		unsigned returnSlot = (*it)->GetReturnSlot();
+		if (std::find((*it)->GetArgumentSlots().begin(), (*it)->GetArgumentSlots().end(), returnSlot) == (*it)->GetArgumentSlots().end())
+		{
+			isObjectAlive[returnSlot] = true;
+		}
 	}
 }
 
@@ -123,6 +201,9 @@ void Renderer::CalculateMemoryRequirements()
 	vector<bool> isObjectAlive(this->GetObjectTable().GetSize(), false);
 	vector<RenderingBounds*> currentBounds(this->GetObjectTable().GetSize(), NULL);
 
+	// Memory allocated by steps outside of the object table (eg. rendered maps), which stays allocated until the end
+	unsigned retainedMemory = 0;
+
 	for (RenderingSequence::const_iterator it = this->renderingSequence.Begin(); it != this->renderingSequence.End(); it++)
 	{
 		RenderingStep const* step = *it;
@@ -143,13 +224,20 @@ void Renderer::CalculateMemoryRequirements()
 		// Memory that will be required by this step beyond the memory allocated by pre-existing renderer objects
 		unsigned stepExtraMemory = (*it)->GetPeakExtraMemory(this, argumentBounds);
 
-		this->GetRenderingSequenceMetadata().SetMemoryRequirement(step, currentAllocatedSum + stepExtraMemory);
+		// Memory retained by this step, unless it is shared with an argument released after the step (which already accounts for it until then)
+		unsigned stepRetainedMemory = step->GetRetainedMemory(this);
+		unsigned stepUnsharedRetainedMemory = step->IsRetainedMemoryShared(this, argumentBounds) ? 0 : stepRetainedMemory;
+
+		this->GetRenderingSequenceMetadata().SetMemoryRequirement(step, currentAllocatedSum + retainedMemory + stepUnsharedRetainedMemory + stepExtraMemory);
+
+		retainedMemory += stepRetainedMemory;
 
 		// Calculate return object's size and memory requirements
 		if (!isObjectAlive[returnSlot])
 		{
-			// Initial bounds are based on the pre-calculated rendering bounds, later they may diverge
-			currentBounds[returnSlot] = this->GetRenderingSequenceMetadata().GetRenderingBounds(step);
+			// Initial bounds are based on the pre-calculated rendering bounds, later they may diverge. They are copied, because the step itself renders according to its pre-calculated bounds, which must not be affected by the simulation.
+			delete currentBounds[returnSlot];
+			currentBounds[returnSlot] = this->GetRenderingSequenceMetadata().GetRenderingBounds(step)->Clone();
 			isObjectAlive[returnSlot] = true;
 		}
 		else 
@@ -158,7 +246,7 @@ void Renderer::CalculateMemoryRequirements()
 			step->SimulateOnRenderingBounds(currentBounds[returnSlot]);
 		}
 
-		allocatedMemoryPerSlot[returnSlot] = currentBounds[returnSlot]->GetMemorySize(this->GetRenderingSequence().GetRenderScale());
+		allocatedMemoryPerSlot[returnSlot] = currentBounds[returnSlot]->GetMemorySize(this->GetRenderScale());
 
 		// Released objects don't occupy any memory any more
 		for (vector<unsigned>::iterator it2 = currentStepObjectIndexesToRelease.begin(); it2 != currentStepObjectIndexesToRelease.end(); it2++)
@@ -167,6 +255,11 @@ void Renderer::CalculateMemoryRequirements()
 			isObjectAlive[*it2] = false;
 		}
 	}
+
+	for (vector<RenderingBounds*>::iterator it = currentBounds.begin(); it != currentBounds.end(); it++)
+	{
+		delete *it;
+	}
 }
 
 
@@ -19,12 +19,16 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 #include <vector>
 
 #include "../Point.hpp"
+#include "../Rectangle.hpp"
 #include "../Configuration.hpp"
 #include "RenderingSequence.hpp"
 #include "RendererObjectTable.hpp"
 #include "RenderingSequenceMetadata.hpp"
 #include "RenderingGraph.hpp"
 #include "RenderedMapTable.hpp"
+#include "RendererObserver.hpp"
+#include "../genlib/CancellationToken.hpp"
+#include "../genlib/MemoryTracker.hpp"
 
 namespace geogen
 {
@@ -70,6 +74,16 @@ namespace geogen
 
 			unsigned stepCounter;
 
+			bool isRenderRectangleOverridden;
+			Rectangle renderRectangleOverride;
+
+			Scale renderScale;
+
+			std::vector<RendererObserver*> observers;
+
+			genlib::CancellationToken const* cancellationToken;
+			genlib::MemoryTracker::Account memoryAccount;
+
 			// Non-copyable
 			Renderer(Renderer const&) : renderingSequence(*(RenderingSequence*)NULL), objectTable(0), renderingSequenceMetadata(*(RenderingSequence*)NULL), graph(*(RenderingSequence*)NULL), configuration(Configuration()) {};
 			Renderer& operator=(Renderer const&) {};
@@ -81,6 +95,26 @@ namespace geogen
 			/// rendering sequence must exist for whole life of the renderer.
 			Renderer(RenderingSequence const& renderingSequence, Configuration configuration = Configuration());
 
+			/// Initializes a new instance of the Renderer class which renders the sequence into a different render
+			/// rectangle than the one it was generated with. This allows one rendering sequence to be rendered into
+			/// many tiles of the same map without running the script again.
+			/// @param renderingSequence The rendering sequence to be rendered with this instance. The
+			/// rendering sequence must exist for whole life of the renderer and must not be dependent on the render
+			/// rectangle (see RenderingSequence::IsRenderRectangleDependent).
+			/// @param renderRectangle The render rectangle, typically obtained using runtime::ScriptParameters::GetActualRenderRectangle.
+			/// All other script parameters must be identical to the ones the sequence was generated with.
+			Renderer(RenderingSequence const& renderingSequence, Rectangle renderRectangle, Configuration configuration = Configuration());
+
+			/// Initializes a new instance of the Renderer class which renders the sequence at a different render
+			/// scale than the one it was generated with. This allows one rendering sequence to be rendered at several
+			/// levels of detail (see ProgressiveRenderer) without running the script again.
+			/// @param renderingSequence The rendering sequence to be rendered with this instance. The
+			/// rendering sequence must exist for whole life of the renderer and must not be dependent on the render
+			/// scale (see RenderingSequence::IsRenderScaleDependent).
+			/// @param renderScale The render scale, must be in range RENDER_SCALE_MIN, RENDER_SCALE_MAX.
+			/// All other script parameters must be identical to the ones the sequence was generated with.
+			Renderer(RenderingSequence const& renderingSequence, Scale renderScale, Configuration configuration = Configuration());
+
 			/// Gets the status of the Renderer.
 			/// @return The status.
 			inline RendererStatus GetStatus() const { return this->status; }
@@ -121,6 +155,47 @@ namespace geogen
 			/// @return The rendered map table.
 			inline RenderedMapTable& GetRenderedMapTable() { return this->renderedMapTable; }
 
+			/// Determines whether the render rectangle the sequence was generated with is overridden by this renderer.
+			/// @return True if the render rectangle is overridden.
+			inline bool IsRenderRectangleOverridden() const { return this->isRenderRectangleOverridden; }
+
+			/// Gets the render rectangle overriding the one the sequence was generated with. Only valid if IsRenderRectangleOverridden returns true.
+			/// @return The render rectangle.
+			inline Rectangle GetRenderRectangleOverride() const { return this->renderRectangleOverride; }
+
+			/// Gets the scale at which the sequence is rendered. Same as scale of the rendering sequence, unless overridden.
+			/// @return The render scale.
+			inline Scale GetRenderScale() const { return this->renderScale; }
+
+			/// Scales a size by the render scale.
+			/// @param size The size.
+			/// @return The scaled size.
+			inline Size1D GetScaledSize(Size1D size) const { return Size1D(size * this->renderScale); }
+
+			/// Gets the number of steps executed so far.
+			/// @return The number of executed steps.
+			inline unsigned GetStepCounter() const { return this->stepCounter; }
+
+			/// Adds an observer, which will be notified before and after each executed step. Observers are notified in order in which they were added.
+			/// @param observer The observer. The renderer does not assume ownership of this pointer.
+			void AddObserver(RendererObserver* observer);
+
+			/// Removes an observer previously added using AddObserver.
+			/// @param observer The observer.
+			void RemoveObserver(RendererObserver* observer);
+
+			/// Gets the cancellation token checked by the renderer.
+			/// @return The token or NULL if the render can't be cancelled.
+			inline genlib::CancellationToken const* GetCancellationToken() const { return this->cancellationToken; }
+
+			/// Sets a token which allows to cancel the render from another thread or after a deadline. The token is checked before each step and by long running operations within the steps. If it is cancelled, Step throws CancellationException. If that happens before the step started, the renderer can continue once the token is reset, otherwise it releases all its objects and rendered maps and switches to status RENDERER_STATUS_FAULTED.
+			/// @param cancellationToken The token or NULL. The renderer does not assume ownership of this pointer.
+			inline void SetCancellationToken(genlib::CancellationToken const* cancellationToken) { this->cancellationToken = cancellationToken; }
+
+			/// Gets the account of memory allocated and released by the renderer's steps. It is assigned to the thread executing each step (see genlib::MemoryTracker::AccountScope), so it only counts memory of this renderer even if other renderers run at the same time.
+			/// @return The account.
+			inline genlib::MemoryTracker::Account& GetMemoryAccount() { return this->memoryAccount; }
+
 			/// Gets rendering sequence graph.
 			/// @return The rendering graph.
 			inline RenderingGraph& GetRenderingGraph() { return this->graph; }
@@ -0,0 +1,166 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include "RendererMetrics.hpp"
+#include "Renderer.hpp"
+#include "RenderingStep.hpp"
+#include "RenderingBounds.hpp"
+#include "../utils/WallClock.hpp"
+#include "../utils/CpuClock.hpp"
+#include "../utils/StringUtils.hpp"
+#include "../genlib/MemoryTracker.hpp"
+
+using namespace std;
+using namespace geogen;
+using namespace renderer;
+using namespace utils;
+using namespace genlib;
+
+RendererMetrics::RendererMetrics()
+{
+	this->Reset();
+}
+
+void RendererMetrics::BeforeStep(Renderer& renderer, RenderingStep const* step)
+{
+	this->stepStartMemory = renderer.GetObjectTable().GetMemorySize();
+
+	renderer.GetMemoryAccount().ResetPeakMemory();
+	this->stepStartCpuTime = GetProcessCpuMicroseconds();
+	this->stepStartTime = GetWallClockMicroseconds();
+}
+
+void RendererMetrics::AfterStep(Renderer& renderer, RenderingStep const* step)
+{
+	unsigned long long endTime = GetWallClockMicroseconds();
+	unsigned long long endCpuTime = GetProcessCpuMicroseconds();
+	unsigned long long endMemory = renderer.GetObjectTable().GetMemorySize();
+
+	RenderingBounds const* bounds = renderer.GetRenderingSequenceMetadata().GetRenderingBounds(step);
+
+	RendererStepMetrics metrics;
+	metrics.StepNumber = renderer.GetStepCounter();
+	metrics.StepName = step->GetName();
+	metrics.StartTime = this->stepStartTime - this->originTime;
+	metrics.WallTime = endTime - this->stepStartTime;
+	metrics.CpuTime = endCpuTime - this->stepStartCpuTime;
+	metrics.PixelCount = bounds != NULL ? bounds->GetPixelCount(renderer.GetRenderScale()) : 0;
+	metrics.AllocatedMemory = endMemory > this->stepStartMemory ? endMemory - this->stepStartMemory : 0;
+	metrics.LiveMemory = endMemory;
+	metrics.PredictedMemory = renderer.GetRenderingSequenceMetadata().GetMemoryRequirement(step);
+	metrics.PeakMemory = renderer.GetMemoryAccount().GetPeakMemory();
+	metrics.Mispredicted = metrics.PeakMemory > metrics.PredictedMemory;
+	this->steps.push_back(metrics);
+
+	RendererStepTypeMetrics& typeMetrics = this->stepTypes[metrics.StepName];
+	typeMetrics.Count++;
+	typeMetrics.WallTime += metrics.WallTime;
+	typeMetrics.CpuTime += metrics.CpuTime;
+	typeMetrics.PixelCount += metrics.PixelCount;
+	typeMetrics.AllocatedMemory += metrics.AllocatedMemory;
+	typeMetrics.PeakLiveMemory = max(typeMetrics.PeakLiveMemory, metrics.LiveMemory);
+	typeMetrics.PeakMemory = max(typeMetrics.PeakMemory, metrics.PeakMemory);
+	typeMetrics.MispredictionCount += metrics.Mispredicted ? 1 : 0;
+
+	this->peakLiveMemory = max(this->peakLiveMemory, metrics.LiveMemory);
+	this->peakMemory = max(this->peakMemory, metrics.PeakMemory);
+	this->mispredictionCount += metrics.Mispredicted ? 1 : 0;
+}
+
+void RendererMetrics::Reset()
+{
+	this->steps.clear();
+	this->stepTypes.clear();
+	this->peakLiveMemory = 0;
+	this->peakMemory = 0;
+	this->mispredictionCount = 0;
+	this->originTime = GetWallClockMicroseconds();
+	this->stepStartTime = this->originTime;
+	this->stepStartCpuTime = 0;
+	this->stepStartMemory = 0;
+}
+
+void RendererMetrics::WriteJson(OStream& stream) const
+{
+	stream << GG_STR("{") << endl;
+	stream << GG_STR("\t\"peakLiveMemory\": ") << this->peakLiveMemory << GG_STR(",") << endl;
+	stream << GG_STR("\t\"peakMemory\": ") << this->peakMemory << GG_STR(",") << endl;
+	stream << GG_STR("\t\"mispredictions\": ") << this->mispredictionCount << GG_STR(",") << endl;
+
+	stream << GG_STR("\t\"stepTypes\": {") << endl;
+	for (StepTypeMetricsMap::const_iterator it = this->stepTypes.begin(); it != this->stepTypes.end(); it++)
+	{
+		stream << (it == this->stepTypes.begin() ? GG_STR("") : GG_STR(",\n"));
+		stream << GG_STR("\t\t\"") << EscapeJsonString(it->first) << GG_STR("\": { ")
+			<< GG_STR("\"count\": ") << it->second.Count
+			<< GG_STR(", \"wallTime\": ") << it->second.WallTime
+			<< GG_STR(", \"cpuTime\": ") << it->second.CpuTime
+			<< GG_STR(", \"pixels\": ") << it->second.PixelCount
+			<< GG_STR(", \"allocatedMemory\": ") << it->second.AllocatedMemory
+			<< GG_STR(", \"peakLiveMemory\": ") << it->second.PeakLiveMemory
+			<< GG_STR(", \"peakMemory\": ") << it->second.PeakMemory
+			<< GG_STR(", \"mispredictions\": ") << it->second.MispredictionCount << GG_STR(" }");
+	}
+
+	stream << endl << GG_STR("\t},") << endl;
+
+	stream << GG_STR("\t\"steps\": [") << endl;
+	for (vector<RendererStepMetrics>::const_iterator it = this->steps.begin(); it != this->steps.end(); it++)
+	{
+		stream << (it == this->steps.begin() ? GG_STR("") : GG_STR(",\n"));
+		stream << GG_STR("\t\t{ \"step\": ") << it->StepNumber
+			<< GG_STR(", \"name\": \"") << EscapeJsonString(it->StepName) << GG_STR("\"")
+			<< GG_STR(", \"start\": ") << it->StartTime
+			<< GG_STR(", \"wallTime\": ") << it->WallTime
+			<< GG_STR(", \"cpuTime\": ") << it->CpuTime
+			<< GG_STR(", \"pixels\": ") << it->PixelCount
+			<< GG_STR(", \"allocatedMemory\": ") << it->AllocatedMemory
+			<< GG_STR(", \"liveMemory\": ") << it->LiveMemory
+			<< GG_STR(", \"predictedMemory\": ") << it->PredictedMemory
+			<< GG_STR(", \"peakMemory\": ") << it->PeakMemory
+			<< GG_STR(", \"mispredicted\": ") << (it->Mispredicted ? GG_STR("true") : GG_STR("false")) << GG_STR(" }");
+	}
+
+	stream << endl << GG_STR("\t]") << endl;
+	stream << GG_STR("}") << endl;
+}
+
+void RendererMetrics::WriteChromeTrace(OStream& stream) const
+{
+	stream << GG_STR("{ \"displayTimeUnit\": \"ms\", \"traceEvents\": [") << endl;
+	for (vector<RendererStepMetrics>::const_iterator it = this->steps.begin(); it != this->steps.end(); it++)
+	{
+		// A complete event for the step itself, followed by counter events with the live memory after it and the predicted and actual peak memory during it.
+		stream << (it == this->steps.begin() ? GG_STR("") : GG_STR(",\n"));
+		stream << GG_STR("\t{ \"name\": \"") << EscapeJsonString(it->StepName) << GG_STR("\", \"cat\": \"render\", \"ph\": \"X\", \"pid\": 1, \"tid\": 1")
+			<< GG_STR(", \"ts\": ") << it->StartTime
+			<< GG_STR(", \"dur\": ") << it->WallTime
+			<< GG_STR(", \"args\": { \"step\": ") << it->StepNumber
+			<< GG_STR(", \"cpuTime\": ") << it->CpuTime
+			<< GG_STR(", \"pixels\": ") << it->PixelCount
+			<< GG_STR(", \"allocatedMemory\": ") << it->AllocatedMemory
+			<< GG_STR(", \"mispredicted\": ") << (it->Mispredicted ? GG_STR("true") : GG_STR("false")) << GG_STR(" } },") << endl;
+		stream << GG_STR("\t{ \"name\": \"Live memory\", \"ph\": \"C\", \"pid\": 1")
+			<< GG_STR(", \"ts\": ") << it->StartTime + it->WallTime
+			<< GG_STR(", \"args\": { \"bytes\": ") << it->LiveMemory << GG_STR(" } },") << endl;
+		stream << GG_STR("\t{ \"name\": \"Peak memory\", \"ph\": \"C\", \"pid\": 1")
+			<< GG_STR(", \"ts\": ") << it->StartTime
+			<< GG_STR(", \"args\": { \"predicted\": ") << it->PredictedMemory
+			<< GG_STR(", \"actual\": ") << it->PeakMemory << GG_STR(" } }");
+	}
+
+	stream << endl << GG_STR("] }") << endl;
+}
\ No newline at end of file
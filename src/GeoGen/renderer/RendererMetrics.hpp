@@ -0,0 +1,159 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include "../String.hpp"
+#include "RendererObserver.hpp"
+
+namespace geogen
+{
+	namespace renderer
+	{
+		/// Metrics of a single executed RenderingStep, collected by RendererMetrics.
+		struct RendererStepMetrics
+		{
+			/// Position of the step in the rendering sequence.
+			unsigned StepNumber;
+
+			/// Name of the step type (see RenderingStep::GetName).
+			String StepName;
+
+			/// Wall time at which the step started, in microseconds since the RendererMetrics was created or reset.
+			unsigned long long StartTime;
+
+			/// Wall time spent, in microseconds.
+			unsigned long long WallTime;
+
+			/// CPU time spent by all threads, in microseconds.
+			unsigned long long CpuTime;
+
+			/// Number of pixels of the step's rendering bounds.
+			unsigned long long PixelCount;
+
+			/// Growth of memory occupied by renderer objects caused by the step, in bytes.
+			unsigned long long AllocatedMemory;
+
+			/// Memory occupied by all renderer objects right after the step, in bytes.
+			unsigned long long LiveMemory;
+
+			/// Peak memory predicted for the step by RenderingSequenceMetadata::GetMemoryRequirement, in bytes.
+			unsigned long long PredictedMemory;
+
+			/// Peak of memory actually allocated during the step (as measured by the renderer's genlib::MemoryTracker::Account) by the renderer's objects, the maps it has rendered and temporary buffers of the step, in bytes.
+			unsigned long long PeakMemory;
+
+			/// Whether PeakMemory exceeded PredictedMemory.
+			bool Mispredicted;
+		};
+
+		/// Metrics of all executed steps of a single type, collected by RendererMetrics.
+		struct RendererStepTypeMetrics
+		{
+			/// Number of executed steps.
+			unsigned long long Count;
+
+			/// Wall time spent, in microseconds.
+			unsigned long long WallTime;
+
+			/// CPU time spent by all threads, in microseconds.
+			unsigned long long CpuTime;
+
+			/// Number of pixels of rendering bounds of all the steps.
+			unsigned long long PixelCount;
+
+			/// Growth of memory occupied by renderer objects caused by the steps, in bytes.
+			unsigned long long AllocatedMemory;
+
+			/// Maximum memory occupied by all renderer objects right after any of the steps, in bytes.
+			unsigned long long PeakLiveMemory;
+
+			/// Maximum of actually allocated memory during any of the steps (see RendererStepMetrics::PeakMemory), in bytes.
+			unsigned long long PeakMemory;
+
+			/// Number of steps whose actual peak memory exceeded the predicted one.
+			unsigned long long MispredictionCount;
+
+			/// Constructs an empty entry.
+			RendererStepTypeMetrics() : Count(0), WallTime(0), CpuTime(0), PixelCount(0), AllocatedMemory(0), PeakLiveMemory(0), PeakMemory(0), MispredictionCount(0) {};
+		};
+
+		/// Renderer observer which records wall time, CPU time, pixels touched and memory of each executed step and aggregates them by step type. Assign it to a Renderer using Renderer::AddObserver. A single instance can collect metrics of multiple renders.
+		///
+		/// Actual peak memory is measured by the memory account of the observed renderer (see Renderer::GetMemoryAccount), so it isn't affected by other renderers running at the same time.
+		class RendererMetrics : public RendererObserver
+		{
+		public:
+			/// Map of step type metrics keyed by step name.
+			typedef std::map<String, RendererStepTypeMetrics> StepTypeMetricsMap;
+		private:
+			std::vector<RendererStepMetrics> steps;
+			StepTypeMetricsMap stepTypes;
+			unsigned long long peakLiveMemory;
+			unsigned long long peakMemory;
+			unsigned long long mispredictionCount;
+
+			unsigned long long originTime;
+			unsigned long long stepStartTime;
+			unsigned long long stepStartCpuTime;
+			unsigned long long stepStartMemory;
+
+			// Non-copyable
+			RendererMetrics(RendererMetrics const&) {};
+			RendererMetrics& operator=(RendererMetrics const&) {};
+		public:
+			/// Constructs a collector with no collected data.
+			RendererMetrics();
+
+			virtual void BeforeStep(Renderer& renderer, RenderingStep const* step);
+			virtual void AfterStep(Renderer& renderer, RenderingStep const* step);
+
+			/// Gets metrics of individual executed steps, in order of execution.
+			/// @return The step metrics.
+			inline std::vector<RendererStepMetrics> const& GetSteps() const { return this->steps; };
+
+			/// Gets metrics aggregated by step type.
+			/// @return The step type metrics.
+			inline StepTypeMetricsMap const& GetStepTypes() const { return this->stepTypes; };
+
+			/// Gets maximum memory occupied by renderer objects after any of the executed steps.
+			/// @return The memory size, in bytes.
+			inline unsigned long long GetPeakLiveMemory() const { return this->peakLiveMemory; };
+
+			/// Gets maximum memory actually allocated during any of the executed steps (see RendererStepMetrics::PeakMemory).
+			/// @return The memory size, in bytes.
+			inline unsigned long long GetPeakMemory() const { return this->peakMemory; };
+
+			/// Gets number of executed steps whose actual peak memory exceeded the predicted one.
+			/// @return The step count.
+			inline unsigned long long GetMispredictionCount() const { return this->mispredictionCount; };
+
+			/// Discards all collected data.
+			void Reset();
+
+			/// Writes the step type metrics and metrics of individual steps as a JSON document.
+			/// @param stream The output stream.
+			void WriteJson(OStream& stream) const;
+
+			/// Writes the individual steps in the Chrome trace event format (viewable in chrome://tracing or Perfetto), with live memory as a counter.
+			/// @param stream The output stream.
+			void WriteChromeTrace(OStream& stream) const;
+		};
+	}
+}
\ No newline at end of file
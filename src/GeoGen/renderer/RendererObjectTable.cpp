@@ -60,6 +60,20 @@ void RendererObjectTable::ReleaseObject(unsigned slot)
 	this->table[slot] = NULL;
 }
 
+unsigned long long RendererObjectTable::GetMemorySize() const
+{
+	unsigned long long memorySize = 0;
+	for (std::vector<RendererObject*>::const_iterator it = this->table.begin(); it != this->table.end(); it++)
+	{
+		if (*it != NULL)
+		{
+			memorySize += (*it)->GetPtr()->GetMemorySize();
+		}
+	}
+
+	return memorySize;
+}
+
 void RendererObjectTable::Serialize(IOStream& stream) const
 {
 	int i = 0;
@@ -74,6 +74,10 @@ namespace geogen
 			/// @param slot The slot.
 			void ReleaseObject(unsigned slot);
 
+			/// Gets the total memory occupied by all objects currently stored in the table.
+			/// @return The memory size, in bytes.
+			unsigned long long GetMemorySize() const;
+
 			void Serialize(IOStream& stream) const;
 		};
 	}
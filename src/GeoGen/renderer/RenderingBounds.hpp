@@ -27,10 +27,15 @@ namespace geogen
 		class RenderingBounds: public Serializable
 		{
 		private:
+			RenderingStepType renderingStepType;
+		protected:
+			RenderingBounds(RenderingStepType renderingStepType) : renderingStepType(renderingStepType) {}
 		public:
-			/// Gets the type of the rendering step to which this object is associated. Indicates the specific derived type of this instance.
+			virtual ~RenderingBounds() {}
+
+			/// Gets the type of the rendering step to which this object is associated. Indicates the specific derived type of this instance (which is why it isn't virtual, so the derived types can be cast to without RTTI, see RenderingBounds1D::Cast and RenderingBounds2D::Cast).
 			/// @return The rendering step type.
-			virtual RenderingStepType GetRenderingStepType() const = 0;
+			inline RenderingStepType GetRenderingStepType() const { return this->renderingStepType; }
 
 			/// Gets the number of bytes that will be required to allocate object of size specified by these
 			/// bounds.
@@ -38,6 +43,15 @@ namespace geogen
 			/// @return The memory size, in bytes.
 			virtual unsigned GetMemorySize(Scale scale) const = 0;
 
+			/// Gets the number of pixels of an object of size specified by these bounds.
+			/// @param scale The scale.
+			/// @return The number of pixels.
+			virtual unsigned long long GetPixelCount(Scale scale) const = 0;
+
+			/// Creates a copy of these bounds.
+			/// @return The copy, owned by the caller.
+			virtual RenderingBounds* Clone() const = 0;
+
 			virtual void Serialize(IOStream& stream) const = 0;
 		};
 	}
@@ -20,6 +20,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 #include "../Interval.hpp"
 #include "RenderingStep.hpp"
 #include "RenderingBounds.hpp"
+#include "../InternalErrorException.hpp"
 #include "../genlib/HeightProfile.hpp"
 
 namespace geogen
@@ -31,16 +32,39 @@ namespace geogen
 		private:
 			Interval interval;
 		public:
-			RenderingBounds1D(Interval interval) : interval(interval) {}
+			RenderingBounds1D(Interval interval) : RenderingBounds(RENDERING_STEP_TYPE_1D), interval(interval) {}
+
+			/// Casts generic rendering bounds to this type, verifying the type using RenderingBounds::GetRenderingStepType.
+			/// @param bounds The bounds.
+			/// @return The cast bounds.
+			static inline RenderingBounds1D* Cast(RenderingBounds* bounds)
+			{
+				if (bounds->GetRenderingStepType() != RENDERING_STEP_TYPE_1D)
+				{
+					throw InternalErrorException(GG_STR("Invalid rendering bounds type."));
+				}
+
+				return static_cast<RenderingBounds1D*>(bounds);
+			}
+
+			/// Casts generic rendering bounds to this type, verifying the type using RenderingBounds::GetRenderingStepType.
+			/// @param bounds The bounds.
+			/// @return The cast bounds.
+			static inline RenderingBounds1D const* Cast(RenderingBounds const* bounds)
+			{
+				return Cast(const_cast<RenderingBounds*>(bounds));
+			}
 
 			inline Interval GetInterval() const { return this->interval; }
 			inline void SetInterval(Interval interval) { this->interval = interval; }
 			inline void CombineInterval(Interval interval) { this->interval = Interval::Combine(interval, this->interval); }
 
-			virtual RenderingStepType GetRenderingStepType() const { return RENDERING_STEP_TYPE_1D; };
-
 			virtual unsigned GetMemorySize(Scale scale) const { return genlib::HeightProfile::GetMemorySize(this->interval, scale); };
 
+			virtual unsigned long long GetPixelCount(Scale scale) const { return (this->interval * scale).GetLength(); };
+
+			virtual RenderingBounds* Clone() const { return new RenderingBounds1D(*this); };
+
 			virtual void Serialize(IOStream& stream) const
 			{
 				this->interval.Serialize(stream);
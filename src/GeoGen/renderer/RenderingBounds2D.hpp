@@ -19,6 +19,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 #include "../Rectangle.hpp"
 #include "RenderingStep.hpp"
 #include "RenderingBounds.hpp"
+#include "../InternalErrorException.hpp"
 #include "../genlib/HeightMap.hpp"
 
 namespace geogen
@@ -30,16 +31,39 @@ namespace geogen
 		private:
 			Rectangle rectangle;
 		public:
-			RenderingBounds2D(Rectangle rectangle) : rectangle(rectangle) {}
+			RenderingBounds2D(Rectangle rectangle) : RenderingBounds(RENDERING_STEP_TYPE_2D), rectangle(rectangle) {}
+
+			/// Casts generic rendering bounds to this type, verifying the type using RenderingBounds::GetRenderingStepType.
+			/// @param bounds The bounds.
+			/// @return The cast bounds.
+			static inline RenderingBounds2D* Cast(RenderingBounds* bounds)
+			{
+				if (bounds->GetRenderingStepType() != RENDERING_STEP_TYPE_2D)
+				{
+					throw InternalErrorException(GG_STR("Invalid rendering bounds type."));
+				}
+
+				return static_cast<RenderingBounds2D*>(bounds);
+			}
+
+			/// Casts generic rendering bounds to this type, verifying the type using RenderingBounds::GetRenderingStepType.
+			/// @param bounds The bounds.
+			/// @return The cast bounds.
+			static inline RenderingBounds2D const* Cast(RenderingBounds const* bounds)
+			{
+				return Cast(const_cast<RenderingBounds*>(bounds));
+			}
 
 			inline Rectangle GetRectangle() const { return this->rectangle; }
 			inline void SetRectangle(Rectangle rectangle) { this->rectangle = rectangle; }
 			inline void CombineRectangle(Rectangle rectangle) { this->rectangle = Rectangle::Combine(rectangle, this->rectangle); }
 
-			virtual RenderingStepType GetRenderingStepType() const { return RENDERING_STEP_TYPE_2D; };
-
 			virtual unsigned GetMemorySize(Scale scale) const { return genlib::HeightMap::GetMemorySize(this->rectangle, scale); };
 
+			virtual unsigned long long GetPixelCount(Scale scale) const { return (this->rectangle * scale).GetSize().GetTotalLength(); };
+
+			virtual RenderingBounds* Clone() const { return new RenderingBounds2D(*this); };
+
 			virtual void Serialize(IOStream& stream) const
 			{
 				this->rectangle.Serialize(stream);
@@ -14,8 +14,6 @@ GNU General Public License for more details.
 You should have received a copy of the GNU General Public License
 along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 
-#include <map>
-
 #include "RenderingGraph.hpp"
 #include "RenderingStep.hpp"
 #include "../InternalErrorException.hpp"
@@ -24,43 +22,52 @@ using namespace std;
 using namespace geogen;
 using namespace renderer;
 
-RenderingGraph::RenderingGraph(RenderingSequence const& renderingSequence) : renderingSequence(renderingSequence)
+RenderingGraph::RenderingGraph(RenderingSequence const& renderingSequence) : renderingSequence(renderingSequence), nodes(renderingSequence.Size())
 {
-	map<unsigned, vector<RenderingGraphNode*> > openNodes;
+	// Nodes of steps waiting for a value of each object table slot. The node vector is allocated in advance, so the node pointers stay valid.
+	vector<vector<RenderingGraphNode*> > openNodes(renderingSequence.GetRequiredObjectTableSize());
 	for (RenderingSequence::const_reverse_iterator it = renderingSequence.RBegin(); it != renderingSequence.REnd(); it++)
 	{
 		RenderingStep const* step = *it;
-		this->nodes.insert(pair<RenderingStep const*, RenderingGraphNode>(step, RenderingGraphNode(step)));
-		RenderingGraphNode* node = &this->nodes[step];
+		RenderingGraphNode* node = this->GetNodeByStep(step);
+		*node = RenderingGraphNode(step);
 
-		if (openNodes.find(step->GetReturnSlot()) == openNodes.end())
+		vector<RenderingGraphNode*>& foundRange = openNodes.at(step->GetReturnSlot());
+		if (foundRange.empty())
 		{		
 			this->entryNodes.push_back(node);
 		}
 		else
 		{
-			vector<RenderingGraphNode*> foundRange = openNodes.find(step->GetReturnSlot())->second;
 			for (vector<RenderingGraphNode*>::iterator it2 = foundRange.begin(); it2 != foundRange.end(); it2++)
 			{
 				node->AddEdge(*it2);
 			}
 
-			openNodes.erase(step->GetReturnSlot());
+			foundRange.clear();
 		}
 
 		for (vector<unsigned>::const_iterator it2 = step->GetArgumentSlots().begin(); it2 != step->GetArgumentSlots().end(); it2++)
 		{
-			openNodes[*it2].push_back(node);
+			openNodes.at(*it2).push_back(node);
 		}
 	}
 
-	if (openNodes.size() > 0)
+	for (vector<vector<RenderingGraphNode*> >::const_iterator it = openNodes.begin(); it != openNodes.end(); it++)
 	{
-		throw InternalErrorException(GG_STR("Graph calculation consistency error."));
+		if (!it->empty())
+		{
+			throw InternalErrorException(GG_STR("Graph calculation consistency error."));
+		}
 	}
 }
 
 RenderingGraphNode* RenderingGraph::GetNodeByStep(RenderingStep const* step)
 {
-	return &this->nodes[step];
+	if (step->GetIndex() >= this->nodes.size())
+	{
+		throw InternalErrorException(GG_STR("Step not present in the sequence."));
+	}
+
+	return &this->nodes[step->GetIndex()];
 }
\ No newline at end of file
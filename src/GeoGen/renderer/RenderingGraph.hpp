@@ -32,7 +32,7 @@ namespace geogen
 		{
 		private:
 			RenderingSequence const& renderingSequence;
-			std::map<RenderingStep const*, RenderingGraphNode> nodes;
+			std::vector<RenderingGraphNode> nodes;
 			std::vector<RenderingGraphNode*> entryNodes;
 		public:
 
@@ -40,7 +40,7 @@ namespace geogen
 			/// @param renderingSequence The rendering sequence. The sequence must exist for entire duration of life of this object. 
 			RenderingGraph(RenderingSequence const& renderingSequence);
 
-			/// Gets RenderingGraphNode corresponding to a specific RenderingStep.
+			/// Gets RenderingGraphNode corresponding to a specific RenderingStep. The nodes are indexed by RenderingStep::GetIndex.
 			/// @param step The rendering step.
 			/// @return The node.
 			RenderingGraphNode* GetNodeByStep(RenderingStep const* step);
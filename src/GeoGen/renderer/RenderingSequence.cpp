@@ -57,6 +57,7 @@ bool RenderingSequence::AddStep(RenderingStep* step)
 		throw new InternalErrorException(GG_STR("Rendering step return slot has too high number (previous slots weren't referenced yet).")); 
 	}
 
+	step->SetIndex(this->steps.size());
 	this->steps.push_back(step);
 
 	return true;
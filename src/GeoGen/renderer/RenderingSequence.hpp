@@ -32,6 +32,8 @@ namespace geogen
 			std::vector<RenderingStep*> steps;
 			unsigned objectTableSize;
 			Scale renderScale;
+			bool isRenderRectangleDependent;
+			bool isRenderScaleDependent;
 
 			// Non-copyable
 			RenderingSequence(RenderingSequence const&) {};
@@ -45,11 +47,25 @@ namespace geogen
 			typedef std::vector<RenderingStep const*>::const_reverse_iterator const_reverse_iterator;
 			typedef std::vector<RenderingStep*>::reverse_iterator reverse_iterator;
 
-			RenderingSequence(Scale renderScale) : renderScale(renderScale), objectTableSize(0){};
+			RenderingSequence(Scale renderScale) : renderScale(renderScale), objectTableSize(0), isRenderRectangleDependent(false), isRenderScaleDependent(false){};
 			~RenderingSequence();
 
 			inline Scale GetRenderScale() const { return this->renderScale; }
 
+			/// Determines whether the script which generated this sequence read the render rectangle. Sequences which don't depend on the render rectangle are identical for all render rectangles of the same map and can be rendered repeatedly using Renderer(RenderingSequence const&, Rectangle, Configuration).
+			/// @return True if the sequence is only valid for the render rectangle it was generated with.
+			inline bool IsRenderRectangleDependent() const { return this->isRenderRectangleDependent; }
+
+			/// Marks the sequence as dependent on the render rectangle it was generated with.
+			inline void SetRenderRectangleDependent() { this->isRenderRectangleDependent = true; }
+
+			/// Determines whether the script which generated this sequence read the render scale (or a parameter derived from it). Sequences which don't depend on the render scale can be rendered at any scale using Renderer(RenderingSequence const&, Scale, Configuration).
+			/// @return True if the sequence is only valid for the render scale it was generated with.
+			inline bool IsRenderScaleDependent() const { return this->isRenderScaleDependent; }
+
+			/// Marks the sequence as dependent on the render scale it was generated with.
+			inline void SetRenderScaleDependent() { this->isRenderScaleDependent = true; }
+
 			inline const_iterator Begin() const { std::vector<RenderingStep*>::const_iterator it = this->steps.begin(); return (const_iterator&)(it); }
 			inline const_iterator End() const { std::vector<RenderingStep*>::const_iterator it = this->steps.end(); return (const_iterator&)(it); }
 			inline iterator Begin() { return this->steps.begin(); }
@@ -25,47 +25,47 @@ using namespace geogen;
 using namespace renderer;
 
 RenderingSequenceMetadata::RenderingSequenceMetadata(RenderingSequence const& renderingSequence)
+: steps(renderingSequence.Begin(), renderingSequence.End()), renderingBounds(renderingSequence.Size(), NULL), objectsIndexesToRelease(renderingSequence.Size()), memoryRequirements(renderingSequence.Size(), 1)
 {
-	unsigned stepNumber = 0;
+	// The bounds are stored by value, so the vectors have to be reserved in advance to keep the pointers stable.
+	unsigned count1D = 0;
 	for (RenderingSequence::const_iterator it = renderingSequence.Begin(); it != renderingSequence.End(); it++)
 	{
-		this->stepNumbers.insert(pair<RenderingStep const*, unsigned>(*it, stepNumber));
+		count1D += (*it)->GetRenderingStepType() == RENDERING_STEP_TYPE_1D ? 1 : 0;
+	}
+
+	this->renderingBounds1D.reserve(count1D);
+	this->renderingBounds2D.reserve(this->steps.size() - count1D);
+
+	for (RenderingSequence::const_iterator it = renderingSequence.Begin(); it != renderingSequence.End(); it++)
+	{
+		unsigned stepNumber = this->GetStepNumberByAddress(*it);
 
 		RenderingStepType stepType = (*it)->GetRenderingStepType();
 		switch (stepType)
 		{
 		case RENDERING_STEP_TYPE_1D:
-			this->renderingBounds.push_back(new RenderingBounds1D(Interval()));
+			this->renderingBounds1D.push_back(RenderingBounds1D(Interval()));
+			this->renderingBounds[stepNumber] = &this->renderingBounds1D.back();
 			break;
 		case RENDERING_STEP_TYPE_2D:
-			this->renderingBounds.push_back(new RenderingBounds2D(Rectangle()));
+			this->renderingBounds2D.push_back(RenderingBounds2D(Rectangle()));
+			this->renderingBounds[stepNumber] = &this->renderingBounds2D.back();
 			break;
 		default:
 			throw InternalErrorException(GG_STR("Invalid rendering step type."));
 		}
-
-		this->objectsIndexesToRelease.push_back(vector<unsigned>());
-		this->memoryRequirements.push_back(1);
-
-		stepNumber++;
-	}
-}
-
-RenderingSequenceMetadata::~RenderingSequenceMetadata()
-{
-	for (vector<RenderingBounds*>::iterator it = this->renderingBounds.begin(); it != this->renderingBounds.end(); it++)
-	{
-		delete *it;
 	}
 }
 
 unsigned RenderingSequenceMetadata::GetStepNumberByAddress(RenderingStep const* step) const
 {
-	map<RenderingStep const*, unsigned>::const_iterator it = this->stepNumbers.find(step);
+	unsigned stepNumber = step->GetIndex();
 
-	if (it != this->stepNumbers.end())
+	// The index alone doesn't identify the step, steps of other sequences have the same indexes.
+	if (stepNumber < this->steps.size() && this->steps[stepNumber] == step)
 	{
-		return it->second;
+		return stepNumber;
 	}
 	else 
 	{
@@ -100,21 +100,20 @@ void RenderingSequenceMetadata::SetMemoryRequirement(RenderingStep const* step,
 
 void RenderingSequenceMetadata::Serialize(IOStream& stream) const
 {
-	for (std::map<RenderingStep const*, unsigned>::const_iterator it = this->stepNumbers.begin(); it != this->stepNumbers.end(); it++)
+	for (unsigned stepNumber = 0; stepNumber < this->steps.size(); stepNumber++)
 	{
-		stream << it->second << GG_STR("# ");
-		//it->first->Serialize(stream);
+		stream << stepNumber << GG_STR("# ");
 		stream << GG_STR(": bounds ");
-		this->renderingBounds[it->second]->Serialize(stream);
+		this->renderingBounds[stepNumber]->Serialize(stream);
 		stream << GG_STR(",memory ");
-		this->memoryRequirements[it->second];
+		stream << this->memoryRequirements[stepNumber];
 		stream << GG_STR(", objects to release ");
 
-		for (vector<unsigned>::const_iterator it2 = this->objectsIndexesToRelease[it->second].begin(); it2 != this->objectsIndexesToRelease[it->second].end(); it2++)
+		for (vector<unsigned>::const_iterator it2 = this->objectsIndexesToRelease[stepNumber].begin(); it2 != this->objectsIndexesToRelease[stepNumber].end(); it2++)
 		{
 			stream << *it2;
 
-			if (it2 + 1 != this->objectsIndexesToRelease[it->second].end())
+			if (it2 + 1 != this->objectsIndexesToRelease[stepNumber].end())
 			{
 				stream << GG_STR(", ");
 			}
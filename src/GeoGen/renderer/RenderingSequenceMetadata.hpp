@@ -17,23 +17,26 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 #pragma once
 
 #include <vector>
-#include <map>
 
 #include "RenderingSequence.hpp"
 #include "../CodeLocation.hpp"
 #include "../Point.hpp"
+#include "RenderingBounds1D.hpp"
+#include "RenderingBounds2D.hpp"
 
 namespace geogen
 {
 	namespace renderer
 	{
-		class RenderingBounds;
 		class RenderingStep;
 
+		/// Data the renderer calculates about individual steps of a RenderingSequence. All of it is stored in flat arrays indexed by RenderingStep::GetIndex.
 		class RenderingSequenceMetadata : public Serializable
 		{
 		private:
-			std::map<RenderingStep const*, unsigned> stepNumbers;
+			std::vector<RenderingStep const*> steps;
+			std::vector<RenderingBounds1D> renderingBounds1D;
+			std::vector<RenderingBounds2D> renderingBounds2D;
 			std::vector<RenderingBounds*> renderingBounds;
 			std::vector<std::vector<unsigned> > objectsIndexesToRelease;
 			std::vector<unsigned> memoryRequirements;
@@ -44,10 +47,19 @@ namespace geogen
 		protected:
 		public:
 			RenderingSequenceMetadata(RenderingSequence const& renderingSequence);
-			~RenderingSequenceMetadata();
 
 			RenderingBounds* GetRenderingBounds(RenderingStep const* step);
 
+			/// Gets rendering bounds of a 1D step.
+			/// @param step The step.
+			/// @return The rendering bounds.
+			inline RenderingBounds1D* GetRenderingBounds1D(RenderingStep const* step) { return RenderingBounds1D::Cast(this->GetRenderingBounds(step)); }
+
+			/// Gets rendering bounds of a 2D step.
+			/// @param step The step.
+			/// @return The rendering bounds.
+			inline RenderingBounds2D* GetRenderingBounds2D(RenderingStep const* step) { return RenderingBounds2D::Cast(this->GetRenderingBounds(step)); }
+
 			std::vector<unsigned>& GetObjectIndexesToRelease(RenderingStep const* step);
 			std::vector<unsigned> const& GetObjectIndexesToRelease(RenderingStep const* step) const;
 			unsigned GetMemoryRequirement(RenderingStep const* step) const;
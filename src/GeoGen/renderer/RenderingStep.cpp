@@ -34,6 +34,16 @@ unsigned RenderingStep::GetPeakExtraMemory(Renderer* renderer, std::vector<Rende
 	return 0;
 }
 
+unsigned RenderingStep::GetRetainedMemory(Renderer* renderer) const
+{
+	return 0;
+}
+
+bool RenderingStep::IsRetainedMemoryShared(Renderer* renderer, std::vector<RenderingBounds const*> argumentBounds) const
+{
+	return false;
+}
+
 void RenderingStep::SimulateOnRenderingBounds(RenderingBounds* renderingBounds) const
 {
 	// Most steps have no effect on the return object's rendering bounds.
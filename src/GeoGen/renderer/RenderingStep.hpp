@@ -40,7 +40,8 @@ namespace geogen
 		private:
 			CodeLocation location;
 			std::vector<unsigned> argumentSlots;
-			unsigned returnSlot;			
+			unsigned returnSlot;
+			unsigned index;
 
 			// Non-copyable
 			RenderingStep(RenderingStep const&) : location( 0, 0) {};
@@ -48,7 +49,7 @@ namespace geogen
 		protected:
 			void TriggerRenderingBoundsCalculationError(String message) const;			
 		public:
-			RenderingStep(CodeLocation location, std::vector<unsigned> const& argumentSlots, unsigned returnSlot) : location(location), argumentSlots(argumentSlots), returnSlot(returnSlot) {}
+			RenderingStep(CodeLocation location, std::vector<unsigned> const& argumentSlots, unsigned returnSlot) : location(location), argumentSlots(argumentSlots), returnSlot(returnSlot), index(0) {}
 
 			virtual RenderingStepType GetRenderingStepType() const = 0;
 			virtual String GetName() const = 0;
@@ -57,6 +58,14 @@ namespace geogen
 			inline std::vector<unsigned> const& GetArgumentSlots() const { return this->argumentSlots; };
 			inline unsigned GetReturnSlot() const { return this->returnSlot; }
 
+			/// Gets position of this step in the RenderingSequence it belongs to, assigned by RenderingSequence::AddStep. Data the renderer keeps about individual steps (RenderingSequenceMetadata, RenderingGraph) is stored in arrays indexed by it.
+			/// @return The index.
+			inline unsigned GetIndex() const { return this->index; }
+
+			/// Sets position of this step in the RenderingSequence. Used by RenderingSequence::AddStep.
+			/// @param index The index.
+			inline void SetIndex(unsigned index) { this->index = index; }
+
 			/// Executes this step.
 			/// @param renderer The renderer.
 			virtual void Step(Renderer* renderer) const = 0;
@@ -73,6 +82,19 @@ namespace geogen
 			/// @return The number of bytes required by this step beyond any memory already allocated by existing objects.
 			virtual unsigned GetPeakExtraMemory(Renderer* renderer, std::vector<RenderingBounds const*> argumentBounds) const;
 
+			/// Gets number of bytes allocated by this step outside of the renderer object table which stay allocated until the rendering ends,
+			/// such as maps added to the RenderedMapTable (used by Renderer::CalculateMemoryRequirements).
+			/// @param renderer The renderer.
+			/// @return The number of bytes.
+			virtual unsigned GetRetainedMemory(Renderer* renderer) const;
+
+			/// Determines whether the memory retained by this step (see GetRetainedMemory) is shared with one of its arguments which is released right after the step, so
+			/// the retained memory is already accounted for by the argument during the step (used by Renderer::CalculateMemoryRequirements).
+			/// @param renderer The renderer.
+			/// @param argumentBounds The argument bounds.
+			/// @return True if the retained memory is shared with a released argument.
+			virtual bool IsRetainedMemoryShared(Renderer* renderer, std::vector<RenderingBounds const*> argumentBounds) const;
+
 			/// Simulates the effect this step would have on the return RendererObject's size without actually executing it.
 			/// @param renderingBounds Reference to the rendering bounds to update with the simulated bounds.
 			virtual void SimulateOnRenderingBounds(RenderingBounds* renderingBounds) const;
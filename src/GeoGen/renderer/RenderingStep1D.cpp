@@ -26,7 +26,7 @@ using namespace renderer;
 
 void RenderingStep1D::SetRenderingBounds(Renderer* renderer, Interval interval) const
 {
-	dynamic_cast<RenderingBounds1D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->SetInterval(interval);
+	renderer->GetRenderingSequenceMetadata().GetRenderingBounds1D(this)->SetInterval(interval);
 }
 
 void RenderingStep1D::UpdateRenderingBounds(Renderer* renderer, std::vector<RenderingBounds*> argumentBounds) const
@@ -36,14 +36,14 @@ void RenderingStep1D::UpdateRenderingBounds(Renderer* renderer, std::vector<Rend
 		this->TriggerRenderingBoundsCalculationError("empty referencing steps list");
 	}*/
 
-	Interval thisInterval = dynamic_cast<RenderingBounds1D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->GetInterval();
+	Interval thisInterval = renderer->GetRenderingSequenceMetadata().GetRenderingBounds1D(this)->GetInterval();
 
 	//Interval newInterval;
 	for (std::vector<RenderingBounds*>::iterator it = argumentBounds.begin(); it != argumentBounds.end(); it++)
 	{
 		if ((*it)->GetRenderingStepType() == RENDERING_STEP_TYPE_1D)
 		{
-			RenderingBounds1D* current = dynamic_cast<RenderingBounds1D*>(*it);
+			RenderingBounds1D* current = RenderingBounds1D::Cast(*it);
 			current->CombineInterval(thisInterval);
 
 			/*
@@ -60,7 +60,7 @@ void RenderingStep1D::UpdateRenderingBounds(Renderer* renderer, std::vector<Rend
 		{
 			this->TriggerRenderingBoundsCalculationError(GG_STR("incorrect rendering step type"));
 
-			/*RenderingBounds2D* current = dynamic_cast<RenderingBounds2D*>(*it);
+			/*RenderingBounds2D* current = RenderingBounds2D::Cast(*it);
 
 			newInterval = 
 				Interval::Combine(
@@ -80,7 +80,7 @@ void RenderingStep1D::UpdateRenderingBounds(Renderer* renderer, std::vector<Rend
 
 Interval RenderingStep1D::GetRenderingBounds(Renderer* renderer) const
 {
-	return dynamic_cast<RenderingBounds1D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->GetInterval();
+	return renderer->GetRenderingSequenceMetadata().GetRenderingBounds1D(this)->GetInterval();
 }
 
 /*Interval RenderingStep1D::CalculateRenderingBounds(Renderer* renderer, Interval argumentBounds) const
@@ -27,12 +27,12 @@ using namespace renderer;
 
 void RenderingStep2D::SetRenderingBounds(Renderer* renderer, Rectangle rectangle) const
 {
-	dynamic_cast<RenderingBounds2D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->SetRectangle(rectangle);
+	renderer->GetRenderingSequenceMetadata().GetRenderingBounds2D(this)->SetRectangle(rectangle);
 }
 
 void RenderingStep2D::UpdateRenderingBounds(Renderer* renderer, std::vector<RenderingBounds*> argumentBounds) const
 {
-	Rectangle thisRectangle = dynamic_cast<RenderingBounds2D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->GetRectangle();
+	Rectangle thisRectangle = renderer->GetRenderingSequenceMetadata().GetRenderingBounds2D(this)->GetRectangle();
 
 	for (std::vector<RenderingBounds*>::iterator it = argumentBounds.begin(); it != argumentBounds.end(); it++)
 	{
@@ -42,7 +42,7 @@ void RenderingStep2D::UpdateRenderingBounds(Renderer* renderer, std::vector<Rend
 		}
 		else if ((*it)->GetRenderingStepType() == RENDERING_STEP_TYPE_2D)
 		{
-			RenderingBounds2D* current = dynamic_cast<RenderingBounds2D*>(*it);
+			RenderingBounds2D* current = RenderingBounds2D::Cast(*it);
 			current->CombineRectangle(thisRectangle);
 		}
 
@@ -52,7 +52,7 @@ void RenderingStep2D::UpdateRenderingBounds(Renderer* renderer, std::vector<Rend
 
 Rectangle RenderingStep2D::GetRenderingBounds(Renderer* renderer) const
 {
-	return dynamic_cast<RenderingBounds2D*>(renderer->GetRenderingSequenceMetadata().GetRenderingBounds(this))->GetRectangle();
+	return renderer->GetRenderingSequenceMetadata().GetRenderingBounds2D(this)->GetRectangle();
 }
 
 /*Rectangle RenderingStep2D::CalculateRenderingBounds(Renderer* renderer, Rectangle argumentBounds) const
@@ -0,0 +1,299 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include <algorithm>
+#include <memory>
+#include <new>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "TileGenerator.hpp"
+#include "Renderer.hpp"
+#include "../ApiUsageException.hpp"
+#include "../InternalErrorException.hpp"
+#include "../CancellationException.hpp"
+
+using namespace std;
+using namespace geogen;
+using namespace renderer;
+using namespace runtime;
+
+enum TileGenerator_Failure
+{
+	TILEGENERATOR_FAILURE_NONE,
+	TILEGENERATOR_FAILURE_GEOGEN_EXCEPTION,
+	TILEGENERATOR_FAILURE_OUT_OF_MEMORY,
+	TILEGENERATOR_FAILURE_UNKNOWN
+};
+
+TileGenerator::TileGenerator(CompiledScript const& compiledScript, ScriptParameters const& parameters, Rectangle region, Size2D tileSize)
+: compiledScript(compiledScript), parameters(parameters), region(region), tileSize(tileSize), threadCount(1), memoryLimit(compiledScript.GetConfiguration().RendererMemoryLimit), scriptMessageHandler(VirtualMachine::DefaultScriptMessageHandler), isFailed(false), handlerFailed(false), finishedTileCount(0), concurrentTileCount(0)
+{
+	if (tileSize.GetWidth() == 0 || tileSize.GetHeight() == 0)
+	{
+		throw ApiUsageException(GG_STR("Tile size must be greater than 0."));
+	}
+
+	// The region is limited to a finite map the same way as the render rectangle of a virtual machine, so tiles don't extend past the map.
+	ScriptParameters regionParameters = parameters;
+	regionParameters.SetRenderRectangle(region);
+	this->region = regionParameters.GetActualRenderRectangle();
+
+#ifdef _OPENMP
+	this->threadCount = omp_get_num_procs();
+#endif
+}
+
+Rectangle TileGenerator::GetTileRectangle(unsigned column, unsigned row) const
+{
+	if (column >= this->GetColumnCount() || row >= this->GetRowCount())
+	{
+		throw ApiUsageException(GG_STR("Tile out of range."));
+	}
+
+	Point position(
+		this->region.GetPosition().GetX() + Coordinate(column * this->tileSize.GetWidth()),
+		this->region.GetPosition().GetY() + Coordinate(row * this->tileSize.GetHeight()));
+
+	// Tiles in the last column and row are cropped to the region.
+	Size2D size(
+		min(this->tileSize.GetWidth(), Size1D(this->region.GetEndingPoint().GetX() - position.GetX())),
+		min(this->tileSize.GetHeight(), Size1D(this->region.GetEndingPoint().GetY() - position.GetY())));
+
+	return Rectangle(position, size);
+}
+
+void TileGenerator::SetThreadCount(unsigned threadCount)
+{
+	if (threadCount == 0)
+	{
+		throw ApiUsageException(GG_STR("Thread count must be greater than 0."));
+	}
+
+	this->threadCount = threadCount;
+}
+
+ScriptParameters TileGenerator::GetTileParameters(unsigned column, unsigned row) const
+{
+	ScriptParameters tileParameters = this->parameters;
+	tileParameters.SetRenderRectangle(this->GetTileRectangle(column, row));
+
+	return tileParameters;
+}
+
+VirtualMachine* TileGenerator::ExecuteScript(ScriptParameters const& tileParameters) const
+{
+	// Virtual machines keep their inline caches to themselves (see VirtualMachine::GetInlineCacheEntry), so multiple of them can run the shared script at once.
+	auto_ptr<VirtualMachine> vm(new VirtualMachine(this->compiledScript, tileParameters));
+	vm->SetScriptMessageHandler(this->scriptMessageHandler);
+	vm->Run();
+
+	return vm.release();
+}
+
+bool TileGenerator::GenerateTile(TileHandler* handler, VirtualMachine const* sharedVirtualMachine, unsigned tileIndex, unsigned long long& memoryRequirement)
+{
+	unsigned column = tileIndex % this->GetColumnCount();
+	unsigned row = tileIndex / this->GetColumnCount();
+	ScriptParameters tileParameters = this->GetTileParameters(column, row);
+
+	// The rectangle the virtual machine of the tile would render, so both ways of rendering the tile produce the same map.
+	Rectangle tileRectangle = tileParameters.GetActualRenderRectangle();
+
+	auto_ptr<VirtualMachine> ownVirtualMachine;
+	if (sharedVirtualMachine == NULL)
+	{
+		ownVirtualMachine = auto_ptr<VirtualMachine>(this->ExecuteScript(tileParameters));
+	}
+
+	RenderingSequence const& renderingSequence = sharedVirtualMachine != NULL ? sharedVirtualMachine->GetRenderingSequence() : ownVirtualMachine->GetRenderingSequence();
+
+	// A rendering sequence which depends on the render rectangle was generated directly for this tile by its own virtual machine.
+	Configuration configuration = this->compiledScript.GetConfiguration();
+	auto_ptr<Renderer> renderer(renderingSequence.IsRenderRectangleDependent() ? new Renderer(renderingSequence, configuration) : new Renderer(renderingSequence, tileRectangle, configuration));
+	renderer->SetCancellationToken(&this->cancellationToken);
+	renderer->CalculateMetadata();
+
+	memoryRequirement = 0;
+	for (RenderingSequence::const_iterator it = renderingSequence.Begin(); it != renderingSequence.End(); it++)
+	{
+		memoryRequirement = max(memoryRequirement, (unsigned long long)renderer->GetRenderingSequenceMetadata().GetMemoryRequirement(*it));
+	}
+
+	try
+	{
+		while (renderer->GetStatus() == RENDERER_STATUS_READY)
+		{
+			if (this->isFailed)
+			{
+				return false;
+			}
+
+			renderer->Step();
+		}
+	}
+	catch (CancellationException&)
+	{
+		return false;
+	}
+
+	if (handler == NULL)
+	{
+		return true;
+	}
+
+	#pragma omp critical (geogen_tile_generator_handler)
+	{
+		if (!this->isFailed && !this->cancellationToken.IsCancelled())
+		{
+			try
+			{
+				handler->HandleTile(*this, column, row, tileRectangle, renderer->GetRenderedMapTable());
+				this->finishedTileCount++;
+			}
+			catch (...)
+			{
+				this->handlerFailed = true;
+				this->isFailed = true;
+			}
+		}
+	}
+
+	return true;
+}
+
+bool TileGenerator::Run(TileHandler& handler)
+{
+	this->isFailed = false;
+	this->handlerFailed = false;
+	this->finishedTileCount = 0;
+	this->concurrentTileCount = 0;
+
+	unsigned tileCount = this->GetTileCount();
+	if (tileCount == 0)
+	{
+		return true;
+	}
+
+	// The first tile is generated alone, so errors in the script are reported directly and the memory requirement of a single tile is known before the others are started.
+	auto_ptr<VirtualMachine> firstVirtualMachine(this->ExecuteScript(this->GetTileParameters(0, 0)));
+
+	unsigned long long tileMemoryRequirement;
+	this->concurrentTileCount = 1;
+	this->GenerateTile(&handler, firstVirtualMachine.get(), 0, tileMemoryRequirement);
+
+	if (this->handlerFailed)
+	{
+		throw ApiUsageException(GG_STR("Tile handler threw an exception."));
+	}
+
+	if (this->IsCancelled() || tileCount == 1)
+	{
+		return this->finishedTileCount == tileCount;
+	}
+
+	VirtualMachine const* sharedVirtualMachine = firstVirtualMachine->GetRenderingSequence().IsRenderRectangleDependent() ? NULL : firstVirtualMachine.get();
+
+	unsigned long long memoryLimitedTileCount = tileMemoryRequirement > 0 ? this->memoryLimit / tileMemoryRequirement : this->threadCount;
+	this->concurrentTileCount = (unsigned)max(1ULL, min(memoryLimitedTileCount, (unsigned long long)min(this->threadCount, tileCount - 1)));
+
+	int failedTileIndex = -1;
+	TileGenerator_Failure failure = TILEGENERATOR_FAILURE_NONE;
+	ErrorCode failureErrorCode = GGE5000_InternalError;
+	String failureMessage;
+
+	#pragma omp parallel for schedule(dynamic) num_threads(this->concurrentTileCount)
+	for (int i = 1; i < (int)tileCount; i++)
+	{
+		if (this->isFailed || this->IsCancelled())
+		{
+			continue;
+		}
+
+		// Exceptions can't leave the parallel region, the failure of the first failed tile is recorded and reported below.
+		TileGenerator_Failure tileFailure = TILEGENERATOR_FAILURE_NONE;
+		ErrorCode tileErrorCode = GGE5000_InternalError;
+		String tileMessage;
+		try
+		{
+			unsigned long long memoryRequirement;
+			this->GenerateTile(&handler, sharedVirtualMachine, i, memoryRequirement);
+		}
+		catch (GeoGenException& e)
+		{
+			tileFailure = TILEGENERATOR_FAILURE_GEOGEN_EXCEPTION;
+			tileErrorCode = e.GetErrorCode();
+			tileMessage = e.GetDetailMessage();
+		}
+		catch (bad_alloc&)
+		{
+			tileFailure = TILEGENERATOR_FAILURE_OUT_OF_MEMORY;
+		}
+		catch (...)
+		{
+			tileFailure = TILEGENERATOR_FAILURE_UNKNOWN;
+		}
+
+		if (tileFailure != TILEGENERATOR_FAILURE_NONE)
+		{
+			#pragma omp critical (geogen_tile_generator_error)
+			{
+				if (failedTileIndex == -1 || i < failedTileIndex)
+				{
+					failedTileIndex = i;
+					failure = tileFailure;
+					failureErrorCode = tileErrorCode;
+					failureMessage = tileMessage;
+				}
+
+				this->isFailed = true;
+			}
+		}
+	}
+
+	if (this->handlerFailed)
+	{
+		throw ApiUsageException(GG_STR("Tile handler threw an exception."));
+	}
+
+	// The tile could also have been interrupted by the cancellation, which isn't an error.
+	if (failedTileIndex != -1 && !this->IsCancelled())
+	{
+		// Running out of memory depends on the tiles rendered at the same time, so repeating the tile alone would likely succeed.
+		if (failure == TILEGENERATOR_FAILURE_OUT_OF_MEMORY)
+		{
+			throw bad_alloc();
+		}
+		else if (failure == TILEGENERATOR_FAILURE_UNKNOWN)
+		{
+			throw InternalErrorException(GG_STR("Generation of a tile failed with an unknown exception."));
+		}
+
+		// Errors of the script and the renderer are deterministic, so this throws the same exception (of its original type) on the calling thread.
+		this->isFailed = false;
+		unsigned long long memoryRequirement;
+		this->GenerateTile(NULL, sharedVirtualMachine, failedTileIndex, memoryRequirement);
+		this->isFailed = true;
+
+		StringStream ss;
+		ss << GG_STR("Generation of a tile failed with error GGE") << (int)failureErrorCode << GG_STR(" (") << failureMessage << GG_STR("), but succeeded when repeated.");
+		throw InternalErrorException(ss.str());
+	}
+
+	return this->finishedTileCount == tileCount;
+}
\ No newline at end of file
@@ -0,0 +1,145 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+#include "../Number.hpp"
+#include "../Rectangle.hpp"
+#include "../runtime/CompiledScript.hpp"
+#include "../runtime/ScriptParameters.hpp"
+#include "../runtime/VirtualMachine.hpp"
+#include "../genlib/CancellationToken.hpp"
+#include "RenderedMapTable.hpp"
+
+namespace geogen
+{
+	namespace renderer
+	{
+		class TileGenerator;
+
+		/// Receives tiles generated by TileGenerator.
+		class TileHandler
+		{
+		public:
+			virtual ~TileHandler() {};
+
+			/// Called once for each generated tile. Calls are never concurrent, but they may come from any thread of the generator and tiles may be delivered in any order. The handler must not throw, use TileGenerator::Cancel to stop the generation instead.
+			/// @param generator The generator.
+			/// @param column Column of the tile.
+			/// @param row Row of the tile.
+			/// @param tileRectangle Rectangle of the tile, in render coordinates.
+			/// @param renderedMaps The maps rendered for the tile. Ownership of the maps can be taken using RenderedMapTable::RemoveItem. The table is released once the handler returns.
+			virtual void HandleTile(TileGenerator& generator, unsigned column, unsigned row, Rectangle tileRectangle, RenderedMapTable& renderedMaps) = 0;
+		};
+
+		/// Generates a rectangular region of a map as a grid of tiles, rendering multiple tiles at once.
+		///
+		/// The first tile is generated alone, the rest are generated in parallel by up to GetThreadCount threads, further limited so the sum of memory requirements of simultaneously rendered tiles (as predicted for the first tile) doesn't exceed GetMemoryLimit. If the rendering sequence generated by the script doesn't depend on the render rectangle (see RenderingSequence::IsRenderRectangleDependent), the script is executed only once and its rendering sequence is rendered into each of the tiles, otherwise the script is executed again for each tile.
+		class TileGenerator
+		{
+		private:
+			runtime::CompiledScript const& compiledScript;
+			runtime::ScriptParameters parameters;
+			Rectangle region;
+			Size2D tileSize;
+			unsigned threadCount;
+			unsigned long long memoryLimit;
+			runtime::VirtualMachine::ScriptMessageHandler scriptMessageHandler;
+			genlib::CancellationToken cancellationToken;
+			volatile bool isFailed;
+			bool handlerFailed;
+			unsigned finishedTileCount;
+			unsigned concurrentTileCount;
+
+			// Non-copyable
+			TileGenerator(TileGenerator const&) : compiledScript(*(runtime::CompiledScript*)NULL) {};
+			TileGenerator& operator=(TileGenerator const&) {};
+
+			runtime::ScriptParameters GetTileParameters(unsigned column, unsigned row) const;
+			runtime::VirtualMachine* ExecuteScript(runtime::ScriptParameters const& tileParameters) const;
+			bool GenerateTile(TileHandler* handler, runtime::VirtualMachine const* sharedVirtualMachine, unsigned tileIndex, unsigned long long& memoryRequirement);
+		public:
+			/// Initializes a new instance of the TileGenerator class.
+			/// @param compiledScript The compiled script. It must exist for whole life of the generator.
+			/// @param parameters The script parameters. Their render rectangle is ignored and replaced by rectangles of individual tiles.
+			/// @param region The region to be generated, in render coordinates. If the map is finite, the region is limited to the map like a render rectangle (see runtime::ScriptParameters::GetActualRenderRectangle).
+			/// @param tileSize Size of the tiles. Tiles in the last column and row are cropped to the region.
+			TileGenerator(runtime::CompiledScript const& compiledScript, runtime::ScriptParameters const& parameters, Rectangle region, Size2D tileSize);
+
+			/// Gets number of tile columns.
+			/// @return The column count.
+			inline unsigned GetColumnCount() const { return (this->region.GetSize().GetWidth() + this->tileSize.GetWidth() - 1) / this->tileSize.GetWidth(); }
+
+			/// Gets number of tile rows.
+			/// @return The row count.
+			inline unsigned GetRowCount() const { return (this->region.GetSize().GetHeight() + this->tileSize.GetHeight() - 1) / this->tileSize.GetHeight(); }
+
+			/// Gets number of tiles.
+			/// @return The tile count.
+			inline unsigned GetTileCount() const { return this->GetColumnCount() * this->GetRowCount(); }
+
+			/// Gets rectangle of a tile.
+			/// @param column Column of the tile.
+			/// @param row Row of the tile.
+			/// @return The rectangle, in render coordinates.
+			Rectangle GetTileRectangle(unsigned column, unsigned row) const;
+
+			/// Gets maximum number of threads generating tiles.
+			/// @return The thread count.
+			inline unsigned GetThreadCount() const { return this->threadCount; }
+
+			/// Sets maximum number of threads generating tiles. Default: number of processors.
+			/// @param threadCount The thread count.
+			void SetThreadCount(unsigned threadCount);
+
+			/// Gets maximum sum of memory requirements of tiles rendered simultaneously.
+			/// @return The memory size, in bytes.
+			inline unsigned long long GetMemoryLimit() const { return this->memoryLimit; }
+
+			/// Sets maximum sum of memory requirements of tiles rendered simultaneously. At least one tile is always rendered, rendering of each tile is additionally limited by Configuration::RendererMemoryLimit. Default: Configuration::RendererMemoryLimit of the compiled script.
+			/// @param memoryLimit The memory size, in bytes.
+			inline void SetMemoryLimit(unsigned long long memoryLimit) { this->memoryLimit = memoryLimit; }
+
+			/// Sets script message handler assigned to all virtual machines executing the script. Default: runtime::VirtualMachine::DefaultScriptMessageHandler.
+			/// @param scriptMessageHandler The handler.
+			inline void SetScriptMessageHandler(runtime::VirtualMachine::ScriptMessageHandler scriptMessageHandler) { this->scriptMessageHandler = scriptMessageHandler; }
+
+			/// Gets number of tiles generated by the last call of Run.
+			/// @return The tile count.
+			inline unsigned GetFinishedTileCount() const { return this->finishedTileCount; }
+
+			/// Gets number of tiles rendered simultaneously by the last call of Run.
+			/// @return The tile count.
+			inline unsigned GetConcurrentTileCount() const { return this->concurrentTileCount; }
+
+			/// Generates all tiles and passes them to a handler. If generation of any tile fails, remaining tiles are abandoned and the error of the first failed tile is thrown once all threads stop.
+			/// @param handler The handler.
+			/// @return true if all tiles were generated, false if the generation was cancelled.
+			bool Run(TileHandler& handler);
+
+			/// Gets the cancellation token of the generation, which can also be used to set its deadline. It is assigned to renderers of all tiles (see Renderer::SetCancellationToken). Once cancelled, it has to be reset before Run is called again.
+			/// @return The token.
+			inline genlib::CancellationToken& GetCancellationToken() { return this->cancellationToken; }
+
+			/// Requests the generation to stop. Tiles which are being generated are abandoned, including their current rendering step. Can be called from the tile handler or any other thread.
+			inline void Cancel() { this->cancellationToken.Cancel(); }
+
+			/// Determines whether the generation was cancelled or its deadline passed.
+			/// @return true if cancelled, false otherwise.
+			inline bool IsCancelled() const { return this->cancellationToken.IsCancelled(); }
+		};
+	}
+}
\ No newline at end of file
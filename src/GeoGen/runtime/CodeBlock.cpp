@@ -74,6 +74,13 @@ void CodeBlock::MoveInstructionsFrom(CodeBlock& another)
 	another.instructions.clear();
 }
 
+std::vector<instructions::Instruction const*> CodeBlock::ReleaseInstructions()
+{
+	std::vector<instructions::Instruction const*> released;
+	released.swap(this->instructions);
+	return released;
+}
+
 void CodeBlock::Serialize(IOStream& stream) const
 {
 	//stream << "{" << std::endl;
@@ -62,6 +62,14 @@ namespace geogen
 			/// @param another The other code block.
 			void MoveInstructionsFrom(CodeBlock& another);
 
+			/// Removes all instructions from the code block and transfers their ownership to the caller.
+			/// @return The instructions, in their original order.
+			std::vector<instructions::Instruction const*> ReleaseInstructions();
+
+			/// Gets number of instructions in the code block (not including instructions in nested code blocks).
+			/// @return Number of instructions.
+			inline unsigned GetInstructionCount() const { return this->instructions.size(); }
+
 			/// Gets an iterator pointing to the first instruction.
 			/// @return An iterator.
 			inline const_iterator Begin() const { return this->instructions.begin(); }
@@ -54,6 +54,8 @@ namespace geogen
 				corelib::CoreLibrary coreLibrary;
 
 				String code;
+
+				unsigned inlineCacheSlotCount;
 			public:
 				/// Name of the main function.
 				static const String MAIN_FUNCTION_NAME;
@@ -104,6 +106,10 @@ namespace geogen
 				inline SymbolDefinitionTable<TypeDefinition> const& GetTypeDefinitions() const { return this->typeDefinitions; }
 				//inline SymbolDefinitionTable<TypeDefinition>& GetTypeDefinitions() { return this->typeDefinitions; }
 
+				/// Gets function definitions owned by this script (the functions declared in the script code and the main function).
+				/// @return The owned function definitions.
+				inline std::vector<FunctionDefinition*> const& GetOwnedFunctionDefinitions() const { return this->ownedFunctionDefinitions; }
+
 				/*inline CodeBlock& GetRootCodeBlock() { return this->rootCodeBlock; }
 				inline CodeBlock const& GetRootCodeBlock() const { return this->rootCodeBlock; }*/
 
@@ -120,6 +126,14 @@ namespace geogen
 				/// @return True if the type is successfully added.
 				bool AddTypeDefinition(TypeDefinition* typeDefinition);
 
+				/// Gets number of inline cache slots assigned to member access instructions of the script. Each VirtualMachine allocates this many inline cache entries.
+				/// @return The slot count.
+				inline unsigned GetInlineCacheSlotCount() const { return this->inlineCacheSlotCount; }
+
+				/// Sets number of inline cache slots assigned to member access instructions of the script.
+				/// @param inlineCacheSlotCount The slot count.
+				inline void SetInlineCacheSlotCount(unsigned inlineCacheSlotCount) { this->inlineCacheSlotCount = inlineCacheSlotCount; }
+
 				/// Gets a list of map names that can be generated by this script.
 				/// @return The supported maps.
 				std::vector<String>& GetSupportedMaps() { return this->supportedMaps; }
@@ -55,35 +55,38 @@ bool FunctionDefinition::CheckArgument(VirtualMachine* vm, CodeLocation location
 	return false;
 }
 
-vector<ManagedObjectHolder> FunctionDefinition::CheckArguments(VirtualMachine* vm, CodeLocation location, vector<TypeDefinition const*> expectedTypes, vector<ManagedObject*>& actualArguments, int requiredArgumentCount) const
+void FunctionDefinition::CheckArgument(VirtualMachine* vm, CodeLocation location, TypeDefinition const* expectedType, NativeArgumentList& actualArguments, unsigned index) const
+{
+	ManagedObject* argument = actualArguments[index];
+	ManagedObjectHolder holder;
+	if (this->CheckArgument(vm, location, expectedType, argument, holder))
+	{
+		actualArguments.Replace(vm, index, argument);
+	}
+}
+
+void FunctionDefinition::CheckArguments(VirtualMachine* vm, CodeLocation location, TypeDefinition const* const* expectedTypes, unsigned expectedTypeCount, NativeArgumentList& actualArguments, int requiredArgumentCount) const
 {
 	// Check argument count first
 	if (requiredArgumentCount == -1)
 	{
-		CheckArguments(location, expectedTypes.size(), actualArguments);
+		CheckArguments(location, expectedTypeCount, actualArguments);
 	}	
 	else 
 	{
-		CheckArguments(location, max(static_cast<size_t>(requiredArgumentCount), min(expectedTypes.size(), actualArguments.size())), actualArguments);
+		CheckArguments(location, max(static_cast<unsigned>(requiredArgumentCount), min(expectedTypeCount, actualArguments.Size())), actualArguments);
 	}
 
-	vector<ManagedObjectHolder> holders;
-	for (vector<ManagedObject*>::size_type i = 0; i < actualArguments.size(); i++)
+	for (unsigned i = 0; i < actualArguments.Size(); i++)
 	{
-		ManagedObjectHolder holder;
-		if (this->CheckArgument(vm, location, expectedTypes[i], actualArguments[i], holder))
-		{
-			holders.push_back(holder);
-		}
+		this->CheckArgument(vm, location, expectedTypes[i], actualArguments, i);
 	}
-
-	return holders;
 }
 
-void FunctionDefinition::CheckArguments(CodeLocation location, unsigned expectedArgumentCount, vector<ManagedObject*> actualArguments) const
+void FunctionDefinition::CheckArguments(CodeLocation location, unsigned expectedArgumentCount, NativeArgumentList const& actualArguments) const
 {
-	if (actualArguments.size() != expectedArgumentCount)
+	if (actualArguments.Size() != expectedArgumentCount)
 	{
-		throw NumberOfArgumentsException(location, expectedArgumentCount, actualArguments.size());
+		throw NumberOfArgumentsException(location, expectedArgumentCount, actualArguments.Size());
 	}
 }
\ No newline at end of file
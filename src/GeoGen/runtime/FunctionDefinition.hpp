@@ -22,6 +22,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 #include "../String.hpp"
 
 #include "ManagedObjectHolder.hpp"
+#include "NativeArgumentList.hpp"
 
 namespace geogen 
 {
@@ -78,21 +79,42 @@ namespace geogen
 			/// @return true if an conversion was performed, false otherwise.
 			bool CheckArgument(VirtualMachine* vm, CodeLocation location, TypeDefinition const* expectedType, ManagedObject*& actualArgument, ManagedObjectHolder& managedObjectHolder) const;
 
+			/// Helper method which performs a type check and type conversion (if required) on a single argument passed to a native function. Throws exception in case of any errors.
+			/// @param vm The virtual machine.
+			/// @param location The code location of the call.
+			/// @param expectedType Definition of the expected type.
+			/// @param actualArguments The actual argument objects. If a conversion is performed, the argument is replaced with result of the conversion.
+			/// @param index Index of the argument to check.
+			void CheckArgument(VirtualMachine* vm, CodeLocation location, TypeDefinition const* expectedType, NativeArgumentList& actualArguments, unsigned index) const;
+
 			/// Helper method which performs type checks and type conversions (if required) on input arguments. Throws exception in case of any errors.
-			/// @param vm If non-null, the virtual memory.
+			/// @param vm The virtual machine.
+			/// @param location The code location.
+			/// @param expectedTypes Array of definitions of expected parameters.
+			/// @param expectedTypeCount Number of items in @a expectedTypes.
+			/// @param actualArguments The actual argument objects. If any conversions are performed, the appropriate object in the list is replaced with result of the conversion.
+			/// @param requiredArgumentCount Number of required arguments, if -1 all arguments are
+			/// required.
+			void CheckArguments(VirtualMachine* vm, CodeLocation location, TypeDefinition const* const* expectedTypes, unsigned expectedTypeCount, NativeArgumentList& actualArguments, int requiredArgumentCount = -1) const;
+
+			/// Helper method which performs type checks and type conversions (if required) on input arguments. Throws exception in case of any errors. The expected types are declared as a fixed-size array, so no allocations are necessary.
+			/// @param vm The virtual machine.
 			/// @param location The code location.
-			/// @param expectedTypes The list of definitions of expected parameters.
-			/// @param actualArguments The actual argument objects. If any conversions are performed, the appropriate object in the vector is replaced with result of the conversion.
+			/// @param expectedTypes Array of definitions of expected parameters.
+			/// @param actualArguments The actual argument objects. If any conversions are performed, the appropriate object in the list is replaced with result of the conversion.
 			/// @param requiredArgumentCount Number of required arguments, if -1 all arguments are
 			/// required.
-			/// @return Vector of holders of any objects that produced in conversions.
-			std::vector<ManagedObjectHolder> CheckArguments(VirtualMachine* vm, CodeLocation location, std::vector<TypeDefinition const*> expectedTypes, std::vector<ManagedObject*>& actualArguments, int requiredArgumentCount = -1) const;
+			template<unsigned N>
+			inline void CheckArguments(VirtualMachine* vm, CodeLocation location, TypeDefinition const* (&expectedTypes)[N], NativeArgumentList& actualArguments, int requiredArgumentCount = -1) const
+			{
+				this->CheckArguments(vm, location, expectedTypes, N, actualArguments, requiredArgumentCount);
+			}
 
 			/// Check a count of actual arguments against a list of expected parameters. If these don't match, an exception is thrown.
 			/// @param location The code location.
 			/// @param expectedArgumentCount The expected number of arguments.
 			/// @param actualArguments The actual arguments.
-			void CheckArguments(CodeLocation location, unsigned expectedArgumentCount, std::vector<ManagedObject*> actualArguments) const;
+			void CheckArguments(CodeLocation location, unsigned expectedArgumentCount, NativeArgumentList const& actualArguments) const;
 
 			virtual void Serialize(IOStream& stream) const = 0;
 		};
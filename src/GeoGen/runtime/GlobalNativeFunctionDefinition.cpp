@@ -36,29 +36,23 @@ void GlobalNativeFunctionDefinition::Call(CodeLocation location, VirtualMachine*
 	ObjectStack& objectStack = vm->GetObjectStack();
 	CallStack& callStack = vm->GetCallStack();
 
-	// Pop the arguments from the stack	
-	objectStack.CheckSize(numberOfArguments);
-
-	vector<ManagedObject*> arguments;
-	for (unsigned i = 0; i < numberOfArguments; i++)
-	{
-		arguments.push_back(objectStack.Top());
-		objectStack.Top()->AddRef();
-		objectStack.Pop(vm);
-	}
-
-	reverse(arguments.begin(), arguments.end());
+	// The arguments stay on the stack (which keeps them alive) for the duration of the call
+	NativeArgumentList arguments(objectStack.GetTopItems(numberOfArguments), numberOfArguments);
 
 	ManagedObject* returnValue = this->CallNative(location, vm, arguments);
 
 	callStack.Pop();
 
+	// The return value might be one of the arguments, so it has to be held while they are popped
+	returnValue->AddRef();
+
 	for (unsigned i = 0; i < numberOfArguments; i++)
 	{
-		arguments[i]->RemoveRef(vm->GetMemoryManager());
+		objectStack.Pop(vm);
 	}
 
 	objectStack.Push(location, returnValue);
+	returnValue->RemoveRef(vm->GetMemoryManager());
 }
 
 void GlobalNativeFunctionDefinition::Serialize(IOStream& stream) const
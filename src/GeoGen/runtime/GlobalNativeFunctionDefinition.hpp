@@ -40,7 +40,7 @@ namespace geogen
 
 			virtual void Call(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, unsigned numberOfArguments) const;
 
-			virtual ManagedObject* CallNative(CodeLocation location, VirtualMachine* vm, std::vector<ManagedObject*> arguments) const = 0;
+			virtual ManagedObject* CallNative(CodeLocation location, VirtualMachine* vm, NativeArgumentList& arguments) const = 0;
 
 			virtual void Serialize(IOStream& stream) const;
 		};
@@ -0,0 +1,63 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+
+#include "ObjectId.hpp"
+
+namespace geogen
+{
+	namespace runtime
+	{
+		class TypeDefinition;
+		class FunctionDefinition;
+		class VariableTableItem;
+
+		/// Inline cache slot of an instruction which wasn't assigned any slot. Such instruction always performs the lookup by name.
+		static const unsigned NO_INLINE_CACHE_SLOT = std::numeric_limits<unsigned>::max();
+
+		/// Monomorphic inline cache of a single member access instruction (CallMember or LoadMemberValue), remembering the receiver the instruction resolved last time. The entries are owned by each VirtualMachine (see VirtualMachine::GetInlineCacheEntry), so virtual machines running the same CompiledScript don't share any mutable state.
+		struct InlineCacheEntry
+		{
+			/// CallMember: Type of the last receiver.
+			TypeDefinition const* ReceiverType;
+
+			/// CallMember: Whether the last receiver was the static object of its type.
+			bool IsStaticReceiver;
+
+			/// CallMember: The function resolved for the last receiver.
+			FunctionDefinition const* Function;
+
+			/// LoadMemberValue: Object ID of the last receiver. Member variables are stored per instance, so the receiver is identified by its ID.
+			ObjectId ReceiverObjectId;
+
+			/// LoadMemberValue: The member variable resolved for the last receiver.
+			VariableTableItem* Variable;
+
+			/// LoadMemberValue: Whether the member variable is a render rectangle parameter.
+			bool IsRenderRectangleAccess;
+
+			/// LoadMemberValue: Whether the member variable is a render scale dependent parameter.
+			bool IsRenderScaleAccess;
+
+			/// Initializes an empty entry, which doesn't match any receiver.
+			InlineCacheEntry() : ReceiverType(NULL), IsStaticReceiver(false), Function(NULL), ReceiverObjectId(UNASSIGNED_OBJECT_ID), Variable(NULL), IsRenderRectangleAccess(false), IsRenderScaleAccess(false) {}
+		};
+	}
+}
\ No newline at end of file
@@ -0,0 +1,42 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include "InlineCacheStatistics.hpp"
+
+using namespace geogen::runtime;
+
+double InlineCacheStatistics::GetHitRate() const
+{
+	unsigned long long total = this->hitCount + this->missCount;
+	if (total == 0)
+	{
+		return 0;
+	}
+
+	return this->hitCount / (double)total;
+}
+
+void InlineCacheStatistics::Add(InlineCacheStatistics const& other)
+{
+	this->hitCount += other.hitCount;
+	this->missCount += other.missCount;
+}
+
+void InlineCacheStatistics::Reset()
+{
+	this->hitCount = 0;
+	this->missCount = 0;
+}
@@ -0,0 +1,59 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+namespace geogen
+{
+	namespace runtime
+	{
+		/// Counters of hits and misses of the monomorphic inline caches used by member access instructions (CallMember and LoadMemberValue) of a single VirtualMachine. Each of these instructions remembers the receiver it resolved last time (see InlineCacheEntry) and skips the lookup by name when the same receiver is seen again.
+		class InlineCacheStatistics
+		{
+		private:
+			unsigned long long hitCount;
+			unsigned long long missCount;
+		public:
+			/// Initializes both counters to zero.
+			InlineCacheStatistics() : hitCount(0), missCount(0) {};
+
+			/// Records a lookup which was served from an inline cache.
+			inline void RegisterHit() { this->hitCount++; }
+
+			/// Records a lookup which had to be performed by name.
+			inline void RegisterMiss() { this->missCount++; }
+
+			/// Gets number of lookups served from inline caches since the last Reset.
+			/// @return The hit count.
+			inline unsigned long long GetHitCount() const { return this->hitCount; }
+
+			/// Gets number of lookups which missed the inline caches since the last Reset.
+			/// @return The miss count.
+			inline unsigned long long GetMissCount() const { return this->missCount; }
+
+			/// Gets ratio of hits to all lookups since the last Reset.
+			/// @return The hit rate in range [0, 1]. 0 if no lookups were performed.
+			double GetHitRate() const;
+
+			/// Adds counters of another statistics object to this one, e.g. to sum statistics of multiple virtual machines.
+			/// @param other The other statistics.
+			void Add(InlineCacheStatistics const& other);
+
+			/// Resets both counters to zero.
+			void Reset();
+		};
+	}
+}
@@ -33,18 +33,8 @@ void MemberNativeFunctionDefinition::Call(CodeLocation location, VirtualMachine*
 	runtime::ObjectStack& objectStack = vm->GetObjectStack();
 	CallStack& callStack = vm->GetCallStack();
 
-	// Pop the arguments from the stack	
-	objectStack.CheckSize(numberOfArguments);
-
-	vector<ManagedObject*> arguments;
-	for (unsigned i = 0; i < numberOfArguments; i++)
-	{
-		arguments.push_back(objectStack.Top());
-		objectStack.Top()->AddRef();
-		objectStack.Pop(vm);
-	}
-
-	reverse(arguments.begin(), arguments.end());
+	// The arguments stay on the stack (which keeps them alive) for the duration of the call
+	NativeArgumentList arguments(objectStack.GetTopItems(numberOfArguments), numberOfArguments);
 
 	if (instance->GetType() != this->GetOwningTypeDefinition())
 	{
@@ -64,12 +54,16 @@ void MemberNativeFunctionDefinition::Call(CodeLocation location, VirtualMachine*
 
 	callStack.Pop();
 
+	// The return value might be one of the arguments, so it has to be held while they are popped
+	returnValue->AddRef();
+
 	for (unsigned i = 0; i < numberOfArguments; i++)
 	{
-		arguments[i]->RemoveRef(vm->GetMemoryManager());
+		objectStack.Pop(vm);
 	}
 
 	objectStack.Push(location, returnValue);
+	returnValue->RemoveRef(vm->GetMemoryManager());
 }
 
 void MemberNativeFunctionDefinition::Serialize(IOStream& stream) const
@@ -48,9 +48,9 @@ namespace geogen
 			/// @param location The code location.
 			/// @param vm The virtual machine.
 			/// @param instance Instance on which the function is being called, if it is being called as a member method.
-			/// @param arguments The arguments.
+			/// @param arguments The arguments. Refers directly to the object stack, the arguments are not copied.
 			/// @return The return value.
-			virtual ManagedObject* CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, std::vector<ManagedObject*> arguments) const = 0;
+			virtual ManagedObject* CallNative(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, NativeArgumentList& arguments) const = 0;
 
 			virtual void Call(CodeLocation location, VirtualMachine* vm, ManagedObject* instance, unsigned numberOfArguments) const;
 
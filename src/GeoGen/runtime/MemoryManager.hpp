@@ -61,6 +61,10 @@ namespace geogen
 			/// @return true if in cleanup mode, false if not.
 			bool IsInCleanupMode() const { return this->cleanupMode; }
 
+			/// Gets number of objects registered with the manager since its creation, including objects which were already destroyed.
+			/// @return The number of registered objects.
+			inline unsigned GetRegisteredObjectCount() const { return this->nextObjectId - MIN_OBJECT_ID; }
+
 			virtual void Serialize(IOStream& stream) const;
 		};
 	}
@@ -0,0 +1,29 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include "NativeArgumentList.hpp"
+#include "ManagedObject.hpp"
+#include "VirtualMachine.hpp"
+
+using namespace geogen;
+using namespace geogen::runtime;
+
+void NativeArgumentList::Replace(VirtualMachine* vm, unsigned index, ManagedObject* object)
+{
+	object->AddRef();
+	this->arguments[index]->RemoveRef(vm->GetMemoryManager());
+	this->arguments[index] = object;
+}
@@ -34,6 +34,12 @@ const unsigned ObjectStack::SIZE_LIMIT = 1000;
 	}
 }*/
 
+ObjectStack::ObjectStack()
+{
+	// Reserving the full capacity up front keeps pointers returned by GetTopItems valid while new objects are pushed.
+	this->stack.reserve(SIZE_LIMIT);
+}
+
 ManagedObject* ObjectStack::Top()
 {
 	if (this->stack.size() < 1)
@@ -56,6 +62,18 @@ void ObjectStack::Pop(VirtualMachine* vm)
 	this->stack.pop_back();
 }
 
+ManagedObject** ObjectStack::GetTopItems(unsigned count)
+{
+	this->CheckSize(count);
+
+	if (count == 0)
+	{
+		return NULL;
+	}
+
+	return &this->stack[this->stack.size() - count];
+}
+
 void ObjectStack::Push(CodeLocation location, ManagedObject* object)
 {	
 	if (SIZE_LIMIT == this->stack.size())
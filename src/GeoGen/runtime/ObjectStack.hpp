@@ -16,7 +16,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 
 #pragma once
 
-#include <deque>
+#include <vector>
 
 #include "../Serializable.hpp"
 #include "../CodeLocation.hpp"
@@ -31,7 +31,7 @@ namespace geogen
 		/// Data structure containing in-expression objects and objects being passed into/from a function. 
 		class ObjectStack : public Serializable
 		{
-			std::deque<ManagedObject*> stack;
+			std::vector<ManagedObject*> stack;
 
 			// Non-copyable
 			ObjectStack(ObjectStack const&) {};
@@ -41,20 +41,20 @@ namespace geogen
 			static const unsigned SIZE_LIMIT;
 
 			/// Default constructor.
-			ObjectStack() {};
+			ObjectStack();
 			//~ObjectStack();
 
 			/// A constant iterator.
-			typedef std::deque<ManagedObject*>::const_iterator const_iterator;
+			typedef std::vector<ManagedObject*>::const_iterator const_iterator;
 
 			/// An iterator.
-			typedef std::deque<ManagedObject*>::iterator iterator;
+			typedef std::vector<ManagedObject*>::iterator iterator;
 
 			/// A constant reverse iterator.
-			typedef std::deque<ManagedObject*>::const_reverse_iterator const_reverse_iterator;
+			typedef std::vector<ManagedObject*>::const_reverse_iterator const_reverse_iterator;
 
 			/// An reverse iterator.
-			typedef std::deque<ManagedObject*>::reverse_iterator reverse_iterator;
+			typedef std::vector<ManagedObject*>::reverse_iterator reverse_iterator;
 
 			/// Gets the topmost entry in the stack. Throws an exception if the stack is empty.
 			/// @return A reference to the topmost entry in the stack.
@@ -63,6 +63,11 @@ namespace geogen
 			/// Removes the topmost object from the stack. Throws an exception if the stack is empty.
 			void Pop(VirtualMachine* vm);
 
+			/// Gets given number of topmost objects, ordered from the bottommost to the topmost one. The stack never reallocates its storage, so the returned pointer remains valid until the objects are popped.
+			/// @param count Number of objects. Throws an exception if there are fewer objects on the stack.
+			/// @return Pointer to the first (bottommost) of the objects.
+			ManagedObject** GetTopItems(unsigned count);
+
 			/// Pushes an object onto this stack.
 			/// @param location The code location.
 			/// @param object The object.
@@ -78,11 +83,11 @@ namespace geogen
 
 			/// Gets an iterator pointing to the first (bottommost) item on the stack or the end iterator, if the stack is empty.
 			/// @return An iterator.
-			inline const_iterator Begin() const { std::deque<ManagedObject*>::const_iterator it = this->stack.begin(); return (const_iterator&)(it); }
+			inline const_iterator Begin() const { std::vector<ManagedObject*>::const_iterator it = this->stack.begin(); return (const_iterator&)(it); }
 
 			/// Gets the end iterator.
 			/// @return An iterator.
-			inline const_iterator End() const { std::deque<ManagedObject*>::const_iterator it = this->stack.end(); return (const_iterator&)(it); }
+			inline const_iterator End() const { std::vector<ManagedObject*>::const_iterator it = this->stack.end(); return (const_iterator&)(it); }
 
 			/// Gets an iterator pointing to the first (bottommost) item on the stack.
 			/// @return An iterator.
@@ -94,11 +99,11 @@ namespace geogen
 
 			/// Gets a reverse iterator pointing to the last (topmost) item on the stack.
 			/// @return An iterator.
-			inline const_reverse_iterator RBegin() const { std::deque<ManagedObject*>::const_reverse_iterator it = this->stack.rbegin(); return (const_reverse_iterator&)(it); }
+			inline const_reverse_iterator RBegin() const { std::vector<ManagedObject*>::const_reverse_iterator it = this->stack.rbegin(); return (const_reverse_iterator&)(it); }
 
 			/// Gets the reverse end iterator.
 			/// @return An iterator.
-			inline const_reverse_iterator REnd() const { std::deque<ManagedObject*>::const_reverse_iterator it = this->stack.rend(); return (const_reverse_iterator&)(it); }
+			inline const_reverse_iterator REnd() const { std::vector<ManagedObject*>::const_reverse_iterator it = this->stack.rend(); return (const_reverse_iterator&)(it); }
 
 			/// Gets a reverse iterator pointing to the last (topmost) item on the stack.
 			/// @return An iterator.
@@ -111,6 +111,64 @@ void ScriptParameters::SetMapHeight(unsigned height)
 	this->mapHeight = min(this->maxMapHeight, height);
 }
 
+Rectangle ScriptParameters::GetActualRenderRectangle() const
+{
+	Coordinate renderOriginX = this->GetRenderOriginX();
+	Size1D renderWidth = this->GetRenderWidth();
+	if (renderWidth == MAP_SIZE_AUTOMATIC)
+	{
+		if (this->GetMaxMapWidth() != MAP_SIZE_INFINITE)
+		{
+			renderWidth = this->GetMapWidth();
+		}
+		else
+		{
+			renderWidth = RENDER_SIZE_DEFAULT;
+		}
+	}
+
+	if (this->GetMaxMapWidth() != MAP_SIZE_INFINITE)
+	{
+		renderOriginX = max(renderOriginX, 0);
+		renderWidth = min(Size1D(this->GetMapWidth()) - renderOriginX, renderWidth);
+	}
+
+	Coordinate renderOriginY = this->GetRenderOriginY();
+	Size1D renderHeight = this->GetRenderHeight();
+	if (renderHeight == MAP_SIZE_AUTOMATIC)
+	{
+		if (this->GetMaxMapHeight() != MAP_SIZE_INFINITE)
+		{
+			renderHeight = this->GetMapHeight();
+		}
+		else
+		{
+			renderHeight = RENDER_SIZE_DEFAULT;
+		}
+	}
+
+	if (this->GetMaxMapHeight() != MAP_SIZE_INFINITE)
+	{
+		renderOriginY = max(renderOriginY, 0);
+		renderHeight = min(Size1D(this->GetMapHeight()) - renderOriginY, renderHeight);
+	}
+
+	return Rectangle(Point(this->GetRenderOriginX(), this->GetRenderOriginY()), Size2D(renderWidth, renderHeight));
+}
+
+bool ScriptParameters::IsMapSizeRenderScaleDependent(Direction direction) const
+{
+	switch (direction)
+	{
+	case DIRECTION_HORIZONTAL:
+		return this->mapWidth == MAP_SIZE_AUTOMATIC && this->GetMaxMapWidth() != MAP_SIZE_INFINITE;
+	case DIRECTION_VERTICAL:
+		return this->mapHeight == MAP_SIZE_AUTOMATIC && this->GetMaxMapHeight() != MAP_SIZE_INFINITE;
+	default:
+		throw ApiUsageException(GG_STR("Invalid direction."));
+	}
+}
+
 bool ScriptParameters::IsMapInfinite(Direction direction) const
 {
 	switch (direction)
@@ -252,6 +252,10 @@ namespace geogen
 				this->SetRenderHeight(renderRectangle.GetSize().GetHeight());
 			};
 
+			/// Gets the rectangle which will actually be rendered into the yielded maps (automatic render size resolved and the render size limited by the map size if the map is finite).
+			/// @return The actual render rectangle.
+			Rectangle GetActualRenderRectangle() const;
+
 			/// Gets scale of the render.
 			/// @return Scale of the render.
 			inline double GetRenderScale() const { return this->renderScale; };
@@ -278,6 +282,11 @@ namespace geogen
 			/// @return true if the map is infinite in given direction, false otherwise.
 			bool IsMapInfinite(Direction direction) const;
 
+			/// Determines whether the map size in given direction is derived from the render size and the render scale (which is the case for finite maps whose size wasn't set explicitly).
+			/// @param direction The direction.
+			/// @return true if the map size depends on the render scale, false otherwise.
+			bool IsMapSizeRenderScaleDependent(Direction direction) const;
+
 			/// Resets all parameters to their default values.
 			void ResetToDefaults();
 
@@ -0,0 +1,226 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include <algorithm>
+#include <iomanip>
+
+#include "ScriptProfiler.hpp"
+#include "VirtualMachine.hpp"
+#include "CallStackEntry.hpp"
+#include "CodeBlockStackEntry.hpp"
+#include "FunctionDefinition.hpp"
+#include "instructions/Instruction.hpp"
+#include "../utils/WallClock.hpp"
+#include "../utils/StringUtils.hpp"
+
+using namespace std;
+using namespace geogen;
+using namespace runtime;
+using namespace utils;
+
+namespace
+{
+	template<typename TKey>
+	bool CompareEntriesByTime(pair<TKey, ScriptProfilerEntry> const& a, pair<TKey, ScriptProfilerEntry> const& b)
+	{
+		return a.second.Time > b.second.Time;
+	}
+
+	void WriteTime(OStream& stream, unsigned long long time, unsigned long long totalTime)
+	{
+		stream << setw(10) << fixed << setprecision(3) << (time / 1000.0) << " ";
+		stream << setw(6) << fixed << setprecision(1) << (totalTime > 0 ? time * 100.0 / totalTime : 0.0) << " ";
+	}
+}
+
+ScriptProfiler::ScriptProfiler()
+: stepLine(-1), stepStartTime(0), stepStartAllocationCount(0), stepNativeTime(0), nativeCallStartTime(0), nativeCallStartAllocationCount(0)
+{
+}
+
+void ScriptProfiler::UpdateCurrentStack(VirtualMachine const& vm)
+{
+	CallStack const& callStack = vm.GetCallStack();
+
+	bool changed = callStack.Size() != this->currentStack.size();
+	if (!changed)
+	{
+		vector<FunctionDefinition const*>::const_iterator cachedIt = this->currentStack.begin();
+		for (CallStack::const_iterator it = callStack.Begin(); it != callStack.End(); it++, cachedIt++)
+		{
+			if ((*it)->GetFunctionDefinition() != *cachedIt)
+			{
+				changed = true;
+				break;
+			}
+		}
+	}
+
+	if (!changed)
+	{
+		return;
+	}
+
+	this->currentStack.clear();
+	this->currentStackName = GG_STR("");
+	for (CallStack::const_iterator it = callStack.Begin(); it != callStack.End(); it++)
+	{
+		FunctionDefinition const* functionDefinition = (*it)->GetFunctionDefinition();
+		if (!this->currentStack.empty())
+		{
+			this->currentStackName += GG_STR(";");
+		}
+
+		this->currentStack.push_back(functionDefinition);
+		this->currentStackName += functionDefinition->GetName();
+	}
+}
+
+void ScriptProfiler::BeforeStep(VirtualMachine& vm)
+{
+	this->UpdateCurrentStack(vm);
+
+	this->stepLine = -1;
+	CallStackEntry const& callStackEntry = vm.GetCallStack().Top();
+	if (!callStackEntry.GetCodeBlockStack().IsEmpty())
+	{
+		instructions::Instruction const* instruction = callStackEntry.GetCodeBlockStack().Top().GetCurrentInstruction();
+		if (instruction != NULL)
+		{
+			this->stepLine = instruction->GetLocation().GetLine();
+		}
+	}
+
+	this->stepNativeTime = 0;
+	this->stepStartAllocationCount = vm.GetMemoryManager().GetRegisteredObjectCount();
+	this->stepStartTime = GetWallClockMicroseconds();
+}
+
+void ScriptProfiler::AfterStep(VirtualMachine& vm)
+{
+	unsigned long long time = GetWallClockMicroseconds() - this->stepStartTime;
+	unsigned allocationCount = vm.GetMemoryManager().GetRegisteredObjectCount() - this->stepStartAllocationCount;
+
+	this->total.Count++;
+	this->total.Time += time;
+	this->total.AllocationCount += allocationCount;
+
+	if (this->stepLine >= 0)
+	{
+		ScriptProfilerEntry& lineEntry = this->lineEntries[this->stepLine];
+		lineEntry.Count++;
+		lineEntry.Time += time;
+		lineEntry.AllocationCount += allocationCount;
+	}
+
+	// Time spent in native functions was already attributed to their own stacks.
+	ScriptProfilerEntry& stackEntry = this->stackEntries[this->currentStackName];
+	stackEntry.Count++;
+	stackEntry.Time += time > this->stepNativeTime ? time - this->stepNativeTime : 0;
+	stackEntry.AllocationCount += allocationCount;
+}
+
+void ScriptProfiler::BeforeNativeCall(VirtualMachine& vm, FunctionDefinition const* functionDefinition)
+{
+	this->nativeCallStartAllocationCount = vm.GetMemoryManager().GetRegisteredObjectCount();
+	this->nativeCallStartTime = GetWallClockMicroseconds();
+}
+
+void ScriptProfiler::AfterNativeCall(VirtualMachine& vm, FunctionDefinition const* functionDefinition)
+{
+	unsigned long long time = GetWallClockMicroseconds() - this->nativeCallStartTime;
+	unsigned allocationCount = vm.GetMemoryManager().GetRegisteredObjectCount() - this->nativeCallStartAllocationCount;
+
+	ScriptProfilerEntry& functionEntry = this->nativeFunctionEntries[functionDefinition->GetName()];
+	functionEntry.Count++;
+	functionEntry.Time += time;
+	functionEntry.AllocationCount += allocationCount;
+
+	String stackName = this->currentStackName.empty() ? functionDefinition->GetName() : this->currentStackName + GG_STR(";") + functionDefinition->GetName();
+	ScriptProfilerEntry& stackEntry = this->stackEntries[stackName];
+	stackEntry.Count++;
+	stackEntry.Time += time;
+	stackEntry.AllocationCount += allocationCount;
+
+	this->stepNativeTime += time;
+}
+
+void ScriptProfiler::Reset()
+{
+	this->lineEntries.clear();
+	this->nativeFunctionEntries.clear();
+	this->stackEntries.clear();
+	this->total = ScriptProfilerEntry();
+	this->currentStack.clear();
+	this->currentStackName = GG_STR("");
+}
+
+void ScriptProfiler::WriteReport(OStream& stream, String const& code, unsigned maxLineCount) const
+{
+	vector<String> codeLines = StringToLines(code);
+
+	vector<pair<int, ScriptProfilerEntry> > sortedLines(this->lineEntries.begin(), this->lineEntries.end());
+	stable_sort(sortedLines.begin(), sortedLines.end(), CompareEntriesByTime<int>);
+
+	stream << "Executed " << this->total.Count << " instructions in " << fixed << setprecision(3) << (this->total.Time / 1000.0) << " ms, " << this->total.AllocationCount << " objects allocated." << endl << endl;
+
+	stream << "  Line    Time ms      % Instructions  Allocations  Code" << endl;
+	for (unsigned i = 0; i < sortedLines.size() && i < maxLineCount; i++)
+	{
+		int line = sortedLines[i].first;
+		ScriptProfilerEntry const& entry = sortedLines[i].second;
+
+		stream << setw(6) << line << " ";
+		WriteTime(stream, entry.Time, this->total.Time);
+		stream << setw(12) << entry.Count << " " << setw(12) << entry.AllocationCount << "  ";
+
+		if (line >= 1 && (unsigned)line <= codeLines.size())
+		{
+			String codeLine = codeLines[line - 1];
+			String::size_type start = codeLine.find_first_not_of(GG_STR(" \t\r"));
+			String::size_type end = codeLine.find_last_not_of(GG_STR(" \t\r"));
+			stream << (start == String::npos ? GG_STR("") : codeLine.substr(start, end - start + 1));
+		}
+
+		stream << endl;
+	}
+
+	if (this->nativeFunctionEntries.empty())
+	{
+		return;
+	}
+
+	vector<pair<String, ScriptProfilerEntry> > sortedFunctions(this->nativeFunctionEntries.begin(), this->nativeFunctionEntries.end());
+	stable_sort(sortedFunctions.begin(), sortedFunctions.end(), CompareEntriesByTime<String>);
+
+	stream << endl << "Native function           Time ms      %        Calls  Allocations" << endl;
+	for (unsigned i = 0; i < sortedFunctions.size() && i < maxLineCount; i++)
+	{
+		ScriptProfilerEntry const& entry = sortedFunctions[i].second;
+
+		stream << left << setw(24) << sortedFunctions[i].first << right << " ";
+		WriteTime(stream, entry.Time, this->total.Time);
+		stream << setw(12) << entry.Count << " " << setw(12) << entry.AllocationCount << endl;
+	}
+}
+
+void ScriptProfiler::WriteCollapsedStacks(OStream& stream) const
+{
+	for (NamedEntryMap::const_iterator it = this->stackEntries.begin(); it != this->stackEntries.end(); it++)
+	{
+		stream << it->first << " " << it->second.Time << endl;
+	}
+}
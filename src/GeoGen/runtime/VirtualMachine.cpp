@@ -31,6 +31,8 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 #include "../utils/StringUtils.hpp"
 #include "RenderingSequenceTooLongException.hpp"
 #include "../renderer/RenderingStep.hpp"
+#include "ScriptFunctionDefinition.hpp"
+#include "ScriptProfiler.hpp"
 
 using namespace std;
 using namespace geogen;
@@ -50,7 +52,11 @@ VirtualMachine::VirtualMachine(CompiledScript const& compiledScript, ScriptParam
 	scriptMessageHandler(DefaultScriptMessageHandler), 
 	commonRandomSequence(arguments.GetRandomSeed()),
 	instructionCounter(0),
-	callbackData(NULL)
+	inlineCacheEntries(compiledScript.GetInlineCacheSlotCount()),
+	booleanTypeDefinition(NULL),
+	numberTypeDefinition(NULL),
+	callbackData(NULL),
+	scriptProfiler(NULL)
 {
 	this->ValidateArguments();
 	this->InitializeTypes();
@@ -147,7 +153,17 @@ VirtualMachineStepResult VirtualMachine::Step()
 	CallStackEntry& callStackEntry = this->callStack.Top();
 
 	this->instructionCounter++;
+	if (this->scriptProfiler != NULL)
+	{
+		this->scriptProfiler->BeforeStep(*this);
+	}
+
 	CallStackEntryStepResult stepResult = callStackEntry.Step(this);
+
+	if (this->scriptProfiler != NULL)
+	{
+		this->scriptProfiler->AfterStep(*this);
+	}
 	
 	if (stepResult == CALL_STACK_ENTRY_STEP_RESULT_FINISHED)
 	{
@@ -176,6 +192,14 @@ void VirtualMachine::CallFunction(CodeLocation location, FunctionDefinition cons
 {
 	this->callStack.Push(location, functionDefinition);
 
+	if (this->scriptProfiler != NULL && dynamic_cast<ScriptFunctionDefinition const*>(functionDefinition) == NULL)
+	{
+		this->scriptProfiler->BeforeNativeCall(*this, functionDefinition);
+		functionDefinition->Call(location, this, instance, numberOfArguments);
+		this->scriptProfiler->AfterNativeCall(*this, functionDefinition);
+		return;
+	}
+
 	functionDefinition->Call(location, this, instance, numberOfArguments);
 }
 
@@ -216,12 +240,22 @@ TypeDefinition const* VirtualMachine::GetTypeDefinition(String const& typeName)
 
 corelib::BooleanTypeDefinition const* VirtualMachine::GetBooleanTypeDefinition() const
 {
-	return dynamic_cast<corelib::BooleanTypeDefinition const*>(this->GetTypeDefinition(GG_STR("Boolean")));
+	if (this->booleanTypeDefinition == NULL)
+	{
+		this->booleanTypeDefinition = dynamic_cast<corelib::BooleanTypeDefinition const*>(this->GetTypeDefinition(GG_STR("Boolean")));
+	}
+
+	return this->booleanTypeDefinition;
 }
 
 corelib::NumberTypeDefinition const* VirtualMachine::GetNumberTypeDefinition() const
 {
-	return dynamic_cast<corelib::NumberTypeDefinition const*>(this->GetTypeDefinition(GG_STR("Number")));
+	if (this->numberTypeDefinition == NULL)
+	{
+		this->numberTypeDefinition = dynamic_cast<corelib::NumberTypeDefinition const*>(this->GetTypeDefinition(GG_STR("Number")));
+	}
+
+	return this->numberTypeDefinition;
 }
 
 VariableTableItem* VirtualMachine::FindVariable(String const& variableName)
@@ -27,6 +27,8 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 #include "CallStack.hpp"
 #include "ObjectStack.hpp"
 #include "ScriptParameters.hpp"
+#include "InlineCacheEntry.hpp"
+#include "InlineCacheStatistics.hpp"
 #include "../renderer/RenderingSequence.hpp"
 #include "../renderer/RendererObjectSlotTable.hpp"
 #include "../random/RandomSequence.hpp"
@@ -48,6 +50,7 @@ namespace geogen
 	{
 		class ManagedObject;
 		class VariableTableItem;
+		class ScriptProfiler;
 
 		/// Statuses of the VirtualMachine.
 		enum VirtualMachineStatus
@@ -102,15 +105,24 @@ namespace geogen
 			void ValidateArguments();
 
 			// Non-copyable
-			VirtualMachine(VirtualMachine const&) : globalVariableTable(NULL), compiledScript(compiledScript), scriptMessageHandler(DefaultScriptMessageHandler), renderingSequence(0), commonRandomSequence(0), instructionCounter(0), callbackData(NULL) {};
+			VirtualMachine(VirtualMachine const&) : globalVariableTable(NULL), compiledScript(compiledScript), scriptMessageHandler(DefaultScriptMessageHandler), renderingSequence(0), commonRandomSequence(0), instructionCounter(0), callbackData(NULL), scriptProfiler(NULL) {};
 			VirtualMachine& operator=(VirtualMachine const&) {};
 
 			void* callbackData;
 
+			ScriptProfiler* scriptProfiler;
+
 			random::RandomSequence commonRandomSequence;
 
 			std::vector<String> generatedMaps;
 
+			std::vector<InlineCacheEntry> inlineCacheEntries;
+			InlineCacheStatistics inlineCacheStatistics;
+
+			// Looked up on first use, operators need these on every call.
+			mutable corelib::BooleanTypeDefinition const* booleanTypeDefinition;
+			mutable corelib::NumberTypeDefinition const* numberTypeDefinition;
+
 			void Finish();
 		public:
 			/// Default (empty) script parameters obeject.
@@ -128,6 +140,19 @@ namespace geogen
 			/// @return The status.
 			inline VirtualMachineStatus GetStatus() const { return this->status; }
 
+			/// Gets inline cache entry of a member access instruction. Each VM has its own entries, so multiple virtual machines can run the same compiled script simultaneously.
+			/// @param slot The inline cache slot assigned to the instruction by the compiler (see CompiledScript::GetInlineCacheSlotCount).
+			/// @return The entry.
+			inline InlineCacheEntry& GetInlineCacheEntry(unsigned slot) { return this->inlineCacheEntries[slot]; }
+
+			/// Gets statistics of inline caches of this VM.
+			/// @return The statistics.
+			inline InlineCacheStatistics& GetInlineCacheStatistics() { return this->inlineCacheStatistics; }
+
+			/// Gets statistics of inline caches of this VM.
+			/// @return The statistics.
+			inline InlineCacheStatistics const& GetInlineCacheStatistics() const { return this->inlineCacheStatistics; }
+
 			/// Gets memory manager.
 			/// @return The memory manager.
 			inline MemoryManager& GetMemoryManager() { return this->memoryManager; }
@@ -269,6 +294,14 @@ namespace geogen
 			/// @param callbackData The callback data pointer. The VM does not assume ownership of this pointer.
 			inline void SetCallbackData(void* callbackData) { this->callbackData = callbackData; }
 
+			/// Gets the script profiler collecting statistics of this VM's execution.
+			/// @return The profiler if set, null otherwise.
+			inline ScriptProfiler* GetScriptProfiler() const { return this->scriptProfiler; }
+
+			/// Sets the script profiler which will collect statistics of all subsequent steps. Profiling is disabled when no profiler is set (the default).
+			/// @param scriptProfiler The profiler or null. The VM does not assume ownership of this pointer.
+			inline void SetScriptProfiler(ScriptProfiler* scriptProfiler) { this->scriptProfiler = scriptProfiler; }
+
 			/// Adds a step to the rendering sequence. Throws overflow exception if too large.
 			/// @param location The code location.
 			/// @param renderingStep The rendering step.
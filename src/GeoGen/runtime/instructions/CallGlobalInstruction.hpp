@@ -36,6 +36,9 @@ namespace geogen
 					this->argumentCount = argumentCount;
 				}
 
+				inline String const& GetFunctionName() const { return this->functionName; };
+				inline int GetArgumentCount() const { return this->argumentCount; };
+
 				virtual void Serialize(IOStream& stream) const { stream << "CallGlobal " << functionName << " " << argumentCount; }
 
 				virtual String GetInstructionName() const { return GG_STR("CallGlobal"); };
@@ -21,6 +21,8 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 #include "../UndefinedSymbolAccessException.hpp"
 #include "../ManagedObject.hpp"
 #include "../NullReferenceException.hpp"
+#include "../InlineCacheStatistics.hpp"
+#include "../TypeDefinition.hpp"
 
 using namespace std;
 using namespace geogen::runtime;
@@ -40,18 +42,39 @@ InstructionStepResult CallMemberInstruction::Step(VirtualMachine* vm) const
 		throw NullReferenceException(this->GetLocation());
 	}
 
-	if (instance->IsStaticObject())
+	TypeDefinition const* type = instance->GetType();
+	bool isStatic = instance->IsStaticObject();
+
+	// Instructions without a slot (never assigned by the compiler) use a temporary entry, which always misses.
+	InlineCacheEntry uncachedEntry;
+	InlineCacheEntry& cacheEntry = this->inlineCacheSlot != NO_INLINE_CACHE_SLOT ? vm->GetInlineCacheEntry(this->inlineCacheSlot) : uncachedEntry;
+
+	// Type definitions live as long as the compiled script, so the cached pointers can't dangle.
+	if (type == cacheEntry.ReceiverType && isStatic == cacheEntry.IsStaticReceiver)
 	{
-		functionDefinition = instance->GetType()->GetStaticFunctionDefinitions().GetItem(this->functionName);
+		functionDefinition = cacheEntry.Function;
+		vm->GetInlineCacheStatistics().RegisterHit();
 	}
 	else
 	{
-		functionDefinition = instance->GetType()->GetFunctionDefinitions().GetItem(this->functionName);
-	}
-	
-	if (functionDefinition == NULL)
-	{
-		throw UndefinedSymbolAccessException(GGE2201_UndefinedFunction, this->GetLocation(), this->functionName);
+		if (isStatic)
+		{
+			functionDefinition = type->GetStaticFunctionDefinitions().GetItem(this->functionName);
+		}
+		else
+		{
+			functionDefinition = type->GetFunctionDefinitions().GetItem(this->functionName);
+		}
+
+		if (functionDefinition == NULL)
+		{
+			throw UndefinedSymbolAccessException(GGE2201_UndefinedFunction, this->GetLocation(), this->functionName);
+		}
+
+		cacheEntry.ReceiverType = type;
+		cacheEntry.IsStaticReceiver = isStatic;
+		cacheEntry.Function = functionDefinition;
+		vm->GetInlineCacheStatistics().RegisterMiss();
 	}
 
 	vm->CallFunction(this->GetLocation(), functionDefinition, instance, this->argumentCount);
@@ -17,11 +17,15 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 #pragma once
 
 #include "Instruction.hpp"
+#include "../InlineCacheEntry.hpp"
 
 namespace geogen 
 {
 	namespace runtime
 	{
+		class TypeDefinition;
+		class FunctionDefinition;
+
 		namespace instructions
 		{
 			class CallMemberInstruction : public Instruction
@@ -29,13 +33,20 @@ namespace geogen
 			private:
 				String functionName;
 				int argumentCount;
+
+				// Index of the monomorphic inline cache entry of this instruction in each VM (see VirtualMachine::GetInlineCacheEntry).
+				unsigned inlineCacheSlot;
 			public:				
-				CallMemberInstruction(CodeLocation location, String functionName, int argumentCount) : Instruction(location)
+				CallMemberInstruction(CodeLocation location, String functionName, int argumentCount) : Instruction(location), inlineCacheSlot(NO_INLINE_CACHE_SLOT)
 				{
 					this->functionName = functionName;
 					this->argumentCount = argumentCount;
 				}
 
+				inline unsigned GetInlineCacheSlot() const { return this->inlineCacheSlot; }
+
+				inline void SetInlineCacheSlot(unsigned inlineCacheSlot) { this->inlineCacheSlot = inlineCacheSlot; }
+
 				virtual void Serialize(IOStream& stream) const { stream << "CallMember " << functionName << " " << argumentCount; }
 
 				virtual String GetInstructionName() const { return GG_STR("CallMember"); };
@@ -34,6 +34,8 @@ namespace geogen
 					this->codeBlockCount = codeBlockCount;
 				}
 
+				inline unsigned GetCodeBlockCount() const { return this->codeBlockCount; };
+
 				virtual void Serialize(IOStream& stream) const { stream << "Continue " << codeBlockCount; }
 
 				virtual String GetInstructionName() const { return GG_STR("Continue"); };
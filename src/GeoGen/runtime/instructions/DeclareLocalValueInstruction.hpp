@@ -34,6 +34,8 @@ namespace geogen
 					this->variableName = variableName;
 				}
 
+				inline String const& GetVariableName() const { return this->variableName; };
+
 				virtual void Serialize(IOStream& stream) const { stream << "DeclareLocalValue " << variableName; }
 
 				virtual String GetInstructionName() const { return GG_STR("DeclareLocalValue"); };
@@ -34,6 +34,8 @@ namespace geogen
 					this->constBoolean = constBoolean;
 				}
 
+				inline bool GetConstBoolean() const { return this->constBoolean; };
+
 				virtual void Serialize(IOStream& stream) const { stream << "LoadConstBoolean " << constBoolean; }
 
 				virtual String GetInstructionName() const { return GG_STR("LoadConstBoolean"); };
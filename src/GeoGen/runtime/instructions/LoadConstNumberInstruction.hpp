@@ -35,6 +35,8 @@ namespace geogen
 					this->constNumber = constNumber;
 				}
 
+				inline Number GetConstNumber() const { return this->constNumber; };
+
 				virtual void Serialize(IOStream& stream) const { stream << "LoadConstNumber " << constNumber; }
 
 				virtual String GetInstructionName() const { return GG_STR("LoadConstNumber"); };
@@ -21,10 +21,13 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 #include "../NullReferenceException.hpp"
 #include "../ManagedObject.hpp"
 #include "../UndefinedSymbolAccessException.hpp"
+#include "../InlineCacheStatistics.hpp"
+#include "../../corelib/ParametersTypeDefinition.hpp"
 
 using namespace std;
 using namespace geogen::runtime;
 using namespace geogen::runtime::instructions;
+using namespace geogen::corelib;
 
 InstructionStepResult LoadMemberValueInstruction::Step(VirtualMachine* vm) const
 {
@@ -35,13 +38,45 @@ InstructionStepResult LoadMemberValueInstruction::Step(VirtualMachine* vm) const
 		throw NullReferenceException(this->GetLocation());
 	}
 
-	VariableTableItem* variableTableItem = instance->GetMemberVariableTable().GetVariable(this->variableName);
-	if (variableTableItem == NULL)
+	ObjectId objectId = instance->GetObjectId();
+
+	// Instructions without a slot (never assigned by the compiler) use a temporary entry, which always misses.
+	InlineCacheEntry uncachedEntry;
+	InlineCacheEntry& cacheEntry = this->inlineCacheSlot != NO_INLINE_CACHE_SLOT ? vm->GetInlineCacheEntry(this->inlineCacheSlot) : uncachedEntry;
+
+	// Object IDs are never reused within a single VM and member variables are never removed, so the cached item stays valid for as long as the object lives.
+	if (objectId != UNASSIGNED_OBJECT_ID && objectId == cacheEntry.ReceiverObjectId)
+	{
+		vm->GetInlineCacheStatistics().RegisterHit();
+	}
+	else
+	{
+		VariableTableItem* variableTableItem = instance->GetMemberVariableTable().GetVariable(this->variableName);
+		if (variableTableItem == NULL)
+		{
+			throw UndefinedSymbolAccessException(GGE2202_UndefinedVariable, this->GetLocation(), this->variableName);
+		}
+
+		cacheEntry.ReceiverObjectId = objectId;
+		cacheEntry.Variable = variableTableItem;
+		cacheEntry.IsRenderRectangleAccess = ParametersTypeDefinition::IsRenderRectangleMemberAccess(instance, this->variableName);
+		cacheEntry.IsRenderScaleAccess = ParametersTypeDefinition::IsRenderScaleMemberAccess(instance, this->variableName, vm->GetArguments());
+		vm->GetInlineCacheStatistics().RegisterMiss();
+	}
+
+	if (cacheEntry.IsRenderRectangleAccess)
+	{
+		// The generated rendering sequence can no longer be reused for other render rectangles.
+		vm->GetRenderingSequence().SetRenderRectangleDependent();
+	}
+
+	if (cacheEntry.IsRenderScaleAccess)
 	{
-		throw UndefinedSymbolAccessException(GGE2202_UndefinedVariable, this->GetLocation(), this->variableName);
-	}	
+		// The generated rendering sequence can no longer be rendered at other scales.
+		vm->GetRenderingSequence().SetRenderScaleDependent();
+	}
 
-	ManagedObject* memberObject = variableTableItem->GetValue();
+	ManagedObject* memberObject = cacheEntry.Variable->GetValue();
 	memberObject->AddRef();
 
 	vm->GetObjectStack().Pop(vm);
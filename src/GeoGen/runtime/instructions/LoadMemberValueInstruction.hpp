@@ -17,6 +17,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 #pragma once
 
 #include "Instruction.hpp"
+#include "../InlineCacheEntry.hpp"
 
 namespace geogen
 {
@@ -28,12 +29,19 @@ namespace geogen
 			{
 			private:
 				String variableName;
+
+				// Index of the monomorphic inline cache entry of this instruction in each VM (see VirtualMachine::GetInlineCacheEntry).
+				unsigned inlineCacheSlot;
 			public:
-				LoadMemberValueInstruction(CodeLocation location, String variableName) : Instruction(location)
+				LoadMemberValueInstruction(CodeLocation location, String variableName) : Instruction(location), inlineCacheSlot(NO_INLINE_CACHE_SLOT)
 				{
 					this->variableName = variableName;
 				}
 
+				inline unsigned GetInlineCacheSlot() const { return this->inlineCacheSlot; }
+
+				inline void SetInlineCacheSlot(unsigned inlineCacheSlot) { this->inlineCacheSlot = inlineCacheSlot; }
+
 				virtual void Serialize(IOStream& stream) const { stream << "LoadMemberValue " << variableName; }
 
 				virtual String GetInstructionName() const { return GG_STR("LoadMemberValue"); };
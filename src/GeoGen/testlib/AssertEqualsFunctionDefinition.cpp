@@ -24,7 +24,7 @@ using namespace geogen;
 using namespace geogen::testlib;
 using namespace geogen::runtime;
 
-ManagedObject* AssertEqualsFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, vector<ManagedObject*> arguments) const
+ManagedObject* AssertEqualsFunctionDefinition::CallNative(CodeLocation location, VirtualMachine* vm, NativeArgumentList& arguments) const
 {
 	this->CheckArguments(location, 2, arguments);
 
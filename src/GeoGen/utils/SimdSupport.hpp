@@ -0,0 +1,41 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+/// Defined if SSE2 intrinsics can be used unconditionally.
+#define GEOGEN_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+// AVX2 code is compiled separately from the rest of the library (using GEOGEN_AVX2_TARGET) and selected at runtime, so the binary still runs on older CPUs.
+#if defined(GEOGEN_SIMD_SSE2) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+/// Defined if AVX2 intrinsics can be used in functions marked with GEOGEN_AVX2_TARGET, provided that IsAvx2Supported returns true.
+#define GEOGEN_SIMD_AVX2
+#define GEOGEN_AVX2_TARGET __attribute__((target("avx2")))
+#include <immintrin.h>
+#endif
+
+namespace geogen
+{
+	namespace utils
+	{
+		/// Determines whether AVX2 code paths (see GEOGEN_SIMD_AVX2) can be used on the running CPU.
+		/// @return true if AVX2 is supported, false otherwise.
+		bool IsAvx2Supported();
+	}
+}
\ No newline at end of file
@@ -55,5 +55,32 @@ String geogen::utils::FormatFileSize(unsigned sizeInBytes)
 		ss << std::fixed << std::setprecision(2) << (sizeInBytes / (1024. * 1024. * 1024.)) << " GB";
 	}
 
+	return ss.str();
+}
+
+String geogen::utils::EscapeJsonString(String const& str)
+{
+	StringStream ss;
+	for (String::const_iterator it = str.begin(); it != str.end(); it++)
+	{
+		switch (*it)
+		{
+		case GG_STR('"'): ss << GG_STR("\\\""); break;
+		case GG_STR('\\'): ss << GG_STR("\\\\"); break;
+		case GG_STR('\n'): ss << GG_STR("\\n"); break;
+		case GG_STR('\r'): ss << GG_STR("\\r"); break;
+		case GG_STR('\t'): ss << GG_STR("\\t"); break;
+		default:
+			if ((unsigned)*it < 0x20)
+			{
+				ss << GG_STR("\\u") << std::hex << std::setw(4) << std::setfill(GG_STR('0')) << (unsigned)*it << std::dec;
+			}
+			else
+			{
+				ss << *it;
+			}
+		}
+	}
+
 	return ss.str();
 }
\ No newline at end of file
@@ -33,5 +33,10 @@ namespace geogen
 		/// @param sizeInBytes The size in bytes.
 		/// @return The formatted file size.
 		String FormatFileSize(unsigned sizeInBytes);
+
+		/// Escapes a string so it can be placed between quotes in a JSON document. Quotes and backslashes are escaped with a backslash, control characters with their escape sequences.
+		/// @param str The string.
+		/// @return The escaped string, without the enclosing quotes.
+		String EscapeJsonString(String const& str);
 	}
 }
\ No newline at end of file
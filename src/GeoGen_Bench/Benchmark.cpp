@@ -0,0 +1,50 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include <sstream>
+
+#include "Benchmark.hpp"
+#include "JsonWriter.hpp"
+
+using namespace geogen;
+using namespace bench;
+
+Benchmark::Benchmark(std::string const& group, std::string const& name, unsigned long long itemCount)
+: group(group), name(name), itemCount(itemCount)
+{
+}
+
+void Benchmark::AddParameter(std::string const& name, double value)
+{
+	this->parameters.push_back(Parameter(name, JsonWriter::FormatNumber(value)));
+}
+
+void Benchmark::AddParameter(std::string const& name, std::string const& value)
+{
+	this->parameters.push_back(Parameter(name, JsonWriter::FormatString(value)));
+}
+
+std::string Benchmark::GetFullName() const
+{
+	std::stringstream ss;
+	ss << this->group << "/" << this->name;
+	for (std::vector<Parameter>::const_iterator it = this->parameters.begin(); it != this->parameters.end(); it++)
+	{
+		ss << "/" << it->first << "=" << it->second;
+	}
+
+	return ss.str();
+}
\ No newline at end of file
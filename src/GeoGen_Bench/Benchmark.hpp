@@ -0,0 +1,80 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <utility>
+
+namespace geogen
+{
+	namespace bench
+	{
+		/// Base class for all benchmarks. Each repetition of the benchmark calls SetUp, Run and TearDown, only Run is timed.
+		class Benchmark
+		{
+		public:
+			/// A parameter name paired with its value, already formatted as a JSON value.
+			typedef std::pair<std::string, std::string> Parameter;
+		private:
+			std::string group;
+			std::string name;
+			std::vector<Parameter> parameters;
+			unsigned long long itemCount;
+
+			// Non-copyable
+			Benchmark(Benchmark const&);
+			Benchmark& operator=(Benchmark const&);
+		protected:
+			/// Initializes a new instance of the Benchmark class.
+			/// @param group The group (such as "genlib" or "script") the benchmark belongs to.
+			/// @param name The name of the benchmark.
+			/// @param itemCount Number of items (such as pixels) processed by a single run, used to calculate per-item times. 0 if not applicable.
+			Benchmark(std::string const& group, std::string const& name, unsigned long long itemCount = 0);
+
+			/// Adds a numeric parameter, which distinguishes this benchmark from other benchmarks with the same name.
+			/// @param name The parameter name.
+			/// @param value The value.
+			void AddParameter(std::string const& name, double value);
+
+			/// Adds a string parameter, which distinguishes this benchmark from other benchmarks with the same name.
+			/// @param name The parameter name.
+			/// @param value The value.
+			void AddParameter(std::string const& name, std::string const& value);
+		public:
+			virtual ~Benchmark() {}
+
+			inline std::string const& GetGroup() const { return this->group; }
+			inline std::string const& GetName() const { return this->name; }
+			inline std::vector<Parameter> const& GetParameters() const { return this->parameters; }
+			inline unsigned long long GetItemCount() const { return this->itemCount; }
+
+			/// Gets full name of the benchmark including its parameters, which is used for filtering and console output.
+			/// @return The full name.
+			std::string GetFullName() const;
+
+			/// Prepares data for a single run. Not timed.
+			virtual void SetUp() {}
+
+			/// Performs the timed operation.
+			virtual void Run() = 0;
+
+			/// Releases data of a single run. Not timed.
+			virtual void TearDown() {}
+		};
+	}
+}
\ No newline at end of file
@@ -0,0 +1,112 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#include "BenchmarkResult.hpp"
+#include "Benchmark.hpp"
+#include "JsonWriter.hpp"
+
+using namespace geogen;
+using namespace bench;
+
+BenchmarkResult::BenchmarkResult(Benchmark const* benchmark, std::vector<double> const& samples)
+: benchmark(benchmark), samples(samples), sortedSamples(samples)
+{
+	std::sort(this->sortedSamples.begin(), this->sortedSamples.end());
+}
+
+double BenchmarkResult::GetMean() const
+{
+	double sum = 0;
+	for (std::vector<double>::const_iterator it = this->samples.begin(); it != this->samples.end(); it++)
+	{
+		sum += *it;
+	}
+
+	return sum / this->samples.size();
+}
+
+double BenchmarkResult::GetStandardDeviation() const
+{
+	if (this->samples.size() < 2)
+	{
+		return 0;
+	}
+
+	double mean = this->GetMean();
+	double sum = 0;
+	for (std::vector<double>::const_iterator it = this->samples.begin(); it != this->samples.end(); it++)
+	{
+		sum += (*it - mean) * (*it - mean);
+	}
+
+	return std::sqrt(sum / (this->samples.size() - 1));
+}
+
+double BenchmarkResult::GetPercentile(double percentile) const
+{
+	double rank = std::min(100.0, std::max(0.0, percentile)) / 100.0 * (this->sortedSamples.size() - 1);
+	unsigned lowerRank = (unsigned)std::floor(rank);
+	unsigned upperRank = std::min(lowerRank + 1, (unsigned)this->sortedSamples.size() - 1);
+	double weight = rank - lowerRank;
+
+	return this->sortedSamples[lowerRank] * (1 - weight) + this->sortedSamples[upperRank] * weight;
+}
+
+void BenchmarkResult::WriteJson(std::ostream& stream, std::string const& indentation) const
+{
+	std::string inner = indentation + "\t";
+
+	stream << indentation << "{" << std::endl;
+	stream << inner << "\"group\": " << JsonWriter::FormatString(this->benchmark->GetGroup()) << "," << std::endl;
+	stream << inner << "\"name\": " << JsonWriter::FormatString(this->benchmark->GetName()) << "," << std::endl;
+
+	stream << inner << "\"parameters\": {";
+	std::vector<Benchmark::Parameter> const& parameters = this->benchmark->GetParameters();
+	for (std::vector<Benchmark::Parameter>::const_iterator it = parameters.begin(); it != parameters.end(); it++)
+	{
+		stream << (it == parameters.begin() ? " " : ", ") << JsonWriter::FormatString(it->first) << ": " << it->second;
+	}
+
+	stream << (parameters.empty() ? "" : " ") << "}," << std::endl;
+
+	stream << inner << "\"repetitions\": " << this->samples.size() << "," << std::endl;
+	stream << inner << "\"minUs\": " << JsonWriter::FormatNumber(this->GetMinimum()) << "," << std::endl;
+	stream << inner << "\"medianUs\": " << JsonWriter::FormatNumber(this->GetMedian()) << "," << std::endl;
+	stream << inner << "\"meanUs\": " << JsonWriter::FormatNumber(this->GetMean()) << "," << std::endl;
+	stream << inner << "\"p90Us\": " << JsonWriter::FormatNumber(this->GetPercentile(90)) << "," << std::endl;
+	stream << inner << "\"p95Us\": " << JsonWriter::FormatNumber(this->GetPercentile(95)) << "," << std::endl;
+	stream << inner << "\"maxUs\": " << JsonWriter::FormatNumber(this->GetMaximum()) << "," << std::endl;
+	stream << inner << "\"stdDevUs\": " << JsonWriter::FormatNumber(this->GetStandardDeviation()) << "," << std::endl;
+
+	if (this->benchmark->GetItemCount() > 0)
+	{
+		stream << inner << "\"items\": " << this->benchmark->GetItemCount() << "," << std::endl;
+		stream << inner << "\"medianNsPerItem\": " << JsonWriter::FormatNumber(this->GetMedian() * 1000 / this->benchmark->GetItemCount()) << "," << std::endl;
+	}
+
+	stream << inner << "\"samplesUs\": [";
+	for (std::vector<double>::const_iterator it = this->samples.begin(); it != this->samples.end(); it++)
+	{
+		stream << (it == this->samples.begin() ? "" : ", ") << JsonWriter::FormatNumber(*it);
+	}
+
+	stream << "]" << std::endl;
+	stream << indentation << "}";
+}
\ No newline at end of file
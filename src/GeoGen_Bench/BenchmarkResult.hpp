@@ -0,0 +1,63 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <ostream>
+
+namespace geogen
+{
+	namespace bench
+	{
+		class Benchmark;
+
+		/// Timings of all repetitions of a single benchmark with statistics calculated from them.
+		class BenchmarkResult
+		{
+		private:
+			Benchmark const* benchmark;
+			std::vector<double> samples;
+			std::vector<double> sortedSamples;
+		public:
+			/// Initializes a new instance of the BenchmarkResult class.
+			/// @param benchmark The benchmark. Must outlive the result.
+			/// @param samples Durations of the individual repetitions in microseconds, in order in which they were measured. Must not be empty.
+			BenchmarkResult(Benchmark const* benchmark, std::vector<double> const& samples);
+
+			inline Benchmark const* GetBenchmark() const { return this->benchmark; }
+			inline std::vector<double> const& GetSamples() const { return this->samples; }
+
+			inline double GetMinimum() const { return this->sortedSamples.front(); }
+			inline double GetMaximum() const { return this->sortedSamples.back(); }
+			inline double GetMedian() const { return this->GetPercentile(50); }
+
+			double GetMean() const;
+			double GetStandardDeviation() const;
+
+			/// Gets a percentile of the samples, linearly interpolated between the two closest ranks.
+			/// @param percentile The percentile (0 - 100).
+			/// @return The percentile in microseconds.
+			double GetPercentile(double percentile) const;
+
+			/// Writes the result as a JSON object.
+			/// @param stream The output stream.
+			/// @param indentation Indentation of the object.
+			void WriteJson(std::ostream& stream, std::string const& indentation) const;
+		};
+	}
+}
\ No newline at end of file
@@ -0,0 +1,114 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include <iomanip>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <GeoGen/GeoGen.hpp>
+
+#include "BenchmarkRunner.hpp"
+#include "JsonWriter.hpp"
+
+using namespace geogen;
+using namespace bench;
+
+BenchmarkRunner::BenchmarkRunner(unsigned warmupIterations, unsigned repetitions, std::string const& filter)
+: warmupIterations(warmupIterations), repetitions(repetitions < 1 ? 1 : repetitions), filter(filter)
+{
+}
+
+BenchmarkRunner::~BenchmarkRunner()
+{
+	for (std::vector<Benchmark*>::iterator it = this->benchmarks.begin(); it != this->benchmarks.end(); it++)
+	{
+		delete *it;
+	}
+}
+
+void BenchmarkRunner::AddBenchmark(Benchmark* benchmark)
+{
+	this->benchmarks.push_back(benchmark);
+}
+
+void BenchmarkRunner::Run(std::ostream& log)
+{
+	for (std::vector<Benchmark*>::iterator it = this->benchmarks.begin(); it != this->benchmarks.end(); it++)
+	{
+		Benchmark* benchmark = *it;
+		std::string fullName = benchmark->GetFullName();
+		if (this->filter != "" && fullName.find(this->filter) == std::string::npos)
+		{
+			continue;
+		}
+
+		log << fullName << std::flush;
+
+		for (unsigned i = 0; i < this->warmupIterations; i++)
+		{
+			benchmark->SetUp();
+			benchmark->Run();
+			benchmark->TearDown();
+		}
+
+		std::vector<double> samples;
+		samples.reserve(this->repetitions);
+		for (unsigned i = 0; i < this->repetitions; i++)
+		{
+			benchmark->SetUp();
+
+			unsigned long long startTime = utils::GetWallClockMicroseconds();
+			benchmark->Run();
+			samples.push_back((double)(utils::GetWallClockMicroseconds() - startTime));
+
+			benchmark->TearDown();
+		}
+
+		this->results.push_back(BenchmarkResult(benchmark, samples));
+
+		BenchmarkResult const& result = this->results.back();
+		log << "\t" << std::fixed << std::setprecision(1) << result.GetMedian() << " us (p95 " << result.GetPercentile(95) << " us)" << std::endl;
+		log.unsetf(std::ios_base::floatfield);
+	}
+}
+
+void BenchmarkRunner::WriteJson(std::ostream& stream) const
+{
+	int threads = 1;
+#ifdef _OPENMP
+	threads = omp_get_max_threads();
+#endif
+
+	stream << "{" << std::endl;
+	stream << "\t\"configuration\": {" << std::endl;
+	stream << "\t\t\"warmupIterations\": " << this->warmupIterations << "," << std::endl;
+	stream << "\t\t\"repetitions\": " << this->repetitions << "," << std::endl;
+	stream << "\t\t\"threads\": " << threads << "," << std::endl;
+	stream << "\t\t\"filter\": " << JsonWriter::FormatString(this->filter) << std::endl;
+	stream << "\t}," << std::endl;
+	stream << "\t\"benchmarks\": [" << std::endl;
+
+	for (std::vector<BenchmarkResult>::const_iterator it = this->results.begin(); it != this->results.end(); it++)
+	{
+		it->WriteJson(stream, "\t\t");
+		stream << (it + 1 == this->results.end() ? "" : ",") << std::endl;
+	}
+
+	stream << "\t]" << std::endl;
+	stream << "}" << std::endl;
+}
\ No newline at end of file
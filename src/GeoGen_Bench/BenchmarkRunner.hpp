@@ -0,0 +1,68 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <ostream>
+
+#include "Benchmark.hpp"
+#include "BenchmarkResult.hpp"
+
+namespace geogen
+{
+	namespace bench
+	{
+		/// Runs benchmarks and collects their results. Each benchmark is first run several times without measurement to warm up caches and the memory allocator, then timed repeatedly using the wall clock.
+		class BenchmarkRunner
+		{
+		private:
+			unsigned warmupIterations;
+			unsigned repetitions;
+			std::string filter;
+			std::vector<Benchmark*> benchmarks;
+			std::vector<BenchmarkResult> results;
+
+			// Non-copyable
+			BenchmarkRunner(BenchmarkRunner const&);
+			BenchmarkRunner& operator=(BenchmarkRunner const&);
+		public:
+			/// Initializes a new instance of the BenchmarkRunner class.
+			/// @param warmupIterations Number of unmeasured runs of each benchmark.
+			/// @param repetitions Number of measured runs of each benchmark. Must be at least 1.
+			/// @param filter Only benchmarks whose full name contains this string are run. Empty to run all benchmarks.
+			BenchmarkRunner(unsigned warmupIterations, unsigned repetitions, std::string const& filter);
+			~BenchmarkRunner();
+
+			inline unsigned GetWarmupIterations() const { return this->warmupIterations; }
+			inline unsigned GetRepetitions() const { return this->repetitions; }
+			inline std::vector<BenchmarkResult> const& GetResults() const { return this->results; }
+
+			/// Adds a benchmark. The runner takes ownership of the benchmark.
+			/// @param benchmark The benchmark.
+			void AddBenchmark(Benchmark* benchmark);
+
+			/// Runs all benchmarks matching the filter.
+			/// @param log Stream to which progress and median times are printed.
+			void Run(std::ostream& log);
+
+			/// Writes the results as a JSON document.
+			/// @param stream The output stream.
+			void WriteJson(std::ostream& stream) const;
+		};
+	}
+}
\ No newline at end of file
@@ -0,0 +1,363 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include "GenlibBenchmarks.hpp"
+
+using namespace geogen;
+using namespace bench;
+using namespace genlib;
+
+namespace
+{
+	const random::RandomSeed BENCHMARK_SEED = 12345;
+
+	/// Maps used by a single run of a HeightMap benchmark. All maps have the same rectangle and scale.
+	struct HeightMapBenchmarkData
+	{
+		HeightMap* map;
+		HeightMap* other;
+		HeightMap* mask;
+		HeightProfile* profile;
+
+		/// Logical width and height of the maps.
+		Size1D logicalSize;
+
+		inline Coordinate At(double fraction) const { return Coordinate(this->logicalSize * fraction); }
+	};
+
+	/// Profiles used by a single run of a HeightProfile benchmark. All profiles have the same interval and scale.
+	struct HeightProfileBenchmarkData
+	{
+		HeightProfile* profile;
+		HeightProfile* other;
+		HeightProfile* mask;
+		HeightMap* map;
+
+		/// Logical length of the profiles.
+		Size1D logicalLength;
+
+		inline Coordinate At(double fraction) const { return Coordinate(this->logicalLength * fraction); }
+	};
+
+	typedef void(*HeightMapOperation)(HeightMapBenchmarkData& data);
+	typedef void(*HeightProfileOperation)(HeightProfileBenchmarkData& data);
+
+	class HeightMapBenchmark : public Benchmark
+	{
+	private:
+		HeightMapOperation operation;
+		Size1D size;
+		Scale scale;
+		HeightMapBenchmarkData data;
+	public:
+		HeightMapBenchmark(std::string const& name, HeightMapOperation operation, Size1D size, Scale scale)
+			: Benchmark("genlib", "HeightMap." + name, (unsigned long long)size * size), operation(operation), size(size), scale(scale)
+		{
+			this->AddParameter("size", size);
+			this->AddParameter("scale", scale);
+
+			this->data.map = NULL;
+			this->data.other = NULL;
+			this->data.mask = NULL;
+			this->data.profile = NULL;
+			this->data.logicalSize = Size1D(size / scale);
+		}
+
+		virtual void SetUp()
+		{
+			Rectangle rectangle(Point(0, 0), Size2D(this->size, this->size));
+			Size1D logicalSize = this->data.logicalSize;
+
+			// Cheap deterministic content, so the set up doesn't dominate the benchmark run time.
+			this->data.map = new HeightMap(rectangle, 0, this->scale);
+			this->data.map->RadialGradient(Point(logicalSize / 2, logicalSize / 2), logicalSize / 2, HEIGHT_MAX, HEIGHT_MIN);
+
+			this->data.other = new HeightMap(rectangle, 0, this->scale);
+			this->data.other->Gradient(Point(0, 0), Point(logicalSize, logicalSize), HEIGHT_MIN, HEIGHT_MAX);
+
+			this->data.mask = new HeightMap(rectangle, 0, this->scale);
+			this->data.mask->Gradient(Point(0, 0), Point(logicalSize, 0), 0, HEIGHT_MAX);
+
+			this->data.profile = new HeightProfile(Interval(0, this->size), 0, this->scale);
+			this->data.profile->Gradient(0, logicalSize, HEIGHT_MIN, HEIGHT_MAX, true);
+		}
+
+		virtual void Run()
+		{
+			this->operation(this->data);
+		}
+
+		virtual void TearDown()
+		{
+			delete this->data.map;
+			delete this->data.other;
+			delete this->data.mask;
+			delete this->data.profile;
+
+			this->data.map = NULL;
+			this->data.other = NULL;
+			this->data.mask = NULL;
+			this->data.profile = NULL;
+		}
+	};
+
+	class HeightProfileBenchmark : public Benchmark
+	{
+	private:
+		HeightProfileOperation operation;
+		Size1D length;
+		Scale scale;
+		HeightProfileBenchmarkData data;
+	public:
+		HeightProfileBenchmark(std::string const& name, HeightProfileOperation operation, Size1D length, Scale scale)
+			: Benchmark("genlib", "HeightProfile." + name, length), operation(operation), length(length), scale(scale)
+		{
+			this->AddParameter("length", length);
+			this->AddParameter("scale", scale);
+
+			this->data.profile = NULL;
+			this->data.other = NULL;
+			this->data.mask = NULL;
+			this->data.map = NULL;
+			this->data.logicalLength = Size1D(length / scale);
+		}
+
+		virtual void SetUp()
+		{
+			Interval interval(0, this->length);
+			Size1D logicalLength = this->data.logicalLength;
+
+			this->data.profile = new HeightProfile(interval, 0, this->scale);
+			this->data.profile->Gradient(0, logicalLength, HEIGHT_MAX, HEIGHT_MIN, true);
+
+			this->data.other = new HeightProfile(interval, 0, this->scale);
+			this->data.other->Gradient(0, logicalLength / 2, HEIGHT_MIN, HEIGHT_MAX, true);
+
+			this->data.mask = new HeightProfile(interval, 0, this->scale);
+			this->data.mask->Gradient(0, logicalLength, 0, HEIGHT_MAX, true);
+
+			// A single row map, used as the source of Slice.
+			this->data.map = new HeightMap(Rectangle(Point(0, 0), Size2D(this->length, 1)), 0, this->scale);
+			this->data.map->Gradient(Point(0, 0), Point(logicalLength, 0), HEIGHT_MIN, HEIGHT_MAX);
+		}
+
+		virtual void Run()
+		{
+			this->operation(this->data);
+		}
+
+		virtual void TearDown()
+		{
+			delete this->data.profile;
+			delete this->data.other;
+			delete this->data.mask;
+			delete this->data.map;
+
+			this->data.profile = NULL;
+			this->data.other = NULL;
+			this->data.mask = NULL;
+			this->data.map = NULL;
+		}
+	};
+
+	void HeightMapAbs(HeightMapBenchmarkData& d) { d.map->Abs(); }
+	void HeightMapAdd(HeightMapBenchmarkData& d) { d.map->Add(1000); }
+	void HeightMapAddMasked(HeightMapBenchmarkData& d) { d.map->AddMasked(1000, d.mask); }
+	void HeightMapAddMap(HeightMapBenchmarkData& d) { d.map->AddMap(d.other); }
+	void HeightMapAddMapMasked(HeightMapBenchmarkData& d) { d.map->AddMapMasked(d.other, d.mask); }
+	void HeightMapAddNoiseLayers(HeightMapBenchmarkData& d) { d.map->AddNoiseLayers(NoiseLayersFactory::CreateDefaultLayers(), BENCHMARK_SEED, 0, false); }
+	void HeightMapBlur(HeightMapBenchmarkData& d) { d.map->Blur(16); }
+	void HeightMapCellNoise(HeightMapBenchmarkData& d) { d.map->CellNoise(64, BENCHMARK_SEED); }
+	void HeightMapClampHeights(HeightMapBenchmarkData& d) { d.map->ClampHeights(-10000, 10000); }
+	void HeightMapCombine(HeightMapBenchmarkData& d) { d.map->Combine(d.other, d.mask); }
+	void HeightMapConvexityMap(HeightMapBenchmarkData& d) { d.map->ConvexityMap(8); }
+	void HeightMapCrop(HeightMapBenchmarkData& d) { d.map->Crop(Rectangle(Point(d.At(0.25), d.At(0.25)), Size2D(d.At(0.5), d.At(0.5))), 0); }
+	void HeightMapCropHeights(HeightMapBenchmarkData& d) { d.map->CropHeights(-10000, 10000, 0); }
+	void HeightMapDistanceMap(HeightMapBenchmarkData& d) { d.map->DistanceMap(64); }
+	void HeightMapDistort(HeightMapBenchmarkData& d) { d.map->Distort(d.other, d.mask, 16); }
+	void HeightMapDrawLine(HeightMapBenchmarkData& d) { d.map->DrawLine(Point(0, d.At(0.1)), Point(d.At(1), d.At(0.9)), HEIGHT_MAX); }
+	void HeightMapDrawPrimitives(HeightMapBenchmarkData& d)
+	{
+		// Long lines crossing many tiles, which are only binned into the tiles they cross.
+		std::vector<HeightMapPrimitive> primitives;
+		primitives.push_back(HeightMapPrimitive::CreateLine(Point(0, 0), Point(d.At(1), d.At(1)), HEIGHT_MAX));
+		primitives.push_back(HeightMapPrimitive::CreateLine(Point(d.At(1), 0), Point(0, d.At(1)), HEIGHT_MIN));
+		primitives.push_back(HeightMapPrimitive::CreateLine(Point(0, d.At(0.1)), Point(d.At(1), d.At(0.9)), HEIGHT_MAX));
+		primitives.push_back(HeightMapPrimitive::CreateLine(Point(d.At(0.1), 0), Point(d.At(0.9), d.At(1)), HEIGHT_MIN));
+		primitives.push_back(HeightMapPrimitive::CreateRectangle(Point(d.At(0.25), d.At(0.25)), Point(d.At(0.75), d.At(0.75)), 0));
+		d.map->DrawPrimitives(primitives);
+	}
+
+	void HeightMapFillRectangle(HeightMapBenchmarkData& d) { d.map->FillRectangle(Rectangle(Point(d.At(0.25), d.At(0.25)), Size2D(d.At(0.5), d.At(0.5))), HEIGHT_MAX); }
+	void HeightMapGradient(HeightMapBenchmarkData& d) { d.map->Gradient(Point(0, 0), Point(d.At(1), d.At(0.5)), HEIGHT_MIN, HEIGHT_MAX); }
+	void HeightMapIntersect(HeightMapBenchmarkData& d) { d.map->Intersect(d.other); }
+	void HeightMapInvert(HeightMapBenchmarkData& d) { d.map->Invert(); }
+	void HeightMapMove(HeightMapBenchmarkData& d) { d.map->Move(Point(d.At(0.1), d.At(0.2))); }
+	void HeightMapMultiply(HeightMapBenchmarkData& d) { d.map->Multiply(0.75); }
+	void HeightMapMultiplyMap(HeightMapBenchmarkData& d) { d.map->MultiplyMap(d.mask); }
+	void HeightMapNoise(HeightMapBenchmarkData& d) { d.map->Noise(NoiseLayersFactory::CreateDefaultLayers(), BENCHMARK_SEED); }
+	void HeightMapNoiseLayer(HeightMapBenchmarkData& d) { d.map->NoiseLayer(64, HEIGHT_MAX / 2, BENCHMARK_SEED, 0, false); }
+	void HeightMapPattern(HeightMapBenchmarkData& d) { d.map->Pattern(d.other, Rectangle(Point(0, 0), Size2D(d.At(0.25), d.At(0.25)))); }
+	void HeightMapProjection(HeightMapBenchmarkData& d) { d.map->Projection(d.profile, DIRECTION_HORIZONTAL); }
+	void HeightMapRadialGradient(HeightMapBenchmarkData& d) { d.map->RadialGradient(Point(d.At(0.5), d.At(0.5)), d.At(0.5), HEIGHT_MAX, 0); }
+	void HeightMapRescale(HeightMapBenchmarkData& d) { d.map->Rescale(1.5, 1.5); }
+	void HeightMapResize(HeightMapBenchmarkData& d) { d.map->Resize(Rectangle(Point(-d.At(0.25), -d.At(0.25)), Size2D(d.At(1.5), d.At(1.5))), 0); }
+	void HeightMapShift(HeightMapBenchmarkData& d) { d.map->Shift(d.profile, 16, DIRECTION_VERTICAL); }
+	// Directly comparable with AddNoiseLayers, both add their default layers to the existing heights.
+	void HeightMapSimplexNoise(HeightMapBenchmarkData& d) { d.map->AddSimplexNoiseLayers(NoiseLayersFactory::CreateDefaultSimplexLayers(), BENCHMARK_SEED, 0); }
+
+	void HeightMapTransform(HeightMapBenchmarkData& d)
+	{
+		TransformationMatrix matrix;
+		matrix.A11 = 0.8;
+		matrix.A12 = -0.6;
+		matrix.A21 = 0.6;
+		matrix.A22 = 0.8;
+		d.map->Transform(matrix, d.map->GetRectangle());
+	}
+
+	void HeightMapTransformHeights(HeightMapBenchmarkData& d) { d.map->TransformHeights(d.profile, d.profile->GetInterval(), HEIGHT_MIN, HEIGHT_MAX); }
+	void HeightMapUnify(HeightMapBenchmarkData& d) { d.map->Unify(d.other); }
+
+	void HeightProfileAbs(HeightProfileBenchmarkData& d) { d.profile->Abs(); }
+	void HeightProfileAdd(HeightProfileBenchmarkData& d) { d.profile->Add(1000); }
+	void HeightProfileAddMasked(HeightProfileBenchmarkData& d) { d.profile->AddMasked(1000, d.mask); }
+	void HeightProfileAddProfile(HeightProfileBenchmarkData& d) { d.profile->AddProfile(d.other); }
+	void HeightProfileAddProfileMasked(HeightProfileBenchmarkData& d) { d.profile->AddProfileMasked(d.other, d.mask); }
+	void HeightProfileBlur(HeightProfileBenchmarkData& d) { d.profile->Blur(16); }
+	void HeightProfileClampHeights(HeightProfileBenchmarkData& d) { d.profile->ClampHeights(-10000, 10000); }
+	void HeightProfileCombine(HeightProfileBenchmarkData& d) { d.profile->Combine(d.other, d.mask); }
+	void HeightProfileCrop(HeightProfileBenchmarkData& d) { d.profile->Crop(Interval(d.At(0.25), d.At(0.5)), 0); }
+	void HeightProfileCropHeights(HeightProfileBenchmarkData& d) { d.profile->CropHeights(-10000, 10000, 0); }
+	void HeightProfileFillInterval(HeightProfileBenchmarkData& d) { d.profile->FillInterval(Interval(d.At(0.25), d.At(0.5)), HEIGHT_MAX); }
+	void HeightProfileFlip(HeightProfileBenchmarkData& d) { d.profile->Flip(); }
+	void HeightProfileGradient(HeightProfileBenchmarkData& d) { d.profile->Gradient(0, d.At(0.5), HEIGHT_MIN, HEIGHT_MAX, true); }
+	void HeightProfileIntersect(HeightProfileBenchmarkData& d) { d.profile->Intersect(d.other); }
+	void HeightProfileInvert(HeightProfileBenchmarkData& d) { d.profile->Invert(); }
+	void HeightProfileMove(HeightProfileBenchmarkData& d) { d.profile->Move(d.At(0.1)); }
+	void HeightProfileMultiply(HeightProfileBenchmarkData& d) { d.profile->Multiply(0.75); }
+	void HeightProfileMultiplyProfile(HeightProfileBenchmarkData& d) { d.profile->MultiplyProfile(d.mask); }
+	void HeightProfileNoise(HeightProfileBenchmarkData& d) { d.profile->Noise(NoiseLayersFactory::CreateDefaultLayers(), BENCHMARK_SEED); }
+	void HeightProfilePattern(HeightProfileBenchmarkData& d) { d.profile->Pattern(d.other, Interval(0, d.At(0.25))); }
+	void HeightProfileRescale(HeightProfileBenchmarkData& d) { d.profile->Rescale(1.5); }
+	void HeightProfileResize(HeightProfileBenchmarkData& d) { d.profile->Resize(Interval(-d.At(0.25), d.At(1.5)), 0); }
+	void HeightProfileSlice(HeightProfileBenchmarkData& d) { d.profile->Slice(d.map, DIRECTION_HORIZONTAL, 0); }
+	void HeightProfileUnify(HeightProfileBenchmarkData& d) { d.profile->Unify(d.other); }
+
+	struct HeightMapOperationEntry
+	{
+		char const* name;
+		HeightMapOperation operation;
+	};
+
+	struct HeightProfileOperationEntry
+	{
+		char const* name;
+		HeightProfileOperation operation;
+	};
+
+	const HeightMapOperationEntry HEIGHT_MAP_OPERATIONS[] = {
+		{ "Abs", HeightMapAbs },
+		{ "Add", HeightMapAdd },
+		{ "AddMasked", HeightMapAddMasked },
+		{ "AddMap", HeightMapAddMap },
+		{ "AddMapMasked", HeightMapAddMapMasked },
+		{ "AddNoiseLayers", HeightMapAddNoiseLayers },
+		{ "Blur", HeightMapBlur },
+		{ "CellNoise", HeightMapCellNoise },
+		{ "ClampHeights", HeightMapClampHeights },
+		{ "Combine", HeightMapCombine },
+		{ "ConvexityMap", HeightMapConvexityMap },
+		{ "Crop", HeightMapCrop },
+		{ "CropHeights", HeightMapCropHeights },
+		{ "DistanceMap", HeightMapDistanceMap },
+		{ "Distort", HeightMapDistort },
+		{ "DrawLine", HeightMapDrawLine },
+		{ "DrawPrimitives", HeightMapDrawPrimitives },
+		{ "FillRectangle", HeightMapFillRectangle },
+		{ "Gradient", HeightMapGradient },
+		{ "Intersect", HeightMapIntersect },
+		{ "Invert", HeightMapInvert },
+		{ "Move", HeightMapMove },
+		{ "Multiply", HeightMapMultiply },
+		{ "MultiplyMap", HeightMapMultiplyMap },
+		{ "Noise", HeightMapNoise },
+		{ "NoiseLayer", HeightMapNoiseLayer },
+		{ "Pattern", HeightMapPattern },
+		{ "Projection", HeightMapProjection },
+		{ "RadialGradient", HeightMapRadialGradient },
+		{ "Rescale", HeightMapRescale },
+		{ "Resize", HeightMapResize },
+		{ "Shift", HeightMapShift },
+		{ "SimplexNoise", HeightMapSimplexNoise },
+		{ "Transform", HeightMapTransform },
+		{ "TransformHeights", HeightMapTransformHeights },
+		{ "Unify", HeightMapUnify }
+	};
+
+	const HeightProfileOperationEntry HEIGHT_PROFILE_OPERATIONS[] = {
+		{ "Abs", HeightProfileAbs },
+		{ "Add", HeightProfileAdd },
+		{ "AddMasked", HeightProfileAddMasked },
+		{ "AddProfile", HeightProfileAddProfile },
+		{ "AddProfileMasked", HeightProfileAddProfileMasked },
+		{ "Blur", HeightProfileBlur },
+		{ "ClampHeights", HeightProfileClampHeights },
+		{ "Combine", HeightProfileCombine },
+		{ "Crop", HeightProfileCrop },
+		{ "CropHeights", HeightProfileCropHeights },
+		{ "FillInterval", HeightProfileFillInterval },
+		{ "Flip", HeightProfileFlip },
+		{ "Gradient", HeightProfileGradient },
+		{ "Intersect", HeightProfileIntersect },
+		{ "Invert", HeightProfileInvert },
+		{ "Move", HeightProfileMove },
+		{ "Multiply", HeightProfileMultiply },
+		{ "MultiplyProfile", HeightProfileMultiplyProfile },
+		{ "Noise", HeightProfileNoise },
+		{ "Pattern", HeightProfilePattern },
+		{ "Rescale", HeightProfileRescale },
+		{ "Resize", HeightProfileResize },
+		{ "Slice", HeightProfileSlice },
+		{ "Unify", HeightProfileUnify }
+	};
+}
+
+void geogen::bench::AddGenlibBenchmarks(BenchmarkRunner& runner, std::vector<Size1D> const& sizes, std::vector<Scale> const& scales)
+{
+	for (unsigned i = 0; i < sizeof(HEIGHT_MAP_OPERATIONS) / sizeof(HEIGHT_MAP_OPERATIONS[0]); i++)
+	{
+		for (std::vector<Size1D>::const_iterator size = sizes.begin(); size != sizes.end(); size++)
+		{
+			for (std::vector<Scale>::const_iterator scale = scales.begin(); scale != scales.end(); scale++)
+			{
+				runner.AddBenchmark(new HeightMapBenchmark(HEIGHT_MAP_OPERATIONS[i].name, HEIGHT_MAP_OPERATIONS[i].operation, *size, *scale));
+			}
+		}
+	}
+
+	// Profiles are benchmarked with as many pixels as the maps of the same size, so that per-pixel times are comparable.
+	for (unsigned i = 0; i < sizeof(HEIGHT_PROFILE_OPERATIONS) / sizeof(HEIGHT_PROFILE_OPERATIONS[0]); i++)
+	{
+		for (std::vector<Size1D>::const_iterator size = sizes.begin(); size != sizes.end(); size++)
+		{
+			for (std::vector<Scale>::const_iterator scale = scales.begin(); scale != scales.end(); scale++)
+			{
+				runner.AddBenchmark(new HeightProfileBenchmark(HEIGHT_PROFILE_OPERATIONS[i].name, HEIGHT_PROFILE_OPERATIONS[i].operation, *size * *size, *scale));
+			}
+		}
+	}
+}
\ No newline at end of file
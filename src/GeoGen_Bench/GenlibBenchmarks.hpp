@@ -0,0 +1,35 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+#include <vector>
+
+#include <GeoGen/GeoGen.hpp>
+
+#include "BenchmarkRunner.hpp"
+
+namespace geogen
+{
+	namespace bench
+	{
+		/// Adds microbenchmarks of individual genlib::HeightMap and genlib::HeightProfile operations. Each operation is benchmarked for every combination of @a sizes and @a scales.
+		/// @param runner The runner.
+		/// @param sizes Physical sizes (width and height of maps, length of profiles) in pixels.
+		/// @param scales Render scales. Parameters of the operations are logical, so the same operation touches a different number of pixels at a different scale.
+		void AddGenlibBenchmarks(BenchmarkRunner& runner, std::vector<Size1D> const& sizes, std::vector<Scale> const& scales);
+	}
+}
\ No newline at end of file
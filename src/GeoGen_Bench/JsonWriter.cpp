@@ -0,0 +1,43 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include <sstream>
+#include <iomanip>
+
+#include <GeoGen/GeoGen.hpp>
+
+#include "JsonWriter.hpp"
+
+using namespace geogen;
+using namespace bench;
+
+std::string JsonWriter::FormatNumber(double value)
+{
+	// NaN is the only value not equal to itself, infinities are caught by the range check.
+	if (value != value || value > 1e300 || value < -1e300)
+	{
+		return "null";
+	}
+
+	std::stringstream ss;
+	ss << std::setprecision(10) << value;
+	return ss.str();
+}
+
+std::string JsonWriter::FormatString(std::string const& value)
+{
+	return "\"" + StringToAscii(utils::EscapeJsonString(AnyStringToString(value))) + "\"";
+}
\ No newline at end of file
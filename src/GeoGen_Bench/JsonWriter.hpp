@@ -0,0 +1,42 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+#include <string>
+
+namespace geogen
+{
+	namespace bench
+	{
+		/// Formatting of JSON values used by the benchmark report.
+		class JsonWriter
+		{
+		private:
+			JsonWriter();
+		public:
+			/// Formats a number as a JSON value. Non-finite numbers are formatted as null.
+			/// @param value The number.
+			/// @return The formatted value.
+			static std::string FormatNumber(double value);
+
+			/// Formats a string as a quoted and escaped JSON value.
+			/// @param value The string.
+			/// @return The formatted value.
+			static std::string FormatString(std::string const& value);
+		};
+	}
+}
\ No newline at end of file
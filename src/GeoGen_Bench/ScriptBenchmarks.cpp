@@ -0,0 +1,167 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include <fstream>
+#include <iterator>
+#include <memory>
+
+#include "ScriptBenchmarks.hpp"
+
+using namespace geogen;
+using namespace bench;
+using namespace compiler;
+using namespace runtime;
+using namespace renderer;
+
+namespace
+{
+	enum ScriptBenchmarkPhase
+	{
+		SCRIPT_BENCHMARK_PHASE_COMPILE,
+		SCRIPT_BENCHMARK_PHASE_EXECUTE,
+		SCRIPT_BENCHMARK_PHASE_RENDER,
+		SCRIPT_BENCHMARK_PHASE_TOTAL
+	};
+
+	const random::RandomSeed BENCHMARK_SEED = 12345;
+
+	std::string GetPhaseName(ScriptBenchmarkPhase phase)
+	{
+		switch (phase)
+		{
+		case SCRIPT_BENCHMARK_PHASE_COMPILE: return "Compile";
+		case SCRIPT_BENCHMARK_PHASE_EXECUTE: return "Execute";
+		case SCRIPT_BENCHMARK_PHASE_RENDER: return "Render";
+		case SCRIPT_BENCHMARK_PHASE_TOTAL: return "Total";
+		default: throw InternalErrorException(GG_STR("Invalid script benchmark phase."));
+		}
+	}
+
+	class ScriptBenchmark : public Benchmark
+	{
+	private:
+		std::string code;
+		ScriptBenchmarkPhase phase;
+		Size1D mapSize;
+		Scale scale;
+		std::auto_ptr<CompiledScript> compiledScript;
+		std::auto_ptr<VirtualMachine> vm;
+
+		ScriptParameters CreateScriptParameters(CompiledScript const& compiledScript) const
+		{
+			ScriptParameters parameters = compiledScript.CreateScriptParameters();
+			parameters.SetMapWidth(this->mapSize);
+			parameters.SetMapHeight(this->mapSize);
+			parameters.SetRenderScale(this->scale);
+			parameters.SetRenderRectangle(Rectangle(Point(0, 0), Size2D(Size1D(this->mapSize * this->scale), Size1D(this->mapSize * this->scale))));
+			parameters.SetRandomSeed(BENCHMARK_SEED);
+
+			return parameters;
+		}
+
+		std::auto_ptr<VirtualMachine> Execute(CompiledScript const& compiledScript) const
+		{
+			std::auto_ptr<VirtualMachine> vm(new VirtualMachine(compiledScript, this->CreateScriptParameters(compiledScript)));
+			vm->SetScriptMessageHandler(VirtualMachine::EmptyScriptMessageHandler);
+			vm->Run();
+
+			return vm;
+		}
+
+		static void Render(VirtualMachine& vm)
+		{
+			Renderer renderer(vm.GetRenderingSequence());
+			renderer.CalculateMetadata();
+			renderer.Run();
+		}
+	public:
+		ScriptBenchmark(std::string const& scriptFile, std::string const& code, ScriptBenchmarkPhase phase, Size1D mapSize, Scale scale)
+			: Benchmark("script", "Script." + GetPhaseName(phase), (unsigned long long)(mapSize * scale) * (unsigned long long)(mapSize * scale)), code(code), phase(phase), mapSize(mapSize), scale(scale)
+		{
+			this->AddParameter("script", scriptFile);
+			this->AddParameter("size", mapSize);
+			this->AddParameter("scale", scale);
+		}
+
+		virtual void SetUp()
+		{
+			// The compiled script is immutable, so it is shared by all runs of the phases which don't measure the compilation.
+			if (this->phase != SCRIPT_BENCHMARK_PHASE_COMPILE && this->phase != SCRIPT_BENCHMARK_PHASE_TOTAL && this->compiledScript.get() == NULL)
+			{
+				this->compiledScript = std::auto_ptr<CompiledScript>(Compiler().CompileScript(this->code));
+			}
+
+			if (this->phase == SCRIPT_BENCHMARK_PHASE_RENDER)
+			{
+				this->vm = this->Execute(*this->compiledScript);
+			}
+		}
+
+		virtual void Run()
+		{
+			switch (this->phase)
+			{
+			case SCRIPT_BENCHMARK_PHASE_COMPILE:
+				delete Compiler().CompileScript(this->code);
+				break;
+			case SCRIPT_BENCHMARK_PHASE_EXECUTE:
+				this->Execute(*this->compiledScript);
+				break;
+			case SCRIPT_BENCHMARK_PHASE_RENDER:
+				Render(*this->vm);
+				break;
+			case SCRIPT_BENCHMARK_PHASE_TOTAL:
+				{
+					std::auto_ptr<CompiledScript> compiledScript(Compiler().CompileScript(this->code));
+					std::auto_ptr<VirtualMachine> vm = this->Execute(*compiledScript);
+					Render(*vm);
+				}
+				break;
+			default:
+				throw InternalErrorException(GG_STR("Invalid script benchmark phase."));
+			}
+		}
+
+		virtual void TearDown()
+		{
+			this->vm.reset();
+		}
+	};
+}
+
+void geogen::bench::AddScriptBenchmarks(BenchmarkRunner& runner, std::vector<std::string> const& scriptFiles, Size1D mapSize, std::vector<Scale> const& scales)
+{
+	for (std::vector<std::string>::const_iterator it = scriptFiles.begin(); it != scriptFiles.end(); it++)
+	{
+		IFStream readStream(it->c_str());
+
+		std::string code((std::istreambuf_iterator<char>(readStream)),
+			std::istreambuf_iterator<char>());
+
+		if (readStream.fail())
+		{
+			throw ApiUsageException(GG_STR("Could not read script file \"") + AnyStringToString(*it) + GG_STR("\"."));
+		}
+
+		for (std::vector<Scale>::const_iterator scale = scales.begin(); scale != scales.end(); scale++)
+		{
+			runner.AddBenchmark(new ScriptBenchmark(*it, code, SCRIPT_BENCHMARK_PHASE_COMPILE, mapSize, *scale));
+			runner.AddBenchmark(new ScriptBenchmark(*it, code, SCRIPT_BENCHMARK_PHASE_EXECUTE, mapSize, *scale));
+			runner.AddBenchmark(new ScriptBenchmark(*it, code, SCRIPT_BENCHMARK_PHASE_RENDER, mapSize, *scale));
+			runner.AddBenchmark(new ScriptBenchmark(*it, code, SCRIPT_BENCHMARK_PHASE_TOTAL, mapSize, *scale));
+		}
+	}
+}
\ No newline at end of file
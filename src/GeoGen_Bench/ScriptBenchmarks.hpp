@@ -0,0 +1,37 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <GeoGen/GeoGen.hpp>
+
+#include "BenchmarkRunner.hpp"
+
+namespace geogen
+{
+	namespace bench
+	{
+		/// Adds end-to-end benchmarks of map scripts. For each script and scale, the compilation, the execution in the virtual machine, the rendering and all three phases together are benchmarked separately.
+		/// @param runner The runner.
+		/// @param scriptFiles Paths to the script files.
+		/// @param mapSize Logical width and height of the map.
+		/// @param scales Render scales.
+		void AddScriptBenchmarks(BenchmarkRunner& runner, std::vector<std::string> const& scriptFiles, Size1D mapSize, std::vector<Scale> const& scales);
+	}
+}
\ No newline at end of file
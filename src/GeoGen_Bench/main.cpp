@@ -0,0 +1,150 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+#include <GeoGen/GeoGen.hpp>
+
+#include "BenchmarkRunner.hpp"
+#include "GenlibBenchmarks.hpp"
+#include "ScriptBenchmarks.hpp"
+
+using namespace geogen;
+using namespace bench;
+using namespace std;
+
+namespace
+{
+	template<typename T>
+	vector<T> ParseList(string const& list)
+	{
+		vector<T> values;
+		stringstream ss(list);
+		string item;
+		while (getline(ss, item, ','))
+		{
+			stringstream itemStream(item);
+			T value;
+			if (itemStream >> value)
+			{
+				values.push_back(value);
+			}
+		}
+
+		return values;
+	}
+
+	void PrintHelp()
+	{
+		cout << "Usage: geogen_bench [options] [script.ggs ...]" << endl << endl;
+		cout << "Runs microbenchmarks of genlib operations and end-to-end benchmarks of the given map scripts." << endl << endl;
+		cout << "  --output FILE         File the JSON results are written to (bench.json by default)." << endl;
+		cout << "  --warmup N            Number of unmeasured runs of each benchmark (2 by default)." << endl;
+		cout << "  --repetitions N       Number of measured runs of each benchmark (10 by default)." << endl;
+		cout << "  --filter TEXT         Runs only benchmarks whose full name contains TEXT." << endl;
+		cout << "  --sizes A,B,...       Map sizes of the genlib benchmarks (256,1024 by default)." << endl;
+		cout << "  --scales A,B,...      Render scales of all benchmarks (0.5,1 by default)." << endl;
+		cout << "  --map-size N          Map size of the script benchmarks (512 by default)." << endl;
+		cout << "  --no-genlib           Skips the genlib benchmarks." << endl;
+		cout << "  --help                Displays this help." << endl;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	string outputFile = "bench.json";
+	unsigned warmupIterations = 2;
+	unsigned repetitions = 10;
+	string filter = "";
+	vector<Size1D> sizes = ParseList<Size1D>("256,1024");
+	vector<Scale> scales = ParseList<Scale>("0.5,1");
+	Size1D mapSize = 512;
+	bool runGenlib = true;
+	vector<string> scriptFiles;
+
+	for (int i = 1; i < argc; i++)
+	{
+		string argument = argv[i];
+		bool hasValue = i + 1 < argc;
+
+		if (argument == "--help" || argument == "-?")
+		{
+			PrintHelp();
+			return 0;
+		}
+		else if (argument == "--no-genlib")
+		{
+			runGenlib = false;
+		}
+		else if (argument.substr(0, 2) == "--" && !hasValue)
+		{
+			cerr << "Missing value of option \"" << argument << "\"." << endl;
+			return 1;
+		}
+		else if (argument == "--output") outputFile = argv[++i];
+		else if (argument == "--warmup") warmupIterations = atoi(argv[++i]);
+		else if (argument == "--repetitions") repetitions = atoi(argv[++i]);
+		else if (argument == "--filter") filter = argv[++i];
+		else if (argument == "--sizes") sizes = ParseList<Size1D>(argv[++i]);
+		else if (argument == "--scales") scales = ParseList<Scale>(argv[++i]);
+		else if (argument == "--map-size") mapSize = atoi(argv[++i]);
+		else if (argument.substr(0, 2) == "--")
+		{
+			cerr << "Unknown option \"" << argument << "\"." << endl;
+			return 1;
+		}
+		else
+		{
+			scriptFiles.push_back(argument);
+		}
+	}
+
+	try
+	{
+		BenchmarkRunner runner(warmupIterations, repetitions, filter);
+
+		if (runGenlib)
+		{
+			AddGenlibBenchmarks(runner, sizes, scales);
+		}
+
+		AddScriptBenchmarks(runner, scriptFiles, mapSize, scales);
+
+		runner.Run(cout);
+
+		ofstream output(outputFile.c_str());
+		runner.WriteJson(output);
+		if (output.fail())
+		{
+			cerr << "Could not write results to \"" << outputFile << "\"." << endl;
+			return 1;
+		}
+
+		cout << "Results of " << runner.GetResults().size() << " benchmarks written to \"" << outputFile << "\"." << endl;
+	}
+	catch (GeoGenException& e)
+	{
+		Cout << GG_STR("Benchmark failed with error GGE") << e.GetErrorCode() << GG_STR(": ") << e.GetDetailMessage() << endl;
+		return 1;
+	}
+
+	return 0;
+}
\ No newline at end of file
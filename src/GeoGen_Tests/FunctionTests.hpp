@@ -127,6 +127,57 @@ public:
 		");
 	}
 
+	static void TestMemberCallInlineCache()
+	{
+		auto_ptr<CompiledScript> compiledScript = TestGetCompiledScript("\n\
+			var a = Array.Empty();\n\
+			a.PushBack(1);\n\
+			var sum = 0;\n\
+			for (var i = 0; i < 10; i++) { sum = sum + a.Count(); }\n\
+			AssertEquals(10, sum);\n\
+		");
+
+		// Each virtual machine starts with empty caches, so the second one has to miss exactly like the first one.
+		for (int i = 0; i < 2; i++)
+		{
+			VirtualMachine vm(*compiledScript, compiledScript->CreateScriptParameters());
+			vm.Run();
+
+			ASSERT_EQUALS(bool, true, vm.GetInlineCacheStatistics().GetHitCount() >= 9);
+			ASSERT_EQUALS(bool, true, vm.GetInlineCacheStatistics().GetMissCount() >= 3);
+		}
+
+		TEST_SCRIPT_FAILURE(UndefinedSymbolAccessException, "\n\
+			function f(x) { return x.Count(); }\n\
+			f(Array.Empty());\n\
+			f(1);\n\
+		");
+	}
+
+	static void TestScriptProfiler()
+	{
+		auto_ptr<CompiledScript> compiledScript = TestGetCompiledScript("\n\
+			function f(x) { return Max(x, 1); }\n\
+			var sum = 0;\n\
+			for (var i = 0; i < 5; i++) { sum = sum + f(i); }\n\
+			AssertEquals(11, sum);\n\
+		");
+
+		ScriptProfiler profiler;
+		VirtualMachine vm(*compiledScript, compiledScript->CreateScriptParameters());
+		vm.SetScriptProfiler(&profiler);
+		vm.Run();
+
+		ASSERT_EQUALS(unsigned, 5, (unsigned)profiler.GetNativeFunctionEntries().find(GG_STR("Max"))->second.Count);
+		ASSERT_EQUALS(bool, true, profiler.GetLineEntries().find(2) != profiler.GetLineEntries().end());
+		ASSERT_EQUALS(bool, true, profiler.GetLineEntries().find(4)->second.Count > profiler.GetLineEntries().find(5)->second.Count);
+		ASSERT_EQUALS(unsigned, vm.GetInstructionCounter(), (unsigned)profiler.GetTotal().Count);
+
+		StringStream stacks;
+		profiler.WriteCollapsedStacks(stacks);
+		ASSERT_EQUALS(bool, true, stacks.str().find(GG_STR("<main>;f;Max ")) != String::npos);
+	}
+
 	FunctionTests() : TestFixtureBase("FunctionTests")
 	{
 		ADD_TESTCASE(TestCallFunction);
@@ -140,5 +191,7 @@ public:
 		ADD_TESTCASE(TestCallStackOverflow);
 		ADD_TESTCASE(TestCallScriptFunctionWithIncorrectNumberOfArguments);
 		ADD_TESTCASE(TestArgumentOrder);
+		ADD_TESTCASE(TestMemberCallInlineCache);
+		ADD_TESTCASE(TestScriptProfiler);
 	}
 };
\ No newline at end of file
@@ -0,0 +1,161 @@
+/* GeoGen - Programmable height map generator
+Copyright (C) 2015  Matej Zabsky
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>. */
+
+#pragma once
+
+#include "TestFixtureBase.hpp"
+
+class OptimizerTests : public TestFixtureBase
+{
+	static auto_ptr<CompiledScript> CompileWithOptimizationLevel(String const& script, OptimizationLevel optimizationLevel)
+	{
+		Configuration configuration;
+		configuration.MainMapIsMandatory = false;
+		configuration.CompilerOptimizationLevel = optimizationLevel;
+
+		Compiler compiler(configuration);
+		return auto_ptr<CompiledScript>(compiler.CompileScript(script));
+	}
+
+	static unsigned CountInstructions(CodeBlock const& codeBlock, String const& instructionName)
+	{
+		unsigned count = 0;
+		for (CodeBlock::const_iterator it = codeBlock.Begin(); it != codeBlock.End(); it++)
+		{
+			if ((*it)->GetInstructionName() == instructionName)
+			{
+				count++;
+			}
+
+			if (instructions::IfInstruction const* ifInstruction = dynamic_cast<instructions::IfInstruction const*>(*it))
+			{
+				count += CountInstructions(ifInstruction->GetIfBranchCodeBlock(), instructionName);
+				count += CountInstructions(ifInstruction->GetElseBranchCodeBlock(), instructionName);
+			}
+			else if (instructions::WhileInstruction const* whileInstruction = dynamic_cast<instructions::WhileInstruction const*>(*it))
+			{
+				count += CountInstructions(whileInstruction->GetCodeBlock(), instructionName);
+			}
+			else if (instructions::CallBlockInstruction const* callBlockInstruction = dynamic_cast<instructions::CallBlockInstruction const*>(*it))
+			{
+				count += CountInstructions(callBlockInstruction->GetCodeBlock(), instructionName);
+			}
+		}
+
+		return count;
+	}
+
+	static unsigned CountMainInstructions(CompiledScript const& compiledScript, String const& instructionName)
+	{
+		ScriptFunctionDefinition const* mainFunction = dynamic_cast<ScriptFunctionDefinition const*>(compiledScript.GetGlobalFunctionDefinitions().GetItem(CompiledScript::MAIN_FUNCTION_NAME));
+		return CountInstructions(mainFunction->GetRootCodeBlock(), instructionName);
+	}
+
+public:
+	static void TestConstantFolding()
+	{
+		String script = GG_STR("\n\
+			var a = -(1 + 2 * 3) % 4 << 2;\n\
+			var b = !(1 < 2 && 3 >= 4) || false;\n\
+			AssertEquals(-12, a);\n\
+			AssertEquals(true, b);\n\
+		");
+
+		TestScript(script);
+
+		auto_ptr<CompiledScript> optimized = CompileWithOptimizationLevel(script, OPTIMIZATION_LEVEL_BASIC);
+		ASSERT_EQUALS(unsigned, 2, CountMainInstructions(*optimized, GG_STR("CallGlobal")));
+
+		auto_ptr<CompiledScript> unoptimized = CompileWithOptimizationLevel(script, OPTIMIZATION_LEVEL_NONE);
+		ASSERT_EQUALS(unsigned, 13, CountMainInstructions(*unoptimized, GG_STR("CallGlobal")));
+	}
+
+	static void TestFoldingPreservesRuntimeErrors()
+	{
+		TEST_SCRIPT_FAILURE(DivisionByZeroException, "var a = 1 / 0;");
+		TEST_SCRIPT_FAILURE(NumberOverflowException, "var a = 5000000000 % 2;");
+		TEST_SCRIPT_FAILURE(IncorrectTypeException, "var a = 1 + true;");
+	}
+
+	static void TestConstantConditionPruning()
+	{
+		String script = GG_STR("\n\
+			var a = 0;\n\
+			if (1 < 2) { a = 1; } else { AssertEquals(1, 2); }\n\
+			if (false) { AssertEquals(1, 2); }\n\
+			while (false) { AssertEquals(1, 2); }\n\
+			for (var i = 0; false; i++) { AssertEquals(1, 2); }\n\
+			AssertEquals(1, a);\n\
+		");
+
+		TestScript(script);
+
+		auto_ptr<CompiledScript> optimized = CompileWithOptimizationLevel(script, OPTIMIZATION_LEVEL_BASIC);
+		ASSERT_EQUALS(unsigned, 0, CountMainInstructions(*optimized, GG_STR("If")));
+		ASSERT_EQUALS(unsigned, 0, CountMainInstructions(*optimized, GG_STR("While")));
+		ASSERT_EQUALS(unsigned, 0, CountMainInstructions(*optimized, GG_STR("LoadConstBoolean")));
+	}
+
+	static void TestUnreachableCodeRemoval()
+	{
+		String script = GG_STR("\n\
+			function f() {\n\
+				return 1;\n\
+				AssertEquals(1, 2);\n\
+			}\n\
+			var a = 0;\n\
+			while (true) { a++; break; AssertEquals(1, 2); }\n\
+			AssertEquals(1, a);\n\
+			AssertEquals(1, f());\n\
+		");
+
+		TestScript(script);
+
+		auto_ptr<CompiledScript> optimized = CompileWithOptimizationLevel(script, OPTIMIZATION_LEVEL_BASIC);
+		ScriptFunctionDefinition const* function = dynamic_cast<ScriptFunctionDefinition const*>(optimized->GetGlobalFunctionDefinitions().GetItem(GG_STR("f")));
+		ASSERT_EQUALS(unsigned, 0, CountInstructions(function->GetRootCodeBlock(), GG_STR("CallGlobal")));
+		ASSERT_EQUALS(unsigned, 4, CountMainInstructions(*optimized, GG_STR("CallGlobal")));
+	}
+
+	static void TestUnusedVariableRemoval()
+	{
+		String script = GG_STR("\n\
+			var unused = 1 + 2;\n\
+			var unusedWithSideEffect = Print(\"a\");\n\
+			var unusedUninitialized;\n\
+			var used = 2;\n\
+			AssertEquals(2, used);\n\
+		");
+
+		TestScript(script);
+
+		auto_ptr<CompiledScript> full = CompileWithOptimizationLevel(script, OPTIMIZATION_LEVEL_FULL);
+		ASSERT_EQUALS(unsigned, 1, CountMainInstructions(*full, GG_STR("DeclareLocalValue")));
+		ASSERT_EQUALS(unsigned, 2, CountMainInstructions(*full, GG_STR("CallGlobal")));
+
+		auto_ptr<CompiledScript> basic = CompileWithOptimizationLevel(script, OPTIMIZATION_LEVEL_BASIC);
+		ASSERT_EQUALS(unsigned, 4, CountMainInstructions(*basic, GG_STR("DeclareLocalValue")));
+	}
+
+	OptimizerTests() : TestFixtureBase("OptimizerTests")
+	{
+		ADD_TESTCASE(TestConstantFolding);
+		ADD_TESTCASE(TestFoldingPreservesRuntimeErrors);
+		ADD_TESTCASE(TestConstantConditionPruning);
+		ADD_TESTCASE(TestUnreachableCodeRemoval);
+		ADD_TESTCASE(TestUnusedVariableRemoval);
+	}
+};
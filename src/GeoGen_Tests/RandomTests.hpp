@@ -59,6 +59,99 @@ public:
 		ASSERT_EQUALS(int, -1143852053, sequence.GetInt(Point(0, 2)));
 	}
 	 
+	static void TestRandomSequence2DRows()
+	{
+		RandomSequence2D sequence(8);
+		sequence.Advance();
+
+		// Odd number of columns at irregular positions, so every code path of the row hashing is used.
+		const unsigned count = 37;
+		Coordinate xs[count];
+		for (unsigned i = 0; i < count; i++)
+		{
+			xs[i] = Coordinate(i * i * 7919) - 5000;
+		}
+
+		unsigned columnHashes[count];
+		sequence.GetColumnHashes(xs, count, columnHashes);
+
+		int ranges[][2] = { { -32767, 32767 }, { 0, 0 }, { -3, 8 }, { INT_MIN / 2, INT_MAX / 2 } };
+		Coordinate ys[] = { 0, 1, -1, 123456, -987654 };
+		int output[count];
+		for (unsigned i = 0; i < sizeof(ys) / sizeof(ys[0]); i++)
+		{
+			RandomSequence2D::GetRowInts(columnHashes, ys[i], count, output);
+			for (unsigned j = 0; j < count; j++)
+			{
+				ASSERT_EQUALS(int, sequence.GetInt(Point(xs[j], ys[i])), output[j]);
+			}
+
+			for (unsigned k = 0; k < sizeof(ranges) / sizeof(ranges[0]); k++)
+			{
+				RandomSequence2D::GetRowInts(columnHashes, ys[i], count, ranges[k][0], ranges[k][1], output);
+				for (unsigned j = 0; j < count; j++)
+				{
+					ASSERT_EQUALS(int, sequence.GetInt(Point(xs[j], ys[i]), ranges[k][0], ranges[k][1]), output[j]);
+				}
+			}
+		}
+
+		sequence.GetColumnHashes(-10, 3, count, columnHashes);
+		RandomSequence2D::GetRowInts(columnHashes, 7, count, output);
+		for (unsigned j = 0; j < count; j++)
+		{
+			ASSERT_EQUALS(int, sequence.GetInt(Point(-10 + 3 * Coordinate(j), 7)), output[j]);
+		}
+	}
+
+	static void TestRandomSequence2DSeedSteps()
+	{
+		RandomSeedScheme seedSchemes[] = { RANDOM_SEED_SCHEME_SEQUENTIAL, RANDOM_SEED_SCHEME_COUNTER };
+		for (unsigned i = 0; i < sizeof(seedSchemes) / sizeof(seedSchemes[0]); i++)
+		{
+			RandomSequence2D advancedSequence(8, seedSchemes[i]);
+			for (unsigned step = 0; step < 20; step++)
+			{
+				RandomSequence2D directSequence(8, step, seedSchemes[i]);
+				ASSERT_EQUALS(unsigned, step, directSequence.GetStep());
+				ASSERT_EQUALS(int, advancedSequence.GetInt(Point(3, -7)), directSequence.GetInt(Point(3, -7)));
+
+				advancedSequence.Advance();
+			}
+		}
+
+		// The original scheme must keep reproducing the same numbers.
+		RandomSequence2D sequentialSequence(8, 0, RANDOM_SEED_SCHEME_SEQUENTIAL);
+		ASSERT_EQUALS(int, 1860076204, sequentialSequence.GetInt(Point(0, 0)));
+
+		RandomSequence2D counterSequence(8, 0, RANDOM_SEED_SCHEME_COUNTER);
+		ASSERT_EQUALS(bool, true, counterSequence.GetInt(Point(0, 0)) != 1860076204);
+	}
+
+	static void TestSimplexNoiseRows()
+	{
+		RandomSequence2D sequence(8);
+
+		// Points both sparser and denser than the grid, crossing zero, so rows span many cells and share some of them.
+		const unsigned count = 300;
+		double xs[count];
+		for (unsigned i = 0; i < count; i++)
+		{
+			xs[i] = -40 + i * (i < count / 2 ? 0.07 : 0.9);
+		}
+
+		double ys[] = { 0, 0.3, -17.25, 1234.5 };
+		double output[count];
+		for (unsigned i = 0; i < sizeof(ys) / sizeof(ys[0]); i++)
+		{
+			SimplexNoise::EvaluateRow(sequence, xs, ys[i], count, output);
+			for (unsigned j = 0; j < count; j++)
+			{
+				ASSERT_EQUALS(bool, true, SimplexNoise::Evaluate(sequence, xs[j], ys[i]) == output[j]);
+			}
+		}
+	}
+
 	static void TestRandomSequenceHistogram()
 	{
 		RandomSequence sequence(8);
@@ -108,6 +201,9 @@ public:
 		ADD_TESTCASE(TestSimpleSequence);
 		ADD_TESTCASE(TestParalellSequences);
 		ADD_TESTCASE(TestRandomSequence2D);
+		ADD_TESTCASE(TestRandomSequence2DRows);
+		ADD_TESTCASE(TestRandomSequence2DSeedSteps);
+		ADD_TESTCASE(TestSimplexNoiseRows);
 		ADD_TESTCASE(TestRandomSequenceHistogram);
 	}
 };
\ No newline at end of file
@@ -184,6 +184,1225 @@ public:
 		SaveRenders("TestBlur", renderer.GetRenderedMapTable());
 	}
 
+	static void TestRenderingSequenceReuse()
+	{
+		auto_ptr<CompiledScript> compiledScript = TestGetCompiledScript("\n\
+			var heightMap = HeightMap.RadialGradient([400, 400], 350, 1.0, 0.0); \n\
+			heightMap.Blur(10); \n\
+			yield heightMap; \n\
+		");
+
+		ScriptParameters templateParameters = compiledScript->CreateScriptParameters();
+		templateParameters.SetRenderRectangle(Rectangle(Point(0, 0), Size2D(250, 250)));
+
+		VirtualMachine templateVm(*compiledScript, templateParameters);
+		templateVm.Run();
+
+		ASSERT_EQUALS(bool, false, templateVm.GetRenderingSequence().IsRenderRectangleDependent());
+
+		vector<Rectangle> rectangles;
+		rectangles.push_back(Rectangle(Point(250, 0), Size2D(250, 250)));
+		rectangles.push_back(Rectangle(Point(250, 250), Size2D(250, 250)));
+		rectangles.push_back(Rectangle(Point(500, 250), Size2D(100, 300)));
+
+		for (vector<Rectangle>::iterator it = rectangles.begin(); it != rectangles.end(); it++)
+		{
+			ScriptParameters parameters = compiledScript->CreateScriptParameters();
+			parameters.SetRenderRectangle(*it);
+
+			Renderer reusingRenderer(templateVm.GetRenderingSequence(), parameters.GetActualRenderRectangle());
+			reusingRenderer.CalculateMetadata();
+			reusingRenderer.Run();
+
+			VirtualMachine vm(*compiledScript, parameters);
+			vm.Run();
+
+			Renderer renderer(vm.GetRenderingSequence());
+			renderer.CalculateMetadata();
+			renderer.Run();
+
+			HeightMap* expected = renderer.GetRenderedMapTable().GetItem(Renderer::MAP_NAME_MAIN);
+			HeightMap* actual = reusingRenderer.GetRenderedMapTable().GetItem(Renderer::MAP_NAME_MAIN);
+
+			ASSERT_EQUALS(Coordinate, expected->GetRectangle().GetPosition().GetX(), actual->GetRectangle().GetPosition().GetX());
+			ASSERT_EQUALS(Coordinate, expected->GetRectangle().GetPosition().GetY(), actual->GetRectangle().GetPosition().GetY());
+			ASSERT_EQUALS(Size1D, expected->GetRectangle().GetSize().GetWidth(), actual->GetRectangle().GetSize().GetWidth());
+			ASSERT_EQUALS(Size1D, expected->GetRectangle().GetSize().GetHeight(), actual->GetRectangle().GetSize().GetHeight());
+
+			for (Coordinate y = 0; y < Coordinate(expected->GetHeight()); y++)
+			{
+				for (Coordinate x = 0; x < Coordinate(expected->GetWidth()); x++)
+				{
+					ASSERT_EQUALS(Height, (*expected)(x, y), (*actual)(x, y));
+				}
+			}
+		}
+	}
+
+	static void TestRenderRectangleDependentSequence()
+	{
+		auto_ptr<CompiledScript> compiledScript = TestGetCompiledScript("\n\
+			var height = 0.2; \n\
+			if (Parameters.RenderWidth > 100) { height = 0.5; } \n\
+			var heightMap = HeightMap.Flat(height); \n\
+			yield heightMap; \n\
+		");
+
+		ScriptParameters parameters = compiledScript->CreateScriptParameters();
+		parameters.SetRenderRectangle(Rectangle(Point(0, 0), Size2D(250, 250)));
+
+		VirtualMachine vm(*compiledScript, parameters);
+		vm.Run();
+
+		ASSERT_EQUALS(bool, true, vm.GetRenderingSequence().IsRenderRectangleDependent());
+
+		try
+		{
+			Renderer renderer(vm.GetRenderingSequence(), Rectangle(Point(250, 0), Size2D(50, 50)));
+		}
+		catch (ApiUsageException&)
+		{
+			return;
+		}
+
+		throw NoExceptionException(AnyStringToString("ApiUsageException"));
+	}
+
+	static void TestDistanceMap()
+	{
+		auto_ptr<CompiledScript> compiledScript = TestGetCompiledScript("\n\
+			var heightMap = HeightMap.Flat(1); \n\
+			heightMap.FillRectangle([60, 40], [61, 41], 0); \n\
+			yield HeightMap.DistanceMap(heightMap, 30); \n\
+		");
+
+		ScriptParameters parameters = compiledScript->CreateScriptParameters();
+		parameters.SetRenderWidth(120);
+		parameters.SetRenderHeight(80);
+
+		VirtualMachine vm(*compiledScript, parameters);
+		vm.Run();
+
+		Renderer renderer(vm.GetRenderingSequence());
+		renderer.CalculateMetadata();
+		renderer.Run();
+
+		HeightMap* map = renderer.GetRenderedMapTable().GetItem(Renderer::MAP_NAME_MAIN);
+		ASSERT_EQUALS(Height, 0, (*map)(60, 40));
+		ASSERT_EQUALS(Height, Height(10 * double(HEIGHT_MAX) / 30), (*map)(71, 40));
+		ASSERT_EQUALS(Height, Height(5 * double(HEIGHT_MAX) / 30), (*map)(64, 45));
+		ASSERT_EQUALS(Height, HEIGHT_MAX, (*map)(100, 40));
+		ASSERT_EQUALS(Height, HEIGHT_MAX, (*map)(60, 79));
+	}
+
+	static void TestGradients()
+	{
+		auto_ptr<CompiledScript> compiledScript = TestGetCompiledScript("\n\
+			yield HeightMap.Gradient([20, 0], [60, 0], 0, 1); \n\
+			yield HeightMap.RadialGradient([50, 5], 10, 1, 0) as \"radial\"; \n\
+		");
+
+		ScriptParameters parameters = compiledScript->CreateScriptParameters();
+		parameters.SetRenderWidth(100);
+		parameters.SetRenderHeight(10);
+
+		VirtualMachine vm(*compiledScript, parameters);
+		vm.Run();
+
+		Renderer renderer(vm.GetRenderingSequence());
+		renderer.CalculateMetadata();
+		renderer.Run();
+
+		HeightMap* linear = renderer.GetRenderedMapTable().GetItem(Renderer::MAP_NAME_MAIN);
+		ASSERT_EQUALS(Height, 0, (*linear)(0, 0));
+		ASSERT_EQUALS(Height, 0, (*linear)(20, 9));
+		ASSERT_EQUALS(Height, 16383, (*linear)(40, 5));
+		ASSERT_EQUALS(Height, HEIGHT_MAX, (*linear)(60, 0));
+		ASSERT_EQUALS(Height, HEIGHT_MAX, (*linear)(99, 9));
+
+		HeightMap* radial = renderer.GetRenderedMapTable().GetItem(GG_STR("radial"));
+		ASSERT_EQUALS(Height, HEIGHT_MAX, (*radial)(50, 5));
+		ASSERT_EQUALS(Height, 16384, (*radial)(55, 5));
+		ASSERT_EQUALS(Height, 0, (*radial)(60, 5));
+		ASSERT_EQUALS(Height, 0, (*radial)(0, 0));
+	}
+
+	static void TestRotate()
+	{
+		auto_ptr<CompiledScript> compiledScript = TestGetCompiledScript("\n\
+			var heightMap = HeightMap.Flat(0.5); \n\
+			heightMap.Rotate(0.3); \n\
+			yield heightMap; \n\
+		");
+
+		ScriptParameters parameters = compiledScript->CreateScriptParameters();
+		parameters.SetRenderWidth(60);
+		parameters.SetRenderHeight(40);
+
+		VirtualMachine vm(*compiledScript, parameters);
+		vm.Run();
+
+		Renderer renderer(vm.GetRenderingSequence());
+		renderer.CalculateMetadata();
+		renderer.Run();
+
+		// The rotated map covers the entire render, so no point may be left empty.
+		HeightMap* map = renderer.GetRenderedMapTable().GetItem(Renderer::MAP_NAME_MAIN);
+		for (Coordinate y = 0; y < Coordinate(map->GetHeight()); y++)
+		{
+			for (Coordinate x = 0; x < Coordinate(map->GetWidth()); x++)
+			{
+				ASSERT_EQUALS(Height, 16383, (*map)(x, y));
+			}
+		}
+	}
+
+	static void TestRescaleFilters()
+	{
+		auto_ptr<CompiledScript> compiledScript = TestGetCompiledScript("\n\
+			function Stripes() { \n\
+				var stripes = HeightMap.Flat(0); \n\
+				for (var x = 1; x < 60; x += 2) { stripes.FillRectangle([x, 0], [x, 40], 0.5); } \n\
+				return stripes; \n\
+			} \n\
+			yield Stripes().Rescale(0.5, 0.5, RescaleFilter.Nearest) as \"nearest\"; \n\
+			yield Stripes().Rescale(0.5, 0.5, RescaleFilter.Box) as \"box\"; \n\
+			var profile = HeightProfile.Gradient(0, 200, 0, 1).Rescale(0.5, RescaleFilter.Bicubic); \n\
+			yield HeightMap.Projection(profile, Direction.Vertical) as \"bicubic\"; \n\
+		");
+
+		ScriptParameters parameters = compiledScript->CreateScriptParameters();
+		parameters.SetRenderWidth(60);
+		parameters.SetRenderHeight(40);
+
+		VirtualMachine vm(*compiledScript, parameters);
+		vm.Run();
+
+		Renderer renderer(vm.GetRenderingSequence());
+		renderer.CalculateMetadata();
+		renderer.Run();
+
+		// Nearest neighbor only picks existing heights, the box filter averages neighboring stripes and cubic interpolation of a gradient is still monotonic.
+		HeightMap* nearest = renderer.GetRenderedMapTable().GetItem(GG_STR("nearest"));
+		HeightMap* box = renderer.GetRenderedMapTable().GetItem(GG_STR("box"));
+		HeightMap* bicubic = renderer.GetRenderedMapTable().GetItem(GG_STR("bicubic"));
+		for (Coordinate y = 0; y < 40; y++)
+		{
+			for (Coordinate x = 0; x < 60; x++)
+			{
+				// Only the rendered part of each object is rescaled, so the results cover the top left quarter of the render.
+				if (x < 30 && y < 20)
+				{
+					ASSERT_EQUALS(bool, true, (*nearest)(x, y) == 0 || (*nearest)(x, y) == 16383);
+					ASSERT_EQUALS(bool, true, (*box)(x, y) > 5000 && (*box)(x, y) < 11500);
+					ASSERT_EQUALS(bool, true, x == 0 || (*bicubic)(x, y) > (*bicubic)(x - 1, y));
+				}
+			}
+		}
+
+		ASSERT_EQUALS(Height, 0, (*bicubic)(0, 0));
+	}
+
+	static void TestProgressiveRendering()
+	{
+		auto_ptr<CompiledScript> compiledScript = TestGetCompiledScript("\n\
+			var heightMap = HeightMap.Gradient([0, 0], [200, 0], 0, 1); \n\
+			heightMap.Blur(5); \n\
+			yield heightMap; \n\
+		");
+
+		ScriptParameters parameters = compiledScript->CreateScriptParameters();
+		parameters.SetRenderWidth(200);
+		parameters.SetRenderHeight(100);
+
+		VirtualMachine vm(*compiledScript, parameters);
+		vm.Run();
+
+		ASSERT_EQUALS(bool, false, vm.GetRenderingSequence().IsRenderScaleDependent());
+
+		ProgressiveRenderer progressiveRenderer(vm.GetRenderingSequence(), 3);
+		ASSERT_EQUALS(unsigned, 3, progressiveRenderer.GetLevelCount());
+
+		// Each level doubles the resolution of the previous one.
+		for (unsigned level = 0; level < 3; level++)
+		{
+			progressiveRenderer.RunLevel();
+			ASSERT_EQUALS(unsigned, level + 1, progressiveRenderer.GetFinishedLevelCount());
+
+			HeightMap* map = progressiveRenderer.GetRenderedMapTable().GetItem(Renderer::MAP_NAME_MAIN);
+			ASSERT_EQUALS(Size1D, 200 >> (2 - level), map->GetWidth());
+			ASSERT_EQUALS(Size1D, 100 >> (2 - level), map->GetHeight());
+		}
+
+		ASSERT_EQUALS(bool, true, progressiveRenderer.IsFinished());
+		ASSERT_EQUALS(double, 100, progressiveRenderer.GetProgress());
+
+		// The last level is identical to a regular render.
+		Renderer renderer(vm.GetRenderingSequence());
+		renderer.CalculateMetadata();
+		renderer.Run();
+
+		HeightMap* expected = renderer.GetRenderedMapTable().GetItem(Renderer::MAP_NAME_MAIN);
+		HeightMap* actual = progressiveRenderer.GetRenderedMapTable().GetItem(Renderer::MAP_NAME_MAIN);
+		for (Coordinate y = 0; y < Coordinate(expected->GetHeight()); y++)
+		{
+			for (Coordinate x = 0; x < Coordinate(expected->GetWidth()); x++)
+			{
+				ASSERT_EQUALS(Height, (*expected)(x, y), (*actual)(x, y));
+			}
+		}
+
+		// A script reading the render scale can only be rendered at the scale it was executed with.
+		auto_ptr<CompiledScript> dependentScript = TestGetCompiledScript("\n\
+			yield HeightMap.Flat(Parameters.RenderScale / 2); \n\
+		");
+
+		VirtualMachine dependentVm(*dependentScript, dependentScript->CreateScriptParameters());
+		dependentVm.Run();
+
+		ASSERT_EQUALS(bool, true, dependentVm.GetRenderingSequence().IsRenderScaleDependent());
+
+		ProgressiveRenderer dependentRenderer(dependentVm.GetRenderingSequence(), 3);
+		ASSERT_EQUALS(unsigned, 1, dependentRenderer.GetLevelCount());
+	}
+
+	static void TestFusedNoiseLayers()
+	{
+		// Wave lengths both with and without interpolation, amplitudes high enough for the accumulated heights to get clamped.
+		NoiseLayers layers;
+		layers[1] = 12000;
+		layers[3] = 15000;
+		layers[40] = 20000;
+		layers[64] = 25000;
+
+		for (int isRidged = 0; isRidged < 2; isRidged++)
+		{
+			HeightMap fused(Rectangle(Point(-13, 7), Size2D(53, 29)), 0, 0.8);
+			fused.AddNoiseLayers(layers, 42, 5, isRidged != 0);
+
+			HeightMap separate(Rectangle(Point(-13, 7), Size2D(53, 29)), 0, 0.8);
+			unsigned seedStep = 5;
+			for (NoiseLayers::const_iterator it = layers.begin(); it != layers.end(); it++)
+			{
+				separate.NoiseLayer(it->first, it->second, 42, seedStep++, isRidged != 0);
+			}
+
+			for (Coordinate y = 0; y < Coordinate(fused.GetHeight()); y++)
+			{
+				for (Coordinate x = 0; x < Coordinate(fused.GetWidth()); x++)
+				{
+					ASSERT_EQUALS(Height, separate(x, y), fused(x, y));
+				}
+			}
+		}
+
+		HeightProfile fusedProfile(Interval(-13, 53), 0, 1);
+		fusedProfile.AddNoiseLayers(layers, 42, 5);
+
+		HeightProfile separateProfile(Interval(-13, 53), 0, 1);
+		unsigned seedStep = 5;
+		for (NoiseLayers::const_iterator it = layers.begin(); it != layers.end(); it++)
+		{
+			separateProfile.NoiseLayer(it->first, it->second, 42, seedStep++);
+		}
+
+		for (Coordinate x = 0; x < Coordinate(fusedProfile.GetLength()); x++)
+		{
+			ASSERT_EQUALS(Height, separateProfile(x), fusedProfile(x));
+		}
+	}
+
+	static void TestSimplexNoiseTiling()
+	{
+		auto_ptr<CompiledScript> compiledScript = TestGetCompiledScript("\n\
+			yield HeightMap.SimplexNoise({7: 0.3, 16: 0.5, 64: 0.5}, 3); \n\
+		");
+
+		Rectangle rectangles[] = { Rectangle(Point(0, 0), Size2D(120, 90)), Rectangle(Point(37, 21), Size2D(50, 40)) };
+		auto_ptr<Renderer> renderers[2];
+		for (unsigned i = 0; i < 2; i++)
+		{
+			ScriptParameters parameters = compiledScript->CreateScriptParameters();
+			parameters.SetRenderRectangle(rectangles[i]);
+
+			VirtualMachine vm(*compiledScript, parameters);
+			vm.Run();
+
+			renderers[i] = auto_ptr<Renderer>(new Renderer(vm.GetRenderingSequence()));
+			renderers[i]->CalculateMetadata();
+			renderers[i]->Run();
+		}
+
+		HeightMap* map = renderers[0]->GetRenderedMapTable().GetItem(Renderer::MAP_NAME_MAIN);
+		HeightMap* tile = renderers[1]->GetRenderedMapTable().GetItem(Renderer::MAP_NAME_MAIN);
+
+		// The tile must match the corresponding part of the whole map and the noise must not be flat.
+		Point offset = tile->GetRectangle().GetPosition() - map->GetRectangle().GetPosition();
+		Height minHeight = HEIGHT_MAX;
+		Height maxHeight = HEIGHT_MIN;
+		for (Coordinate y = 0; y < Coordinate(tile->GetHeight()); y++)
+		{
+			for (Coordinate x = 0; x < Coordinate(tile->GetWidth()); x++)
+			{
+				ASSERT_EQUALS(Height, (*map)(x + offset.GetX(), y + offset.GetY()), (*tile)(x, y));
+				minHeight = min(minHeight, (*tile)(x, y));
+				maxHeight = max(maxHeight, (*tile)(x, y));
+			}
+		}
+
+		ASSERT_EQUALS(bool, true, maxHeight - minHeight > HEIGHT_MAX / 4);
+	}
+
+	static void TestRendererMetrics()
+	{
+		auto_ptr<CompiledScript> compiledScript = TestGetCompiledScript("\n\
+			var a = HeightMap.Flat(0.5).Blur(3); \n\
+			var b = HeightMap.Flat(0.2).Blur(5); \n\
+			yield a.Add(b); \n\
+		");
+
+		ScriptParameters parameters = compiledScript->CreateScriptParameters();
+		parameters.SetRenderRectangle(Rectangle(Point(0, 0), Size2D(50, 40)));
+
+		VirtualMachine vm(*compiledScript, parameters);
+		vm.Run();
+
+		RendererMetrics metrics;
+		Renderer renderer(vm.GetRenderingSequence());
+		renderer.AddObserver(&metrics);
+		renderer.CalculateMetadata();
+		renderer.Run();
+
+		ASSERT_EQUALS(unsigned, vm.GetRenderingSequence().Size(), metrics.GetSteps().size());
+		for (unsigned i = 0; i < metrics.GetSteps().size(); i++)
+		{
+			ASSERT_EQUALS(unsigned, i, metrics.GetSteps()[i].StepNumber);
+		}
+
+		RendererStepTypeMetrics const& blur = metrics.GetStepTypes().find(GG_STR("HeightMap.Blur"))->second;
+		ASSERT_EQUALS(unsigned, 2, (unsigned)blur.Count);
+		ASSERT_EQUALS(bool, true, blur.PixelCount >= 2 * 50 * 40);
+
+		// Both maps are alive at the same time before they are added together.
+		ASSERT_EQUALS(bool, true, metrics.GetPeakLiveMemory() >= 2 * 50 * 40 * sizeof(Height));
+
+		StringStream trace;
+		metrics.WriteChromeTrace(trace);
+		ASSERT_EQUALS(bool, true, trace.str().find(GG_STR("\"name\": \"HeightMap.Blur\", \"cat\": \"render\", \"ph\": \"X\"")) != String::npos);
+	}
+
+	static void TestMemoryTracking()
+	{
+		auto_ptr<CompiledScript> compiledScript = TestGetCompiledScript("\n\
+			var a = HeightMap.Flat(0.5); \n\
+			a.Rescale(2); \n\
+			yield a; \n\
+		");
+
+		ScriptParameters parameters = compiledScript->CreateScriptParameters();
+		parameters.SetRenderRectangle(Rectangle(Point(0, 0), Size2D(50, 40)));
+
+		VirtualMachine vm(*compiledScript, parameters);
+		vm.Run();
+
+		unsigned long long initialMemory = genlib::MemoryTracker::GetCurrentMemory();
+
+		{
+			RendererMetrics metrics;
+			Renderer renderer(vm.GetRenderingSequence());
+			renderer.AddObserver(&metrics);
+			renderer.CalculateMetadata();
+			renderer.Run();
+
+			// The map is created at half of the yielded size, the rescale must not affect the bounds it is created with.
+			ASSERT_EQUALS(unsigned long long, genlib::HeightMap::GetMemorySize(Rectangle(Point(0, 0), Size2D(25, 20)), 1), metrics.GetSteps()[0].LiveMemory);
+
+			// The rescale allocates the rescaled map and a buffer of horizontally rescaled rows while the original map is still alive, all of which is predicted.
+			RendererStepMetrics const& rescale = metrics.GetSteps()[1];
+			ASSERT_EQUALS(String, GG_STR("HeightMap.Rescale"), rescale.StepName);
+			ASSERT_EQUALS(bool, true, rescale.PeakMemory > rescale.LiveMemory);
+			ASSERT_EQUALS(bool, true, rescale.PeakMemory >= rescale.LiveMemory + metrics.GetSteps()[0].LiveMemory);
+			ASSERT_EQUALS(bool, false, rescale.Mispredicted);
+			ASSERT_EQUALS(bool, true, metrics.GetPeakMemory() >= rescale.PeakMemory);
+
+			// The copy of the map added to the rendered map table is predicted too.
+			ASSERT_EQUALS(unsigned long long, 0, metrics.GetMispredictionCount());
+		}
+
+		// All tracked memory is released with the renderer.
+		ASSERT_EQUALS(unsigned long long, initialMemory, genlib::MemoryTracker::GetCurrentMemory());
+	}
+
+	static void TestMemoryTrackingPerRenderer()
+	{
+		// Stands for another renderer running at the same time, allocating a large map under its own account during each step.
+		class ConcurrentAllocationObserver : public RendererObserver
+		{
+		public:
+			genlib::MemoryTracker::Account otherAccount;
+			auto_ptr<HeightMap> otherMap;
+
+			virtual void BeforeStep(Renderer& renderer, RenderingStep const* step)
+			{
+				genlib::MemoryTracker::AccountScope accountScope(&this->otherAccount);
+				this->otherMap = auto_ptr<HeightMap>(new HeightMap(Rectangle(Point(0, 0), Size2D(500, 500)), 0));
+			}
+
+			virtual void AfterStep(Renderer& renderer, RenderingStep const* step)
+			{
+				genlib::MemoryTracker::AccountScope accountScope(&this->otherAccount);
+				this->otherMap.reset();
+			}
+		};
+
+		auto_ptr<CompiledScript> compiledScript = TestGetCompiledScript("\n\
+			var a = HeightMap.Flat(0.5); \n\
+			a.Blur(2); \n\
+			yield a; \n\
+		");
+
+		ScriptParameters parameters = compiledScript->CreateScriptParameters();
+		parameters.SetRenderRectangle(Rectangle(Point(0, 0), Size2D(50, 40)));
+
+		VirtualMachine vm(*compiledScript, parameters);
+		vm.Run();
+
+		RendererMetrics metrics;
+		ConcurrentAllocationObserver concurrentAllocation;
+		Renderer renderer(vm.GetRenderingSequence());
+		renderer.AddObserver(&metrics);
+		renderer.AddObserver(&concurrentAllocation);
+		renderer.CalculateMetadata();
+		renderer.Run();
+
+		// The other map is far larger than anything the render predicts, but it belongs to the other account.
+		ASSERT_EQUALS(bool, true, concurrentAllocation.otherAccount.GetPeakMemory() >= 500 * 500 * sizeof(Height));
+		ASSERT_EQUALS(unsigned long long, 0, concurrentAllocation.otherAccount.GetCurrentMemory());
+		ASSERT_EQUALS(bool, true, metrics.GetPeakMemory() < 500 * 500 * sizeof(Height));
+		ASSERT_EQUALS(unsigned long long, 0, metrics.GetMispredictionCount());
+	}
+
+	static void TestRenderingStepIndexes()
+	{
+		auto_ptr<CompiledScript> compiledScript = TestGetCompiledScript("\n\
+			var profile = HeightProfile.Flat(0.2); \n\
+			var a = HeightMap.Flat(0.5); \n\
+			a.Add(HeightMap.Projection(profile, Direction.Horizontal)); \n\
+			yield a; \n\
+		");
+
+		ScriptParameters parameters = compiledScript->CreateScriptParameters();
+		parameters.SetRenderWidth(20);
+		parameters.SetRenderHeight(10);
+
+		VirtualMachine vm(*compiledScript, parameters);
+		vm.Run();
+
+		RenderingSequence const& renderingSequence = vm.GetRenderingSequence();
+		Renderer renderer(renderingSequence);
+		renderer.CalculateMetadata();
+
+		unsigned index = 0;
+		for (RenderingSequence::const_iterator it = renderingSequence.Begin(); it != renderingSequence.End(); it++)
+		{
+			ASSERT_EQUALS(unsigned, index, (*it)->GetIndex());
+			ASSERT_EQUALS(unsigned, index, renderer.GetRenderingSequenceMetadata().GetStepNumberByAddress(*it));
+			ASSERT_EQUALS(bool, true, renderer.GetRenderingGraph().GetNodeByStep(*it)->GetStep() == *it);
+
+			// The typed accessors must agree with the step types.
+			RenderingBounds* bounds = renderer.GetRenderingSequenceMetadata().GetRenderingBounds(*it);
+			ASSERT_EQUALS(bool, true, bounds->GetRenderingStepType() == (*it)->GetRenderingStepType());
+			if ((*it)->GetRenderingStepType() == RENDERING_STEP_TYPE_1D)
+			{
+				ASSERT_EQUALS(bool, true, renderer.GetRenderingSequenceMetadata().GetRenderingBounds1D(*it) == bounds);
+			}
+			else
+			{
+				ASSERT_EQUALS(bool, true, renderer.GetRenderingSequenceMetadata().GetRenderingBounds2D(*it) == bounds);
+			}
+
+			index++;
+		}
+
+		ASSERT_EQUALS(unsigned, renderingSequence.Size(), index);
+
+		// Steps of another sequence have the same indexes, but they don't belong to this one.
+		VirtualMachine otherVm(*compiledScript, parameters);
+		otherVm.Run();
+
+		bool isForeignStepRejected = false;
+		try
+		{
+			renderer.GetRenderingSequenceMetadata().GetStepNumberByAddress(*otherVm.GetRenderingSequence().Begin());
+		}
+		catch (InternalErrorException&)
+		{
+			isForeignStepRejected = true;
+		}
+
+		ASSERT_EQUALS(bool, true, isForeignStepRejected);
+
+		// The first step creates the profile, so its bounds can't be accessed as 2D.
+		try
+		{
+			renderer.GetRenderingSequenceMetadata().GetRenderingBounds2D(*renderingSequence.Begin());
+		}
+		catch (InternalErrorException&)
+		{
+			return;
+		}
+
+		throw NoExceptionException(AnyStringToString("InternalErrorException"));
+	}
+
+	static void TestDrawPrimitivesBatching()
+	{
+		// More draw calls than RenderingSequence::SIZE_LIMIT, on a map spanning multiple tiles.
+		auto_ptr<CompiledScript> compiledScript = TestGetCompiledScript("\n\
+			var map = HeightMap.Flat(0); \n\
+			for (var i = 0; i < 1500; i++) { \n\
+				map.DrawLine([i % 150, 0], [(i * 7) % 150, 99], 0.5); \n\
+				map.FillRectangle([(i * 13) % 150, (i * 17) % 100], [(i * 13) % 150 + 3, (i * 17) % 100 + 2], -0.5); \n\
+			} \n\
+			yield map; \n\
+		");
+
+		ScriptParameters parameters = compiledScript->CreateScriptParameters();
+		parameters.SetRenderWidth(150);
+		parameters.SetRenderHeight(100);
+
+		VirtualMachine vm(*compiledScript, parameters);
+		vm.Run();
+
+		// The flat map, a single batch of all the primitives and the yield.
+		ASSERT_EQUALS(unsigned, 3, vm.GetRenderingSequence().Size());
+
+		Renderer renderer(vm.GetRenderingSequence());
+		renderer.CalculateMetadata();
+		renderer.Run();
+
+		// The batch must draw the same pixels as the primitives drawn one by one.
+		HeightMap expected(Rectangle(Point(0, 0), Size2D(150, 100)), 0);
+		for (int i = 0; i < 1500; i++)
+		{
+			expected.DrawLine(Point(i % 150, 0), Point((i * 7) % 150, 99), NumberToHeight(0.5));
+			expected.FillRectangle(Rectangle(Point((i * 13) % 150, (i * 17) % 100), Point((i * 13) % 150 + 3, (i * 17) % 100 + 2)), NumberToHeight(-0.5));
+		}
+
+		HeightMap* map = renderer.GetRenderedMapTable().GetItem(Renderer::MAP_NAME_MAIN);
+		for (Coordinate y = 0; y < 100; y++)
+		{
+			for (Coordinate x = 0; x < 150; x++)
+			{
+				ASSERT_EQUALS(Height, expected(x, y), (*map)(x, y));
+			}
+		}
+	}
+
+	static void TestDrawPrimitivesLongLines()
+	{
+		// Both diagonals of a map spanning many tiles, the only pixels they may touch are the diagonal ones.
+		HeightMap map(Rectangle(Point(-20, 10), Size2D(1000, 700)), 0);
+		std::vector<HeightMapPrimitive> primitives;
+		primitives.push_back(HeightMapPrimitive::CreateLine(Point(-20, 10), Point(679, 709), 1));
+		primitives.push_back(HeightMapPrimitive::CreateLine(Point(679, 10), Point(-20, 709), 2));
+		map.DrawPrimitives(primitives);
+
+		HeightMap const& constMap = map;
+		unsigned drawnCount = 0;
+		for (Coordinate y = 0; y < 700; y++)
+		{
+			ASSERT_EQUALS(Height, 1, constMap(y, y));
+			ASSERT_EQUALS(Height, 2, constMap(699 - y, y));
+
+			for (Coordinate x = 0; x < 1000; x++)
+			{
+				drawnCount += constMap(x, y) != 0 ? 1 : 0;
+			}
+		}
+
+		ASSERT_EQUALS(unsigned, 1400, drawnCount);
+
+		// Steep and shallow lines in both directions, partly outside of the map, must draw the same pixels as DrawLine.
+		primitives.push_back(HeightMapPrimitive::CreateLine(Point(-300, -50), Point(1100, 1000), 3));
+		primitives.push_back(HeightMapPrimitive::CreateLine(Point(950, 800), Point(100, -100), 4));
+		primitives.push_back(HeightMapPrimitive::CreateLine(Point(-100, 650), Point(1050, 30), 5));
+		primitives.push_back(HeightMapPrimitive::CreateLine(Point(400, 900), Point(437, -200), 6));
+		primitives.push_back(HeightMapPrimitive::CreateLine(Point(333, 333), Point(333, 333), 7));
+
+		HeightMap drawnMap(Rectangle(Point(-20, 10), Size2D(1000, 700)), 0);
+		drawnMap.DrawPrimitives(primitives);
+
+		HeightMap expected(Rectangle(Point(-20, 10), Size2D(1000, 700)), 0);
+		for (std::vector<HeightMapPrimitive>::const_iterator it = primitives.begin(); it != primitives.end(); it++)
+		{
+			expected.DrawLine(it->FirstPoint, it->SecondPoint, it->DrawHeight);
+		}
+
+		HeightMap const& constDrawnMap = drawnMap;
+		HeightMap const& constExpected = expected;
+		for (Coordinate y = 0; y < 700; y++)
+		{
+			for (Coordinate x = 0; x < 1000; x++)
+			{
+				ASSERT_EQUALS(Height, constExpected(x, y), constDrawnMap(x, y));
+			}
+		}
+	}
+
+	static void TestCopyOnWriteClone()
+	{
+		// Copies share the data until one of them is modified.
+		HeightMap original(Rectangle(Point(0, 0), Size2D(20, 10)), 100);
+		unsigned long long allocatedMemory = genlib::MemoryTracker::GetAllocatedMemory();
+		HeightMap copy(original);
+		ASSERT_EQUALS(unsigned long long, allocatedMemory, genlib::MemoryTracker::GetAllocatedMemory());
+		ASSERT_EQUALS(bool, true, original.IsShared() && copy.IsShared());
+
+		copy.Add(50);
+		ASSERT_EQUALS(bool, false, original.IsShared() || copy.IsShared());
+		ASSERT_EQUALS(Height, 100, original(5, 5));
+		ASSERT_EQUALS(Height, 150, copy(5, 5));
+
+		// Writing a single height through operator() copies the shared data too.
+		HeightMap writtenCopy(original);
+		writtenCopy(5, 5) = 200;
+		HeightMap const& constOriginal = original;
+		ASSERT_EQUALS(bool, false, original.IsShared() || writtenCopy.IsShared());
+		ASSERT_EQUALS(Height, 100, constOriginal(5, 5));
+		ASSERT_EQUALS(Height, 200, writtenCopy(5, 5));
+
+		auto_ptr<CompiledScript> compiledScript = TestGetCompiledScript("\n\
+			var base = HeightMap.Flat(0.5); \n\
+			yield HeightMap.Clone(base).Invert() as \"inverted\"; \n\
+			yield HeightMap.Clone(base).Add(0.25) as \"raised\"; \n\
+			yield base as \"base\"; \n\
+		");
+
+		ScriptParameters parameters = compiledScript->CreateScriptParameters();
+		parameters.SetRenderWidth(20);
+		parameters.SetRenderHeight(10);
+
+		VirtualMachine vm(*compiledScript, parameters);
+		vm.Run();
+
+		RendererMetrics metrics;
+		Renderer renderer(vm.GetRenderingSequence());
+		renderer.AddObserver(&metrics);
+		renderer.CalculateMetadata();
+		renderer.Run();
+
+		// Modifying the clones must not affect the original, and the lazily copied data must be covered by the predictions.
+		ASSERT_EQUALS(Height, NumberToHeight(-0.5), (*renderer.GetRenderedMapTable().GetItem(GG_STR("inverted")))(3, 3));
+		ASSERT_EQUALS(Height, NumberToHeight(0.5) + NumberToHeight(0.25), (*renderer.GetRenderedMapTable().GetItem(GG_STR("raised")))(3, 3));
+		ASSERT_EQUALS(Height, NumberToHeight(0.5), (*renderer.GetRenderedMapTable().GetItem(GG_STR("base")))(3, 3));
+		ASSERT_EQUALS(unsigned long long, 0, metrics.GetMispredictionCount());
+	}
+
+	static void TestZeroCopyYield()
+	{
+		auto_ptr<CompiledScript> compiledScript = TestGetCompiledScript("\n\
+			var a = HeightMap.Flat(0.5); \n\
+			yield a; \n\
+		");
+
+		ScriptParameters parameters = compiledScript->CreateScriptParameters();
+		parameters.SetRenderWidth(50);
+		parameters.SetRenderHeight(40);
+
+		VirtualMachine vm(*compiledScript, parameters);
+		vm.Run();
+
+		RendererMetrics metrics;
+		Renderer renderer(vm.GetRenderingSequence());
+		renderer.AddObserver(&metrics);
+		renderer.CalculateMetadata();
+		renderer.Run();
+
+		// The yielded object is released right after the yield, so its data is passed to the rendered map instead of being copied.
+		unsigned long long mapSize = genlib::HeightMap::GetMemorySize(Rectangle(Point(0, 0), Size2D(50, 40)), 1);
+		RendererStepMetrics const& yield = metrics.GetSteps()[1];
+		ASSERT_EQUALS(String, GG_STR("Yield"), yield.StepName);
+		ASSERT_EQUALS(unsigned long long, mapSize, yield.PredictedMemory);
+		ASSERT_EQUALS(unsigned long long, 50 * 40 * sizeof(Height), yield.PeakMemory);
+		ASSERT_EQUALS(bool, false, renderer.GetRenderedMapTable().GetItem(Renderer::MAP_NAME_MAIN)->IsShared());
+	}
+
+	static void TestTileGenerator()
+	{
+		auto_ptr<CompiledScript> compiledScript = TestGetCompiledScript("\n\
+			var heightMap = HeightMap.Noise().Add(HeightMap.RadialGradient([60, 50], 40, 1.0, 0.0)); \n\
+			yield heightMap; \n\
+		");
+
+		ScriptParameters parameters = compiledScript->CreateScriptParameters();
+		parameters.SetMapWidth(120);
+		parameters.SetMapHeight(100);
+		parameters.SetRandomSeed(7);
+
+		Rectangle region(Point(10, 5), Size2D(90, 70));
+
+		ScriptParameters fullParameters = parameters;
+		fullParameters.SetRenderRectangle(region);
+		VirtualMachine vm(*compiledScript, fullParameters);
+		vm.Run();
+
+		Renderer renderer(vm.GetRenderingSequence());
+		renderer.CalculateMetadata();
+		renderer.Run();
+
+		class ComparingTileHandler : public TileHandler
+		{
+		public:
+			genlib::HeightMap const* fullMap;
+			unsigned tileCount;
+			unsigned mismatchCount;
+
+			virtual void HandleTile(TileGenerator& generator, unsigned column, unsigned row, Rectangle tileRectangle, RenderedMapTable& renderedMaps)
+			{
+				genlib::HeightMap const* tileMap = renderedMaps.GetItem(Renderer::MAP_NAME_MAIN);
+				if (tileMap == NULL || tileMap->GetRectangle() != tileRectangle)
+				{
+					this->mismatchCount++;
+					return;
+				}
+
+				for (Coordinate y = 0; y < Coordinate(tileRectangle.GetSize().GetHeight()); y++)
+				{
+					for (Coordinate x = 0; x < Coordinate(tileRectangle.GetSize().GetWidth()); x++)
+					{
+						Coordinate fullX = tileRectangle.GetPosition().GetX() - this->fullMap->GetRectangle().GetPosition().GetX() + x;
+						Coordinate fullY = tileRectangle.GetPosition().GetY() - this->fullMap->GetRectangle().GetPosition().GetY() + y;
+						this->mismatchCount += (*tileMap)(x, y) != (*this->fullMap)(fullX, fullY) ? 1 : 0;
+					}
+				}
+
+				this->tileCount++;
+			}
+		};
+
+		ComparingTileHandler handler;
+		handler.fullMap = renderer.GetRenderedMapTable().GetItem(Renderer::MAP_NAME_MAIN);
+		handler.tileCount = 0;
+		handler.mismatchCount = 0;
+
+		// 3x3 tiles, the last column and row are cropped.
+		TileGenerator generator(*compiledScript, parameters, region, Size2D(32, 32));
+		generator.SetThreadCount(4);
+		ASSERT_EQUALS(unsigned, 9, generator.GetTileCount());
+		ASSERT_EQUALS(bool, true, generator.GetTileRectangle(2, 2) == Rectangle(Point(74, 69), Size2D(26, 6)));
+
+		ASSERT_EQUALS(bool, true, generator.Run(handler));
+		ASSERT_EQUALS(unsigned, 9, handler.tileCount);
+		ASSERT_EQUALS(unsigned, 9, generator.GetFinishedTileCount());
+		ASSERT_EQUALS(unsigned, 0, handler.mismatchCount);
+
+		// Memory limit lower than requirement of a single tile still renders tiles one by one.
+		generator.SetMemoryLimit(1);
+		handler.tileCount = 0;
+		ASSERT_EQUALS(bool, true, generator.Run(handler));
+		ASSERT_EQUALS(unsigned, 1, generator.GetConcurrentTileCount());
+		ASSERT_EQUALS(unsigned, 9, handler.tileCount);
+		ASSERT_EQUALS(unsigned, 0, handler.mismatchCount);
+	}
+
+	static void TestTileGeneratorRenderRectangleDependent()
+	{
+		// Every tile runs its own virtual machine, all of them executing the member accesses of the same compiled script at once.
+		auto_ptr<CompiledScript> compiledScript = TestGetCompiledScript("\n\
+			var sum = 0; \n\
+			for (var i = 0; i < 200; i++) { sum = sum + Parameters.RenderOriginX + Parameters.RenderScale; } \n\
+			yield HeightMap.Flat(sum / 200000); \n\
+		");
+
+		ScriptParameters parameters = compiledScript->CreateScriptParameters();
+		parameters.SetMapWidth(160);
+		parameters.SetMapHeight(40);
+
+		class ReferenceTileHandler : public TileHandler
+		{
+		public:
+			CompiledScript const* compiledScript;
+			ScriptParameters parameters;
+			unsigned tileCount;
+			unsigned mismatchCount;
+
+			virtual void HandleTile(TileGenerator& generator, unsigned column, unsigned row, Rectangle tileRectangle, RenderedMapTable& renderedMaps)
+			{
+				ScriptParameters tileParameters = this->parameters;
+				tileParameters.SetRenderRectangle(tileRectangle);
+				VirtualMachine vm(*this->compiledScript, tileParameters);
+				vm.Run();
+
+				Renderer renderer(vm.GetRenderingSequence());
+				renderer.CalculateMetadata();
+				renderer.Run();
+
+				genlib::HeightMap const* referenceMap = renderer.GetRenderedMapTable().GetItem(Renderer::MAP_NAME_MAIN);
+				genlib::HeightMap const* tileMap = renderedMaps.GetItem(Renderer::MAP_NAME_MAIN);
+				if (tileMap == NULL || tileMap->GetRectangle() != referenceMap->GetRectangle())
+				{
+					this->mismatchCount++;
+					return;
+				}
+
+				for (Coordinate y = 0; y < Coordinate(tileRectangle.GetSize().GetHeight()); y++)
+				{
+					for (Coordinate x = 0; x < Coordinate(tileRectangle.GetSize().GetWidth()); x++)
+					{
+						this->mismatchCount += (*tileMap)(x, y) != (*referenceMap)(x, y) ? 1 : 0;
+					}
+				}
+
+				this->tileCount++;
+			}
+		};
+
+		ReferenceTileHandler handler;
+		handler.compiledScript = compiledScript.get();
+		handler.parameters = parameters;
+		handler.tileCount = 0;
+		handler.mismatchCount = 0;
+
+		TileGenerator generator(*compiledScript, parameters, Rectangle(Point(0, 0), Size2D(160, 40)), Size2D(20, 20));
+		generator.SetThreadCount(4);
+
+		ASSERT_EQUALS(bool, true, generator.Run(handler));
+		ASSERT_EQUALS(unsigned, 4, generator.GetConcurrentTileCount());
+		ASSERT_EQUALS(unsigned, 16, handler.tileCount);
+		ASSERT_EQUALS(unsigned, 0, handler.mismatchCount);
+	}
+
+	static void TestTileGeneratorError()
+	{
+		// Only the first tile succeeds, the others fail on the worker threads.
+		auto_ptr<CompiledScript> compiledScript = TestGetCompiledScript("\n\
+			var a = Parameters.RenderOriginX * 1000000000000000000000000000000000000000 * 1000000000000000000000000000000000000000 * 1000000000000000000000000000000000000000 * 1000000000000000000000000000000000000000 * 1000000000000000000000000000000000000000 * 1000000000000000000000000000000000000000 * 1000000000000000000000000000000000000000 * 1000000000000000000000000000000000000000; \n\
+			yield HeightMap.Flat(0.5); \n\
+		");
+
+		ScriptParameters parameters = compiledScript->CreateScriptParameters();
+
+		class EmptyTileHandler : public TileHandler
+		{
+		public:
+			virtual void HandleTile(TileGenerator& generator, unsigned column, unsigned row, Rectangle tileRectangle, RenderedMapTable& renderedMaps) {}
+		};
+
+		EmptyTileHandler handler;
+		TileGenerator generator(*compiledScript, parameters, Rectangle(Point(0, 0), Size2D(80, 20)), Size2D(20, 20));
+		generator.SetThreadCount(4);
+
+		try
+		{
+			generator.Run(handler);
+		}
+		catch (NumberOverflowException&)
+		{
+			ASSERT_EQUALS(unsigned, 1, generator.GetFinishedTileCount());
+			return;
+		}
+
+		throw NoExceptionException(AnyStringToString("NumberOverflowException"));
+	}
+
+	static void TestTileGeneratorMapEdge()
+	{
+		// The same finite map once with a rendering sequence shared by all tiles and once with a virtual machine for each tile.
+		const char* scripts[] = {
+			"metadata { Width: { Max: 1000 }, Height: { Max: 1000 } } \n\
+			yield HeightMap.Noise().Add(HeightMap.RadialGradient([80, 60], 30, 1.0, 0.0)); \n",
+			"metadata { Width: { Max: 1000 }, Height: { Max: 1000 } } \n\
+			var originX = Parameters.RenderOriginX; \n\
+			yield HeightMap.Noise().Add(HeightMap.RadialGradient([80, 60], 30, 1.0, 0.0)); \n"
+		};
+
+		class ComparingTileHandler : public TileHandler
+		{
+		public:
+			genlib::HeightMap const* fullMap;
+			unsigned tileCount;
+			unsigned mismatchCount;
+
+			virtual void HandleTile(TileGenerator& generator, unsigned column, unsigned row, Rectangle tileRectangle, RenderedMapTable& renderedMaps)
+			{
+				genlib::HeightMap const* tileMap = renderedMaps.GetItem(Renderer::MAP_NAME_MAIN);
+				if (tileMap == NULL || tileMap->GetRectangle() != tileRectangle || tileRectangle != generator.GetTileRectangle(column, row))
+				{
+					this->mismatchCount++;
+					return;
+				}
+
+				for (Coordinate y = 0; y < Coordinate(tileRectangle.GetSize().GetHeight()); y++)
+				{
+					for (Coordinate x = 0; x < Coordinate(tileRectangle.GetSize().GetWidth()); x++)
+					{
+						Coordinate fullX = tileRectangle.GetPosition().GetX() - this->fullMap->GetRectangle().GetPosition().GetX() + x;
+						Coordinate fullY = tileRectangle.GetPosition().GetY() - this->fullMap->GetRectangle().GetPosition().GetY() + y;
+						this->mismatchCount += (*tileMap)(x, y) != (*this->fullMap)(fullX, fullY) ? 1 : 0;
+					}
+				}
+
+				this->tileCount++;
+			}
+		};
+
+		for (unsigned i = 0; i < 2; i++)
+		{
+			auto_ptr<CompiledScript> compiledScript = TestGetCompiledScript(scripts[i]);
+
+			ScriptParameters parameters = compiledScript->CreateScriptParameters();
+			parameters.SetMapWidth(100);
+			parameters.SetMapHeight(80);
+			parameters.SetRandomSeed(3);
+
+			// The region extends past the right and bottom edges of the map.
+			Rectangle region(Point(60, 50), Size2D(80, 60));
+
+			ScriptParameters fullParameters = parameters;
+			fullParameters.SetRenderRectangle(region);
+			VirtualMachine vm(*compiledScript, fullParameters);
+			vm.Run();
+			ASSERT_EQUALS(bool, i == 1, vm.GetRenderingSequence().IsRenderRectangleDependent());
+
+			Renderer renderer(vm.GetRenderingSequence());
+			renderer.CalculateMetadata();
+			renderer.Run();
+
+			ComparingTileHandler handler;
+			handler.fullMap = renderer.GetRenderedMapTable().GetItem(Renderer::MAP_NAME_MAIN);
+			handler.tileCount = 0;
+			handler.mismatchCount = 0;
+			ASSERT_EQUALS(bool, true, handler.fullMap->GetRectangle() == Rectangle(Point(60, 50), Size2D(40, 30)));
+
+			// The region is limited to the map, so it is cut into 3x2 tiles.
+			TileGenerator generator(*compiledScript, parameters, region, Size2D(16, 16));
+			generator.SetThreadCount(4);
+			ASSERT_EQUALS(unsigned, 6, generator.GetTileCount());
+
+			ASSERT_EQUALS(bool, true, generator.Run(handler));
+			ASSERT_EQUALS(unsigned, 6, handler.tileCount);
+			ASSERT_EQUALS(unsigned, 0, handler.mismatchCount);
+		}
+	}
+
+	static void TestCancellation()
+	{
+		auto_ptr<CompiledScript> compiledScript = TestGetCompiledScript("\n\
+			var a = HeightMap.Flat(0.5); \n\
+			var b = HeightMap.Noise(); \n\
+			yield a.Add(b); \n\
+		");
+
+		ScriptParameters parameters = compiledScript->CreateScriptParameters();
+		parameters.SetRenderWidth(200);
+		parameters.SetRenderHeight(200);
+
+		VirtualMachine vm(*compiledScript, parameters);
+		vm.Run();
+
+		// Cancellation before a step leaves the renderer ready to continue.
+		CancellationToken token;
+		Renderer renderer(vm.GetRenderingSequence());
+		renderer.SetCancellationToken(&token);
+		renderer.CalculateMetadata();
+		renderer.Step();
+
+		token.SetDeadline(1);
+
+		try
+		{
+			renderer.Step();
+			throw NoExceptionException(AnyStringToString("CancellationException"));
+		}
+		catch (CancellationException& e)
+		{
+			ASSERT_EQUALS(bool, true, e.IsDeadlineExceeded());
+		}
+
+		ASSERT_EQUALS(unsigned, 1, renderer.GetStepCounter());
+		ASSERT_EQUALS(RendererStatus, RENDERER_STATUS_READY, renderer.GetStatus());
+
+		token.Reset();
+		renderer.Run();
+		ASSERT_EQUALS(bool, true, renderer.GetRenderedMapTable().ContainsItem(Renderer::MAP_NAME_MAIN));
+
+		// Cancellation while the noise is being generated interrupts the step and releases all maps.
+		class CancellingObserver : public RendererObserver
+		{
+		public:
+			CancellationToken* token;
+
+			virtual void BeforeStep(Renderer& renderer, RenderingStep const* step)
+			{
+				if (renderer.GetStepCounter() == 1)
+				{
+					this->token->Cancel();
+				}
+			}
+		};
+
+		CancellingObserver observer;
+		observer.token = &token;
+
+		Renderer interruptedRenderer(vm.GetRenderingSequence());
+		interruptedRenderer.SetCancellationToken(&token);
+		interruptedRenderer.AddObserver(&observer);
+		interruptedRenderer.CalculateMetadata();
+
+		try
+		{
+			interruptedRenderer.Run();
+			throw NoExceptionException(AnyStringToString("CancellationException"));
+		}
+		catch (CancellationException& e)
+		{
+			ASSERT_EQUALS(bool, false, e.IsDeadlineExceeded());
+		}
+
+		ASSERT_EQUALS(unsigned, 1, interruptedRenderer.GetStepCounter());
+		ASSERT_EQUALS(RendererStatus, RENDERER_STATUS_FAULTED, interruptedRenderer.GetStatus());
+		ASSERT_EQUALS(unsigned long long, 0, interruptedRenderer.GetObjectTable().GetMemorySize());
+	}
+
+	static void TestMaskedCombine()
+	{
+		// Width which is not a multiple of any vector size, so every code path of the span kernels is used.
+		auto_ptr<CompiledScript> compiledScript = TestGetCompiledScript("\n\
+			var a = HeightMap.Gradient([0, 0], [91, 0], -1, 1); \n\
+			var b = HeightMap.RadialGradient([45, 18], 30, 1, -1); \n\
+			var mask = HeightMap.Gradient([0, 0], [0, 37], -0.5, 1); \n\
+			yield a as \"a\"; \n\
+			yield b as \"b\"; \n\
+			yield mask as \"mask\"; \n\
+			yield HeightMap.Clone(a).Add(b) as \"add\"; \n\
+			yield HeightMap.Clone(a).Add(b, mask) as \"addMasked\"; \n\
+			yield HeightMap.Clone(a).Add(0.75, mask) as \"addMaskedNumber\"; \n\
+			yield HeightMap.Clone(a).Multiply(b) as \"multiply\"; \n\
+			yield HeightMap.Clone(a).Unify(b) as \"unify\"; \n\
+			yield HeightMap.Clone(a).Intersect(b) as \"intersect\"; \n\
+			yield HeightMap.Clone(a).Combine(b, mask) as \"combine\"; \n\
+		");
+
+		ScriptParameters parameters = compiledScript->CreateScriptParameters();
+		parameters.SetRenderWidth(91);
+		parameters.SetRenderHeight(37);
+
+		VirtualMachine vm(*compiledScript, parameters);
+		vm.Run();
+
+		Renderer renderer(vm.GetRenderingSequence());
+		renderer.CalculateMetadata();
+		renderer.Run();
+
+		RenderedMapTable& maps = renderer.GetRenderedMapTable();
+		HeightMap* a = maps.GetItem(GG_STR("a"));
+		HeightMap* b = maps.GetItem(GG_STR("b"));
+		HeightMap* mask = maps.GetItem(GG_STR("mask"));
+		Height addend = Height(0.75 * HEIGHT_MAX);
+
+		for (Coordinate y = 0; y < 37; y++)
+		{
+			for (Coordinate x = 0; x < 91; x++)
+			{
+				int heightA = (*a)(x, y);
+				int heightB = (*b)(x, y);
+				Height factor = max((*mask)(x, y), Height(0));
+
+				ASSERT_EQUALS(Height, Height(min(max(heightA + heightB, int(HEIGHT_MIN)), int(HEIGHT_MAX))), (*maps.GetItem(GG_STR("add")))(x, y));
+				ASSERT_EQUALS(Height, Height(min(max(heightA + HeightSpanKernels::ScaleHeight(heightB, factor), int(HEIGHT_MIN)), int(HEIGHT_MAX))), (*maps.GetItem(GG_STR("addMasked")))(x, y));
+				ASSERT_EQUALS(Height, Height(min(max(heightA + HeightSpanKernels::ScaleHeight(addend, factor), int(HEIGHT_MIN)), int(HEIGHT_MAX))), (*maps.GetItem(GG_STR("addMaskedNumber")))(x, y));
+				ASSERT_EQUALS(Height, HeightSpanKernels::ScaleHeight(heightA, heightB), (*maps.GetItem(GG_STR("multiply")))(x, y));
+				ASSERT_EQUALS(Height, Height(max(heightA, heightB)), (*maps.GetItem(GG_STR("unify")))(x, y));
+				ASSERT_EQUALS(Height, Height(min(heightA, heightB)), (*maps.GetItem(GG_STR("intersect")))(x, y));
+				ASSERT_EQUALS(Height, Height(HeightSpanKernels::ScaleHeight(heightA, factor) + HeightSpanKernels::ScaleHeight(heightB, HEIGHT_MAX - factor)), (*maps.GetItem(GG_STR("combine")))(x, y));
+			}
+		}
+
+		// The multiplication rounds towards zero.
+		ASSERT_EQUALS(Height, 0, HeightSpanKernels::ScaleHeight(1, HEIGHT_MAX - 1));
+		ASSERT_EQUALS(Height, -100, HeightSpanKernels::ScaleHeight(-100, HEIGHT_MAX));
+		ASSERT_EQUALS(Height, -1, HeightSpanKernels::ScaleHeight(-2, HEIGHT_MAX / 2 + 1));
+	}
+
+	static HeightMap* CreatePatternMap(Rectangle rectangle, int seed)
+	{
+		HeightMap* map = new HeightMap(rectangle);
+		for (Coordinate y = 0; y < Coordinate(rectangle.GetSize().GetHeight()); y++)
+		{
+			for (Coordinate x = 0; x < Coordinate(rectangle.GetSize().GetWidth()); x++)
+			{
+				(*map)(x, y) = Height(((x * 7919 + y * 104729 + seed * 1299709) % 65535) - HEIGHT_MAX);
+			}
+		}
+
+		return map;
+	}
+
+	// Height of a map at a logical point, or @a outside if the map doesn't cover the point.
+	static int GetHeightAt(HeightMap const* map, Coordinate x, Coordinate y, int outside)
+	{
+		if (!map->GetRectangle().Contains(Point(x, y)))
+		{
+			return outside;
+		}
+
+		return (*map)(x - map->GetRectangle().GetPosition().GetX(), y - map->GetRectangle().GetPosition().GetY());
+	}
+
+	static int ClampHeight(int height)
+	{
+		return min(max(height, int(HEIGHT_MIN)), int(HEIGHT_MAX));
+	}
+
+	static void TestMaskedCombineOffset()
+	{
+		// The other maps are offset from the target and cover it only partly, so the row pointers of each map start at a different place.
+		Rectangle targetRect(Point(-7, 4), Size2D(91, 37));
+		auto_ptr<HeightMap> target(CreatePatternMap(targetRect, 1));
+		auto_ptr<HeightMap> other(CreatePatternMap(Rectangle(Point(13, -5), Size2D(61, 30)), 2));
+		auto_ptr<HeightMap> mask(CreatePatternMap(Rectangle(Point(5, -2), Size2D(83, 36)), 3));
+		auto_ptr<HeightMap> largeMask(CreatePatternMap(Rectangle(Point(-10, 0), Size2D(100, 45)), 4));
+		Height addend = Height(0.75 * HEIGHT_MAX);
+
+		HeightMap add(*target);
+		add.AddMap(other.get());
+		HeightMap addMasked(*target);
+		addMasked.AddMapMasked(other.get(), mask.get());
+		HeightMap addMaskedNumber(*target);
+		addMaskedNumber.AddMasked(addend, largeMask.get());
+		HeightMap multiply(*target);
+		multiply.MultiplyMap(other.get());
+		HeightMap unify(*target);
+		unify.Unify(other.get());
+		HeightMap intersect(*target);
+		intersect.Intersect(other.get());
+		HeightMap combine(*target);
+		combine.Combine(other.get(), mask.get());
+
+		for (Coordinate y = targetRect.GetPosition().GetY(); y < targetRect.GetEndingPoint().GetY(); y++)
+		{
+			for (Coordinate x = targetRect.GetPosition().GetX(); x < targetRect.GetEndingPoint().GetX(); x++)
+			{
+				int heightA = GetHeightAt(target.get(), x, y, 0);
+				bool isOtherCovered = other->GetRectangle().Contains(Point(x, y));
+				bool isMaskCovered = isOtherCovered && mask->GetRectangle().Contains(Point(x, y));
+				int heightB = GetHeightAt(other.get(), x, y, 0);
+				int factor = max(GetHeightAt(mask.get(), x, y, 0), 0);
+				int largeFactor = max(GetHeightAt(largeMask.get(), x, y, 0), 0);
+
+				// Integer division rounds towards zero, same as the span kernels.
+				ASSERT_EQUALS(int, isOtherCovered ? ClampHeight(heightA + heightB) : heightA, GetHeightAt(&add, x, y, 0));
+				ASSERT_EQUALS(int, isOtherCovered ? ClampHeight(heightA + heightB * factor / HEIGHT_MAX) : heightA, GetHeightAt(&addMasked, x, y, 0));
+				ASSERT_EQUALS(int, ClampHeight(heightA + addend * largeFactor / HEIGHT_MAX), GetHeightAt(&addMaskedNumber, x, y, 0));
+				ASSERT_EQUALS(int, isOtherCovered ? ClampHeight(heightA * heightB / HEIGHT_MAX) : heightA, GetHeightAt(&multiply, x, y, 0));
+				ASSERT_EQUALS(int, isOtherCovered ? max(heightA, heightB) : heightA, GetHeightAt(&unify, x, y, 0));
+				ASSERT_EQUALS(int, isOtherCovered ? min(heightA, heightB) : heightA, GetHeightAt(&intersect, x, y, 0));
+				ASSERT_EQUALS(int, isMaskCovered ? heightA * factor / HEIGHT_MAX + heightB * (HEIGHT_MAX - factor) / HEIGHT_MAX : heightA, GetHeightAt(&combine, x, y, 0));
+			}
+		}
+	}
+
 	static void TestNoise()
 	{
 		auto_ptr<CompiledScript> compiledScript = TestGetCompiledScript("\n\
@@ -216,6 +1435,30 @@ public:
 		ADD_TESTCASE(TestSimpleTiling);
 		ADD_TESTCASE(TestTilingWithScaling);
 		ADD_TESTCASE(TestBlur);
+		ADD_TESTCASE(TestRenderingSequenceReuse);
+		ADD_TESTCASE(TestRenderRectangleDependentSequence);
+		ADD_TESTCASE(TestDistanceMap);
+		ADD_TESTCASE(TestGradients);
+		ADD_TESTCASE(TestRotate);
+		ADD_TESTCASE(TestRescaleFilters);
+		ADD_TESTCASE(TestProgressiveRendering);
+		ADD_TESTCASE(TestMaskedCombine);
+		ADD_TESTCASE(TestMaskedCombineOffset);
+		ADD_TESTCASE(TestFusedNoiseLayers);
+		ADD_TESTCASE(TestSimplexNoiseTiling);
+		ADD_TESTCASE(TestRendererMetrics);
+		ADD_TESTCASE(TestMemoryTracking);
+		ADD_TESTCASE(TestMemoryTrackingPerRenderer);
+		ADD_TESTCASE(TestRenderingStepIndexes);
+		ADD_TESTCASE(TestDrawPrimitivesBatching);
+		ADD_TESTCASE(TestDrawPrimitivesLongLines);
+		ADD_TESTCASE(TestCopyOnWriteClone);
+		ADD_TESTCASE(TestZeroCopyYield);
+		ADD_TESTCASE(TestTileGenerator);
+		ADD_TESTCASE(TestTileGeneratorRenderRectangleDependent);
+		ADD_TESTCASE(TestTileGeneratorError);
+		ADD_TESTCASE(TestTileGeneratorMapEdge);
+		ADD_TESTCASE(TestCancellation);
 		//ADD_TESTCASE(TestNoise);
 	}
 };
\ No newline at end of file
@@ -32,6 +32,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>. */
 #include "RendererTests.hpp"
 #include "MetadataTests.hpp"
 #include "RandomTests.hpp"
+#include "OptimizerTests.hpp"
 
 using namespace std;
 
@@ -55,6 +56,7 @@ int main()
 	RUN_FIXTURE(CoordinateTests);
 	RUN_FIXTURE(RendererTests);
 	RUN_FIXTURE(RandomTests);
+	RUN_FIXTURE(OptimizerTests);
 
 	cout << "================================================================" << endl << "Finished! " << numberOfFailures << " tests failed, " << numberOfPassed << " tests passed.";
 
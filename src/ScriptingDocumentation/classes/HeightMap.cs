@@ -208,6 +208,35 @@ public:
     /// @return The height map.
     static HeightMap RidgedNoise(Array layerDefinitions, Number seed);
 
+    /// Creates a height map filled with random simplex noise.
+    /// 
+    /// See HeightMap.Noise for detailed description of the @a layerDefinitions. Simplex noise has no visible grid artifacts and contains very little detail shorter than the wave length of each layer, so it needs fewer layers than HeightMap.Noise to achieve a similar look and is therefore faster to render. Layers with wave length shorter than 4 are not useful.
+    /// 
+    /// Simple usage:
+    /// @code{.cs}
+    /// yield HeightMap.SimplexNoise();
+    /// @endcode
+    /// 
+    /// The default value for @a layerDefinitions parameter is:
+    /// @code{.cs}
+    /// {
+    ///     {4: 0.0078125}, 
+    ///     {8: 0.015625}, 
+    ///     {16: 0.03125}, 
+    ///     {32: 0.0625},
+    ///     {64: 0.125},
+    ///     {128: 0.25},
+    ///     {256: 0.5}
+    /// }
+    /// @endcode
+    /// 
+    /// @see [Simplex noise on Wikipedia](https://en.wikipedia.org/wiki/Simplex_noise)
+    /// 
+    /// @param layerDefinitions (Optional) Array defining layers of the noise. If not provided, a default array is used. This array can be created using CreateNoiseLayers.
+    /// @param seed (Optional) Random seed. If not provided, 0 is used. This seed is always combined with the main script seed provided in script arguments to the script.
+    /// @return The height map.
+    static HeightMap SimplexNoise(Array layerDefinitions, Number seed);
+
 
     /// Replaces height in each pixel with its absolute value (makes negative heights positive).
     /// 
@@ -511,7 +540,7 @@ public:
 	HeightMap Multiply(Number/HeightMap factor);
 
     /// Enlarges (with scale &gt; 1) or shrinks (with scale &lt; 1) the entire map. The scaling
-    /// transformation has origin at [0, 0]. Uses linear interpolation.
+    /// transformation has origin at [0, 0]. Uses linear interpolation unless a different @a filter is specified.
     /// 
     /// Example:
     /// @code{.cs}
@@ -539,8 +568,9 @@ public:
     ///        
     /// @param horizontalScale The horizontal scale ratio. Must be greater than 0.1 and less than 10.
     /// @param verticalScale (Optional) The vertical scale ratio. If not provided, it will be the same as @a horizontalScale. Must be greater than 0.1 and less than 10.
+    /// @param filter (Optional) The RescaleFilter used to calculate the new heights. RescaleFilter.Bilinear if not provided. RescaleFilter.Box gives the smoothest results when shrinking.
     /// @return The height map itself (for call chaining).
-    HeightMap Rescale(Number horizontalScale, Number verticalScale);
+    HeightMap Rescale(Number horizontalScale, Number verticalScale, RescaleFilter filter);
 
     /// Rotates the height map by @a angle in radians clockwise. The rotation origin is at [0, 0].
     /// 
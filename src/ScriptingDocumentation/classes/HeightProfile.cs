@@ -362,11 +362,12 @@ public:
 	HeightProfile Multiply(Number/HeightProfile factor);
 
     /// Enlarges (with scale &gt; 1) or shrinks (with scale &lt; 1) the entire profile. The scaling
-    /// transformation has origin at coordiante 0. Uses linear interpolation.
+    /// transformation has origin at coordiante 0. Uses linear interpolation unless a different @a filter is specified.
     /// 
     /// @param scale The scale ratio. Must be greater than 0.1 and less than 10.
+    /// @param filter (Optional) The RescaleFilter used to calculate the new heights. RescaleFilter.Bilinear if not provided.
     /// @return The height profile itself (for call chaining).
-    HeightMap Rescale(Number scale);
+    HeightMap Rescale(Number scale, RescaleFilter filter);
 
     /// Sets each pixel in the to the greater of the two corresponding heights in the current profile and the other profile.
     /// 
@@ -0,0 +1,17 @@
+/// @link enum_types Enum type@endlink specifying the filter used by HeightMap.Rescale and HeightProfile.Rescale.
+class RescaleFilter
+{
+private:
+public:
+    /// Nearest neighbor, numeric value 0. Fastest, produces blocky results when enlarging.
+    static RescaleFilter Nearest { get; set; }
+    
+    /// Linear interpolation between the two nearest pixels, numeric value 1. The default filter.
+    static RescaleFilter Bilinear { get; set; }
+    
+    /// Average of all pixels covered by each new pixel, numeric value 2. Avoids aliasing when shrinking, same as Bilinear when enlarging.
+    static RescaleFilter Box { get; set; }
+    
+    /// Cubic interpolation between the four nearest pixels, numeric value 3. Smoothest results when enlarging.
+    static RescaleFilter Bicubic { get; set; }
+};
\ No newline at end of file